@@ -67,6 +67,7 @@
 #include <memory>
 #include <mutex>
 #include <stack>
+#include <type_traits>
 #include <unordered_set>
 using namespace nvinfer1;
 using namespace nvinfer1::plugin;
@@ -83,6 +84,168 @@ extern ILogger* gLogger;
 
 namespace
 {
+//! Holds the plugin creator a LazyPluginCreator stands for, constructed the first time it is needed.
+template <typename CreatorType>
+class LazyCreatorInstance
+{
+public:
+    LazyCreatorInstance(char const* name, char const* version)
+        : mName(name)
+        , mVersion(version)
+    {
+    }
+
+    //! Return the plugin creator, constructing it on the first call, or nullptr if it could not be constructed.
+    CreatorType* get() noexcept
+    {
+        try
+        {
+            std::call_once(mCreated, [this]() {
+                auto creator = std::make_unique<CreatorType>();
+                PLUGIN_VALIDATE(mName == creator->getPluginName() && mVersion == creator->getPluginVersion(),
+                    "Plugin creator registered lazily under another name or version.");
+                std::lock_guard<std::mutex> lock(mNamespaceLock);
+                creator->setPluginNamespace(mNamespace.c_str());
+                gLogVerbose << "Constructed plugin creator - " << mNamespace << "::" << mName << " version " << mVersion
+                            << std::endl;
+                mCreator = std::move(creator);
+            });
+            return mCreator.get();
+        }
+        catch (std::exception const& e)
+        {
+            caughtError(e);
+        }
+        return nullptr;
+    }
+
+    //! Set the namespace of the plugin, on the creator too if it is already constructed.
+    void setNamespace(char const* libNamespace) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mNamespaceLock);
+        mNamespace = libNamespace;
+        if (mCreator)
+        {
+            mCreator->setPluginNamespace(libNamespace);
+        }
+    }
+
+    char const* getNamespace() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(mNamespaceLock);
+        return mNamespace.c_str();
+    }
+
+    std::string const mName;
+    std::string const mVersion;
+
+private:
+    std::once_flag mCreated;
+    //! Guards mNamespace and mCreator between setNamespace() and the construction of the creator in get().
+    mutable std::mutex mNamespaceLock;
+    std::string mNamespace;
+    std::unique_ptr<CreatorType> mCreator;
+};
+
+// Stands for a plugin creator in the registry. It only knows the name, version and namespace of the plugin, and
+// constructs the creator, with its plugin field collection, when a plugin is created or deserialized with it. This
+// way initLibNvInferPlugins() does not construct the creators of all the plugins of the library.
+template <typename CreatorType, bool kIS_V3 = std::is_base_of<IPluginCreatorV3One, CreatorType>::value>
+class LazyPluginCreator : public IPluginCreator
+{
+public:
+    LazyPluginCreator(char const* name, char const* version)
+        : mInstance(name, version)
+    {
+    }
+
+    char const* getPluginName() const noexcept override
+    {
+        return mInstance.mName.c_str();
+    }
+
+    char const* getPluginVersion() const noexcept override
+    {
+        return mInstance.mVersion.c_str();
+    }
+
+    PluginFieldCollection const* getFieldNames() noexcept override
+    {
+        auto* creator = mInstance.get();
+        return creator == nullptr ? nullptr : creator->getFieldNames();
+    }
+
+    IPluginV2* createPlugin(char const* name, PluginFieldCollection const* fc) noexcept override
+    {
+        auto* creator = mInstance.get();
+        return creator == nullptr ? nullptr : creator->createPlugin(name, fc);
+    }
+
+    IPluginV2* deserializePlugin(char const* name, void const* serialData, size_t serialLength) noexcept override
+    {
+        auto* creator = mInstance.get();
+        return creator == nullptr ? nullptr : creator->deserializePlugin(name, serialData, serialLength);
+    }
+
+    void setPluginNamespace(char const* libNamespace) noexcept override
+    {
+        mInstance.setNamespace(libNamespace);
+    }
+
+    char const* getPluginNamespace() const noexcept override
+    {
+        return mInstance.getNamespace();
+    }
+
+private:
+    LazyCreatorInstance<CreatorType> mInstance;
+};
+
+template <typename CreatorType>
+class LazyPluginCreator<CreatorType, true> : public IPluginCreatorV3One
+{
+public:
+    LazyPluginCreator(char const* name, char const* version)
+        : mInstance(name, version)
+    {
+    }
+
+    char const* getPluginName() const noexcept override
+    {
+        return mInstance.mName.c_str();
+    }
+
+    char const* getPluginVersion() const noexcept override
+    {
+        return mInstance.mVersion.c_str();
+    }
+
+    PluginFieldCollection const* getFieldNames() noexcept override
+    {
+        auto* creator = mInstance.get();
+        return creator == nullptr ? nullptr : creator->getFieldNames();
+    }
+
+    IPluginV3* createPlugin(char const* name, PluginFieldCollection const* fc, TensorRTPhase phase) noexcept override
+    {
+        auto* creator = mInstance.get();
+        return creator == nullptr ? nullptr : creator->createPlugin(name, fc, phase);
+    }
+
+    void setPluginNamespace(char const* libNamespace) noexcept
+    {
+        mInstance.setNamespace(libNamespace);
+    }
+
+    char const* getPluginNamespace() const noexcept override
+    {
+        return mInstance.getNamespace();
+    }
+
+private:
+    LazyCreatorInstance<CreatorType> mInstance;
+};
+
 // This singleton ensures that each plugin is only registered once for a given
 // namespace and type, and attempts of duplicate registration are ignored.
 class PluginCreatorRegistry
@@ -95,7 +258,7 @@ public:
     }
 
     template <typename CreatorType>
-    void addPluginCreator(void* logger, char const* libNamespace)
+    void addPluginCreator(void* logger, char const* libNamespace, char const* name, char const* version)
     {
         // Make accesses to the plugin creator registry thread safe
         std::lock_guard<std::mutex> lock(mRegistryLock);
@@ -103,7 +266,7 @@ public:
         std::string errorMsg;
         std::string verboseMsg;
 
-        std::unique_ptr<CreatorType> pluginCreator{new CreatorType{}};
+        auto pluginCreator = std::make_unique<LazyPluginCreator<CreatorType>>(name, version);
         pluginCreator->setPluginNamespace(libNamespace);
 
         nvinfer1::plugin::gLogger = static_cast<nvinfer1::ILogger*>(logger);
@@ -167,10 +330,12 @@ public:
     void operator=(PluginCreatorRegistry const&) = delete;
 };
 
+//! Register the creator of a plugin, which is only constructed on first use. The name and version must be the
+//! constants the creator returns them from, declared next to it in its header.
 template <typename CreatorType>
-void initializePlugin(void* logger, char const* libNamespace)
+void initializePlugin(void* logger, char const* libNamespace, char const* name, char const* version)
 {
-    PluginCreatorRegistry::getInstance().addPluginCreator<CreatorType>(logger, libNamespace);
+    PluginCreatorRegistry::getInstance().addPluginCreator<CreatorType>(logger, libNamespace, name, version);
 }
 
 } // namespace
@@ -180,56 +345,111 @@ extern "C"
 {
     bool initLibNvInferPlugins(void* logger, char const* libNamespace)
     {
-        initializePlugin<nvinfer1::plugin::ROIAlignV3PluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::CropAndResizeDynamicPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::InstanceNormalizationV3PluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ScatterElementsPluginV3Creator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::MultiscaleDeformableAttnPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ModulatedDeformableConvPluginDynamicCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::BatchedNMSDynamicPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::BatchedNMSPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::BatchTilePluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ClipPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::CoordConvACPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::CropAndResizeDynamicPluginLegacyCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::CropAndResizePluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::DecodeBbox3DPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::DetectionLayerPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::EfficientNMSExplicitTFTRTPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::EfficientNMSImplicitTFTRTPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::EfficientNMSONNXPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::EfficientNMSPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::FlattenConcatPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::GenerateDetectionPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::GridAnchorPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::GridAnchorRectPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::InstanceNormalizationPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::InstanceNormalizationPluginCreatorV2>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::LReluPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ModulatedDeformableConvPluginDynamicLegacyCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::MultilevelCropAndResizePluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::MultilevelProposeROIPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::MultiscaleDeformableAttnPluginCreatorLegacy>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::NMSDynamicPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::NMSPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::NormalizePluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::PillarScatterPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::PriorBoxPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ProposalDynamicPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ProposalLayerPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ProposalPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::PyramidROIAlignPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::RegionPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ReorgDynamicPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ReorgStaticPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ResizeNearestPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ROIAlignPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::RPROIPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ScatterElementsPluginV2Creator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::ScatterNDPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::SpecialSlicePluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::SplitPluginCreator>(logger, libNamespace);
-        initializePlugin<nvinfer1::plugin::VoxelGeneratorPluginCreator>(logger, libNamespace);
+        initializePlugin<nvinfer1::plugin::ROIAlignV3PluginCreator>(
+            logger, libNamespace, kROIALIGN_PLUGIN_NAME, kROIALIGN_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::CropAndResizeDynamicPluginCreator>(
+            logger, libNamespace, kCROP_AND_RESIZE_DYNAMIC_PLUGIN_NAME, kCROP_AND_RESIZE_DYNAMIC_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::InstanceNormalizationV3PluginCreator>(
+            logger, libNamespace, kINSTANCE_NORM_PLUGIN_NAME, kINSTANCE_NORM_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ScatterElementsPluginV3Creator>(
+            logger, libNamespace, kSCATTER_PLUGIN_NAME, kSCATTER_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::MultiscaleDeformableAttnPluginCreator>(
+            logger, libNamespace, kMULTISCALE_DEFORMABLE_ATTN_PLUGIN_NAME, kMULTISCALE_DEFORMABLE_ATTN_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ModulatedDeformableConvPluginDynamicCreator>(
+            logger, libNamespace, kMODULATED_DEFORM_CONV_PLUGIN_NAME, kMODULATED_DEFORM_CONV_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::BatchedNMSDynamicPluginCreator>(
+            logger, libNamespace, kBATCHED_NMS_DYNAMIC_PLUGIN_NAME, kBATCHED_NMS_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::BatchedNMSPluginCreator>(
+            logger, libNamespace, kBATCHED_NMS_PLUGIN_NAME, kBATCHED_NMS_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::BatchTilePluginCreator>(
+            logger, libNamespace, kBATCH_TILE_PLUGIN_NAME, kBATCH_TILE_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ClipPluginCreator>(
+            logger, libNamespace, kCLIP_PLUGIN_NAME, kCLIP_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::CoordConvACPluginCreator>(
+            logger, libNamespace, kCOORDCONV_AC_PLUGIN_NAME, kCOORDCONV_AC_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::CropAndResizeDynamicPluginLegacyCreator>(
+            logger, libNamespace, kCROP_AND_RESIZE_DYNAMIC_LEGACY_PLUGIN_NAME,
+            kCROP_AND_RESIZE_DYNAMIC_LEGACY_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::CropAndResizePluginCreator>(
+            logger, libNamespace, kCROP_AND_RESIZE_PLUGIN_NAME, kCROP_AND_RESIZE_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::DecodeBbox3DPluginCreator>(
+            logger, libNamespace, kDECODE_BBOX_3D_PLUGIN_NAME, kDECODE_BBOX_3D_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::DetectionLayerPluginCreator>(
+            logger, libNamespace, kDETECTIONLAYER_PLUGIN_NAME, kDETECTIONLAYER_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::EfficientNMSExplicitTFTRTPluginCreator>(
+            logger, libNamespace, kEFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_NAME,
+            kEFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::EfficientNMSImplicitTFTRTPluginCreator>(
+            logger, libNamespace, kEFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_NAME,
+            kEFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::EfficientNMSONNXPluginCreator>(
+            logger, libNamespace, kEFFICIENT_NMS_ONNX_PLUGIN_NAME, kEFFICIENT_NMS_ONNX_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::EfficientNMSPluginCreator>(
+            logger, libNamespace, kEFFICIENT_NMS_PLUGIN_NAME, kEFFICIENT_NMS_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::FlattenConcatPluginCreator>(
+            logger, libNamespace, kFLATTENCONCAT_PLUGIN_NAME, kFLATTENCONCAT_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::GenerateDetectionPluginCreator>(
+            logger, libNamespace, kGENERATEDETECTION_PLUGIN_NAME, kGENERATEDETECTION_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::GridAnchorPluginCreator>(
+            logger, libNamespace, kGRID_ANCHOR_PLUGIN_NAME, kGRID_ANCHOR_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::GridAnchorRectPluginCreator>(
+            logger, libNamespace, kGRID_ANCHOR_RECT_PLUGIN_NAME, kGRID_ANCHOR_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::InstanceNormalizationPluginCreator>(
+            logger, libNamespace, kINSTANCE_NORM_LEGACY_PLUGIN_NAME, kINSTANCE_NORM_LEGACY_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::InstanceNormalizationPluginCreatorV2>(
+            logger, libNamespace, kINSTANCE_NORM_LEGACY_PLUGIN_NAME, kINSTANCE_NORM_LEGACY_PLUGIN_VERSION_V2);
+        initializePlugin<nvinfer1::plugin::LReluPluginCreator>(
+            logger, libNamespace, kLRELU_PLUGIN_NAME, kLRELU_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ModulatedDeformableConvPluginDynamicLegacyCreator>(
+            logger, libNamespace, kMODULATED_DEFORM_CONV_LEGACY_PLUGIN_NAME,
+            kMODULATED_DEFORM_CONV_LEGACY_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::MultilevelCropAndResizePluginCreator>(
+            logger, libNamespace, kMULTILEVELCROPANDRESIZE_PLUGIN_NAME, kMULTILEVELCROPANDRESIZE_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::MultilevelProposeROIPluginCreator>(
+            logger, libNamespace, kMULTILEVELPROPOSEROI_PLUGIN_NAME, kMULTILEVELPROPOSEROI_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::MultiscaleDeformableAttnPluginCreatorLegacy>(
+            logger, libNamespace, kMULTISCALE_DEFORMABLE_ATTN_LEGACY_PLUGIN_NAME,
+            kMULTISCALE_DEFORMABLE_ATTN_LEGACY_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::NMSDynamicPluginCreator>(
+            logger, libNamespace, kNMS_DYNAMIC_PLUGIN_NAME, kNMS_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::NMSPluginCreator>(
+            logger, libNamespace, kNMS_PLUGIN_NAME, kNMS_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::NormalizePluginCreator>(
+            logger, libNamespace, kNORMALIZE_PLUGIN_NAME, kNORMALIZE_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::PillarScatterPluginCreator>(
+            logger, libNamespace, kPILLAR_SCATTER_PLUGIN_NAME, kPILLAR_SCATTER_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::PriorBoxPluginCreator>(
+            logger, libNamespace, kPRIOR_BOX_PLUGIN_NAME, kPRIOR_BOX_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ProposalDynamicPluginCreator>(
+            logger, libNamespace, kPROPOSAL_DYNAMIC_PLUGIN_NAME, kPROPOSAL_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ProposalLayerPluginCreator>(
+            logger, libNamespace, kPROPOSALLAYER_PLUGIN_NAME, kPROPOSALLAYER_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ProposalPluginCreator>(
+            logger, libNamespace, kPROPOSAL_PLUGIN_NAME, kPROPOSAL_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::PyramidROIAlignPluginCreator>(
+            logger, libNamespace, kPYRAMIDROIALGIN_PLUGIN_NAME, kPYRAMIDROIALGIN_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::RegionPluginCreator>(
+            logger, libNamespace, kREGION_PLUGIN_NAME, kREGION_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ReorgDynamicPluginCreator>(
+            logger, libNamespace, kREORG_PLUGIN_NAME, kREORG_PLUGIN_DYNAMIC_VERSION);
+        initializePlugin<nvinfer1::plugin::ReorgStaticPluginCreator>(
+            logger, libNamespace, kREORG_PLUGIN_NAME, kREORG_PLUGIN_STATIC_VERSION);
+        initializePlugin<nvinfer1::plugin::ResizeNearestPluginCreator>(
+            logger, libNamespace, kRESIZE_PLUGIN_NAME, kRESIZE_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ROIAlignPluginCreator>(
+            logger, libNamespace, kROIALIGN_LEGACY_PLUGIN_NAME, kROIALIGN_LEGACY_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::RPROIPluginCreator>(
+            logger, libNamespace, kRPROI_PLUGIN_NAME, kRPROI_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::ScatterElementsPluginV2Creator>(
+            logger, libNamespace, kSCATTER_ELEMENTS_NAME, kSCATTER_ELEMENTS_VERSION);
+        initializePlugin<nvinfer1::plugin::ScatterNDPluginCreator>(
+            logger, libNamespace, kSCATTERND_PLUGIN_NAME, kSCATTERND_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::SpecialSlicePluginCreator>(
+            logger, libNamespace, kSPECIALSLICE_PLUGIN_NAME, kSPECIALSLICE_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::SplitPluginCreator>(
+            logger, libNamespace, SPLIT_PLUGIN_NAME, SPLIT_PLUGIN_VERSION);
+        initializePlugin<nvinfer1::plugin::VoxelGeneratorPluginCreator>(
+            logger, libNamespace, kVOXEL_GENERATOR_PLUGIN_NAME, kVOXEL_GENERATOR_PLUGIN_VERSION);
         return true;
     }
 } // extern "C"
@@ -25,12 +25,6 @@ using namespace nvinfer1::plugin;
 using nvinfer1::plugin::BatchTilePlugin;
 using nvinfer1::plugin::BatchTilePluginCreator;
 
-namespace
-{
-static char const* const kBATCH_TILE_PLUGIN_VERSION{"1"};
-static char const* const kBATCH_TILE_PLUGIN_NAME{"BatchTilePlugin_TRT"};
-} // namespace
-
 PluginFieldCollection BatchTilePluginCreator::mFC{};
 
 BatchTilePlugin::BatchTilePlugin(std::string const& name)
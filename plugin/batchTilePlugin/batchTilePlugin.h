@@ -24,6 +24,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kBATCH_TILE_PLUGIN_VERSION{"1"};
+constexpr char const* kBATCH_TILE_PLUGIN_NAME{"BatchTilePlugin_TRT"};
+
 class TRT_DEPRECATED BatchTilePlugin : public IPluginV2Ext
 {
 public:
@@ -28,12 +28,6 @@ namespace nvinfer1::plugin
 
 #define NVBUG_3321606_WAR 1
 
-namespace
-{
-char const* const kNMS_PLUGIN_VERSION{"1"};
-char const* const kNMS_PLUGIN_NAMES[] = {"BatchedNMS_TRT", "BatchedNMSDynamic_TRT"};
-} // namespace
-
 template <>
 void write<NMSParameters>(char*& buffer, NMSParameters const& val)
 {
@@ -460,22 +454,22 @@ bool BatchedNMSDynamicPlugin::supportsFormatCombination(
 
 char const* BatchedNMSPlugin::getPluginType() const noexcept
 {
-    return kNMS_PLUGIN_NAMES[0];
+    return kBATCHED_NMS_PLUGIN_NAME;
 }
 
 char const* BatchedNMSDynamicPlugin::getPluginType() const noexcept
 {
-    return kNMS_PLUGIN_NAMES[1];
+    return kBATCHED_NMS_DYNAMIC_PLUGIN_NAME;
 }
 
 char const* BatchedNMSPlugin::getPluginVersion() const noexcept
 {
-    return kNMS_PLUGIN_VERSION;
+    return kBATCHED_NMS_PLUGIN_VERSION;
 }
 
 char const* BatchedNMSDynamicPlugin::getPluginVersion() const noexcept
 {
-    return kNMS_PLUGIN_VERSION;
+    return kBATCHED_NMS_PLUGIN_VERSION;
 }
 
 void BatchedNMSPlugin::destroy() noexcept
@@ -647,17 +641,17 @@ BatchedNMSBasePluginCreator::BatchedNMSBasePluginCreator()
 
 char const* BatchedNMSPluginCreator::getPluginName() const noexcept
 {
-    return kNMS_PLUGIN_NAMES[0];
+    return kBATCHED_NMS_PLUGIN_NAME;
 }
 
 char const* BatchedNMSDynamicPluginCreator::getPluginName() const noexcept
 {
-    return kNMS_PLUGIN_NAMES[1];
+    return kBATCHED_NMS_DYNAMIC_PLUGIN_NAME;
 }
 
 char const* BatchedNMSBasePluginCreator::getPluginVersion() const noexcept
 {
-    return kNMS_PLUGIN_VERSION;
+    return kBATCHED_NMS_PLUGIN_VERSION;
 }
 
 PluginFieldCollection const* BatchedNMSBasePluginCreator::getFieldNames() noexcept
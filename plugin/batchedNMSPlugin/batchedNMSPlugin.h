@@ -27,6 +27,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kBATCHED_NMS_PLUGIN_VERSION{"1"};
+constexpr char const* kBATCHED_NMS_PLUGIN_NAME{"BatchedNMS_TRT"};
+constexpr char const* kBATCHED_NMS_DYNAMIC_PLUGIN_NAME{"BatchedNMSDynamic_TRT"};
 
 class TRT_DEPRECATED BatchedNMSPlugin : public IPluginV2Ext
 {
@@ -18,10 +18,12 @@
 #ifndef _BERT_FMHA_FMHA
 #define _BERT_FMHA_FMHA
 #include "common/bertCommon.h"
+#include "common/cubinArchive.h"
 #include "common/cudaDriverWrapper.h"
 #include "common/plugin.h"
 #include "cuda_runtime_api.h"
 #include "fused_multihead_attention_common.h"
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -60,101 +62,91 @@ public:
         PLUGIN_ASSERT(mKernelMetaCount && "No kernels were loaded correctly.");
     }
 
-    void loadXMMAKernels(uint32_t smVersion)
+    //! Register the kernels of an SM version that fit in the shared memory of the device. Their cubins are only loaded
+    //! on the first lookup of their key, and kernels registered first are preferred for a key.
+    void indexXMMAKernels(uint32_t smVersion)
     {
+        int32_t deviceID{0};
+        cudaGetDevice(&deviceID);
+        int32_t sharedMemPerMultiprocessor{0};
+        if (cudaDeviceGetAttribute(&sharedMemPerMultiprocessor, cudaDevAttrMaxSharedMemoryPerBlockOptin, deviceID)
+            != cudaSuccess)
+        {
+            sharedMemPerMultiprocessor = 0;
+        }
+
         for (uint32_t i = 0; i < mKernelMetaCount; ++i)
         {
             const auto& kernelMeta = mKernelMeta[i];
+            if (kernelMeta.mSM != smVersion || kernelMeta.mDataType != mDataType)
+            {
+                continue;
+            }
+            if (kernelMeta.mSharedMemBytes >= kDEFAULT_SMEM_SIZE
+                && sharedMemPerMultiprocessor < static_cast<int32_t>(kernelMeta.mSharedMemBytes))
+            {
+                // skip kernel because not enough shared memory to launch it
+                continue;
+            }
+
             const auto kernelKey = hashID(kernelMeta);
-            if (kernelMeta.mSM == smVersion && kernelMeta.mDataType == mDataType
-                && mFunctions.find(kernelKey) == mFunctions.end())
+            mFunctions[kernelKey].mCandidates.push_back(i);
+            uint64_t const s = kernelMeta.mS;
+            uint64_t const headSize = kernelMeta.mD;
+            auto& sequenceKeys = mValidSequences[headSize << 32 | s];
+            if (std::find(sequenceKeys.begin(), sequenceKeys.end(), kernelKey) == sequenceKeys.end())
             {
-                const uint32_t DEFAULT_SMEM_SIZE{48 * 1024};
-                if (kernelMeta.mSharedMemBytes >= DEFAULT_SMEM_SIZE)
-                {
-                    int32_t deviceID{0};
-                    cudaGetDevice(&deviceID);
-                    int32_t sharedMemPerMultiprocessor{0};
-                    if (cudaDeviceGetAttribute(
-                            &sharedMemPerMultiprocessor, cudaDevAttrMaxSharedMemoryPerBlockOptin, deviceID)
-                            != cudaSuccess
-                        || sharedMemPerMultiprocessor < static_cast<int32_t>(kernelMeta.mSharedMemBytes))
-                    {
-                        // skip load function because not enough shared memory to launch the kernel
-                        continue;
-                    }
-                }
-
-                CUmodule hmod{0};
-                auto findModuleIter = mModules.find(kernelMeta.mCubin);
-                if (findModuleIter != mModules.end())
-                {
-                    hmod = findModuleIter->second;
-                }
-                else
-                {
-                    cuErrCheck(mDriver.cuModuleLoadData(&hmod, kernelMeta.mCubin), mDriver);
-                    mModules.insert(std::make_pair(kernelMeta.mCubin, hmod));
-                }
-
-                FusedMultiHeadAttentionKernelInfo funcInfo;
-                funcInfo.mMetaInfoIndex = i;
-                cuErrCheck(mDriver.cuModuleGetFunction(&funcInfo.mDeviceFunction, hmod, kernelMeta.mFuncName), mDriver);
-                if (kernelMeta.mSharedMemBytes >= DEFAULT_SMEM_SIZE)
-                {
-                    if (mDriver.cuFuncSetAttribute(funcInfo.mDeviceFunction,
-                            CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES, kernelMeta.mSharedMemBytes)
-                        != CUDA_SUCCESS)
-                    {
-                        // some chip may not have enough shared memory to launch the kernel
-                        continue;
-                    }
-                }
-                mFunctions.insert({kernelKey, funcInfo});
-                uint64_t const s = kernelMeta.mS;
-                uint64_t const headSize = kernelMeta.mD;
-                uint64_t key = (headSize << 32 | s);
-                if (mValidSequences.find(key) == mValidSequences.end())
-                {
-                    mValidSequences.insert(key);
-                }
+                sequenceKeys.push_back(kernelKey);
             }
         }
     }
 
-    void loadXMMAKernels()
+    void indexXMMAKernels()
     {
         if (!mFunctions.empty())
         {
             return;
         }
 
-        loadXMMAKernels(mSM);
+        indexXMMAKernels(mSM);
 
         // sm_86 chips prefer sm_86 sass, but can also use sm_80 sass if sm_86 not exist.
         // sm_87 cannot run sm_80 sass
         if (mSM == kSM_86)
         {
-            loadXMMAKernels(kSM_80);
+            indexXMMAKernels(kSM_80);
         }
 
         // sm_89 will reuse sm_80 and sm_86 kernels
         if (mSM == kSM_89)
         {
-            loadXMMAKernels(kSM_86);
-            loadXMMAKernels(kSM_80);
+            indexXMMAKernels(kSM_86);
+            indexXMMAKernels(kSM_80);
         }
     }
 
     bool isValid(int32_t headSize, int32_t s) const
     {
         uint64_t key = (static_cast<uint64_t>(headSize) << 32 | static_cast<uint64_t>(s));
-        return (mValidSequences.find(key) != mValidSequences.end());
+        const auto findIter = mValidSequences.find(key);
+        if (findIter == mValidSequences.end())
+        {
+            return false;
+        }
+        // Load the kernels of every variant run() may select for the combination (interleaved or not, unrolled or
+        // not), so that no cubin is loaded at enqueue time. The combination is only valid if one of them can be loaded
+        // on this chip.
+        bool valid{false};
+        for (const uint64_t kernelKey : findIter->second)
+        {
+            valid = findKernel(kernelKey) != nullptr || valid;
+        }
+        return valid;
     }
 
     virtual void run(TKernelParam& params, cudaStream_t ss) const
     {
-        const auto findIter = mFunctions.find(hashID(params.s, params.d));
+        const auto* kernelInfo = findKernel(hashID(params.s, params.d));
         std::stringstream errMsg;
         errMsg << "Could not find kernel for:\n"
                << "\t s: " << params.s << "\n"
@@ -185,10 +177,10 @@ public:
                << "90 "
 #endif
                << "\n";
-        PLUGIN_VALIDATE(findIter != mFunctions.end(), errMsg.str().c_str());
+        PLUGIN_VALIDATE(kernelInfo != nullptr, errMsg.str().c_str());
 
-        const auto& kernelMeta = mKernelMeta[findIter->second.mMetaInfoIndex];
-        const CUfunction func = findIter->second.mDeviceFunction;
+        const auto& kernelMeta = mKernelMeta[kernelInfo->mMetaInfoIndex];
+        const CUfunction func = kernelInfo->mDeviceFunction;
 
         void* kernelParams[] = {&params, nullptr};
         cuErrCheck(mDriver.cuLaunchKernel(func, params.h, params.b, 1, kernelMeta.mThreadsPerCTA, 1, 1,
@@ -199,21 +191,88 @@ public:
     virtual ~TFusedMultiHeadAttentionXMMAKernel() = default;
 
 protected:
+    static constexpr uint32_t kDEFAULT_SMEM_SIZE{48 * 1024};
+
+    struct FusedMultiHeadAttentionKernelInfo
+    {
+        //! Meta info indices of the kernels registered for the key, in order of preference.
+        std::vector<uint32_t> mCandidates;
+        mutable std::once_flag mLoadFlag;
+        mutable uint32_t mMetaInfoIndex{0};
+        //! Function of the first candidate that could be loaded, or null if none could.
+        mutable CUfunction mDeviceFunction{nullptr};
+    };
+
+    //! Return the kernel registered for a key, loading its cubin on the first lookup, or null if there is none.
+    //! Thread-safe: each key is loaded once.
+    const FusedMultiHeadAttentionKernelInfo* findKernel(uint64_t kernelKey) const
+    {
+        const auto findIter = mFunctions.find(kernelKey);
+        if (findIter == mFunctions.end())
+        {
+            return nullptr;
+        }
+        const auto& kernelInfo = findIter->second;
+        std::call_once(kernelInfo.mLoadFlag, [this, &kernelInfo]() { loadKernel(kernelInfo); });
+        return kernelInfo.mDeviceFunction == nullptr ? nullptr : &kernelInfo;
+    }
+
     nvinfer1::CUDADriverWrapper mDriver;
 
     plugin::bert::Data_type mDataType;
     const TKernelMeta* mKernelMeta;
     uint32_t mKernelMetaCount;
     uint32_t mSM;
-    std::unordered_map<const unsigned char*, CUmodule> mModules;
-    struct FusedMultiHeadAttentionKernelInfo
-    {
-        uint32_t mMetaInfoIndex;
-        CUfunction mDeviceFunction;
-    };
+    // Modules loaded so far, shared by the kernels of a cubin.
+    mutable std::unordered_map<const unsigned char*, CUmodule> mModules;
+    mutable std::mutex mModulesMutex;
+    // Kernels of each key, fixed once indexed so that lookups need no lock.
     std::unordered_map<uint64_t, FusedMultiHeadAttentionKernelInfo> mFunctions;
-    // Set of valid sequence and head size combination. We use (headSize << 32 | sequence) as key here.
-    std::unordered_set<uint64_t> mValidSequences;
+    // Keys of the kernels of each valid sequence and head size combination. We use (headSize << 32 | sequence) as key
+    // here.
+    std::unordered_map<uint64_t, std::vector<uint64_t>> mValidSequences;
+
+private:
+    void loadKernel(const FusedMultiHeadAttentionKernelInfo& kernelInfo) const
+    {
+        for (const uint32_t i : kernelInfo.mCandidates)
+        {
+            const auto& kernelMeta = mKernelMeta[i];
+            CUfunction func{nullptr};
+            cuErrCheck(mDriver.cuModuleGetFunction(&func, getModule(kernelMeta.mCubin), kernelMeta.mFuncName), mDriver);
+            if (kernelMeta.mSharedMemBytes >= kDEFAULT_SMEM_SIZE
+                && mDriver.cuFuncSetAttribute(
+                       func, CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES, kernelMeta.mSharedMemBytes)
+                    != CUDA_SUCCESS)
+            {
+                // some chip may not have enough shared memory to launch the kernel
+                continue;
+            }
+            kernelInfo.mMetaInfoIndex = i;
+            kernelInfo.mDeviceFunction = func;
+            return;
+        }
+    }
+
+    CUmodule getModule(const unsigned char* cubin) const
+    {
+        std::lock_guard<std::mutex> lock(mModulesMutex);
+        auto findModuleIter = mModules.find(cubin);
+        if (findModuleIter != mModules.end())
+        {
+            return findModuleIter->second;
+        }
+
+        // The cubin may be a stub of the compressed archive, decompressed here on first use.
+        const void* image = getCubinImage(cubin);
+        PLUGIN_VALIDATE(image != nullptr, "Corrupted compressed cubin of a fused MHA kernel.");
+        CUmodule hmod{0};
+        cuErrCheck(mDriver.cuModuleLoadData(&hmod, image), mDriver);
+        mModules.insert(std::make_pair(cubin, hmod));
+        plugin::gLogVerbose << "Fused MHA kernels (SM " << mSM << ", data type " << static_cast<int32_t>(mDataType)
+                            << "): loaded " << mModules.size() << " cubin module(s)" << std::endl;
+        return hmod;
+    }
 };
 template <typename TFusedMHAKernelList>
 class TFusedMHAKernelFactory
@@ -230,7 +289,7 @@ public:
         if (findIter == mKernels.end())
         {
             TFusedMHAKernelList* newKernel = new TFusedMHAKernelList{pKernelList, nbKernels, type, sm};
-            newKernel->loadXMMAKernels();
+            newKernel->indexXMMAKernels();
             mKernels.insert(std::make_pair(id, std::unique_ptr<TFusedMHAKernelList>(newKernel)));
             return newKernel;
         }
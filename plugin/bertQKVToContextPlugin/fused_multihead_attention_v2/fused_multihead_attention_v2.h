@@ -1174,7 +1174,7 @@ public:
             }
         }
 
-        const auto findIter = mFunctions.find(hashID(params.s, params.d, params.interleaved, forceUnroll));
+        const auto* kernelInfo = findKernel(hashID(params.s, params.d, params.interleaved, forceUnroll));
         // Provide debug information if the kernel is missing in the pool.
         std::stringstream errMsg;
         errMsg << "Could not find kernel for:\n"
@@ -1216,10 +1216,10 @@ public:
 #endif
 
                << "\n";
-        PLUGIN_VALIDATE(findIter != mFunctions.end(), errMsg.str().c_str());
+        PLUGIN_VALIDATE(kernelInfo != nullptr, errMsg.str().c_str());
 
-        const auto& kernelMeta = mKernelMeta[findIter->second.mMetaInfoIndex];
-        const CUfunction func = findIter->second.mDeviceFunction;
+        const auto& kernelMeta = mKernelMeta[kernelInfo->mMetaInfoIndex];
+        const CUfunction func = kernelInfo->mDeviceFunction;
 
         void* kernelParams[] = {&params, nullptr};
         if (!forceUnroll)
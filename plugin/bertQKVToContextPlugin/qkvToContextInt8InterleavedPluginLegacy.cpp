@@ -70,6 +70,11 @@ QKVToContextInterleavedPluginLegacy::QKVToContextInterleavedPluginLegacy(std::st
     PLUGIN_VALIDATE(isSMSupported && "requesting maxSeqlen not compatible with GPU arch");
     // the layout changes: SxB will be a combined \sum_i s_i and hdim will be the 2nd dimension instead of the third
     mXmmaKernel = getXMMAKernelsV2(DATA_TYPE_INT8, mSM);
+    // Load the kernels of every sequence length enqueue() may select, so that no cubin is loaded while enqueuing.
+    for (int32_t const s : {128, 192, 256, 384})
+    {
+        mXmmaKernel->isValid(mHeadSize, s);
+    }
 }
 
 QKVToContextInterleavedPluginLegacy::QKVToContextInterleavedPluginLegacy(
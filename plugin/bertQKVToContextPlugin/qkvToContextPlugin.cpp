@@ -880,6 +880,18 @@ void QKVToContextVarSeqlenPlugin::createMHARunner()
                 mDispatcher.reset(new FusedMHARunnerInt8v2(mNumHeads, mSM, mDqProbs, mUseInt8ScaleMax));
             }
         }
+        // enqueue() selects the sequence length and the padded head size from the input shapes. Load the kernels of
+        // every combination it may select now, so that no cubin is loaded while enqueuing.
+        for (int32_t const s : {64, 96, 128, 192, 256, 384, 512})
+        {
+            for (int32_t const padSize : {32, 64})
+            {
+                if (mDispatcher.get() && mHeadSize <= padSize)
+                {
+                    mDispatcher->isValid(padSize, s);
+                }
+            }
+        }
     }
     else
     {
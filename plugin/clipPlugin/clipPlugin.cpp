@@ -30,8 +30,6 @@ using namespace nvinfer1;
 using nvinfer1::plugin::ClipPluginCreator;
 using nvinfer1::plugin::ClipPlugin;
 
-static char const* const kCLIP_PLUGIN_VERSION{"1"};
-static char const* const kCLIP_PLUGIN_NAME{"Clip_TRT"};
 PluginFieldCollection ClipPluginCreator::mFC{};
 std::vector<PluginField> ClipPluginCreator::mPluginAttributes;
 
@@ -27,6 +27,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kCLIP_PLUGIN_VERSION{"1"};
+constexpr char const* kCLIP_PLUGIN_NAME{"Clip_TRT"};
+
 class TRT_DEPRECATED ClipPlugin : public nvinfer1::pluginInternal::BasePlugin
 {
 public:
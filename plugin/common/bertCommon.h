@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cuda_runtime_api.h>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <stdexcept>
@@ -164,6 +165,31 @@ inline int64_t getWeightsSize(nvinfer1::Weights const& w, nvinfer1::DataType typ
     return w.count * getElementSize(type);
 }
 
+//! Multiply two sizes read from a serialized buffer. Return false if the product does not fit in an int64_t, as for
+//! the counts of corrupted buffers, where negative counts read as huge sizes.
+inline bool checkedMultiply(size_t a, size_t b, size_t& product) noexcept
+{
+    size_t constexpr kMAX{static_cast<size_t>(std::numeric_limits<int64_t>::max())};
+    if (a > kMAX || b > kMAX || (b != 0 && a > kMAX / b))
+    {
+        return false;
+    }
+    product = a * b;
+    return true;
+}
+
+//! Add two sizes read from a serialized buffer. Return false if the sum does not fit in an int64_t.
+inline bool checkedAdd(size_t a, size_t b, size_t& sum) noexcept
+{
+    size_t constexpr kMAX{static_cast<size_t>(std::numeric_limits<int64_t>::max())};
+    if (a > kMAX || b > kMAX - a)
+    {
+        return false;
+    }
+    sum = a + b;
+    return true;
+}
+
 inline int64_t volume(nvinfer1::Dims const& d)
 {
     return std::accumulate(d.d, d.d + d.nbDims, int64_t{1}, std::multiplies<int64_t>{});
@@ -0,0 +1,285 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cubinArchive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace nvinfer1
+{
+
+namespace pluginInternal
+{
+
+namespace
+{
+
+constexpr size_t kMIN_MATCH{4};
+constexpr size_t kMAX_OFFSET{65535};
+constexpr int32_t kHASH_BITS{16};
+//! Number of earlier positions with the same hash compared to find the longest match.
+constexpr int32_t kMAX_CHAIN_LENGTH{64};
+constexpr uint8_t kNIBBLE_MAX{15};
+
+uint32_t read32(uint8_t const* p)
+{
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint32_t hashSequence(uint32_t sequence)
+{
+    return (sequence * 2654435761U) >> (32 - kHASH_BITS);
+}
+
+void writeLength(std::vector<uint8_t>& out, size_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        out.push_back(255);
+    }
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+//! Append literals, then a match unless matchLength is 0.
+void writeSequence(
+    std::vector<uint8_t>& out, uint8_t const* literals, size_t nbLiterals, size_t offset, size_t matchLength)
+{
+    size_t const matchCode = matchLength == 0 ? 0 : matchLength - kMIN_MATCH;
+    uint8_t const token = static_cast<uint8_t>(std::min<size_t>(nbLiterals, kNIBBLE_MAX) << 4
+        | std::min<size_t>(matchCode, kNIBBLE_MAX));
+    out.push_back(token);
+    if (nbLiterals >= kNIBBLE_MAX)
+    {
+        writeLength(out, nbLiterals - kNIBBLE_MAX);
+    }
+    out.insert(out.end(), literals, literals + nbLiterals);
+    if (matchLength == 0)
+    {
+        return;
+    }
+    out.push_back(static_cast<uint8_t>(offset & 0xFF));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchCode >= kNIBBLE_MAX)
+    {
+        writeLength(out, matchCode - kNIBBLE_MAX);
+    }
+}
+
+bool readLength(uint8_t const* src, size_t srcSize, size_t& pos, size_t& length)
+{
+    uint8_t byte{255};
+    while (byte == 255)
+    {
+        if (pos >= srcSize)
+        {
+            return false;
+        }
+        byte = src[pos++];
+        length += byte;
+    }
+    return true;
+}
+
+struct CubinArchive
+{
+    CubinArchiveEntry const* entries;
+    uint32_t nbEntries;
+    uint8_t const* data;
+    size_t dataSize;
+};
+
+// Constant-initialized, so that it is set before any dynamic initializer registers the archive.
+CubinArchive gArchive{nullptr, 0, nullptr, 0};
+
+struct CubinCache
+{
+    std::mutex mutex;
+    std::vector<std::unique_ptr<uint8_t[]>> images;
+};
+
+CubinCache& getCubinCache()
+{
+    static CubinCache cache;
+    return cache;
+}
+
+} // namespace
+
+std::vector<uint8_t> compressCubin(uint8_t const* data, size_t size)
+{
+    std::vector<uint8_t> out;
+    out.reserve(size / 2 + 16);
+    // Hash chains: head holds the last position of each hash, and previous the position before it with the same hash.
+    std::vector<int64_t> head(size_t{1} << kHASH_BITS, -1);
+    std::vector<int64_t> previous(size, -1);
+    auto const insert = [&](size_t pos) {
+        uint32_t const h = hashSequence(read32(data + pos));
+        previous[pos] = head[h];
+        head[h] = static_cast<int64_t>(pos);
+    };
+
+    size_t anchor = 0;
+    size_t pos = 0;
+    while (pos + kMIN_MATCH <= size)
+    {
+        size_t bestLength = 0;
+        size_t bestOffset = 0;
+        int64_t candidate = head[hashSequence(read32(data + pos))];
+        for (int32_t i = 0; i < kMAX_CHAIN_LENGTH && candidate >= 0 && pos - candidate <= kMAX_OFFSET; ++i)
+        {
+            size_t length = 0;
+            while (pos + length < size && data[candidate + length] == data[pos + length])
+            {
+                ++length;
+            }
+            if (length > bestLength)
+            {
+                bestLength = length;
+                bestOffset = pos - candidate;
+            }
+            candidate = previous[candidate];
+        }
+
+        if (bestLength < kMIN_MATCH)
+        {
+            insert(pos++);
+            continue;
+        }
+        writeSequence(out, data + anchor, pos - anchor, bestOffset, bestLength);
+        for (size_t end = pos + bestLength; pos < end; ++pos)
+        {
+            if (pos + kMIN_MATCH <= size)
+            {
+                insert(pos);
+            }
+        }
+        anchor = pos;
+    }
+    writeSequence(out, data + anchor, size - anchor, 0, 0);
+    return out;
+}
+
+bool decompressCubin(uint8_t const* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+{
+    size_t ip = 0;
+    size_t op = 0;
+    while (ip < srcSize)
+    {
+        uint8_t const token = src[ip++];
+        size_t nbLiterals = token >> 4;
+        if (nbLiterals == kNIBBLE_MAX && !readLength(src, srcSize, ip, nbLiterals))
+        {
+            return false;
+        }
+        if (nbLiterals > srcSize - ip || nbLiterals > dstSize - op)
+        {
+            return false;
+        }
+        std::memcpy(dst + op, src + ip, nbLiterals);
+        ip += nbLiterals;
+        op += nbLiterals;
+        if (ip == srcSize)
+        {
+            break;
+        }
+
+        if (srcSize - ip < 2)
+        {
+            return false;
+        }
+        size_t const offset = src[ip] | static_cast<size_t>(src[ip + 1]) << 8;
+        ip += 2;
+        size_t matchLength = token & kNIBBLE_MAX;
+        if (matchLength == kNIBBLE_MAX && !readLength(src, srcSize, ip, matchLength))
+        {
+            return false;
+        }
+        matchLength += kMIN_MATCH;
+        if (offset == 0 || offset > op || matchLength > dstSize - op)
+        {
+            return false;
+        }
+        // The match may overlap the bytes it produces, so it is copied forward one byte at a time.
+        uint8_t const* match = dst + op - offset;
+        for (size_t i = 0; i < matchLength; ++i)
+        {
+            dst[op + i] = match[i];
+        }
+        op += matchLength;
+    }
+    return op == dstSize;
+}
+
+bool registerCubinArchive(
+    CubinArchiveEntry const* entries, uint32_t nbEntries, uint8_t const* data, size_t dataSize) noexcept
+{
+    if (gArchive.entries != nullptr)
+    {
+        return false;
+    }
+    gArchive = CubinArchive{entries, nbEntries, data, dataSize};
+    return true;
+}
+
+void const* getCubinImage(void const* cubin)
+{
+    auto const* stub = static_cast<uint8_t const*>(cubin);
+    if (std::memcmp(stub, kCUBIN_STUB_MAGIC, sizeof(kCUBIN_STUB_MAGIC)) != 0)
+    {
+        return cubin;
+    }
+
+    uint8_t const* indexBytes = stub + sizeof(kCUBIN_STUB_MAGIC);
+    uint32_t const index = indexBytes[0] | indexBytes[1] << 8 | indexBytes[2] << 16
+        | static_cast<uint32_t>(indexBytes[3]) << 24;
+    if (index >= gArchive.nbEntries)
+    {
+        return nullptr;
+    }
+
+    auto& cache = getCubinCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.images.empty())
+    {
+        cache.images.resize(gArchive.nbEntries);
+    }
+    auto& image = cache.images[index];
+    if (image == nullptr)
+    {
+        CubinArchiveEntry const& entry = gArchive.entries[index];
+        if (entry.offset > gArchive.dataSize || entry.compressedSize > gArchive.dataSize - entry.offset)
+        {
+            return nullptr;
+        }
+        auto decompressed = std::make_unique<uint8_t[]>(entry.size);
+        if (!decompressCubin(gArchive.data + entry.offset, entry.compressedSize, decompressed.get(), entry.size))
+        {
+            return nullptr;
+        }
+        image = std::move(decompressed);
+    }
+    return image.get();
+}
+
+} // namespace pluginInternal
+
+} // namespace nvinfer1
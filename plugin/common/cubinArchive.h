@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_PLUGIN_CUBIN_ARCHIVE_H
+#define TRT_PLUGIN_CUBIN_ARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nvinfer1
+{
+
+namespace pluginInternal
+{
+
+//! Entry of a cubin in a compressed archive generated by trt_cubin_packer.
+struct CubinArchiveEntry
+{
+    //! Offset of the compressed cubin in the archive data.
+    uint64_t offset;
+    uint32_t compressedSize;
+    //! Size of the cubin once decompressed.
+    uint32_t size;
+};
+
+//! Magic number at the start of the stubs that stand for the cubins of an archive.
+constexpr uint8_t kCUBIN_STUB_MAGIC[8] = {'T', 'R', 'T', 'C', 'U', 'B', 'Z', '1'};
+
+//! Size of a stub: kCUBIN_STUB_MAGIC then the index of the entry of the cubin as a little-endian uint32_t.
+constexpr size_t kCUBIN_STUB_SIZE{12};
+
+//! Compress a cubin into the LZ77 format read by decompressCubin().
+//!
+//! The format is a sequence of (literals, match) pairs: a token byte holds the number of literals in its high nibble
+//! and the match length minus 4 in its low nibble, a nibble of 15 being followed by extra length bytes up to the first
+//! one below 255. The literals then follow, then the little-endian 16-bit offset of the match. The last pair has no
+//! match.
+std::vector<uint8_t> compressCubin(uint8_t const* data, size_t size);
+
+//! Decompress a cubin compressed by compressCubin() into dst, which must be exactly its size.
+//!
+//! \return false if src is corrupted or does not decompress to dstSize bytes.
+bool decompressCubin(uint8_t const* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+//! Register the archive of a library, which the source generated by trt_cubin_packer does when the library is loaded.
+//! The archive must outlive every call to getCubinImage().
+//!
+//! \return false if an archive was already registered, which is not supported.
+bool registerCubinArchive(
+    CubinArchiveEntry const* entries, uint32_t nbEntries, uint8_t const* data, size_t dataSize) noexcept;
+
+//! Return the image of a cubin array to load with cuModuleLoadData(): the array itself, or if it is the stub of a
+//! compressed cubin, the cubin decompressed into a cache that lives until the library is unloaded. Thread-safe.
+//!
+//! \return nullptr if the stub does not match the registered archive or the cubin is corrupted.
+void const* getCubinImage(void const* cubin);
+
+} // namespace pluginInternal
+
+} // namespace nvinfer1
+
+#endif // TRT_PLUGIN_CUBIN_ARCHIVE_H
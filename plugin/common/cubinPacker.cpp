@@ -0,0 +1,313 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//!
+//! trt_cubin_packer: build tool that compresses cubin sources into one archive source.
+//!
+//! Each input source defines a cubin array and its length, as in the fused multi-head attention plugins:
+//!     unsigned char <name>[] = {0x7f, 0x45, ...};
+//!     unsigned int <name>_len = <size>;
+//! The generated source holds the cubins in one compressed archive registered with registerCubinArchive(), and defines
+//! each <name> as a stub resolved by getCubinImage(), so that declarations and users of the arrays are unchanged.
+//! Identical cubins share an entry of the archive.
+//!
+//! Usage: trt_cubin_packer --output <file.cpp> --namespace <namespace> (--sources <list file> | <source>...)
+//!
+
+#include "cubinArchive.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace nvinfer1::pluginInternal;
+
+namespace
+{
+
+//! Number of bytes written per line of the generated arrays.
+constexpr int32_t kBYTES_PER_LINE{24};
+
+struct Cubin
+{
+    std::string name;
+    std::vector<uint8_t> data;
+};
+
+std::string readFile(std::string const& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("cannot open " + path);
+    }
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+size_t skipSpaces(std::string const& text, size_t pos)
+{
+    while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+    {
+        ++pos;
+    }
+    return pos;
+}
+
+//! Parse the cubin array and its length defined by a source.
+Cubin parseCubinSource(std::string const& path)
+{
+    std::string const text = readFile(path);
+    auto const fail = [&path](std::string const& msg) { return std::runtime_error(path + ": " + msg); };
+
+    std::string const arrayPrefix = "unsigned char ";
+    size_t pos = text.find(arrayPrefix);
+    if (pos == std::string::npos)
+    {
+        throw fail("no cubin array");
+    }
+    pos += arrayPrefix.size();
+    size_t const nameEnd = text.find("[]", pos);
+    if (nameEnd == std::string::npos)
+    {
+        throw fail("malformed cubin array");
+    }
+    Cubin cubin;
+    cubin.name = text.substr(pos, nameEnd - pos);
+    pos = text.find('{', nameEnd);
+    if (pos == std::string::npos)
+    {
+        throw fail("malformed cubin array");
+    }
+    ++pos;
+
+    cubin.data.reserve(text.size() / 6);
+    while (true)
+    {
+        pos = skipSpaces(text, pos);
+        if (pos < text.size() && text[pos] == '}')
+        {
+            break;
+        }
+        char* end = nullptr;
+        unsigned long const value = std::strtoul(text.c_str() + pos, &end, 0);
+        size_t const next = static_cast<size_t>(end - text.c_str());
+        if (next == pos || value > 0xFF)
+        {
+            throw fail("invalid byte in " + cubin.name);
+        }
+        cubin.data.push_back(static_cast<uint8_t>(value));
+        pos = skipSpaces(text, next);
+        if (pos < text.size() && text[pos] == ',')
+        {
+            ++pos;
+        }
+    }
+
+    std::string const lengthPrefix = "unsigned int " + cubin.name + "_len = ";
+    pos = text.find(lengthPrefix, pos);
+    if (pos == std::string::npos)
+    {
+        throw fail("no length for " + cubin.name);
+    }
+    unsigned long const length = std::strtoul(text.c_str() + pos + lengthPrefix.size(), nullptr, 10);
+    if (length != cubin.data.size())
+    {
+        throw fail(cubin.name + " has " + std::to_string(cubin.data.size()) + " bytes but a length of "
+            + std::to_string(length));
+    }
+    if (cubin.data.size() >= sizeof(kCUBIN_STUB_MAGIC)
+        && std::memcmp(cubin.data.data(), kCUBIN_STUB_MAGIC, sizeof(kCUBIN_STUB_MAGIC)) == 0)
+    {
+        throw fail(cubin.name + " is already a stub");
+    }
+    return cubin;
+}
+
+void writeBytes(std::ostream& out, uint8_t const* data, size_t size)
+{
+    out << std::hex << std::setfill('0');
+    for (size_t i = 0; i < size; ++i)
+    {
+        out << (i % kBYTES_PER_LINE == 0 ? "\n    " : " ") << "0x" << std::setw(2) << static_cast<uint32_t>(data[i])
+            << ',';
+    }
+    out << std::dec << std::setfill(' ');
+}
+
+std::vector<std::string> readSourceList(std::string const& path)
+{
+    std::vector<std::string> sources;
+    std::istringstream lines(readFile(path));
+    for (std::string line; std::getline(lines, line);)
+    {
+        while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back())))
+        {
+            line.pop_back();
+        }
+        if (!line.empty())
+        {
+            sources.push_back(line);
+        }
+    }
+    return sources;
+}
+
+void printUsage()
+{
+    std::cerr << "Usage: trt_cubin_packer --output <file.cpp> --namespace <namespace> (--sources <list file> | "
+                 "<source>...)"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string output;
+    std::string nameSpace;
+    std::vector<std::string> sources;
+    for (int32_t i = 1; i < argc; ++i)
+    {
+        std::string const arg = argv[i];
+        bool const hasValue = i + 1 < argc;
+        if (arg == "--output" && hasValue)
+        {
+            output = argv[++i];
+        }
+        else if (arg == "--namespace" && hasValue)
+        {
+            nameSpace = argv[++i];
+        }
+        else if (arg == "--sources" && hasValue)
+        {
+            auto const listed = readSourceList(argv[++i]);
+            sources.insert(sources.end(), listed.begin(), listed.end());
+        }
+        else if (arg.rfind("--", 0) == 0)
+        {
+            printUsage();
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            sources.push_back(arg);
+        }
+    }
+    if (output.empty() || nameSpace.empty() || sources.empty())
+    {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        std::vector<uint8_t> archive;
+        std::vector<CubinArchiveEntry> entries;
+        // Entry of each cubin, and of each distinct cubin content.
+        std::vector<std::pair<std::string, uint32_t>> stubs;
+        std::map<std::vector<uint8_t>, uint32_t> contentEntries;
+        std::map<std::string, std::string> names;
+        size_t totalSize = 0;
+        for (auto const& source : sources)
+        {
+            Cubin cubin = parseCubinSource(source);
+            if (!names.emplace(cubin.name, source).second)
+            {
+                throw std::runtime_error(source + ": " + cubin.name + " is also defined in " + names[cubin.name]);
+            }
+            totalSize += cubin.data.size();
+            auto const found = contentEntries.find(cubin.data);
+            if (found != contentEntries.end())
+            {
+                stubs.emplace_back(cubin.name, found->second);
+                continue;
+            }
+
+            std::vector<uint8_t> const compressed = compressCubin(cubin.data.data(), cubin.data.size());
+            std::vector<uint8_t> check(cubin.data.size());
+            if (!decompressCubin(compressed.data(), compressed.size(), check.data(), check.size()) || check != cubin.data)
+            {
+                throw std::runtime_error(source + ": " + cubin.name + " does not survive compression");
+            }
+            auto const index = static_cast<uint32_t>(entries.size());
+            entries.push_back(CubinArchiveEntry{archive.size(), static_cast<uint32_t>(compressed.size()),
+                static_cast<uint32_t>(cubin.data.size())});
+            archive.insert(archive.end(), compressed.begin(), compressed.end());
+            stubs.emplace_back(cubin.name, index);
+            contentEntries.emplace(std::move(cubin.data), index);
+        }
+
+        std::ofstream out(output, std::ios::binary);
+        if (!out)
+        {
+            throw std::runtime_error("cannot write " + output);
+        }
+        out << "// Generated by trt_cubin_packer from " << sources.size() << " cubin sources (" << totalSize
+            << " bytes compressed to " << archive.size() << "). Do not edit.\n\n";
+        out << "#include \"common/cubinArchive.h\"\n\n";
+        out << "namespace " << nameSpace << "\n{\nnamespace\n{\n\n";
+        out << "uint8_t const kCubinArchiveData[] = {";
+        writeBytes(out, archive.data(), archive.size());
+        out << "\n};\n\n";
+        out << "nvinfer1::pluginInternal::CubinArchiveEntry const kCubinArchiveEntries[] = {\n";
+        for (auto const& entry : entries)
+        {
+            out << "    {" << entry.offset << "U, " << entry.compressedSize << "U, " << entry.size << "U},\n";
+        }
+        out << "};\n\n";
+        out << "bool const kCubinArchiveRegistered = nvinfer1::pluginInternal::registerCubinArchive(kCubinArchiveEntries, "
+            << entries.size() << "U, kCubinArchiveData, sizeof(kCubinArchiveData));\n\n";
+        out << "} // namespace\n\n";
+        for (auto const& stub : stubs)
+        {
+            uint8_t bytes[kCUBIN_STUB_SIZE];
+            std::memcpy(bytes, kCUBIN_STUB_MAGIC, sizeof(kCUBIN_STUB_MAGIC));
+            for (int32_t b = 0; b < 4; ++b)
+            {
+                bytes[sizeof(kCUBIN_STUB_MAGIC) + b] = static_cast<uint8_t>(stub.second >> (8 * b));
+            }
+            out << "unsigned char " << stub.first << "[] = {";
+            writeBytes(out, bytes, sizeof(bytes));
+            out << "\n};\n";
+            out << "unsigned int " << stub.first << "_len = " << entries[stub.second].size << ";\n";
+        }
+        out << "\n} // namespace " << nameSpace << "\n";
+        if (!out)
+        {
+            throw std::runtime_error("cannot write " + output);
+        }
+        std::cout << "Compressed " << sources.size() << " cubins from " << totalSize << " to " << archive.size()
+                  << " bytes" << std::endl;
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << "trt_cubin_packer: " << e.what() << std::endl;
+        std::remove(output.c_str());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_PLUGIN_HOST_PARALLEL_H
+#define TRT_PLUGIN_HOST_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace nvinfer1
+{
+
+namespace pluginInternal
+{
+
+//! Return the number of threads to use for host implementations of plugins: the requested number if positive, and
+//! the number of hardware threads otherwise.
+inline int32_t getNbHostThreads(int32_t requested)
+{
+    if (requested > 0)
+    {
+        return requested;
+    }
+    return std::max(static_cast<int32_t>(std::thread::hardware_concurrency()), 1);
+}
+
+//! Call func(task) for each task in [0, nbTasks), on up to nbThreads threads including the calling one.
+//!
+//! Tasks are handed out one at a time, so they may have uneven costs. func must not throw.
+template <typename F>
+void parallelFor(int64_t nbTasks, int32_t nbThreads, F const& func)
+{
+    int64_t const nbWorkers = std::min(static_cast<int64_t>(getNbHostThreads(nbThreads)), nbTasks);
+    if (nbWorkers <= 1)
+    {
+        for (int64_t task = 0; task < nbTasks; ++task)
+        {
+            func(task);
+        }
+        return;
+    }
+
+    std::atomic<int64_t> next{0};
+    auto const work = [&]() {
+        for (int64_t task = next++; task < nbTasks; task = next++)
+        {
+            func(task);
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(nbWorkers - 1);
+    for (int64_t w = 1; w < nbWorkers; ++w)
+    {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+} // namespace pluginInternal
+
+} // namespace nvinfer1
+
+#endif // TRT_PLUGIN_HOST_PARALLEL_H
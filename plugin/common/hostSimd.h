@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_PLUGIN_HOST_SIMD_H
+#define TRT_PLUGIN_HOST_SIMD_H
+
+#include "utils/hostSimd.h"
+#include <cstdint>
+#include <cuda_fp16.h>
+
+// The SIMD dispatch is shared with the samples; TRT_DISABLE_PLUGIN_HOST_SIMD still disables it for the plugins only.
+#if TRT_HOST_X86_SIMD && !defined(TRT_DISABLE_PLUGIN_HOST_SIMD)
+#define TRT_PLUGIN_HOST_X86_SIMD 1
+#endif
+
+namespace nvinfer1
+{
+
+namespace pluginInternal
+{
+
+using utils::getHostSimdLevel;
+using utils::HostSimdLevel;
+using utils::setMaxHostSimdLevel;
+
+#if TRT_PLUGIN_HOST_X86_SIMD
+__attribute__((target("avx2,f16c"))) inline int64_t convertToFloatF16C(
+    __half const* src, float* dst, int64_t count)
+{
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i))));
+    }
+    return i;
+}
+
+__attribute__((target("avx2,f16c"))) inline int64_t convertToHalfF16C(float const* src, __half* dst, int64_t count)
+{
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+            _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    }
+    return i;
+}
+#endif
+
+//! Convert count values from FP16 to FP32, 8 at a time with F16C when available.
+inline void convertToFloat(__half const* src, float* dst, int64_t count)
+{
+    int64_t i = 0;
+#if TRT_PLUGIN_HOST_X86_SIMD
+    if (getHostSimdLevel() != HostSimdLevel::kSCALAR)
+    {
+        i = convertToFloatF16C(src, dst, count);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        dst[i] = __half2float(src[i]);
+    }
+}
+
+//! Convert count values from FP32 to FP16 with rounding to nearest even, 8 at a time with F16C when available.
+inline void convertToHalf(float const* src, __half* dst, int64_t count)
+{
+    int64_t i = 0;
+#if TRT_PLUGIN_HOST_X86_SIMD
+    if (getHostSimdLevel() != HostSimdLevel::kSCALAR)
+    {
+        i = convertToHalfF16C(src, dst, count);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        dst[i] = __float2half(src[i]);
+    }
+}
+
+} // namespace pluginInternal
+
+} // namespace nvinfer1
+
+#endif // TRT_PLUGIN_HOST_SIMD_H
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/kernels/kernel.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace nvinfer1::plugin
+{
+
+void priorBoxHost(PriorBoxParameters const& param, int32_t H, int32_t W, int32_t numPriors, int32_t numAspectRatios,
+    float const* minSize, float const* maxSize, float const* aspectRatios, float* outputData)
+{
+    // Same indexing and arithmetic as priorBoxKernel.
+    int32_t const dim = H * W * numPriors;
+    bool const haveMaxSize = param.numMaxSize > 0;
+    int32_t const dimAR = (haveMaxSize ? 1 : 0) + numAspectRatios;
+    auto const clip = [&param](float v) { return param.clip ? std::min(std::max(v, 0.0F), 1.0F) : v; };
+    float* variance = outputData + dim * 4;
+    for (int32_t i = 0; i < dim; ++i)
+    {
+        int32_t const w = (i / numPriors) % W;
+        int32_t const h = (i / numPriors) / W;
+        float const centerX = (w + param.offset) * param.stepW;
+        float const centerY = (h + param.offset) * param.stepH;
+        int32_t const minSizeId = (i / dimAR) % param.numMinSize;
+        int32_t const arId = i % dimAR;
+        float boxW;
+        float boxH;
+        if (arId == 0)
+        {
+            boxW = minSize[minSizeId];
+            boxH = boxW;
+        }
+        else if (haveMaxSize && arId == 1)
+        {
+            boxW = std::sqrt(minSize[minSizeId] * maxSize[minSizeId]);
+            boxH = boxW;
+        }
+        else
+        {
+            int32_t const arOffset = haveMaxSize ? arId - 1 : arId;
+            boxW = minSize[minSizeId] * std::sqrt(aspectRatios[arOffset]);
+            boxH = minSize[minSizeId] / std::sqrt(aspectRatios[arOffset]);
+        }
+        outputData[i * 4] = clip((centerX - boxW / 2.0F) / param.imgW);
+        outputData[i * 4 + 1] = clip((centerY - boxH / 2.0F) / param.imgH);
+        outputData[i * 4 + 2] = clip((centerX + boxW / 2.0F) / param.imgW);
+        outputData[i * 4 + 3] = clip((centerY + boxH / 2.0F) / param.imgH);
+        std::copy_n(param.variance, 4, variance + i * 4);
+    }
+}
+
+void anchorGridHost(GridAnchorParameters const& param, int32_t numAspectRatios, float const* widths,
+    float const* heights, float* outputData)
+{
+    // Same indexing and arithmetic as gridAnchorKernel, where nvcc contracts the centers into an FMA.
+    int32_t const dim = param.H * param.W * numAspectRatios;
+    float const anchorStrideH = 1.0F / param.H;
+    float const anchorStrideW = 1.0F / param.W;
+    float const anchorOffsetH = 0.5F * anchorStrideH;
+    float const anchorOffsetW = 0.5F * anchorStrideW;
+    float* variance = outputData + dim * 4;
+    for (int32_t i = 0; i < dim; ++i)
+    {
+        int32_t const arId = i % numAspectRatios;
+        int32_t const currIndex = i / numAspectRatios;
+        int32_t const w = currIndex % param.W;
+        int32_t const h = currIndex / param.W;
+        float const yC = std::fma(static_cast<float>(h), anchorStrideH, anchorOffsetH);
+        float const xC = std::fma(static_cast<float>(w), anchorStrideW, anchorOffsetW);
+        outputData[i * 4] = xC - 0.5 * widths[arId];
+        outputData[i * 4 + 1] = yC - 0.5 * heights[arId];
+        outputData[i * 4 + 2] = xC + 0.5 * widths[arId];
+        outputData[i * 4 + 3] = yC + 0.5 * heights[arId];
+        std::copy_n(param.variance, 4, variance + i * 4);
+    }
+}
+
+} // namespace nvinfer1::plugin
@@ -116,6 +116,14 @@ pluginStatus_t reorgInference(cudaStream_t stream, int32_t batch, int32_t C, int
 pluginStatus_t anchorGridInference(cudaStream_t stream, nvinfer1::plugin::GridAnchorParameters param,
     int32_t numAspectRatios, void const* aspectRatios, void const* scales, void* outputData);
 
+// Host references of priorBoxInference() and anchorGridInference(), on host arrays. The outputs only depend on the
+// parameters, so plugins generate them once with these and copy them at enqueue.
+void priorBoxHost(nvinfer1::plugin::PriorBoxParameters const& param, int32_t H, int32_t W, int32_t numPriors,
+    int32_t numAspectRatios, float const* minSize, float const* maxSize, float const* aspectRatios, float* outputData);
+
+void anchorGridHost(nvinfer1::plugin::GridAnchorParameters const& param, int32_t numAspectRatios, float const* widths,
+    float const* heights, float* outputData);
+
 pluginStatus_t regionInference(cudaStream_t stream, int32_t batch, int32_t C, int32_t H, int32_t W, int32_t num,
     int32_t coords, int32_t classes, bool hasSoftmaxTree, nvinfer1::plugin::softmaxTree const* smTree,
     void const* input, void* output);
@@ -0,0 +1,587 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/normalizationHost.h"
+
+#include "common/hostParallel.h"
+#include "common/hostSimd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace nvinfer1
+{
+namespace plugin
+{
+namespace
+{
+
+using nvinfer1::pluginInternal::HostSimdLevel;
+using nvinfer1::pluginInternal::parallelFor;
+
+//! Rows are grouped into tasks of at least this many values, so that short rows do not cost one task each.
+constexpr int64_t kMIN_VALUES_PER_TASK{16384};
+
+//! Machine epsilon of FP16, which skipLayerNorm kernels add to the variance of FP16 rows.
+constexpr float kHALF_EPSILON{0.0009765625F};
+
+//! Row kernels, selected once per call for the instruction set of the host.
+struct RowKernels
+{
+    //! Welford's update of the kMOMENT_LANES lanes of mean and m2 with nbBlocks blocks of kMOMENT_LANES values.
+    void (*updateLanes)(float const* values, int64_t nbBlocks, float* mean, float* m2);
+    //! output[i] = gamma[i] * (row[i] - mean) * rsigma + beta[i].
+    void (*normalize)(float const* row, int64_t count, float mean, float rsigma, float const* gamma,
+        float const* beta, float* output);
+    //! output[i] = y < 0 ? y * slope : y, with y = input[i] * a + b.
+    void (*scaleShift)(float const* input, int64_t count, float a, float b, float slope, float* output);
+};
+
+void updateLanesScalar(float const* values, int64_t nbBlocks, float* mean, float* m2)
+{
+    // All the lanes have seen the same number of values, so the reciprocal of the count is shared.
+    for (int64_t b = 0; b < nbBlocks; ++b)
+    {
+        float const* block = values + b * kMOMENT_LANES;
+        float const rCount = 1.F / static_cast<float>(b + 1);
+        for (int32_t l = 0; l < kMOMENT_LANES; ++l)
+        {
+            float const delta = block[l] - mean[l];
+            mean[l] += delta * rCount;
+            m2[l] += delta * (block[l] - mean[l]);
+        }
+    }
+}
+
+void normalizeScalar(float const* row, int64_t count, float mean, float rsigma, float const* gamma,
+    float const* beta, float* output)
+{
+    for (int64_t i = 0; i < count; ++i)
+    {
+        output[i] = gamma[i] * (row[i] - mean) * rsigma + beta[i];
+    }
+}
+
+void scaleShiftScalar(float const* input, int64_t count, float a, float b, float slope, float* output)
+{
+    for (int64_t i = 0; i < count; ++i)
+    {
+        float const y = input[i] * a + b;
+        output[i] = y < 0.F ? y * slope : y;
+    }
+}
+
+#if TRT_PLUGIN_HOST_X86_SIMD
+__attribute__((target("avx2,fma"))) void updateLanesAvx2(
+    float const* values, int64_t nbBlocks, float* mean, float* m2)
+{
+    static_assert(kMOMENT_LANES == 16, "The lanes are held in two AVX2 registers.");
+    __m256 meanLo = _mm256_loadu_ps(mean);
+    __m256 meanHi = _mm256_loadu_ps(mean + 8);
+    __m256 m2Lo = _mm256_loadu_ps(m2);
+    __m256 m2Hi = _mm256_loadu_ps(m2 + 8);
+    for (int64_t b = 0; b < nbBlocks; ++b)
+    {
+        float const* block = values + b * kMOMENT_LANES;
+        __m256 const rCount = _mm256_set1_ps(1.F / static_cast<float>(b + 1));
+        __m256 const xLo = _mm256_loadu_ps(block);
+        __m256 const xHi = _mm256_loadu_ps(block + 8);
+        __m256 const deltaLo = _mm256_sub_ps(xLo, meanLo);
+        __m256 const deltaHi = _mm256_sub_ps(xHi, meanHi);
+        meanLo = _mm256_fmadd_ps(deltaLo, rCount, meanLo);
+        meanHi = _mm256_fmadd_ps(deltaHi, rCount, meanHi);
+        m2Lo = _mm256_fmadd_ps(deltaLo, _mm256_sub_ps(xLo, meanLo), m2Lo);
+        m2Hi = _mm256_fmadd_ps(deltaHi, _mm256_sub_ps(xHi, meanHi), m2Hi);
+    }
+    _mm256_storeu_ps(mean, meanLo);
+    _mm256_storeu_ps(mean + 8, meanHi);
+    _mm256_storeu_ps(m2, m2Lo);
+    _mm256_storeu_ps(m2 + 8, m2Hi);
+}
+
+__attribute__((target("avx2,fma"))) void normalizeAvx2(float const* row, int64_t count, float mean, float rsigma,
+    float const* gamma, float const* beta, float* output)
+{
+    __m256 const m = _mm256_set1_ps(mean);
+    __m256 const r = _mm256_set1_ps(rsigma);
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 const scaled = _mm256_mul_ps(_mm256_loadu_ps(gamma + i), _mm256_sub_ps(_mm256_loadu_ps(row + i), m));
+        _mm256_storeu_ps(output + i, _mm256_fmadd_ps(scaled, r, _mm256_loadu_ps(beta + i)));
+    }
+    normalizeScalar(row + i, count - i, mean, rsigma, gamma + i, beta + i, output + i);
+}
+
+__attribute__((target("avx2,fma"))) void scaleShiftAvx2(
+    float const* input, int64_t count, float a, float b, float slope, float* output)
+{
+    __m256 const va = _mm256_set1_ps(a);
+    __m256 const vb = _mm256_set1_ps(b);
+    __m256 const vSlope = _mm256_set1_ps(slope);
+    int64_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 const y = _mm256_fmadd_ps(_mm256_loadu_ps(input + i), va, vb);
+        __m256 const negative = _mm256_cmp_ps(y, _mm256_setzero_ps(), _CMP_LT_OQ);
+        _mm256_storeu_ps(output + i, _mm256_blendv_ps(y, _mm256_mul_ps(y, vSlope), negative));
+    }
+    scaleShiftScalar(input + i, count - i, a, b, slope, output + i);
+}
+
+__attribute__((target("avx512f"))) void updateLanesAvx512(
+    float const* values, int64_t nbBlocks, float* mean, float* m2)
+{
+    static_assert(kMOMENT_LANES == 16, "The lanes are held in one AVX-512 register.");
+    __m512 vMean = _mm512_loadu_ps(mean);
+    __m512 vM2 = _mm512_loadu_ps(m2);
+    for (int64_t b = 0; b < nbBlocks; ++b)
+    {
+        __m512 const x = _mm512_loadu_ps(values + b * kMOMENT_LANES);
+        __m512 const delta = _mm512_sub_ps(x, vMean);
+        vMean = _mm512_fmadd_ps(delta, _mm512_set1_ps(1.F / static_cast<float>(b + 1)), vMean);
+        vM2 = _mm512_fmadd_ps(delta, _mm512_sub_ps(x, vMean), vM2);
+    }
+    _mm512_storeu_ps(mean, vMean);
+    _mm512_storeu_ps(m2, vM2);
+}
+
+__attribute__((target("avx512f"))) void normalizeAvx512(float const* row, int64_t count, float mean, float rsigma,
+    float const* gamma, float const* beta, float* output)
+{
+    __m512 const m = _mm512_set1_ps(mean);
+    __m512 const r = _mm512_set1_ps(rsigma);
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m512 const scaled = _mm512_mul_ps(_mm512_loadu_ps(gamma + i), _mm512_sub_ps(_mm512_loadu_ps(row + i), m));
+        _mm512_storeu_ps(output + i, _mm512_fmadd_ps(scaled, r, _mm512_loadu_ps(beta + i)));
+    }
+    normalizeScalar(row + i, count - i, mean, rsigma, gamma + i, beta + i, output + i);
+}
+
+__attribute__((target("avx512f"))) void scaleShiftAvx512(
+    float const* input, int64_t count, float a, float b, float slope, float* output)
+{
+    __m512 const va = _mm512_set1_ps(a);
+    __m512 const vb = _mm512_set1_ps(b);
+    __m512 const vSlope = _mm512_set1_ps(slope);
+    int64_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m512 const y = _mm512_fmadd_ps(_mm512_loadu_ps(input + i), va, vb);
+        __mmask16 const negative = _mm512_cmp_ps_mask(y, _mm512_setzero_ps(), _CMP_LT_OQ);
+        _mm512_storeu_ps(output + i, _mm512_mask_mul_ps(y, negative, y, vSlope));
+    }
+    scaleShiftScalar(input + i, count - i, a, b, slope, output + i);
+}
+#endif
+
+RowKernels getRowKernels()
+{
+    RowKernels kernels{updateLanesScalar, normalizeScalar, scaleShiftScalar};
+#if TRT_PLUGIN_HOST_X86_SIMD
+    switch (nvinfer1::pluginInternal::getHostSimdLevel())
+    {
+    case HostSimdLevel::kAVX512: kernels = {updateLanesAvx512, normalizeAvx512, scaleShiftAvx512}; break;
+    case HostSimdLevel::kAVX2: kernels = {updateLanesAvx2, normalizeAvx2, scaleShiftAvx2}; break;
+    case HostSimdLevel::kSCALAR: break;
+    }
+#endif
+    return kernels;
+}
+
+RowMoments computeMoments(RowKernels const& kernels, float const* values, int64_t count)
+{
+    float mean[kMOMENT_LANES] = {};
+    float m2[kMOMENT_LANES] = {};
+    int64_t const nbBlocks = count / kMOMENT_LANES;
+    kernels.updateLanes(values, nbBlocks, mean, m2);
+
+    // Merge the lanes pairwise with Chan's formula, which for two sets of c values each reduces to
+    // M2 = M2a + M2b + (meanB - meanA)^2 * c / 2.
+    auto laneCount = static_cast<float>(nbBlocks);
+    for (int32_t width = kMOMENT_LANES / 2; width > 0; width /= 2)
+    {
+        for (int32_t l = 0; l < width; ++l)
+        {
+            float const delta = mean[l + width] - mean[l];
+            mean[l] = 0.5F * (mean[l] + mean[l + width]);
+            m2[l] += m2[l + width] + delta * delta * laneCount * 0.5F;
+        }
+        laneCount *= 2.F;
+    }
+
+    float totalMean = mean[0];
+    float totalM2 = m2[0];
+    for (int64_t i = nbBlocks * kMOMENT_LANES; i < count; ++i)
+    {
+        float const delta = values[i] - totalMean;
+        totalMean += delta / static_cast<float>(i + 1);
+        totalM2 += delta * (values[i] - totalMean);
+    }
+    return RowMoments{totalMean, count > 0 ? totalM2 / static_cast<float>(count) : 0.F};
+}
+
+float getTypeEpsilon(float const*)
+{
+    return std::numeric_limits<float>::epsilon();
+}
+
+float getTypeEpsilon(__half const*)
+{
+    return kHALF_EPSILON;
+}
+
+//! Return values[0, count) as FP32, converted into scratch if needed.
+float const* getFloatValues(float const* values, int64_t /* count */, std::vector<float>& /* scratch */)
+{
+    return values;
+}
+
+float const* getFloatValues(__half const* values, int64_t count, std::vector<float>& scratch)
+{
+    scratch.resize(count);
+    nvinfer1::pluginInternal::convertToFloat(values, scratch.data(), count);
+    return scratch.data();
+}
+
+//! Return where to write count FP32 values of output: output itself, or scratch, stored by storeFloatValues().
+float* getFloatOutput(float* output, int64_t /* count */, std::vector<float>& /* scratch */)
+{
+    return output;
+}
+
+float* getFloatOutput(__half* /* output */, int64_t count, std::vector<float>& scratch)
+{
+    scratch.resize(count);
+    return scratch.data();
+}
+
+void storeFloatValues(float const* /* values */, int64_t /* count */, float* /* output */) {}
+
+void storeFloatValues(float const* values, int64_t count, __half* output)
+{
+    nvinfer1::pluginInternal::convertToHalf(values, output, count);
+}
+
+template <typename T>
+std::vector<float> toFloatVector(T const* values, int64_t count)
+{
+    std::vector<float> result(count);
+    if (values != nullptr)
+    {
+        std::vector<float> scratch;
+        float const* floats = getFloatValues(values, count, scratch);
+        std::copy(floats, floats + count, result.begin());
+    }
+    return result;
+}
+
+//! Return the number of rows of rowSize values per task.
+int64_t getRowsPerTask(int64_t rowSize)
+{
+    return std::max(kMIN_VALUES_PER_TASK / std::max(rowSize, static_cast<int64_t>(1)), static_cast<int64_t>(1));
+}
+
+//! FP32 buffers of a task: the row to normalize, its FP16 operands converted to FP32, and its output.
+struct RowScratch
+{
+    explicit RowScratch(int64_t ld)
+        : row(ld)
+    {
+    }
+
+    std::vector<float> row;
+    std::vector<float> operands[3];
+    std::vector<float> output;
+};
+
+//! Write gamma * (x - mean) / sqrt(variance + epsilon) + beta for each value x of a row.
+template <typename T>
+void normalizeRow(RowKernels const& kernels, float const* row, int64_t ld, float epsilon, float const* gamma,
+    float const* beta, T* output, std::vector<float>& scratch)
+{
+    RowMoments const moments = computeMoments(kernels, row, ld);
+    float* out = getFloatOutput(output, ld, scratch);
+    kernels.normalize(row, ld, moments.mean, 1.F / std::sqrt(moments.variance + epsilon), gamma, beta, out);
+    storeFloatValues(out, ld, output);
+}
+
+//! Write count FP32 values to output.
+template <typename T>
+void copyFloatValues(float const* values, int64_t count, T* output, std::vector<float>& scratch)
+{
+    float* out = getFloatOutput(output, count, scratch);
+    std::copy(values, values + count, out);
+    storeFloatValues(out, count, output);
+}
+
+template <typename T>
+void skipLayerNormHostImpl(int32_t ld, int64_t n, T const* input, T const* skip, T const* beta, T const* gamma,
+    T* output, T const* bias, int32_t numThreads)
+{
+    auto const kernels = getRowKernels();
+    auto const betaF = toFloatVector(beta, ld);
+    auto const gammaF = toFloatVector(gamma, ld);
+    auto const biasF = toFloatVector(bias, ld);
+    float const epsilon = getTypeEpsilon(input);
+    int64_t const rowsPerTask = getRowsPerTask(ld);
+    int64_t const nbRows = n / ld;
+    parallelFor((nbRows + rowsPerTask - 1) / rowsPerTask, numThreads, [&](int64_t task) {
+        RowScratch scratch(ld);
+        int64_t const end = std::min((task + 1) * rowsPerTask, nbRows);
+        for (int64_t r = task * rowsPerTask; r < end; ++r)
+        {
+            int64_t const offset = r * ld;
+            float const* in = getFloatValues(input + offset, ld, scratch.operands[0]);
+            float const* sk = getFloatValues(skip + offset, ld, scratch.operands[1]);
+            for (int32_t i = 0; i < ld; ++i)
+            {
+                scratch.row[i] = in[i] + sk[i] + biasF[i];
+            }
+            normalizeRow(kernels, scratch.row.data(), ld, epsilon, gammaF.data(), betaF.data(), output + offset,
+                scratch.output);
+        }
+    });
+}
+
+//! Embedding tables and parameters shared by the embLayerNorm variants.
+template <typename T>
+struct EmbeddingTables
+{
+    int32_t ld;
+    float const* beta;
+    float const* gamma;
+    T const* wordEmb;
+    T const* posEmb;
+    T const* tokEmb;
+    int32_t wordSize;
+    int32_t tokSize;
+};
+
+//! Normalize the embedding sum of a token at a position, writing the sum to skip if not null.
+template <typename T>
+void embedToken(RowKernels const& kernels, EmbeddingTables<T> const& tables, int32_t wordId, int32_t tokenId,
+    int32_t position, RowScratch& scratch, T* output, T* skip)
+{
+    int32_t const ld = tables.ld;
+    if (wordId < 0 || wordId >= tables.wordSize || tokenId < 0 || tokenId >= tables.tokSize)
+    {
+        copyFloatValues(tables.beta, ld, output, scratch.output);
+        return;
+    }
+    float const* word = getFloatValues(tables.wordEmb + static_cast<int64_t>(wordId) * ld, ld, scratch.operands[0]);
+    float const* token = getFloatValues(tables.tokEmb + static_cast<int64_t>(tokenId) * ld, ld, scratch.operands[1]);
+    float const* pos = getFloatValues(tables.posEmb + static_cast<int64_t>(position) * ld, ld, scratch.operands[2]);
+    float* row = scratch.row.data();
+    for (int32_t i = 0; i < ld; ++i)
+    {
+        row[i] = word[i] + token[i] + pos[i];
+    }
+    if (skip != nullptr)
+    {
+        copyFloatValues(row, ld, skip, scratch.output);
+    }
+    normalizeRow(kernels, row, ld, 0.F, tables.gamma, tables.beta, output, scratch.output);
+}
+
+template <typename T>
+void embLayerNormHostImpl(EmbeddingTables<T> const& tables, int32_t B, int32_t S, int32_t const* inputIds,
+    int32_t const* tokenIds, T* output, int32_t numThreads)
+{
+    auto const kernels = getRowKernels();
+    int32_t const ld = tables.ld;
+    int64_t const nbTokens = static_cast<int64_t>(S) * B;
+    int64_t const tokensPerTask = getRowsPerTask(ld);
+    parallelFor((nbTokens + tokensPerTask - 1) / tokensPerTask, numThreads, [&](int64_t task) {
+        RowScratch scratch(ld);
+        int64_t const end = std::min((task + 1) * tokensPerTask, nbTokens);
+        for (int64_t t = task * tokensPerTask; t < end; ++t)
+        {
+            // Ids are [S, B], so token t is at position t / B.
+            embedToken(kernels, tables, inputIds[t], tokenIds[t], static_cast<int32_t>(t / B), scratch,
+                output + t * ld, static_cast<T*>(nullptr));
+        }
+    });
+}
+
+template <typename T>
+void embLayerNormVarSeqlenHostImpl(EmbeddingTables<T> const& tables, int32_t B, int32_t S, int32_t const* inputIds,
+    int32_t const* tokenIds, int32_t const* cuSeqlens, T* output, T* skip, int32_t numThreads)
+{
+    auto const kernels = getRowKernels();
+    int32_t const ld = tables.ld;
+    int64_t const nbTokens = cuSeqlens[B];
+    // Position of each packed token in its sequence, or -1 past the S first tokens, which are not computed.
+    std::vector<int32_t> positions(nbTokens, -1);
+    for (int32_t b = 0; b < B; ++b)
+    {
+        int32_t const length = std::min(cuSeqlens[b + 1] - cuSeqlens[b], S);
+        for (int32_t s = 0; s < length; ++s)
+        {
+            positions[cuSeqlens[b] + s] = s;
+        }
+    }
+
+    int64_t const tokensPerTask = getRowsPerTask(ld);
+    parallelFor((nbTokens + tokensPerTask - 1) / tokensPerTask, numThreads, [&](int64_t task) {
+        RowScratch scratch(ld);
+        int64_t const end = std::min((task + 1) * tokensPerTask, nbTokens);
+        for (int64_t t = task * tokensPerTask; t < end; ++t)
+        {
+            if (positions[t] >= 0)
+            {
+                embedToken(kernels, tables, inputIds[t], tokenIds[t], positions[t], scratch, output + t * ld,
+                    skip == nullptr ? nullptr : skip + t * ld);
+            }
+        }
+    });
+}
+
+template <typename T>
+void instanceNormHostImpl(int32_t batchSize, int32_t nbChannels, int64_t channelVolume, float epsilon,
+    T const* input, float const* scale, float const* bias, bool relu, float alpha, T* output, int32_t numThreads)
+{
+    auto const kernels = getRowKernels();
+    int64_t const planesPerTask = getRowsPerTask(channelVolume);
+    int64_t const nbPlanes = static_cast<int64_t>(batchSize) * nbChannels;
+    parallelFor((nbPlanes + planesPerTask - 1) / planesPerTask, numThreads, [&](int64_t task) {
+        std::vector<float> planeScratch;
+        std::vector<float> outputScratch;
+        int64_t const end = std::min((task + 1) * planesPerTask, nbPlanes);
+        for (int64_t p = task * planesPerTask; p < end; ++p)
+        {
+            int64_t const offset = p * channelVolume;
+            float const* plane = getFloatValues(input + offset, channelVolume, planeScratch);
+            RowMoments const moments = computeMoments(kernels, plane, channelVolume);
+            int32_t const c = static_cast<int32_t>(p % nbChannels);
+            // Fold the normalization and the scale and shift of the channel into one multiply-add.
+            float const a = scale[c] / std::sqrt(moments.variance + epsilon);
+            float const b = bias[c] - moments.mean * a;
+            float* out = getFloatOutput(output + offset, channelVolume, outputScratch);
+            kernels.scaleShift(plane, channelVolume, a, b, relu ? alpha : 1.F, out);
+            storeFloatValues(out, channelVolume, output + offset);
+        }
+    });
+}
+
+} // namespace
+
+RowMoments computeRowMoments(float const* values, int64_t count)
+{
+    return computeMoments(getRowKernels(), values, count);
+}
+
+void skipLayerNormHost(int32_t ld, int64_t n, float const* input, float const* skip, float const* beta,
+    float const* gamma, float* output, float const* bias, int32_t numThreads)
+{
+    skipLayerNormHostImpl(ld, n, input, skip, beta, gamma, output, bias, numThreads);
+}
+
+void skipLayerNormHost(int32_t ld, int64_t n, __half const* input, __half const* skip, __half const* beta,
+    __half const* gamma, __half* output, __half const* bias, int32_t numThreads)
+{
+    skipLayerNormHostImpl(ld, n, input, skip, beta, gamma, output, bias, numThreads);
+}
+
+void embLayerNormHost(int32_t ld, int32_t B, int32_t S, int32_t const* inputIds, int32_t const* tokenIds,
+    float const* beta, float const* gamma, float const* wordEmb, float const* posEmb, float const* tokEmb,
+    int32_t wordSize, int32_t tokSize, float* output, int32_t numThreads)
+{
+    EmbeddingTables<float> const tables{ld, beta, gamma, wordEmb, posEmb, tokEmb, wordSize, tokSize};
+    embLayerNormHostImpl(tables, B, S, inputIds, tokenIds, output, numThreads);
+}
+
+void embLayerNormHost(int32_t ld, int32_t B, int32_t S, int32_t const* inputIds, int32_t const* tokenIds,
+    float const* beta, float const* gamma, __half const* wordEmb, __half const* posEmb, __half const* tokEmb,
+    int32_t wordSize, int32_t tokSize, __half* output, int32_t numThreads)
+{
+    EmbeddingTables<__half> const tables{ld, beta, gamma, wordEmb, posEmb, tokEmb, wordSize, tokSize};
+    embLayerNormHostImpl(tables, B, S, inputIds, tokenIds, output, numThreads);
+}
+
+void embLayerNormVarSeqlenHost(int32_t ld, int32_t B, int32_t S, int32_t const* inputIds, int32_t const* tokenIds,
+    int32_t const* cuSeqlens, float const* beta, float const* gamma, float const* wordEmb, float const* posEmb,
+    float const* tokEmb, int32_t wordSize, int32_t tokSize, float* output, float* skip, int32_t numThreads)
+{
+    EmbeddingTables<float> const tables{ld, beta, gamma, wordEmb, posEmb, tokEmb, wordSize, tokSize};
+    embLayerNormVarSeqlenHostImpl(tables, B, S, inputIds, tokenIds, cuSeqlens, output, skip, numThreads);
+}
+
+void embLayerNormVarSeqlenHost(int32_t ld, int32_t B, int32_t S, int32_t const* inputIds, int32_t const* tokenIds,
+    int32_t const* cuSeqlens, float const* beta, float const* gamma, __half const* wordEmb, __half const* posEmb,
+    __half const* tokEmb, int32_t wordSize, int32_t tokSize, __half* output, __half* skip, int32_t numThreads)
+{
+    EmbeddingTables<__half> const tables{ld, beta, gamma, wordEmb, posEmb, tokEmb, wordSize, tokSize};
+    embLayerNormVarSeqlenHostImpl(tables, B, S, inputIds, tokenIds, cuSeqlens, output, skip, numThreads);
+}
+
+void computeMaskIdxHost(int32_t S, int32_t B, int32_t const* mask, int32_t* maskIdx)
+{
+    for (int32_t b = 0; b < B; ++b)
+    {
+        int32_t s = 0;
+        while (s < S && mask[static_cast<int64_t>(s) * B + b] != 0)
+        {
+            ++s;
+        }
+        maskIdx[b] = s;
+    }
+}
+
+void groupNormHost(int32_t batchSize, int32_t nbChannels, int64_t channelVolume, int32_t nbGroups, float epsilon,
+    float const* input, float const* gamma, float const* beta, float* output, int32_t numThreads)
+{
+    auto const kernels = getRowKernels();
+    int32_t const channelsPerGroup = nbChannels / nbGroups;
+    int64_t const groupSize = channelsPerGroup * channelVolume;
+    parallelFor(static_cast<int64_t>(batchSize) * nbGroups, numThreads, [&](int64_t task) {
+        int64_t const offset = task * groupSize;
+        RowMoments const moments = computeMoments(kernels, input + offset, groupSize);
+        float const rsigma = 1.F / std::sqrt(moments.variance + epsilon);
+        int32_t const firstChannel = static_cast<int32_t>(task % nbGroups) * channelsPerGroup;
+        for (int32_t c = 0; c < channelsPerGroup; ++c)
+        {
+            float const a = gamma[firstChannel + c] * rsigma;
+            float const b = beta[firstChannel + c] - moments.mean * a;
+            int64_t const channelOffset = offset + c * channelVolume;
+            kernels.scaleShift(input + channelOffset, channelVolume, a, b, 1.F, output + channelOffset);
+        }
+    });
+}
+
+void instanceNormHost(int32_t batchSize, int32_t nbChannels, int64_t channelVolume, float epsilon,
+    float const* input, float const* scale, float const* bias, bool relu, float alpha, float* output,
+    int32_t numThreads)
+{
+    instanceNormHostImpl(
+        batchSize, nbChannels, channelVolume, epsilon, input, scale, bias, relu, alpha, output, numThreads);
+}
+
+void instanceNormHost(int32_t batchSize, int32_t nbChannels, int64_t channelVolume, float epsilon,
+    __half const* input, float const* scale, float const* bias, bool relu, float alpha, __half* output,
+    int32_t numThreads)
+{
+    instanceNormHostImpl(
+        batchSize, nbChannels, channelVolume, epsilon, input, scale, bias, relu, alpha, output, numThreads);
+}
+
+} // namespace plugin
+} // namespace nvinfer1
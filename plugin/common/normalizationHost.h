@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_PLUGIN_NORMALIZATION_HOST_H
+#define TRT_PLUGIN_NORMALIZATION_HOST_H
+
+#include <cstdint>
+#include <cuda_fp16.h>
+
+//!
+//! Host implementations of the normalization plugins, on host buffers with the layouts of their tensors.
+//!
+//! Statistics are computed in FP32 in a single pass over each row or group with Welford's algorithm, run on
+//! kMOMENT_LANES interleaved partial sums and then merged. Rows and groups are normalized in parallel. The statistics
+//! and the normalization use AVX2 with FMA or AVX-512 when the CPU supports them, which changes the rounding. FP16
+//! tensors are converted row by row, with F16C when available, so the results may differ from the CUDA kernels, which
+//! accumulate some of the sums in FP16, by FP16 rounding.
+//!
+//! These implementations are not part of the plugin library. They are compiled into plugin_host_benchmark, which times
+//! them and compares them with the CUDA plugins.
+//!
+//! numThreads is the number of threads, or 0 for one per hardware thread.
+//!
+
+namespace nvinfer1
+{
+namespace plugin
+{
+
+//! Number of interleaved partial statistics of computeRowMoments().
+constexpr int32_t kMOMENT_LANES{16};
+
+//! Mean and population variance of a set of values.
+struct RowMoments
+{
+    float mean;
+    float variance;
+};
+
+//! Return the mean and population variance of values[0, count), computed in one pass.
+RowMoments computeRowMoments(float const* values, int64_t count);
+
+//!
+//! \brief Host implementation of computeSkipLayerNorm(): layer normalization of input + skip (+ bias) over rows of ld
+//! values, with epsilon the machine epsilon of the tensor type as in the CUDA kernels.
+//!
+//! \param n Number of values of input, skip and output.
+//! \param beta, gamma, bias [ld] parameters. bias may be null.
+//!
+void skipLayerNormHost(int32_t ld, int64_t n, float const* input, float const* skip, float const* beta,
+    float const* gamma, float* output, float const* bias, int32_t numThreads = 0);
+
+void skipLayerNormHost(int32_t ld, int64_t n, __half const* input, __half const* skip, __half const* beta,
+    __half const* gamma, __half* output, __half const* bias, int32_t numThreads = 0);
+
+//!
+//! \brief Host implementation of embSkipLayerNorm(): layer normalization, without epsilon, of the sum of the word,
+//! position and token type embeddings of each token.
+//!
+//! Tokens with an out of range word or token type id are set to beta, where the CUDA output is undefined.
+//!
+//! \param inputIds, tokenIds [S, B] ids.
+//! \param wordEmb, posEmb, tokEmb [wordSize, ld], [S, ld] and [tokSize, ld] embeddings.
+//! \param output [S, B, ld] output.
+//!
+void embLayerNormHost(int32_t ld, int32_t B, int32_t S, int32_t const* inputIds, int32_t const* tokenIds,
+    float const* beta, float const* gamma, float const* wordEmb, float const* posEmb, float const* tokEmb,
+    int32_t wordSize, int32_t tokSize, float* output, int32_t numThreads = 0);
+
+void embLayerNormHost(int32_t ld, int32_t B, int32_t S, int32_t const* inputIds, int32_t const* tokenIds,
+    float const* beta, float const* gamma, __half const* wordEmb, __half const* posEmb, __half const* tokEmb,
+    int32_t wordSize, int32_t tokSize, __half* output, int32_t numThreads = 0);
+
+//!
+//! \brief Host implementation of embSkipLayerNormHFace() and embSkipLayerNormMTron(), the packed variable sequence
+//! length variants of embLayerNormHost().
+//!
+//! \param inputIds, tokenIds [cuSeqlens[B]] packed ids.
+//! \param cuSeqlens [B + 1] offsets of the sequences, which are at most S long.
+//! \param output [cuSeqlens[B], ld] output.
+//! \param skip [cuSeqlens[B], ld] output of the embedding sums before normalization, as in the MTron variant, or
+//! null.
+//!
+void embLayerNormVarSeqlenHost(int32_t ld, int32_t B, int32_t S, int32_t const* inputIds, int32_t const* tokenIds,
+    int32_t const* cuSeqlens, float const* beta, float const* gamma, float const* wordEmb, float const* posEmb,
+    float const* tokEmb, int32_t wordSize, int32_t tokSize, float* output, float* skip, int32_t numThreads = 0);
+
+void embLayerNormVarSeqlenHost(int32_t ld, int32_t B, int32_t S, int32_t const* inputIds, int32_t const* tokenIds,
+    int32_t const* cuSeqlens, float const* beta, float const* gamma, __half const* wordEmb, __half const* posEmb,
+    __half const* tokEmb, int32_t wordSize, int32_t tokSize, __half* output, __half* skip, int32_t numThreads = 0);
+
+//!
+//! \brief Host implementation of computeMaskIdx(): position of the first masked token of each sequence of an [S, B]
+//! mask, or S if none is.
+//!
+void computeMaskIdxHost(int32_t S, int32_t B, int32_t const* mask, int32_t* maskIdx);
+
+//!
+//! \brief Host implementation of GroupNormalizationPlugin: normalization of the [nbChannels / nbGroups,
+//! channelVolume] values of each group, then scale and shift of each channel.
+//!
+//! \param input, output [batchSize, nbChannels, channelVolume] tensors.
+//! \param gamma, beta [nbChannels] scale and shift.
+//!
+void groupNormHost(int32_t batchSize, int32_t nbChannels, int64_t channelVolume, int32_t nbGroups, float epsilon,
+    float const* input, float const* gamma, float const* beta, float* output, int32_t numThreads = 0);
+
+//!
+//! \brief Host implementation of InstanceNormalizationPlugin: normalization of each channel of each image, then scale
+//! and shift of each channel, followed by a leaky ReLU of slope alpha if relu is set.
+//!
+//! \param input, output [batchSize, nbChannels, channelVolume] tensors.
+//! \param scale, bias [nbChannels] scale and shift.
+//!
+void instanceNormHost(int32_t batchSize, int32_t nbChannels, int64_t channelVolume, float epsilon,
+    float const* input, float const* scale, float const* bias, bool relu, float alpha, float* output,
+    int32_t numThreads = 0);
+
+void instanceNormHost(int32_t batchSize, int32_t nbChannels, int64_t channelVolume, float epsilon,
+    __half const* input, float const* scale, float const* bias, bool relu, float alpha, __half* output,
+    int32_t numThreads = 0);
+
+} // namespace plugin
+} // namespace nvinfer1
+
+#endif // TRT_PLUGIN_NORMALIZATION_HOST_H
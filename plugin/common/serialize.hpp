@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 1993-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -19,6 +19,8 @@
 #include <cstring>
 #include <vector>
 #include <cassert>
+#include <cstdint>
+#include <string_view>
 #include <type_traits>
 
 #include <iostream>
@@ -32,9 +34,93 @@ inline void serialize_value(void** buffer, T const& value);
 template <typename T>
 inline void deserialize_value(void const** buffer, size_t* buffer_size, T* value);
 
+template <typename T>
+inline bool try_deserialize_value(void const** buffer, size_t* buffer_size, T* value);
+
+//!
+//! \brief Read-only view of an array of a serialized buffer, which references the buffer instead of copying it.
+//!
+//! The view is only valid as long as the buffer. Serialized arrays are not necessarily aligned for T, so elements are
+//! read with memcpy, and data() is only a byte pointer.
+//!
+template <typename T>
+class SerializedView
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SerializedView requires a trivially copyable type");
+
+public:
+    SerializedView() = default;
+
+    SerializedView(void const* data, size_t size)
+        : mData(static_cast<char const*>(data))
+        , mSize(size)
+    {
+    }
+
+    char const* data() const
+    {
+        return mData;
+    }
+
+    size_t size() const
+    {
+        return mSize;
+    }
+
+    size_t size_bytes() const
+    {
+        return mSize * sizeof(T);
+    }
+
+    bool empty() const
+    {
+        return mSize == 0;
+    }
+
+    T operator[](size_t i) const
+    {
+        assert(i < mSize);
+        T value;
+        ::memcpy(&value, mData + i * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    void copy_to(T* dst) const
+    {
+        if (mSize != 0)
+        {
+            ::memcpy(dst, mData, size_bytes());
+        }
+    }
+
+    std::vector<T> to_vector() const
+    {
+        std::vector<T> values(mSize);
+        copy_to(values.data());
+        return values;
+    }
+
+private:
+    char const* mData{nullptr};
+    size_t mSize{0};
+};
+
 namespace
 {
 
+//! Consume nbyte bytes of the buffer into *data, or return false if it is shorter.
+inline bool consume_bytes(void const** buffer, size_t* buffer_size, size_t nbyte, char const** data)
+{
+    if (*buffer_size < nbyte)
+    {
+        return false;
+    }
+    *data = static_cast<char const*>(*buffer);
+    reinterpret_cast<char const*&>(*buffer) += nbyte;
+    *buffer_size -= nbyte;
+    return true;
+}
+
 template <typename T, class Enable = void>
 struct Serializer
 {
@@ -59,6 +145,16 @@ struct Serializer<T, typename std::enable_if_t<std::is_arithmetic_v<T> || std::i
         reinterpret_cast<char const*&>(*buffer) += sizeof(T);
         *buffer_size -= sizeof(T);
     }
+    static bool try_deserialize(void const** buffer, size_t* buffer_size, T* value)
+    {
+        char const* data{nullptr};
+        if (!consume_bytes(buffer, buffer_size, sizeof(T), &data))
+        {
+            return false;
+        }
+        ::memcpy(value, data, sizeof(T));
+        return true;
+    }
 };
 
 template <>
@@ -81,6 +177,20 @@ struct Serializer<const char*>
         reinterpret_cast<char const*&>(*buffer) += data_size;
         *buffer_size -= data_size;
     }
+    static bool try_deserialize(void const** buffer, size_t* buffer_size, const char** value)
+    {
+        char const* str = static_cast<char const*>(*buffer);
+        size_t const length = strnlen(str, *buffer_size);
+        // The terminator must be in the buffer.
+        if (length == *buffer_size)
+        {
+            return false;
+        }
+        char const* data{nullptr};
+        consume_bytes(buffer, buffer_size, length + 1, &data);
+        *value = data;
+        return true;
+    }
 };
 
 template <typename T>
@@ -109,6 +219,46 @@ struct Serializer<std::vector<T>,
         reinterpret_cast<char const*&>(*buffer) += nbyte;
         *buffer_size -= nbyte;
     }
+    static bool try_deserialize(void const** buffer, size_t* buffer_size, std::vector<T>* value)
+    {
+        SerializedView<T> view;
+        if (!try_deserialize_value(buffer, buffer_size, &view))
+        {
+            return false;
+        }
+        value->resize(view.size());
+        view.copy_to(value->data());
+        return true;
+    }
+};
+
+//! Views deserialize the format of std::vector<T> without copying the elements.
+template <typename T>
+struct Serializer<SerializedView<T>>
+{
+    static bool try_deserialize(void const** buffer, size_t* buffer_size, SerializedView<T>* value)
+    {
+        void const* const start = *buffer;
+        size_t const start_size = *buffer_size;
+        size_t size{0};
+        char const* data{nullptr};
+        // Compare counts rather than byte sizes, which may overflow for corrupted sizes.
+        if (!try_deserialize_value(buffer, buffer_size, &size) || size > *buffer_size / sizeof(T)
+            || !consume_bytes(buffer, buffer_size, size * sizeof(T), &data))
+        {
+            *buffer = start;
+            *buffer_size = start_size;
+            return false;
+        }
+        *value = SerializedView<T>(data, size);
+        return true;
+    }
+    static void deserialize(void const** buffer, size_t* buffer_size, SerializedView<T>* value)
+    {
+        bool const success = try_deserialize(buffer, buffer_size, value);
+        assert(success);
+        static_cast<void>(success);
+    }
 };
 
 template <>
@@ -136,6 +286,38 @@ struct Serializer<std::string>
         reinterpret_cast<char const*&>(*buffer) += nbyte;
         *buffer_size -= nbyte;
     }
+    static bool try_deserialize(void const** buffer, size_t* buffer_size, std::string* value)
+    {
+        std::string_view view;
+        if (!try_deserialize_value(buffer, buffer_size, &view))
+        {
+            return false;
+        }
+        value->assign(view);
+        return true;
+    }
+};
+
+//! String views deserialize the format of std::string without copying the characters.
+template <>
+struct Serializer<std::string_view>
+{
+    static bool try_deserialize(void const** buffer, size_t* buffer_size, std::string_view* value)
+    {
+        SerializedView<char> view;
+        if (!Serializer<SerializedView<char>>::try_deserialize(buffer, buffer_size, &view))
+        {
+            return false;
+        }
+        *value = std::string_view(view.data(), view.size());
+        return true;
+    }
+    static void deserialize(void const** buffer, size_t* buffer_size, std::string_view* value)
+    {
+        bool const success = try_deserialize(buffer, buffer_size, value);
+        assert(success);
+        static_cast<void>(success);
+    }
 };
 
 } // namespace
@@ -157,3 +339,42 @@ inline void deserialize_value(void const** buffer, size_t* buffer_size, T* value
 {
     return Serializer<T>::deserialize(buffer, buffer_size, value);
 }
+
+//! Deserialize a value, or return false and leave the buffer unchanged if it is truncated.
+template <typename T>
+inline bool try_deserialize_value(void const** buffer, size_t* buffer_size, T* value)
+{
+    return Serializer<T>::try_deserialize(buffer, buffer_size, value);
+}
+
+//! View the next count elements of the buffer, which are serialized without a size, such as weights whose size
+//! follows from other fields. Return false and leave the buffer unchanged if it is truncated.
+template <typename T>
+inline bool try_deserialize_view(void const** buffer, size_t* buffer_size, size_t count, SerializedView<T>* value)
+{
+    char const* data{nullptr};
+    if (count > *buffer_size / sizeof(T) || !consume_bytes(buffer, buffer_size, count * sizeof(T), &data))
+    {
+        return false;
+    }
+    *value = SerializedView<T>(data, count);
+    return true;
+}
+
+//!
+//! \brief Deserialize a field added in version since_version of a serialization format.
+//!
+//! The field is read if the buffer was written by that version or a later one, and set to default_value otherwise, so
+//! that buffers of earlier versions remain readable. Return false if the buffer is truncated.
+//!
+template <typename T>
+inline bool try_deserialize_versioned_value(void const** buffer, size_t* buffer_size, uint32_t version,
+    uint32_t since_version, T* value, T const& default_value)
+{
+    if (version < since_version)
+    {
+        *value = default_value;
+        return true;
+    }
+    return try_deserialize_value(buffer, buffer_size, value);
+}
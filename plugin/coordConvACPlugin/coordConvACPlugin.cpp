@@ -25,8 +25,6 @@ using namespace nvinfer1::plugin;
 
 namespace
 {
-char const* const kCOORDCONV_AC_PLUGIN_VERSION{"1"};
-char const* const kCOORDCONV_AC_PLUGIN_NAME{"CoordConvAC"};
 int32_t const kNUM_COORDCONV_CHANNELS = 2;
 } // namespace
 
@@ -29,6 +29,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kCOORDCONV_AC_PLUGIN_VERSION{"1"};
+constexpr char const* kCOORDCONV_AC_PLUGIN_NAME{"CoordConvAC"};
 
 class TRT_DEPRECATED CoordConvACPlugin : public IPluginV2Ext
 {
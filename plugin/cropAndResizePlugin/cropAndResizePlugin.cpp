@@ -24,13 +24,6 @@
 
 namespace nvinfer1::plugin
 {
-// Plugin-specific constants
-namespace
-{
-char const* const kCROP_AND_RESIZE_DYNAMIC_PLUGIN_VERSION{"2"};
-char const* const kCROP_AND_RESIZE_DYNAMIC_PLUGIN_NAME{"CropAndResizeDynamic"};
-} // namespace
-
 // Static class fields initialization
 PluginFieldCollection CropAndResizeDynamicPlugin::mFCToSerialize{};
 std::vector<PluginField> CropAndResizeDynamicPlugin::mDataToSerialize{};
@@ -28,6 +28,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kCROP_AND_RESIZE_DYNAMIC_PLUGIN_VERSION{"2"};
+constexpr char const* kCROP_AND_RESIZE_DYNAMIC_PLUGIN_NAME{"CropAndResizeDynamic"};
 
 //!
 //! \brief CropAndResizeDynamicPlugin implements a TensorRT plugin that performs
@@ -24,15 +24,6 @@
 
 namespace nvinfer1::plugin
 {
-// Plugin-specific constants
-namespace
-{
-char const* const kCROP_AND_RESIZE_PLUGIN_VERSION{"1"};
-char const* const kCROP_AND_RESIZE_DYNAMIC_PLUGIN_VERSION{"1"};
-char const* const kCROP_AND_RESIZE_PLUGIN_NAME{"CropAndResize"};
-char const* const kCROP_AND_RESIZE_DYNAMIC_PLUGIN_NAME{"CropAndResizeDynamic"};
-} // namespace
-
 // Static class fields initialization for Legacy creators
 PluginFieldCollection CropAndResizeBasePluginCreator::mFC{};
 std::vector<PluginField> CropAndResizeBasePluginCreator::mPluginAttributes;
@@ -109,7 +100,7 @@ char const* CropAndResizePlugin::getPluginType() const noexcept
 
 char const* CropAndResizeDynamicPluginLegacy::getPluginType() const noexcept
 {
-    return kCROP_AND_RESIZE_DYNAMIC_PLUGIN_NAME;
+    return kCROP_AND_RESIZE_DYNAMIC_LEGACY_PLUGIN_NAME;
 }
 
 char const* CropAndResizePlugin::getPluginVersion() const noexcept
@@ -119,7 +110,7 @@ char const* CropAndResizePlugin::getPluginVersion() const noexcept
 
 char const* CropAndResizeDynamicPluginLegacy::getPluginVersion() const noexcept
 {
-    return kCROP_AND_RESIZE_DYNAMIC_PLUGIN_VERSION;
+    return kCROP_AND_RESIZE_DYNAMIC_LEGACY_PLUGIN_VERSION;
 }
 
 int32_t CropAndResizePlugin::getNbOutputs() const noexcept
@@ -534,8 +525,8 @@ CropAndResizePluginCreator::CropAndResizePluginCreator()
 
 CropAndResizeDynamicPluginLegacyCreator::CropAndResizeDynamicPluginLegacyCreator()
 {
-    mPluginName = kCROP_AND_RESIZE_DYNAMIC_PLUGIN_NAME;
-    mPluginVersion = kCROP_AND_RESIZE_DYNAMIC_PLUGIN_VERSION;
+    mPluginName = kCROP_AND_RESIZE_DYNAMIC_LEGACY_PLUGIN_NAME;
+    mPluginVersion = kCROP_AND_RESIZE_DYNAMIC_LEGACY_PLUGIN_VERSION;
 }
 
 IPluginV2Ext* CropAndResizePluginCreator::createPlugin(char const* /* name */, PluginFieldCollection const* fc) noexcept
@@ -28,6 +28,10 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kCROP_AND_RESIZE_PLUGIN_VERSION{"1"};
+constexpr char const* kCROP_AND_RESIZE_DYNAMIC_LEGACY_PLUGIN_VERSION{"1"};
+constexpr char const* kCROP_AND_RESIZE_PLUGIN_NAME{"CropAndResize"};
+constexpr char const* kCROP_AND_RESIZE_DYNAMIC_LEGACY_PLUGIN_NAME{"CropAndResizeDynamic"};
 
 //!
 //! \brief Legacy implementation of CropAndResizePlugin that implements IPluginV2Ext.
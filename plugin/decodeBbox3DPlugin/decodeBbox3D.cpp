@@ -27,12 +27,6 @@ namespace nvinfer1::plugin
 using nvinfer1::plugin::DecodeBbox3DPlugin;
 using nvinfer1::plugin::DecodeBbox3DPluginCreator;
 
-namespace
-{
-static char const* const kPLUGIN_VERSION{"1"};
-static char const* const kPLUGIN_NAME{"DecodeBbox3DPlugin"};
-} // namespace
-
 // Static class fields initialization
 PluginFieldCollection DecodeBbox3DPluginCreator::mFC{};
 std::vector<PluginField> DecodeBbox3DPluginCreator::mPluginAttributes;
@@ -293,12 +287,12 @@ nvinfer1::DataType DecodeBbox3DPlugin::getOutputDataType(
 
 char const* DecodeBbox3DPlugin::getPluginType() const noexcept
 {
-    return kPLUGIN_NAME;
+    return kDECODE_BBOX_3D_PLUGIN_NAME;
 }
 
 char const* DecodeBbox3DPlugin::getPluginVersion() const noexcept
 {
-    return kPLUGIN_VERSION;
+    return kDECODE_BBOX_3D_PLUGIN_VERSION;
 }
 
 int32_t DecodeBbox3DPlugin::getNbOutputs() const noexcept
@@ -389,12 +383,12 @@ DecodeBbox3DPluginCreator::DecodeBbox3DPluginCreator()
 
 char const* DecodeBbox3DPluginCreator::getPluginName() const noexcept
 {
-    return kPLUGIN_NAME;
+    return kDECODE_BBOX_3D_PLUGIN_NAME;
 }
 
 char const* DecodeBbox3DPluginCreator::getPluginVersion() const noexcept
 {
-    return kPLUGIN_VERSION;
+    return kDECODE_BBOX_3D_PLUGIN_VERSION;
 }
 
 PluginFieldCollection const* DecodeBbox3DPluginCreator::getFieldNames() noexcept
@@ -27,6 +27,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kDECODE_BBOX_3D_PLUGIN_VERSION{"1"};
+constexpr char const* kDECODE_BBOX_3D_PLUGIN_NAME{"DecodeBbox3DPlugin"};
 
 class DecodeBbox3DPlugin : public nvinfer1::IPluginV2DynamicExt
 {
@@ -22,12 +22,6 @@ using namespace plugin;
 using nvinfer1::plugin::DetectionLayer;
 using nvinfer1::plugin::DetectionLayerPluginCreator;
 
-namespace
-{
-char const* const kDETECTIONLAYER_PLUGIN_VERSION{"1"};
-char const* const kDETECTIONLAYER_PLUGIN_NAME{"DetectionLayer_TRT"};
-} // namespace
-
 PluginFieldCollection DetectionLayerPluginCreator::mFC{};
 std::vector<PluginField> DetectionLayerPluginCreator::mPluginAttributes;
 
@@ -29,6 +29,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kDETECTIONLAYER_PLUGIN_VERSION{"1"};
+constexpr char const* kDETECTIONLAYER_PLUGIN_NAME{"DetectionLayer_TRT"};
 
 class DetectionLayer : public IPluginV2Ext
 {
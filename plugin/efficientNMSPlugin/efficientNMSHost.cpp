@@ -0,0 +1,478 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "efficientNMSHost.h"
+
+#include "common/hostParallel.h"
+#include "common/hostSimd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace nvinfer1;
+using namespace nvinfer1::plugin;
+using nvinfer1::pluginInternal::HostSimdLevel;
+using nvinfer1::pluginInternal::parallelFor;
+
+namespace
+{
+
+// For NMS/IOU purposes, YXYX coding is identical to XYXY, and YXHW coding is identical to XYWH.
+struct HostBox
+{
+    float y1, x1, y2, x2;
+};
+
+struct Candidate
+{
+    float score;
+    int32_t element; //!< anchor * numClasses + class
+};
+
+//! Candidates of one image, in decreasing score order, with their boxes decoded to corner coding.
+struct ImageCandidates
+{
+    std::vector<Candidate> selected;
+    std::vector<HostBox> boxes;   //!< As written to the output
+    std::vector<int32_t> boxIdx; //!< Index of the box in the boxes input
+    std::vector<std::vector<int32_t>> groups; //!< Positions in selected of the boxes NMS compares with each other
+    std::vector<uint8_t> kept;
+    std::vector<int32_t> written; //!< Positions in selected of the boxes written to the output
+};
+
+HostBox toCorner(HostBox const& box, int32_t boxCoding)
+{
+    if (boxCoding == 0)
+    {
+        return box;
+    }
+    // Center-size coding: y, x, h, w.
+    float const h2 = box.y2 * 0.5F;
+    float const w2 = box.x2 * 0.5F;
+    return {box.y1 - h2, box.x1 - w2, box.y1 + h2, box.x1 + w2};
+}
+
+HostBox reorderCorner(HostBox box)
+{
+    if (box.y1 > box.y2)
+    {
+        std::swap(box.y1, box.y2);
+    }
+    if (box.x1 > box.x2)
+    {
+        std::swap(box.x1, box.x2);
+    }
+    return box;
+}
+
+HostBox decodeBox(EfficientNMSParameters const& param, HostBox box, HostBox anchor)
+{
+    if (!param.boxDecoder)
+    {
+        return toCorner(box, param.boxCoding);
+    }
+    if (param.boxCoding == 0)
+    {
+        box = reorderCorner(box);
+        anchor = reorderCorner(anchor);
+        return {box.y1 + anchor.y1, box.x1 + anchor.x1, box.y2 + anchor.y2, box.x2 + anchor.x2};
+    }
+    HostBox const decoded{box.y1 * anchor.y2 + anchor.y1, box.x1 * anchor.x2 + anchor.x1,
+        anchor.y2 * std::exp(box.y2), anchor.x2 * std::exp(box.x2)};
+    return toCorner(decoded, 1);
+}
+
+float cornerArea(float y1, float x1, float y2, float x2)
+{
+    float const h = y2 - y1;
+    float const w = x2 - x1;
+    return (h <= 0.F || w <= 0.F) ? 0.F : h * w;
+}
+
+//! Threshold the scores of an image, keep the numSelectedBoxes best and decode their boxes.
+void selectCandidates(EfficientNMSParameters const& param, float scoreThreshold, int32_t imageIdx, float const* scores,
+    HostBox const* boxes, HostBox const* anchors, ImageCandidates& image)
+{
+    float const* imageScores = scores + static_cast<int64_t>(imageIdx) * param.numScoreElements;
+    auto& selected = image.selected;
+    selected.clear();
+    for (int32_t e = 0; e < param.numScoreElements; ++e)
+    {
+        if (imageScores[e] >= scoreThreshold && e % param.numClasses != param.backgroundClass)
+        {
+            selected.push_back({imageScores[e], e});
+        }
+    }
+
+    auto const better = [](Candidate const& a, Candidate const& b) {
+        return a.score > b.score || (a.score == b.score && a.element < b.element);
+    };
+    auto const nbSelected
+        = std::min(static_cast<int64_t>(selected.size()), static_cast<int64_t>(param.numSelectedBoxes));
+    if (nbSelected < static_cast<int64_t>(selected.size()))
+    {
+        std::nth_element(selected.begin(), selected.begin() + nbSelected, selected.end(), better);
+        selected.resize(nbSelected);
+    }
+    std::sort(selected.begin(), selected.end(), better);
+
+    image.boxes.resize(nbSelected);
+    image.boxIdx.resize(nbSelected);
+    for (int64_t i = 0; i < nbSelected; ++i)
+    {
+        int32_t const anchorIdx = selected[i].element / param.numClasses;
+        int32_t const classIdx = selected[i].element % param.numClasses;
+        int32_t const boxIdx = param.shareLocation
+            ? imageIdx * param.numAnchors + anchorIdx
+            : (imageIdx * param.numAnchors + anchorIdx) * param.numClasses + classIdx;
+        int32_t const anchorInputIdx = param.shareAnchors ? anchorIdx : imageIdx * param.numAnchors + anchorIdx;
+        HostBox const anchor = param.boxDecoder ? anchors[anchorInputIdx] : HostBox{};
+        image.boxes[i] = decodeBox(param, boxes[boxIdx], anchor);
+        image.boxIdx[i] = boxIdx;
+    }
+
+    image.groups.clear();
+    if (param.classAgnostic)
+    {
+        image.groups.emplace_back(nbSelected);
+        for (int32_t i = 0; i < nbSelected; ++i)
+        {
+            image.groups.back()[i] = i;
+        }
+    }
+    else
+    {
+        std::vector<int32_t> classGroup(param.numClasses, -1);
+        for (int32_t i = 0; i < nbSelected; ++i)
+        {
+            int32_t const classIdx = selected[i].element % param.numClasses;
+            if (classGroup[classIdx] < 0)
+            {
+                classGroup[classIdx] = static_cast<int32_t>(image.groups.size());
+                image.groups.emplace_back();
+            }
+            image.groups[classGroup[classIdx]].push_back(i);
+        }
+    }
+    image.kept.assign(nbSelected, 0);
+}
+
+//! Coordinates of the boxes of a group, as a structure of arrays so that the IoU loop vectorizes.
+struct GroupBoxes
+{
+    std::vector<float> y1, x1, y2, x2, area, score;
+    std::vector<uint8_t> alive;
+};
+
+//! Suppress the boxes in [begin, end) whose score is not higher than the one of box b and whose IoU with it reaches
+//! the threshold.
+void suppressAfterScalar(GroupBoxes& boxes, int32_t b, int32_t begin, int32_t end, float threshold)
+{
+    float const by1 = boxes.y1[b];
+    float const bx1 = boxes.x1[b];
+    float const by2 = boxes.y2[b];
+    float const bx2 = boxes.x2[b];
+    float const barea = boxes.area[b];
+    float const bscore = boxes.score[b];
+    float const* py1 = boxes.y1.data();
+    float const* px1 = boxes.x1.data();
+    float const* py2 = boxes.y2.data();
+    float const* px2 = boxes.x2.data();
+    float const* parea = boxes.area.data();
+    float const* pscore = boxes.score.data();
+    uint8_t* palive = boxes.alive.data();
+    for (int32_t j = begin; j < end; ++j)
+    {
+        float const h = std::min(by2, py2[j]) - std::max(by1, py1[j]);
+        float const w = std::min(bx2, px2[j]) - std::max(bx1, px1[j]);
+        float const intersection = (h <= 0.F || w <= 0.F) ? 0.F : h * w;
+        float const unionArea = barea + parea[j] - intersection;
+        float const iou = (intersection <= 0.F || unionArea <= 0.F) ? 0.F : intersection / unionArea;
+        palive[j] &= static_cast<uint8_t>(!(pscore[j] <= bscore && iou >= threshold));
+    }
+}
+
+#if TRT_PLUGIN_HOST_X86_SIMD
+// The SIMD loops evaluate the scalar expressions in the same order and without FMA, so they keep the same boxes. The
+// operand order of min and max matches std::min and std::max for NaN coordinates.
+
+void clearSuppressed(uint8_t* alive, uint32_t suppressed)
+{
+    while (suppressed != 0)
+    {
+        alive[__builtin_ctz(suppressed)] = 0;
+        suppressed &= suppressed - 1;
+    }
+}
+
+__attribute__((target("avx2"))) void suppressAfterAvx2(
+    GroupBoxes& boxes, int32_t b, int32_t begin, int32_t end, float threshold)
+{
+    __m256 const by1 = _mm256_set1_ps(boxes.y1[b]);
+    __m256 const bx1 = _mm256_set1_ps(boxes.x1[b]);
+    __m256 const by2 = _mm256_set1_ps(boxes.y2[b]);
+    __m256 const bx2 = _mm256_set1_ps(boxes.x2[b]);
+    __m256 const barea = _mm256_set1_ps(boxes.area[b]);
+    __m256 const bscore = _mm256_set1_ps(boxes.score[b]);
+    __m256 const vthreshold = _mm256_set1_ps(threshold);
+    __m256 const zero = _mm256_setzero_ps();
+    int32_t j = begin;
+    for (; j + 8 <= end; j += 8)
+    {
+        __m256 const h = _mm256_sub_ps(
+            _mm256_min_ps(_mm256_loadu_ps(&boxes.y2[j]), by2), _mm256_max_ps(_mm256_loadu_ps(&boxes.y1[j]), by1));
+        __m256 const w = _mm256_sub_ps(
+            _mm256_min_ps(_mm256_loadu_ps(&boxes.x2[j]), bx2), _mm256_max_ps(_mm256_loadu_ps(&boxes.x1[j]), bx1));
+        __m256 const empty = _mm256_or_ps(_mm256_cmp_ps(h, zero, _CMP_LE_OQ), _mm256_cmp_ps(w, zero, _CMP_LE_OQ));
+        __m256 const intersection = _mm256_andnot_ps(empty, _mm256_mul_ps(h, w));
+        __m256 const unionArea = _mm256_sub_ps(_mm256_add_ps(barea, _mm256_loadu_ps(&boxes.area[j])), intersection);
+        __m256 const noIou = _mm256_or_ps(
+            _mm256_cmp_ps(intersection, zero, _CMP_LE_OQ), _mm256_cmp_ps(unionArea, zero, _CMP_LE_OQ));
+        __m256 const iou = _mm256_andnot_ps(noIou, _mm256_div_ps(intersection, unionArea));
+        __m256 const suppressed = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&boxes.score[j]), bscore, _CMP_LE_OQ),
+            _mm256_cmp_ps(iou, vthreshold, _CMP_GE_OQ));
+        clearSuppressed(&boxes.alive[j], static_cast<uint32_t>(_mm256_movemask_ps(suppressed)));
+    }
+    suppressAfterScalar(boxes, b, j, end, threshold);
+}
+
+__attribute__((target("avx512f"))) void suppressAfterAvx512(
+    GroupBoxes& boxes, int32_t b, int32_t begin, int32_t end, float threshold)
+{
+    __m512 const by1 = _mm512_set1_ps(boxes.y1[b]);
+    __m512 const bx1 = _mm512_set1_ps(boxes.x1[b]);
+    __m512 const by2 = _mm512_set1_ps(boxes.y2[b]);
+    __m512 const bx2 = _mm512_set1_ps(boxes.x2[b]);
+    __m512 const barea = _mm512_set1_ps(boxes.area[b]);
+    __m512 const bscore = _mm512_set1_ps(boxes.score[b]);
+    __m512 const vthreshold = _mm512_set1_ps(threshold);
+    __m512 const zero = _mm512_setzero_ps();
+    int32_t j = begin;
+    for (; j + 16 <= end; j += 16)
+    {
+        __m512 const h = _mm512_sub_ps(
+            _mm512_min_ps(_mm512_loadu_ps(&boxes.y2[j]), by2), _mm512_max_ps(_mm512_loadu_ps(&boxes.y1[j]), by1));
+        __m512 const w = _mm512_sub_ps(
+            _mm512_min_ps(_mm512_loadu_ps(&boxes.x2[j]), bx2), _mm512_max_ps(_mm512_loadu_ps(&boxes.x1[j]), bx1));
+        __mmask16 const overlap = _mm512_cmp_ps_mask(h, zero, _CMP_NLE_UQ) & _mm512_cmp_ps_mask(w, zero, _CMP_NLE_UQ);
+        __m512 const intersection = _mm512_maskz_mul_ps(overlap, h, w);
+        __m512 const unionArea = _mm512_sub_ps(_mm512_add_ps(barea, _mm512_loadu_ps(&boxes.area[j])), intersection);
+        __mmask16 const hasIou = _mm512_cmp_ps_mask(intersection, zero, _CMP_NLE_UQ)
+            & _mm512_cmp_ps_mask(unionArea, zero, _CMP_NLE_UQ);
+        __m512 const iou = _mm512_maskz_div_ps(hasIou, intersection, unionArea);
+        __mmask16 const suppressed = _mm512_cmp_ps_mask(_mm512_loadu_ps(&boxes.score[j]), bscore, _CMP_LE_OQ)
+            & _mm512_cmp_ps_mask(iou, vthreshold, _CMP_GE_OQ);
+        clearSuppressed(&boxes.alive[j], static_cast<uint32_t>(suppressed));
+    }
+    suppressAfterScalar(boxes, b, j, end, threshold);
+}
+#endif
+
+//! Greedy NMS over one group of boxes in decreasing score order, stopping after maxKept boxes are kept.
+void suppressGroup(
+    EfficientNMSParameters const& param, std::vector<int32_t> const& group, int64_t maxKept, ImageCandidates& image)
+{
+    int32_t const n = static_cast<int32_t>(group.size());
+    GroupBoxes boxes;
+    for (auto* v : {&boxes.y1, &boxes.x1, &boxes.y2, &boxes.x2, &boxes.area, &boxes.score})
+    {
+        v->resize(n);
+    }
+    boxes.alive.assign(n, 1);
+    for (int32_t i = 0; i < n; ++i)
+    {
+        HostBox const box = reorderCorner(image.boxes[group[i]]);
+        boxes.y1[i] = box.y1;
+        boxes.x1[i] = box.x1;
+        boxes.y2[i] = box.y2;
+        boxes.x2[i] = box.x2;
+        boxes.area[i] = cornerArea(box.y1, box.x1, box.y2, box.x2);
+        boxes.score[i] = image.selected[group[i]].score;
+    }
+
+    auto suppressAfter = suppressAfterScalar;
+#if TRT_PLUGIN_HOST_X86_SIMD
+    switch (pluginInternal::getHostSimdLevel())
+    {
+    case HostSimdLevel::kAVX512: suppressAfter = suppressAfterAvx512; break;
+    case HostSimdLevel::kAVX2: suppressAfter = suppressAfterAvx2; break;
+    case HostSimdLevel::kSCALAR: break;
+    }
+#endif
+
+    int64_t nbKept{0};
+    for (int32_t i = 0; i < n && nbKept < maxKept; ++i)
+    {
+        if (!boxes.alive[i])
+        {
+            continue;
+        }
+        image.kept[group[i]] = 1;
+        ++nbKept;
+        suppressAfter(boxes, i, i + 1, n, param.iouThreshold);
+    }
+}
+
+//! Merge the boxes kept in all the groups of an image, in score order, up to the output limits.
+void mergeKept(EfficientNMSParameters const& param, ImageCandidates& image)
+{
+    image.written.clear();
+    std::vector<int32_t> classCounts(param.numClasses, 0);
+    for (int32_t i = 0; i < static_cast<int32_t>(image.selected.size()); ++i)
+    {
+        if (!image.kept[i])
+        {
+            continue;
+        }
+        if (static_cast<int32_t>(image.written.size()) >= param.numOutputBoxes)
+        {
+            break;
+        }
+        int32_t const classIdx = image.selected[i].element % param.numClasses;
+        if (param.numOutputBoxesPerClass < 0 || classCounts[classIdx] < param.numOutputBoxesPerClass)
+        {
+            image.written.push_back(i);
+        }
+        ++classCounts[classIdx];
+    }
+}
+
+} // namespace
+
+pluginStatus_t EfficientNMSHostInference(EfficientNMSParameters param, void const* boxesInput, void const* scoresInput,
+    void const* anchorsInput, void* numDetectionsOutput, void* nmsBoxesOutput, void* nmsScoresOutput,
+    void* nmsClassesOutput, void* nmsIndicesOutput, int32_t numThreads)
+{
+    if (param.datatype != DataType::kFLOAT || (param.boxCoding != 0 && param.boxCoding != 1))
+    {
+        return STATUS_NOT_SUPPORTED;
+    }
+
+    int64_t const nbOutputs = static_cast<int64_t>(param.batchSize) * param.numOutputBoxes;
+    if (param.outputONNXIndices)
+    {
+        std::memset(nmsIndicesOutput, 0xFF, nbOutputs * 3 * sizeof(int32_t));
+    }
+    else
+    {
+        std::memset(numDetectionsOutput, 0, param.batchSize * sizeof(int32_t));
+        std::memset(nmsScoresOutput, 0, nbOutputs * sizeof(float));
+        std::memset(nmsBoxesOutput, 0, nbOutputs * 4 * sizeof(float));
+        std::memset(nmsClassesOutput, 0, nbOutputs * sizeof(int32_t));
+    }
+    if (param.numScoreElements < 1)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    float scoreThreshold = param.scoreThreshold;
+    if (param.scoreSigmoid)
+    {
+        // Compare the logits against the inverse sigmoid of the threshold, as the CUDA implementation does.
+        scoreThreshold = param.scoreThreshold <= 0.F
+            ? -(1 << 15)
+            : std::log(param.scoreThreshold / (1.F - param.scoreThreshold));
+    }
+
+    auto const* scores = static_cast<float const*>(scoresInput);
+    auto const* boxes = static_cast<HostBox const*>(boxesInput);
+    auto const* anchors = static_cast<HostBox const*>(anchorsInput);
+
+    std::vector<ImageCandidates> images(param.batchSize);
+    parallelFor(param.batchSize, numThreads, [&](int64_t imageIdx) {
+        selectCandidates(
+            param, scoreThreshold, static_cast<int32_t>(imageIdx), scores, boxes, anchors, images[imageIdx]);
+    });
+
+    // Suppression is independent across images and, unless class-agnostic, across classes.
+    std::vector<std::pair<int32_t, int32_t>> tasks;
+    for (int32_t imageIdx = 0; imageIdx < param.batchSize; ++imageIdx)
+    {
+        for (int32_t g = 0; g < static_cast<int32_t>(images[imageIdx].groups.size()); ++g)
+        {
+            tasks.emplace_back(imageIdx, g);
+        }
+    }
+    // A class never writes more than numOutputBoxes or numOutputBoxesPerClass boxes, so its NMS can stop there. A
+    // class-agnostic group holds all the classes, so with a per-class limit it cannot stop early.
+    int64_t maxKept = param.numOutputBoxes;
+    if (param.numOutputBoxesPerClass >= 0)
+    {
+        maxKept = param.classAgnostic ? std::numeric_limits<int64_t>::max()
+                                      : std::min<int64_t>(maxKept, param.numOutputBoxesPerClass);
+    }
+    parallelFor(static_cast<int64_t>(tasks.size()), numThreads, [&](int64_t t) {
+        auto& image = images[tasks[t].first];
+        suppressGroup(param, image.groups[tasks[t].second], maxKept, image);
+    });
+
+    parallelFor(param.batchSize, numThreads, [&](int64_t imageIdx) {
+        auto& image = images[imageIdx];
+        mergeKept(param, image);
+        if (param.outputONNXIndices)
+        {
+            return;
+        }
+        auto* numDetections = static_cast<int32_t*>(numDetectionsOutput);
+        auto* outScores = static_cast<float*>(nmsScoresOutput);
+        auto* outBoxes = static_cast<HostBox*>(nmsBoxesOutput);
+        auto* outClasses = static_cast<int32_t*>(nmsClassesOutput);
+        numDetections[imageIdx] = static_cast<int32_t>(image.written.size());
+        for (int32_t r = 0; r < static_cast<int32_t>(image.written.size()); ++r)
+        {
+            int32_t const i = image.written[r];
+            int64_t const outputIdx = imageIdx * param.numOutputBoxes + r;
+            float const score = image.selected[i].score;
+            outScores[outputIdx] = param.scoreSigmoid ? 1.F / (1.F + std::exp(-score)) : score;
+            outClasses[outputIdx] = image.selected[i].element % param.numClasses;
+            HostBox box = image.boxes[i];
+            if (param.clipBoxes)
+            {
+                auto const clip = [](float v) { return std::min(std::max(v, 0.F), 1.F); };
+                box = {clip(box.y1), clip(box.x1), clip(box.y2), clip(box.x2)};
+            }
+            outBoxes[outputIdx] = box;
+        }
+    });
+
+    if (param.outputONNXIndices)
+    {
+        // The selected indices of all the images are packed, then padded with the last one.
+        auto* indices = static_cast<int32_t*>(nmsIndicesOutput);
+        int64_t nbIndices{0};
+        for (int32_t imageIdx = 0; imageIdx < param.batchSize; ++imageIdx)
+        {
+            auto const& image = images[imageIdx];
+            for (int32_t const i : image.written)
+            {
+                indices[nbIndices * 3 + 0] = imageIdx;
+                indices[nbIndices * 3 + 1] = image.selected[i].element % param.numClasses;
+                indices[nbIndices * 3 + 2] = image.boxIdx[i] % param.numAnchors;
+                ++nbIndices;
+            }
+        }
+        for (int64_t idx = nbIndices; nbIndices > 0 && idx < nbOutputs; ++idx)
+        {
+            std::copy(indices + (nbIndices - 1) * 3, indices + nbIndices * 3, indices + idx * 3);
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
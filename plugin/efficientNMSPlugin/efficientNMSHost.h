@@ -0,0 +1,47 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_EFFICIENT_NMS_HOST_H
+#define TRT_EFFICIENT_NMS_HOST_H
+
+#include "common/plugin.h"
+
+#include "efficientNMSParameters.h"
+
+//!
+//! \brief Host implementation of EfficientNMSInference(), on host buffers with the same layouts.
+//!
+//! Supports FP32 tensors only. The boxes kept are the ones of the CUDA implementation, written in decreasing score
+//! order with ties broken by anchor and class. Scores below the threshold are always discarded, whereas the CUDA
+//! implementation lets them through with a score of -32768 below a threshold of 0.007 when fewer boxes are kept than
+//! numOutputBoxes. Sigmoid scores may differ from the CUDA ones by the precision of its fast intrinsics.
+//!
+//! Each image is processed in three stages, parallel across images then across (image, class) pairs: threshold and
+//! select the numSelectedBoxes best candidates with a partial sort, suppress overlapping boxes of each class with an
+//! IoU loop over structure-of-arrays coordinates, then merge the classes up to numOutputBoxes. The IoU loop uses AVX2 or
+//! AVX-512 when the CPU supports them, and keeps the same boxes as the scalar loop.
+//!
+//! This implementation is not part of the plugin library. It is compiled into plugin_host_benchmark, which times it and
+//! compares it with EfficientNMS_TRT.
+//!
+//! \param numThreads Number of threads, or 0 for one per hardware thread.
+//!
+pluginStatus_t EfficientNMSHostInference(nvinfer1::plugin::EfficientNMSParameters param, void const* boxesInput,
+    void const* scoresInput, void const* anchorsInput, void* numDetectionsOutput, void* nmsBoxesOutput,
+    void* nmsScoresOutput, void* nmsClassesOutput, void* nmsIndicesOutput, int32_t numThreads = 0);
+
+#endif
@@ -24,14 +24,6 @@ using nvinfer1::plugin::EfficientNMSParameters;
 using nvinfer1::plugin::EfficientNMSPluginCreator;
 using nvinfer1::plugin::EfficientNMSONNXPluginCreator;
 
-namespace
-{
-char const* const kEFFICIENT_NMS_PLUGIN_VERSION{"1"};
-char const* const kEFFICIENT_NMS_PLUGIN_NAME{"EfficientNMS_TRT"};
-char const* const kEFFICIENT_NMS_ONNX_PLUGIN_VERSION{"1"};
-char const* const kEFFICIENT_NMS_ONNX_PLUGIN_NAME{"EfficientNMS_ONNX_TRT"};
-} // namespace
-
 EfficientNMSPlugin::EfficientNMSPlugin(EfficientNMSParameters param)
     : mParam(std::move(param))
 {
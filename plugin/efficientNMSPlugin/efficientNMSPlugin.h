@@ -26,6 +26,10 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kEFFICIENT_NMS_PLUGIN_VERSION{"1"};
+constexpr char const* kEFFICIENT_NMS_PLUGIN_NAME{"EfficientNMS_TRT"};
+constexpr char const* kEFFICIENT_NMS_ONNX_PLUGIN_VERSION{"1"};
+constexpr char const* kEFFICIENT_NMS_ONNX_PLUGIN_NAME{"EfficientNMS_ONNX_TRT"};
 
 class EfficientNMSPlugin : public IPluginV2DynamicExt
 {
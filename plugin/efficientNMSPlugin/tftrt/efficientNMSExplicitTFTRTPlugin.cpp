@@ -26,12 +26,6 @@ using namespace nvinfer1::plugin;
 using nvinfer1::plugin::EfficientNMSExplicitTFTRTPlugin;
 using nvinfer1::plugin::EfficientNMSExplicitTFTRTPluginCreator;
 
-namespace
-{
-const char* EFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_VERSION{"1"};
-const char* EFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_NAME{"EfficientNMS_Explicit_TF_TRT"};
-} // namespace
-
 EfficientNMSExplicitTFTRTPlugin::EfficientNMSExplicitTFTRTPlugin(EfficientNMSParameters param)
     : EfficientNMSPlugin(std::move(param))
 {
@@ -44,12 +38,12 @@ EfficientNMSExplicitTFTRTPlugin::EfficientNMSExplicitTFTRTPlugin(const void* dat
 
 const char* EfficientNMSExplicitTFTRTPlugin::getPluginType() const noexcept
 {
-    return EFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_NAME;
+    return kEFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_NAME;
 }
 
 const char* EfficientNMSExplicitTFTRTPlugin::getPluginVersion() const noexcept
 {
-    return EFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_VERSION;
+    return kEFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_VERSION;
 }
 
 IPluginV2DynamicExt* EfficientNMSExplicitTFTRTPlugin::clone() const noexcept
@@ -83,12 +77,12 @@ EfficientNMSExplicitTFTRTPluginCreator::EfficientNMSExplicitTFTRTPluginCreator()
 
 const char* EfficientNMSExplicitTFTRTPluginCreator::getPluginName() const noexcept
 {
-    return EFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_NAME;
+    return kEFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_NAME;
 }
 
 const char* EfficientNMSExplicitTFTRTPluginCreator::getPluginVersion() const noexcept
 {
-    return EFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_VERSION;
+    return kEFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_VERSION;
 }
 
 const PluginFieldCollection* EfficientNMSExplicitTFTRTPluginCreator::getFieldNames() noexcept
@@ -30,6 +30,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kEFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_VERSION{"1"};
+constexpr char const* kEFFICIENT_NMS_EXPLICIT_TFTRT_PLUGIN_NAME{"EfficientNMS_Explicit_TF_TRT"};
 
 class EfficientNMSExplicitTFTRTPlugin : public EfficientNMSPlugin
 {
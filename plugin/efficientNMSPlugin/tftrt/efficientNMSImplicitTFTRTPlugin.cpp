@@ -27,12 +27,6 @@ using nvinfer1::plugin::EfficientNMSParameters;
 using nvinfer1::plugin::EfficientNMSImplicitTFTRTPlugin;
 using nvinfer1::plugin::EfficientNMSImplicitTFTRTPluginCreator;
 
-namespace
-{
-const char* EFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_VERSION{"1"};
-const char* EFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_NAME{"EfficientNMS_Implicit_TF_TRT"};
-} // namespace
-
 EfficientNMSImplicitTFTRTPlugin::EfficientNMSImplicitTFTRTPlugin(EfficientNMSParameters param)
     : mParam(std::move(param))
 {
@@ -52,12 +46,12 @@ void EfficientNMSImplicitTFTRTPlugin::deserialize(int8_t const* data, size_t len
 
 const char* EfficientNMSImplicitTFTRTPlugin::getPluginType() const noexcept
 {
-    return EFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_NAME;
+    return kEFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_NAME;
 }
 
 const char* EfficientNMSImplicitTFTRTPlugin::getPluginVersion() const noexcept
 {
-    return EFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_VERSION;
+    return kEFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_VERSION;
 }
 
 int32_t EfficientNMSImplicitTFTRTPlugin::getNbOutputs() const noexcept
@@ -317,12 +311,12 @@ EfficientNMSImplicitTFTRTPluginCreator::EfficientNMSImplicitTFTRTPluginCreator()
 
 const char* EfficientNMSImplicitTFTRTPluginCreator::getPluginName() const noexcept
 {
-    return EFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_NAME;
+    return kEFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_NAME;
 }
 
 const char* EfficientNMSImplicitTFTRTPluginCreator::getPluginVersion() const noexcept
 {
-    return EFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_VERSION;
+    return kEFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_VERSION;
 }
 
 const PluginFieldCollection* EfficientNMSImplicitTFTRTPluginCreator::getFieldNames() noexcept
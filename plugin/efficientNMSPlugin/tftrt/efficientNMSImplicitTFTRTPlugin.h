@@ -29,6 +29,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kEFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_VERSION{"1"};
+constexpr char const* kEFFICIENT_NMS_IMPLICIT_TFTRT_PLUGIN_NAME{"EfficientNMS_Implicit_TF_TRT"};
 
 #if NV_TENSORRT_MAJOR >= 8
 using EfficientNMSImplicitTFTRTOutputsDataType = void* const*;
@@ -88,17 +88,31 @@ EmbLayerNormPluginDynamicLegacy::EmbLayerNormPluginDynamicLegacy(
     BERT_DEBUG_MSG("EmbLayerNormPluginDynamicLegacy deserialize.");
 
     // Deserialize in the same order as serialization
-    deserialize_value(&data, &length, &mType);
-    deserialize_value(&data, &length, &mMhaType);
-    deserialize_value(&data, &length, &mLd);
-    deserialize_value(&data, &length, &mS);
-    deserialize_value(&data, &length, &mWordVocabSize);
-    deserialize_value(&data, &length, &mPosVocabSize);
-    deserialize_value(&data, &length, &mTokVocabSize);
-    deserialize_value(&data, &length, &mUseFullMask);
-    deserialize_value(&data, &length, &mSM);
-
-    char const* d = static_cast<char const*>(data);
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mType));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mMhaType));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mLd));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mS));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mWordVocabSize));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mPosVocabSize));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mTokVocabSize));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mUseFullMask));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mSM));
+    PLUGIN_VALIDATE(mType == DataType::kFLOAT || mType == DataType::kHALF);
+
+    // The weights are copied straight from the serialized buffer, once its size has been checked. The sizes of the
+    // embeddings are checked first, so that corrupted counts cannot overflow it.
+    size_t vocabSize{0};
+    size_t nbEmbeddings{0};
+    size_t nbEmbeddingBytes{0};
+    size_t nbNormBytes{0};
+    size_t nbBytes{0};
+    PLUGIN_VALIDATE(checkedAdd(mWordVocabSize, mPosVocabSize, vocabSize)
+        && checkedAdd(vocabSize, mTokVocabSize, vocabSize) && checkedMultiply(mLd, vocabSize, nbEmbeddings)
+        && checkedMultiply(nbEmbeddings, getElementSize(mType), nbEmbeddingBytes)
+        && checkedMultiply(mLd, 2 * sizeof(float), nbNormBytes) && checkedAdd(nbNormBytes, nbEmbeddingBytes, nbBytes));
+    SerializedView<char> weights;
+    PLUGIN_VALIDATE(try_deserialize_view(&data, &length, nbBytes, &weights));
+    char const* d = weights.data();
     mBeta.convertAndCopy(d, mLd, nvinfer1::DataType::kFLOAT);
     mGamma.convertAndCopy(d, mLd, nvinfer1::DataType::kFLOAT);
     mWordEmb.convertAndCopy(d, mLd * mWordVocabSize, mType);
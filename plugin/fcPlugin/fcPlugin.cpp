@@ -382,14 +382,19 @@ FCPluginDynamic::FCPluginDynamic(std::string const name, void const* data, size_
     gLogVerbose << "FCPluginDynamic deserialize\n";
 
     // Deserialize in the same order as serialization
-    deserialize_value(&data, &length, &mType);
-    deserialize_value(&data, &length, &mOutDim);
-    deserialize_value(&data, &length, &mNumParams);
-    deserialize_value(&data, &length, &mNmax);
-    deserialize_value(&data, &length, &mK);
-    deserialize_value(&data, &length, &mAlgo);
-
-    char const* d = static_cast<char const*>(data);
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mType));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mOutDim));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mNumParams));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mNmax));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mK));
+    PLUGIN_VALIDATE(try_deserialize_value(&data, &length, &mAlgo));
+    PLUGIN_VALIDATE(mType == DataType::kFLOAT || mType == DataType::kHALF);
+
+    size_t nbBytes{0};
+    PLUGIN_VALIDATE(checkedMultiply(mNumParams, getElementSize(mType), nbBytes));
+    SerializedView<char> weights;
+    PLUGIN_VALIDATE(try_deserialize_view(&data, &length, nbBytes, &weights));
+    char const* d = weights.data();
 
     mW.convertAndCopy(d, mNumParams, mType);
     copyToDevice(mW, getWeightsSize(mW, mType), mWdev);
@@ -30,9 +30,6 @@ using namespace nvinfer1::pluginInternal;
 using nvinfer1::plugin::FlattenConcat;
 using nvinfer1::plugin::FlattenConcatPluginCreator;
 
-static char const* const kFLATTENCONCAT_PLUGIN_VERSION{"1"};
-static char const* const kFLATTENCONCAT_PLUGIN_NAME{"FlattenConcat_TRT"};
-
 PluginFieldCollection FlattenConcatPluginCreator::mFC{};
 std::vector<PluginField> FlattenConcatPluginCreator::mPluginAttributes;
 
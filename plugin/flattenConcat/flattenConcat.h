@@ -28,6 +28,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kFLATTENCONCAT_PLUGIN_VERSION{"1"};
+constexpr char const* kFLATTENCONCAT_PLUGIN_NAME{"FlattenConcat_TRT"};
+
 class FlattenConcat : public IPluginV2Ext
 {
 public:
@@ -27,12 +27,6 @@ using nvinfer1::plugin::GenerateDetectionPluginCreator;
 
 #include <fstream>
 
-namespace
-{
-char const* const kGENERATEDETECTION_PLUGIN_VERSION{"1"};
-char const* const kGENERATEDETECTION_PLUGIN_NAME{"GenerateDetection_TRT"};
-} // namespace
-
 PluginFieldCollection GenerateDetectionPluginCreator::mFC{};
 std::vector<PluginField> GenerateDetectionPluginCreator::mPluginAttributes;
 
@@ -32,6 +32,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kGENERATEDETECTION_PLUGIN_VERSION{"1"};
+constexpr char const* kGENERATEDETECTION_PLUGIN_NAME{"GenerateDetection_TRT"};
 
 class GenerateDetection : public IPluginV2Ext
 {
@@ -27,12 +27,6 @@ using namespace nvinfer1::pluginInternal;
 
 namespace nvinfer1::plugin
 {
-namespace
-{
-std::string const kGRID_ANCHOR_PLUGIN_NAMES[] = {"GridAnchor_TRT", "GridAnchorRect_TRT"};
-char const* const kGRID_ANCHOR_PLUGIN_VERSION = "1";
-} // namespace
-
 PluginFieldCollection GridAnchorBasePluginCreator::mFC{};
 std::vector<PluginField> GridAnchorBasePluginCreator::mPluginAttributes;
 
@@ -162,6 +156,7 @@ GridAnchorGenerator::GridAnchorGenerator(void const* data, size_t length, char c
 
 GridAnchorGenerator::~GridAnchorGenerator()
 {
+    terminate();
     for (int32_t id = 0; id < mNumLayers; id++)
     {
         PLUGIN_CUERROR(cudaFree(const_cast<void*>(mDeviceWidths[id].values)));
@@ -188,10 +183,52 @@ Dims GridAnchorGenerator::getOutputDimensions(int32_t index, Dims const* inputs,
 
 int32_t GridAnchorGenerator::initialize() noexcept
 {
+    // The anchors only depend on the parameters, so they are the same at every enqueue.
+    if (mPrecomputedOutputs.empty() && !precomputeOutputs())
+    {
+        // Fall back to generating the anchors at each enqueue.
+        terminate();
+        static_cast<void>(cudaGetLastError());
+    }
     return STATUS_SUCCESS;
 }
 
-void GridAnchorGenerator::terminate() noexcept {}
+bool GridAnchorGenerator::precomputeOutputs() noexcept
+{
+    for (int32_t id = 0; id < mNumLayers; id++)
+    {
+        std::vector<float> widths(mNumPriors[id]);
+        std::vector<float> heights(mNumPriors[id]);
+        char* w = reinterpret_cast<char*>(widths.data());
+        char* h = reinterpret_cast<char*>(heights.data());
+        serializeFromDevice(w, mDeviceWidths[id]);
+        serializeFromDevice(h, mDeviceHeights[id]);
+
+        size_t const count = 2 * static_cast<size_t>(mParam[id].H) * mParam[id].W * mNumPriors[id] * 4;
+        std::vector<float> output(count);
+        anchorGridHost(mParam[id], mNumPriors[id], widths.data(), heights.data(), output.data());
+        void* deviceOutput{nullptr};
+        if (cudaMalloc(&deviceOutput, count * sizeof(float)) != cudaSuccess)
+        {
+            return false;
+        }
+        mPrecomputedOutputs.push_back(deviceOutput);
+        if (cudaMemcpy(deviceOutput, output.data(), count * sizeof(float), cudaMemcpyHostToDevice) != cudaSuccess)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void GridAnchorGenerator::terminate() noexcept
+{
+    for (void* output : mPrecomputedOutputs)
+    {
+        PLUGIN_CUERROR(cudaFree(output));
+    }
+    mPrecomputedOutputs.clear();
+}
 
 size_t GridAnchorGenerator::getWorkspaceSize(int32_t maxBatchSize) const noexcept
 {
@@ -205,6 +242,14 @@ int32_t GridAnchorGenerator::enqueue(
     for (int32_t id = 0; id < mNumLayers; id++)
     {
         void* outputData = outputs[id];
+        if (!mPrecomputedOutputs.empty())
+        {
+            size_t const size
+                = 2 * static_cast<size_t>(mParam[id].H) * mParam[id].W * mNumPriors[id] * 4 * sizeof(float);
+            CSC(cudaMemcpyAsync(outputData, mPrecomputedOutputs[id], size, cudaMemcpyDeviceToDevice, stream),
+                STATUS_FAILURE);
+            continue;
+        }
         pluginStatus_t status = anchorGridInference(
             stream, mParam[id], mNumPriors[id], mDeviceWidths[id].values, mDeviceHeights[id].values, outputData);
         if (status != STATUS_SUCCESS)
@@ -404,7 +449,7 @@ IPluginV2Ext* GridAnchorBasePluginCreator::createPlugin(char const* name, Plugin
         std::vector<float> layerVariances;
         PluginField const* fields = fc->fields;
 
-        bool const isFMapRect = (kGRID_ANCHOR_PLUGIN_NAMES[1] == mPluginName);
+        bool const isFMapRect = (kGRID_ANCHOR_RECT_PLUGIN_NAME == mPluginName);
         for (int32_t i = 0; i < fc->nbFields; ++i)
         {
             char const* attrName = fields[i].name;
@@ -530,12 +575,12 @@ IPluginV2Ext* GridAnchorBasePluginCreator::deserializePlugin(
 
 GridAnchorPluginCreator::GridAnchorPluginCreator()
 {
-    mPluginName = kGRID_ANCHOR_PLUGIN_NAMES[0];
+    mPluginName = kGRID_ANCHOR_PLUGIN_NAME;
 }
 
 GridAnchorRectPluginCreator::GridAnchorRectPluginCreator()
 {
-    mPluginName = kGRID_ANCHOR_PLUGIN_NAMES[1];
+    mPluginName = kGRID_ANCHOR_RECT_PLUGIN_NAME;
 }
 
 } // namespace nvinfer1::plugin
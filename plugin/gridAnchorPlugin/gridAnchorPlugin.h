@@ -26,6 +26,10 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kGRID_ANCHOR_PLUGIN_VERSION{"1"};
+constexpr char const* kGRID_ANCHOR_PLUGIN_NAME{"GridAnchor_TRT"};
+constexpr char const* kGRID_ANCHOR_RECT_PLUGIN_NAME{"GridAnchorRect_TRT"};
+
 class GridAnchorGenerator : public IPluginV2Ext
 {
 public:
@@ -93,10 +97,16 @@ private:
 
     Weights deserializeToDevice(char const*& hostBuffer, size_t count) noexcept;
 
+    //! Generate the outputs on the host and keep them on the device. Return false if they could not be stored.
+    bool precomputeOutputs() noexcept;
+
     int32_t mNumLayers;
     std::vector<GridAnchorParameters> mParam;
     int32_t* mNumPriors;
     Weights *mDeviceWidths, *mDeviceHeights;
+    // Outputs generated at initialize(), copied at enqueue instead of running the kernel. Empty if they could not be
+    // allocated.
+    std::vector<void*> mPrecomputedOutputs;
     std::string mPluginNamespace;
 };
 
@@ -28,12 +28,6 @@ using namespace instance_norm_impl;
 using nvinfer1::plugin::InstanceNormalizationV3Plugin;
 using nvinfer1::plugin::InstanceNormalizationV3PluginCreator;
 
-namespace
-{
-constexpr char const* gInstancePluginVersion{"3"};
-constexpr char const* gInstancePluginName{"InstanceNormalization_TRT"};
-} // namespace
-
 PluginFieldCollection InstanceNormalizationV3PluginCreator::mFC{};
 std::vector<PluginField> InstanceNormalizationV3PluginCreator::mPluginAttributes;
 
@@ -490,12 +484,12 @@ bool InstanceNormalizationV3Plugin::supportsFormatCombination(
 
 char const* InstanceNormalizationV3Plugin::getPluginName() const noexcept
 {
-    return gInstancePluginName;
+    return kINSTANCE_NORM_PLUGIN_NAME;
 }
 
 char const* InstanceNormalizationV3Plugin::getPluginVersion() const noexcept
 {
-    return gInstancePluginVersion;
+    return kINSTANCE_NORM_PLUGIN_VERSION;
 }
 
 char const* InstanceNormalizationV3Plugin::getPluginNamespace() const noexcept
@@ -611,12 +605,12 @@ InstanceNormalizationV3PluginCreator::InstanceNormalizationV3PluginCreator()
 
 char const* InstanceNormalizationV3PluginCreator::getPluginName() const noexcept
 {
-    return gInstancePluginName;
+    return kINSTANCE_NORM_PLUGIN_NAME;
 }
 
 char const* InstanceNormalizationV3PluginCreator::getPluginVersion() const noexcept
 {
-    return gInstancePluginVersion;
+    return kINSTANCE_NORM_PLUGIN_VERSION;
 }
 
 PluginFieldCollection const* InstanceNormalizationV3PluginCreator::getFieldNames() noexcept
@@ -37,6 +37,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kINSTANCE_NORM_PLUGIN_VERSION{"3"};
+constexpr char const* kINSTANCE_NORM_PLUGIN_NAME{"InstanceNormalization_TRT"};
+
 class InstanceNormalizationV3Plugin : public IPluginV3,
                                       public IPluginV3OneCore,
                                       public IPluginV3OneBuild,
@@ -30,13 +30,6 @@ using nvinfer1::plugin::InstanceNormalizationPluginV2;
 using nvinfer1::plugin::InstanceNormalizationPluginCreator;
 using nvinfer1::plugin::InstanceNormalizationPluginCreatorV2;
 
-namespace
-{
-constexpr char const* gInstancePluginVersion{"1"};
-constexpr char const* gInstancePluginVersionV2{"2"};
-constexpr char const* gInstancePluginName{"InstanceNormalization_TRT"};
-} // namespace
-
 PluginFieldCollection InstanceNormalizationPluginCreator::mFC{};
 std::vector<PluginField> InstanceNormalizationPluginCreator::mPluginAttributes;
 
@@ -502,17 +495,17 @@ bool InstanceNormalizationPlugin::supportsFormatCombination(
 
 char const* InstanceNormalizationPlugin::getPluginType() const noexcept
 {
-    return gInstancePluginName;
+    return kINSTANCE_NORM_LEGACY_PLUGIN_NAME;
 }
 
 char const* InstanceNormalizationPlugin::getPluginVersion() const noexcept
 {
-    return gInstancePluginVersion;
+    return kINSTANCE_NORM_LEGACY_PLUGIN_VERSION;
 }
 
 char const* InstanceNormalizationPluginV2::getPluginVersion() const noexcept
 {
-    return gInstancePluginVersionV2;
+    return kINSTANCE_NORM_LEGACY_PLUGIN_VERSION_V2;
 }
 
 void InstanceNormalizationPlugin::destroy() noexcept
@@ -597,17 +590,17 @@ InstanceNormalizationPluginCreator::InstanceNormalizationPluginCreator()
 
 char const* InstanceNormalizationPluginCreator::getPluginName() const noexcept
 {
-    return gInstancePluginName;
+    return kINSTANCE_NORM_LEGACY_PLUGIN_NAME;
 }
 
 char const* InstanceNormalizationPluginCreator::getPluginVersion() const noexcept
 {
-    return gInstancePluginVersion;
+    return kINSTANCE_NORM_LEGACY_PLUGIN_VERSION;
 }
 
 char const* InstanceNormalizationPluginCreatorV2::getPluginVersion() const noexcept
 {
-    return gInstancePluginVersionV2;
+    return kINSTANCE_NORM_LEGACY_PLUGIN_VERSION_V2;
 }
 
 PluginFieldCollection const* InstanceNormalizationPluginCreator::getFieldNames() noexcept
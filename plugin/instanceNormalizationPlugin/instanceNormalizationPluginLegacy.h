@@ -30,6 +30,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kINSTANCE_NORM_LEGACY_PLUGIN_VERSION{"1"};
+constexpr char const* kINSTANCE_NORM_LEGACY_PLUGIN_VERSION_V2{"2"};
+constexpr char const* kINSTANCE_NORM_LEGACY_PLUGIN_NAME{"InstanceNormalization_TRT"};
 
 namespace
 {
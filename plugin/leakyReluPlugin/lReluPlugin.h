@@ -27,6 +27,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kLRELU_PLUGIN_VERSION{"1"};
+constexpr char const* kLRELU_PLUGIN_NAME{"LReLU_TRT"};
 
 class TRT_DEPRECATED LReLU : public nvinfer1::pluginInternal::BasePlugin
 {
@@ -0,0 +1,347 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ **************************************************************************
+ * Modified from mmcv (https://github.com/open-mmlab/mmcv/tree/master/mmcv)
+ * Copyright (c) OpenMMLab. All Rights Reserved.
+ * Licensed under the Apache License, Version 2.0 [see LICENSE for details]
+ * https://github.com/open-mmlab/mmcv/blob/master/LICENSE
+ **************************************************************************
+ */
+
+#include "modulatedDeformConvHost.h"
+
+#include "common/hostParallel.h"
+#include "common/hostSimd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using nvinfer1::pluginInternal::HostSimdLevel;
+using nvinfer1::pluginInternal::parallelFor;
+
+//! Output pixels per column tile.
+constexpr int32_t kTILE{64};
+
+//! Output channels accumulated together by the GEMM.
+constexpr int32_t kBLOCK_M{4};
+
+//! Bilinear sample of one kernel tap at one output pixel: the positions of the four neighbors in a channel, and their
+//! weights multiplied by the mask. Neighbors outside of the image have a weight of 0.
+struct Sample
+{
+    int32_t index[4];
+    float weight[4];
+};
+
+Sample getSample(float h, float w, int32_t height, int32_t width, float mask)
+{
+    Sample sample{{0, 0, 0, 0}, {0.F, 0.F, 0.F, 0.F}};
+    if (h <= -1 || height <= h || w <= -1 || width <= w)
+    {
+        return sample;
+    }
+    auto const hLow = static_cast<int32_t>(std::floor(h));
+    auto const wLow = static_cast<int32_t>(std::floor(w));
+    int32_t const hHigh = hLow + 1;
+    int32_t const wHigh = wLow + 1;
+    float const lh = h - hLow;
+    float const lw = w - wLow;
+    float const hh = 1 - lh;
+    float const hw = 1 - lw;
+
+    bool const valid[4] = {hLow >= 0 && wLow >= 0, hLow >= 0 && wHigh <= width - 1,
+        hHigh <= height - 1 && wLow >= 0, hHigh <= height - 1 && wHigh <= width - 1};
+    int32_t const index[4] = {hLow * width + wLow, hLow * width + wHigh, hHigh * width + wLow, hHigh * width + wHigh};
+    float const weight[4] = {hh * hw, hh * lw, lh * hw, lh * lw};
+    for (int32_t k = 0; k < 4; ++k)
+    {
+        if (valid[k])
+        {
+            sample.index[k] = index[k];
+            sample.weight[k] = weight[k] * mask;
+        }
+    }
+    return sample;
+}
+
+std::vector<float> toFloat(__half const* data, int64_t count)
+{
+    std::vector<float> result(data == nullptr ? 0 : count);
+    nvinfer1::pluginInternal::convertToFloat(data, result.data(), static_cast<int64_t>(result.size()));
+    return result;
+}
+
+//! Operands of the product of the weights of a group with a column tile.
+struct TileProduct
+{
+    float const* weight; //!< [m, k]
+    float const* columns; //!< [k, kTILE]
+    float const* bias;   //!< [m], or null
+    float* output;       //!< [m, nbPixels], at the first pixel of the tile
+    int32_t m;
+    int32_t k;
+    int64_t nbPixels;
+    int32_t nbTilePixels;
+};
+
+//! output[mo, p] = sum over kk of weight[mo, kk] * columns[kk, p] + bias[mo], kBLOCK_M output channels at a time so
+//! that each column row is loaded once per block.
+void multiplyTileScalar(TileProduct const& t)
+{
+    for (int32_t mo = 0; mo < t.m; mo += kBLOCK_M)
+    {
+        float acc[kBLOCK_M][kTILE] = {};
+        for (int32_t kk = 0; kk < t.k; ++kk)
+        {
+            float const* row = t.columns + static_cast<int64_t>(kk) * kTILE;
+            for (int32_t r = 0; r < kBLOCK_M; ++r)
+            {
+                float const w = mo + r < t.m ? t.weight[static_cast<int64_t>(mo + r) * t.k + kk] : 0.F;
+                for (int32_t p = 0; p < kTILE; ++p)
+                {
+                    acc[r][p] += w * row[p];
+                }
+            }
+        }
+        for (int32_t r = 0; r < kBLOCK_M && mo + r < t.m; ++r)
+        {
+            float const b0 = t.bias != nullptr ? t.bias[mo + r] : 0.F;
+            float* out = t.output + static_cast<int64_t>(mo + r) * t.nbPixels;
+            for (int32_t p = 0; p < t.nbTilePixels; ++p)
+            {
+                out[p] = acc[r][p] + b0;
+            }
+        }
+    }
+}
+
+#if TRT_PLUGIN_HOST_X86_SIMD
+//! Rows of the weights of a block of output channels. Rows past m repeat the last one, and are not stored.
+void getBlockRows(TileProduct const& t, int32_t mo, float const* (&rows)[kBLOCK_M])
+{
+    for (int32_t r = 0; r < kBLOCK_M; ++r)
+    {
+        rows[r] = t.weight + static_cast<int64_t>(std::min(mo + r, t.m - 1)) * t.k;
+    }
+}
+
+//! Add the bias to an accumulated block of pixels and store the pixels of the tile.
+void storeBlock(TileProduct const& t, int32_t mo, int32_t p0, float const (&acc)[kBLOCK_M][32], int32_t width)
+{
+    int32_t const nbPixels = std::min(width, t.nbTilePixels - p0);
+    for (int32_t r = 0; r < kBLOCK_M && mo + r < t.m; ++r)
+    {
+        float const b0 = t.bias != nullptr ? t.bias[mo + r] : 0.F;
+        float* out = t.output + static_cast<int64_t>(mo + r) * t.nbPixels + p0;
+        for (int32_t p = 0; p < nbPixels; ++p)
+        {
+            out[p] = acc[r][p] + b0;
+        }
+    }
+}
+
+//! Same product with FMA, on blocks of kBLOCK_M channels by 16 pixels held in 8 registers.
+__attribute__((target("avx2,fma"))) void multiplyTileAvx2(TileProduct const& t)
+{
+    for (int32_t mo = 0; mo < t.m; mo += kBLOCK_M)
+    {
+        float const* rows[kBLOCK_M];
+        getBlockRows(t, mo, rows);
+        for (int32_t p0 = 0; p0 < t.nbTilePixels; p0 += 16)
+        {
+            __m256 acc[kBLOCK_M][2];
+            for (auto& a : acc)
+            {
+                a[0] = _mm256_setzero_ps();
+                a[1] = _mm256_setzero_ps();
+            }
+            for (int32_t kk = 0; kk < t.k; ++kk)
+            {
+                float const* row = t.columns + static_cast<int64_t>(kk) * kTILE + p0;
+                __m256 const c0 = _mm256_loadu_ps(row);
+                __m256 const c1 = _mm256_loadu_ps(row + 8);
+                for (int32_t r = 0; r < kBLOCK_M; ++r)
+                {
+                    __m256 const w = _mm256_set1_ps(rows[r][kk]);
+                    acc[r][0] = _mm256_fmadd_ps(w, c0, acc[r][0]);
+                    acc[r][1] = _mm256_fmadd_ps(w, c1, acc[r][1]);
+                }
+            }
+            float block[kBLOCK_M][32];
+            for (int32_t r = 0; r < kBLOCK_M; ++r)
+            {
+                _mm256_storeu_ps(block[r], acc[r][0]);
+                _mm256_storeu_ps(block[r] + 8, acc[r][1]);
+            }
+            storeBlock(t, mo, p0, block, 16);
+        }
+    }
+}
+
+//! Same product with FMA, on blocks of kBLOCK_M channels by 32 pixels held in 8 registers.
+__attribute__((target("avx512f"))) void multiplyTileAvx512(TileProduct const& t)
+{
+    for (int32_t mo = 0; mo < t.m; mo += kBLOCK_M)
+    {
+        float const* rows[kBLOCK_M];
+        getBlockRows(t, mo, rows);
+        for (int32_t p0 = 0; p0 < t.nbTilePixels; p0 += 32)
+        {
+            __m512 acc[kBLOCK_M][2];
+            for (auto& a : acc)
+            {
+                a[0] = _mm512_setzero_ps();
+                a[1] = _mm512_setzero_ps();
+            }
+            for (int32_t kk = 0; kk < t.k; ++kk)
+            {
+                float const* row = t.columns + static_cast<int64_t>(kk) * kTILE + p0;
+                __m512 const c0 = _mm512_loadu_ps(row);
+                __m512 const c1 = _mm512_loadu_ps(row + 16);
+                for (int32_t r = 0; r < kBLOCK_M; ++r)
+                {
+                    __m512 const w = _mm512_set1_ps(rows[r][kk]);
+                    acc[r][0] = _mm512_fmadd_ps(w, c0, acc[r][0]);
+                    acc[r][1] = _mm512_fmadd_ps(w, c1, acc[r][1]);
+                }
+            }
+            float block[kBLOCK_M][32];
+            for (int32_t r = 0; r < kBLOCK_M; ++r)
+            {
+                _mm512_storeu_ps(block[r], acc[r][0]);
+                _mm512_storeu_ps(block[r] + 16, acc[r][1]);
+            }
+            storeBlock(t, mo, p0, block, 32);
+        }
+    }
+}
+#endif
+
+} // namespace
+
+void modulatedDeformConvHost(float const* input, float const* weight, float const* bias, float const* offset,
+    float const* mask, float* output, int32_t batch, int32_t channels, int32_t height, int32_t width,
+    int32_t channelsOut, int32_t kernelW, int32_t kernelH, int32_t strideW, int32_t strideH, int32_t padW,
+    int32_t padH, int32_t dilationW, int32_t dilationH, int32_t group, int32_t deformableGroup, int32_t numThreads)
+{
+    int32_t const heightOut = (height + 2 * padH - (dilationH * (kernelH - 1) + 1)) / strideH + 1;
+    int32_t const widthOut = (width + 2 * padW - (dilationW * (kernelW - 1) + 1)) / strideW + 1;
+    int32_t const nbPixels = heightOut * widthOut;
+    int32_t const nbTiles = (nbPixels + kTILE - 1) / kTILE;
+    int32_t const nbTaps = kernelH * kernelW;
+    int32_t const channelsPerGroup = channels / group;
+    int32_t const channelsPerDeformableGroup = channels / deformableGroup;
+    int32_t const m = channelsOut / group;
+    int32_t const k = channelsPerGroup * nbTaps;
+
+    auto multiplyTile = multiplyTileScalar;
+#if TRT_PLUGIN_HOST_X86_SIMD
+    switch (nvinfer1::pluginInternal::getHostSimdLevel())
+    {
+    case HostSimdLevel::kAVX512: multiplyTile = multiplyTileAvx512; break;
+    case HostSimdLevel::kAVX2: multiplyTile = multiplyTileAvx2; break;
+    case HostSimdLevel::kSCALAR: break;
+    }
+#endif
+
+    parallelFor(static_cast<int64_t>(batch) * group * nbTiles, numThreads, [&](int64_t task) {
+        int32_t const tile = static_cast<int32_t>(task % nbTiles);
+        int32_t const g = static_cast<int32_t>(task / nbTiles % group);
+        int32_t const b = static_cast<int32_t>(task / nbTiles / group);
+        int32_t const firstPixel = tile * kTILE;
+        int32_t const nbTilePixels = std::min(kTILE, nbPixels - firstPixel);
+
+        // im2col of the tile: row (channel, tap) holds the modulated samples of the channel at the tap.
+        std::vector<float> columns(static_cast<int64_t>(k) * kTILE);
+        std::vector<Sample> samples(nbTaps * kTILE);
+        int32_t sampledGroup{-1};
+        for (int32_t cl = 0; cl < channelsPerGroup; ++cl)
+        {
+            int32_t const c = g * channelsPerGroup + cl;
+            int32_t const dg = c / channelsPerDeformableGroup;
+            if (dg != sampledGroup)
+            {
+                // The sampling positions are shared by all the channels of a deformable group.
+                int64_t const groupIndex = static_cast<int64_t>(b) * deformableGroup + dg;
+                float const* groupOffset = offset + groupIndex * 2 * nbTaps * nbPixels;
+                float const* groupMask = mask + groupIndex * nbTaps * nbPixels;
+                for (int32_t tap = 0; tap < nbTaps; ++tap)
+                {
+                    int32_t const i = tap / kernelW;
+                    int32_t const j = tap % kernelW;
+                    for (int32_t p = 0; p < nbTilePixels; ++p)
+                    {
+                        int32_t const pixel = firstPixel + p;
+                        int32_t const hIn = pixel / widthOut * strideH - padH;
+                        int32_t const wIn = pixel % widthOut * strideW - padW;
+                        float const offsetH = groupOffset[2 * tap * nbPixels + pixel];
+                        float const offsetW = groupOffset[(2 * tap + 1) * nbPixels + pixel];
+                        samples[tap * kTILE + p] = getSample(hIn + i * dilationH + offsetH,
+                            wIn + j * dilationW + offsetW, height, width, groupMask[tap * nbPixels + pixel]);
+                    }
+                }
+                sampledGroup = dg;
+            }
+
+            float const* image = input + (static_cast<int64_t>(b) * channels + c) * height * width;
+            for (int32_t tap = 0; tap < nbTaps; ++tap)
+            {
+                float* row = columns.data() + static_cast<int64_t>(cl * nbTaps + tap) * kTILE;
+                Sample const* tapSamples = samples.data() + tap * kTILE;
+                for (int32_t p = 0; p < nbTilePixels; ++p)
+                {
+                    Sample const& s = tapSamples[p];
+                    row[p] = s.weight[0] * image[s.index[0]] + s.weight[1] * image[s.index[1]]
+                        + s.weight[2] * image[s.index[2]] + s.weight[3] * image[s.index[3]];
+                }
+            }
+        }
+
+        multiplyTile({weight + static_cast<int64_t>(g) * m * k, columns.data(), bias != nullptr ? bias + g * m : nullptr,
+            output + (static_cast<int64_t>(b) * channelsOut + g * m) * nbPixels + firstPixel, m, k, nbPixels,
+            nbTilePixels});
+    });
+}
+
+void modulatedDeformConvHost(__half const* input, __half const* weight, __half const* bias, __half const* offset,
+    __half const* mask, __half* output, int32_t batch, int32_t channels, int32_t height, int32_t width,
+    int32_t channelsOut, int32_t kernelW, int32_t kernelH, int32_t strideW, int32_t strideH, int32_t padW,
+    int32_t padH, int32_t dilationW, int32_t dilationH, int32_t group, int32_t deformableGroup, int32_t numThreads)
+{
+    int32_t const heightOut = (height + 2 * padH - (dilationH * (kernelH - 1) + 1)) / strideH + 1;
+    int32_t const widthOut = (width + 2 * padW - (dilationW * (kernelW - 1) + 1)) / strideW + 1;
+    int64_t const nbPixels = static_cast<int64_t>(heightOut) * widthOut;
+    int64_t const nbTaps = static_cast<int64_t>(kernelH) * kernelW;
+
+    auto const inputF = toFloat(input, static_cast<int64_t>(batch) * channels * height * width);
+    auto const weightF = toFloat(weight, static_cast<int64_t>(channelsOut) * (channels / group) * nbTaps);
+    auto const biasF = toFloat(bias, channelsOut);
+    auto const offsetF = toFloat(offset, static_cast<int64_t>(batch) * deformableGroup * 2 * nbTaps * nbPixels);
+    auto const maskF = toFloat(mask, static_cast<int64_t>(batch) * deformableGroup * nbTaps * nbPixels);
+    std::vector<float> outputF(static_cast<int64_t>(batch) * channelsOut * nbPixels);
+
+    modulatedDeformConvHost(inputF.data(), weightF.data(), bias != nullptr ? biasF.data() : nullptr, offsetF.data(),
+        maskF.data(), outputF.data(), batch, channels, height, width, channelsOut, kernelW, kernelH, strideW, strideH,
+        padW, padH, dilationW, dilationH, group, deformableGroup, numThreads);
+    nvinfer1::pluginInternal::convertToHalf(outputF.data(), output, static_cast<int64_t>(outputF.size()));
+}
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ **************************************************************************
+ * Modified from mmcv (https://github.com/open-mmlab/mmcv/tree/master/mmcv)
+ * Copyright (c) OpenMMLab. All Rights Reserved.
+ * Licensed under the Apache License, Version 2.0 [see LICENSE for details]
+ * https://github.com/open-mmlab/mmcv/blob/master/LICENSE
+ **************************************************************************
+ */
+
+#ifndef TRT_MODULATED_DEFORM_CONV_HOST_H
+#define TRT_MODULATED_DEFORM_CONV_HOST_H
+
+#include <cstdint>
+#include <cuda_fp16.h>
+
+//!
+//! \brief Host implementation of ModulatedDeformConvForwardCUDAKernelLauncherFloat(), on host buffers with the same
+//! layouts. bias may be null.
+//!
+//! The output pixels are split in tiles, processed in parallel across batch items, groups and tiles: the bilinear
+//! samples of each deformable group are computed once for all its channels into a column tile, which is multiplied
+//! by the weights with a register-blocked GEMM. The GEMM uses AVX2 with FMA or AVX-512 when the CPU supports them,
+//! which changes the rounding of the sums.
+//!
+//! This implementation is not part of the plugin library. It is compiled into plugin_host_benchmark, which times it and
+//! compares it with ModulatedDeformConv2d.
+//!
+//! \param numThreads Number of threads, or 0 for one per hardware thread.
+//!
+void modulatedDeformConvHost(float const* input, float const* weight, float const* bias, float const* offset,
+    float const* mask, float* output, int32_t batch, int32_t channels, int32_t height, int32_t width,
+    int32_t channelsOut, int32_t kernelW, int32_t kernelH, int32_t strideW, int32_t strideH, int32_t padW,
+    int32_t padH, int32_t dilationW, int32_t dilationH, int32_t group, int32_t deformableGroup, int32_t numThreads = 0);
+
+//!
+//! \brief FP16 overload, computing in FP32 on copies of the tensors converted on the host with F16C when available.
+//!
+void modulatedDeformConvHost(__half const* input, __half const* weight, __half const* bias, __half const* offset,
+    __half const* mask, __half* output, int32_t batch, int32_t channels, int32_t height, int32_t width,
+    int32_t channelsOut, int32_t kernelW, int32_t kernelH, int32_t strideW, int32_t strideH, int32_t padW,
+    int32_t padH, int32_t dilationW, int32_t dilationH, int32_t group, int32_t deformableGroup, int32_t numThreads = 0);
+
+#endif // TRT_MODULATED_DEFORM_CONV_HOST_H
@@ -46,12 +46,6 @@ void ModulatedDeformConvForwardCUDAKernelLauncherHalf(half const* input, half co
     int32_t deformableGroup, int32_t im2colStep, nvinfer1::pluginInternal::cublasHandle_t cublasHandle,
     cudaStream_t stream);
 
-namespace
-{
-static char const* PLUGIN_VERSION{"2"};
-static char const* PLUGIN_NAME{"ModulatedDeformConv2d"};
-} // namespace
-
 PluginFieldCollection ModulatedDeformableConvPluginDynamic::mFCToSerialize{};
 std::vector<PluginField> ModulatedDeformableConvPluginDynamic::mDataToSerialize{};
 PluginFieldCollection ModulatedDeformableConvPluginDynamicCreator::mFC{};
@@ -320,12 +314,12 @@ int32_t ModulatedDeformableConvPluginDynamic::getOutputDataTypes(nvinfer1::DataT
 
 char const* ModulatedDeformableConvPluginDynamic::getPluginName() const noexcept
 {
-    return PLUGIN_NAME;
+    return kMODULATED_DEFORM_CONV_PLUGIN_NAME;
 }
 
 char const* ModulatedDeformableConvPluginDynamic::getPluginVersion() const noexcept
 {
-    return PLUGIN_VERSION;
+    return kMODULATED_DEFORM_CONV_PLUGIN_VERSION;
 }
 
 void ModulatedDeformableConvPluginDynamic::setPluginNamespace(char const* pluginNamespace) noexcept
@@ -394,12 +388,12 @@ ModulatedDeformableConvPluginDynamicCreator::ModulatedDeformableConvPluginDynami
 
 char const* ModulatedDeformableConvPluginDynamicCreator::getPluginName() const noexcept
 {
-    return PLUGIN_NAME;
+    return kMODULATED_DEFORM_CONV_PLUGIN_NAME;
 }
 
 char const* ModulatedDeformableConvPluginDynamicCreator::getPluginVersion() const noexcept
 {
-    return PLUGIN_VERSION;
+    return kMODULATED_DEFORM_CONV_PLUGIN_VERSION;
 }
 
 nvinfer1::PluginFieldCollection const* ModulatedDeformableConvPluginDynamicCreator::getFieldNames() noexcept
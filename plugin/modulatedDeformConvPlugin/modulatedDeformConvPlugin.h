@@ -45,6 +45,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kMODULATED_DEFORM_CONV_PLUGIN_VERSION{"2"};
+constexpr char const* kMODULATED_DEFORM_CONV_PLUGIN_NAME{"ModulatedDeformConv2d"};
 
 class ModulatedDeformableConvPluginDynamic final : public nvinfer1::IPluginV3,
                                                    public nvinfer1::IPluginV3OneCore,
@@ -45,12 +45,6 @@ void ModulatedDeformConvForwardCUDAKernelLauncherHalf(half const* input, half co
     int32_t strideH, int32_t padW, int32_t padH, int32_t dilationW, int32_t dilationH, int32_t group,
     int32_t deformableGroup, int32_t im2colStep, cublasHandle_t cublasHandle, cudaStream_t stream);
 
-namespace
-{
-static char const* PLUGIN_VERSION{"1"};
-static char const* PLUGIN_NAME{"ModulatedDeformConv2d"};
-} // namespace
-
 nvinfer1::PluginFieldCollection ModulatedDeformableConvPluginDynamicLegacyCreator::mFC{};
 std::vector<nvinfer1::PluginField> ModulatedDeformableConvPluginDynamicLegacyCreator::mPluginAttributes;
 
@@ -226,12 +220,12 @@ nvinfer1::DataType ModulatedDeformableConvPluginDynamicLegacy::getOutputDataType
 // IPluginV2 Methods
 char const* ModulatedDeformableConvPluginDynamicLegacy::getPluginType() const noexcept
 {
-    return PLUGIN_NAME;
+    return kMODULATED_DEFORM_CONV_LEGACY_PLUGIN_NAME;
 }
 
 char const* ModulatedDeformableConvPluginDynamicLegacy::getPluginVersion() const noexcept
 {
-    return PLUGIN_VERSION;
+    return kMODULATED_DEFORM_CONV_LEGACY_PLUGIN_VERSION;
 }
 
 int32_t ModulatedDeformableConvPluginDynamicLegacy::getNbOutputs() const noexcept
@@ -317,12 +311,12 @@ ModulatedDeformableConvPluginDynamicLegacyCreator::ModulatedDeformableConvPlugin
 
 char const* ModulatedDeformableConvPluginDynamicLegacyCreator::getPluginName() const noexcept
 {
-    return PLUGIN_NAME;
+    return kMODULATED_DEFORM_CONV_LEGACY_PLUGIN_NAME;
 }
 
 char const* ModulatedDeformableConvPluginDynamicLegacyCreator::getPluginVersion() const noexcept
 {
-    return PLUGIN_VERSION;
+    return kMODULATED_DEFORM_CONV_LEGACY_PLUGIN_VERSION;
 }
 
 nvinfer1::PluginFieldCollection const* ModulatedDeformableConvPluginDynamicLegacyCreator::getFieldNames() noexcept
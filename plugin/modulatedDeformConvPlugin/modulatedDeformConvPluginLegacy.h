@@ -42,6 +42,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kMODULATED_DEFORM_CONV_LEGACY_PLUGIN_VERSION{"1"};
+constexpr char const* kMODULATED_DEFORM_CONV_LEGACY_PLUGIN_NAME{"ModulatedDeformConv2d"};
 
 class ModulatedDeformableConvPluginDynamicLegacy : public nvinfer1::IPluginV2DynamicExt
 {
@@ -27,12 +27,6 @@ using namespace plugin;
 using nvinfer1::plugin::MultilevelCropAndResize;
 using nvinfer1::plugin::MultilevelCropAndResizePluginCreator;
 
-namespace
-{
-char const* const kMULTILEVELCROPANDRESIZE_PLUGIN_VERSION{"1"};
-char const* const kMULTILEVELCROPANDRESIZE_PLUGIN_NAME{"MultilevelCropAndResize_TRT"};
-} // namespace
-
 PluginFieldCollection MultilevelCropAndResizePluginCreator::mFC{};
 std::vector<PluginField> MultilevelCropAndResizePluginCreator::mPluginAttributes;
 
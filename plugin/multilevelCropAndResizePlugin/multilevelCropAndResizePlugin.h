@@ -32,6 +32,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kMULTILEVELCROPANDRESIZE_PLUGIN_VERSION{"1"};
+constexpr char const* kMULTILEVELCROPANDRESIZE_PLUGIN_NAME{"MultilevelCropAndResize_TRT"};
 
 class MultilevelCropAndResize : public IPluginV2Ext
 {
@@ -30,12 +30,6 @@ using namespace plugin;
 using nvinfer1::plugin::MultilevelProposeROI;
 using nvinfer1::plugin::MultilevelProposeROIPluginCreator;
 
-namespace
-{
-char const* const kMULTILEVELPROPOSEROI_PLUGIN_VERSION{"1"};
-char const* const kMULTILEVELPROPOSEROI_PLUGIN_NAME{"MultilevelProposeROI_TRT"};
-} // namespace
-
 PluginFieldCollection MultilevelProposeROIPluginCreator::mFC{};
 std::vector<PluginField> MultilevelProposeROIPluginCreator::mPluginAttributes;
 
@@ -31,6 +31,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kMULTILEVELPROPOSEROI_PLUGIN_VERSION{"1"};
+constexpr char const* kMULTILEVELPROPOSEROI_PLUGIN_NAME{"MultilevelProposeROI_TRT"};
 
 class MultilevelProposeROI : public IPluginV2Ext
 {
@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ **************************************************************************
+ * Modified from Deformable DETR
+ * Copyright (c) 2020-2023 SenseTime. All Rights Reserved.
+ * Licensed under the Apache License, Version 2.0 [see LICENSE for details]
+ * https://github.com/fundamentalvision/Deformable-DETR/blob/main/LICENSE
+ **************************************************************************
+ */
+
+#include "multiscaleDeformableAttnHost.h"
+
+#include "common/hostParallel.h"
+#include "common/hostSimd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+//! Queries processed by one task.
+constexpr int32_t kQUERY_BLOCK{32};
+
+using nvinfer1::pluginInternal::HostSimdLevel;
+
+std::vector<float> toFloat(__half const* data, int64_t count)
+{
+    std::vector<float> result(count);
+    nvinfer1::pluginInternal::convertToFloat(data, result.data(), count);
+    return result;
+}
+
+//! output[c] += weight * row[c] for each channel.
+void accumulateScalar(float* output, float const* row, float weight, int32_t channels)
+{
+    for (int32_t c = 0; c < channels; ++c)
+    {
+        output[c] += weight * row[c];
+    }
+}
+
+#if TRT_PLUGIN_HOST_X86_SIMD
+__attribute__((target("avx2,fma"))) void accumulateAvx2(
+    float* output, float const* row, float weight, int32_t channels)
+{
+    __m256 const w = _mm256_set1_ps(weight);
+    int32_t c = 0;
+    for (; c + 8 <= channels; c += 8)
+    {
+        _mm256_storeu_ps(output + c, _mm256_fmadd_ps(w, _mm256_loadu_ps(row + c), _mm256_loadu_ps(output + c)));
+    }
+    accumulateScalar(output + c, row + c, weight, channels - c);
+}
+
+__attribute__((target("avx512f"))) void accumulateAvx512(
+    float* output, float const* row, float weight, int32_t channels)
+{
+    __m512 const w = _mm512_set1_ps(weight);
+    int32_t c = 0;
+    for (; c + 16 <= channels; c += 16)
+    {
+        _mm512_storeu_ps(output + c, _mm512_fmadd_ps(w, _mm512_loadu_ps(row + c), _mm512_loadu_ps(output + c)));
+    }
+    // The remaining channels are masked, for heads of 8 or 24 channels.
+    __mmask16 const tail = static_cast<__mmask16>((1U << (channels - c)) - 1U);
+    _mm512_mask_storeu_ps(output + c, tail,
+        _mm512_fmadd_ps(w, _mm512_maskz_loadu_ps(tail, row + c), _mm512_maskz_loadu_ps(tail, output + c)));
+}
+#endif
+
+} // namespace
+
+int32_t ms_deform_attn_host_forward(float const* value, int32_t const* spatialShapes, int32_t const* levelStartIndex,
+    float const* samplingLoc, float const* attnWeight, float* output, int32_t batch, int32_t mSpatialSize,
+    int32_t mNumHeads, int32_t mChannels, int32_t mNumLevels, int32_t mNumQuery, int32_t mNumPoint,
+    int32_t numThreads)
+{
+    int32_t const nbQueryBlocks = (mNumQuery + kQUERY_BLOCK - 1) / kQUERY_BLOCK;
+    int32_t const pixelStride = mNumHeads * mChannels;
+
+    auto accumulate = accumulateScalar;
+#if TRT_PLUGIN_HOST_X86_SIMD
+    switch (nvinfer1::pluginInternal::getHostSimdLevel())
+    {
+    case HostSimdLevel::kAVX512: accumulate = accumulateAvx512; break;
+    case HostSimdLevel::kAVX2: accumulate = accumulateAvx2; break;
+    case HostSimdLevel::kSCALAR: break;
+    }
+#endif
+
+    nvinfer1::pluginInternal::parallelFor(
+        static_cast<int64_t>(batch) * mNumHeads * nbQueryBlocks, numThreads, [&](int64_t task) {
+            int32_t const head = static_cast<int32_t>(task % mNumHeads);
+            int32_t const block = static_cast<int32_t>(task / mNumHeads % nbQueryBlocks);
+            int32_t const b = static_cast<int32_t>(task / mNumHeads / nbQueryBlocks);
+            float const* headValue = value + static_cast<int64_t>(b) * mSpatialSize * pixelStride + head * mChannels;
+            int32_t const lastQuery = std::min(mNumQuery, (block + 1) * kQUERY_BLOCK);
+            for (int32_t q = block * kQUERY_BLOCK; q < lastQuery; ++q)
+            {
+                int64_t const samplingIndex = (static_cast<int64_t>(b) * mNumQuery + q) * mNumHeads + head;
+                float* out = output + samplingIndex * mChannels;
+                std::fill_n(out, mChannels, 0.F);
+                float const* weights = attnWeight + samplingIndex * mNumLevels * mNumPoint;
+                float const* locations = samplingLoc + samplingIndex * mNumLevels * mNumPoint * 2;
+                for (int32_t level = 0; level < mNumLevels; ++level)
+                {
+                    int32_t const height = spatialShapes[2 * level];
+                    int32_t const width = spatialShapes[2 * level + 1];
+                    float const* levelValue = headValue + static_cast<int64_t>(levelStartIndex[level]) * pixelStride;
+                    for (int32_t point = 0; point < mNumPoint; ++point)
+                    {
+                        int32_t const sample = level * mNumPoint + point;
+                        float const hIm = locations[2 * sample + 1] * height - 0.5F;
+                        float const wIm = locations[2 * sample] * width - 0.5F;
+                        if (!(hIm > -1 && wIm > -1 && hIm < height && wIm < width))
+                        {
+                            continue;
+                        }
+                        auto const hLow = static_cast<int32_t>(std::floor(hIm));
+                        auto const wLow = static_cast<int32_t>(std::floor(wIm));
+                        float const lh = hIm - hLow;
+                        float const lw = wIm - wLow;
+                        float const hh = 1 - lh;
+                        float const hw = 1 - lw;
+                        float const weight = weights[sample];
+                        auto const row = [&](int32_t h, int32_t w) {
+                            return levelValue + (static_cast<int64_t>(h) * width + w) * pixelStride;
+                        };
+                        if (hLow >= 0 && wLow >= 0)
+                        {
+                            accumulate(out, row(hLow, wLow), hh * hw * weight, mChannels);
+                        }
+                        if (hLow >= 0 && wLow + 1 <= width - 1)
+                        {
+                            accumulate(out, row(hLow, wLow + 1), hh * lw * weight, mChannels);
+                        }
+                        if (hLow + 1 <= height - 1 && wLow >= 0)
+                        {
+                            accumulate(out, row(hLow + 1, wLow), lh * hw * weight, mChannels);
+                        }
+                        if (hLow + 1 <= height - 1 && wLow + 1 <= width - 1)
+                        {
+                            accumulate(out, row(hLow + 1, wLow + 1), lh * lw * weight, mChannels);
+                        }
+                    }
+                }
+            }
+        });
+    return 0;
+}
+
+int32_t ms_deform_attn_host_forward(__half const* value, int32_t const* spatialShapes, int32_t const* levelStartIndex,
+    __half const* samplingLoc, __half const* attnWeight, __half* output, int32_t batch, int32_t mSpatialSize,
+    int32_t mNumHeads, int32_t mChannels, int32_t mNumLevels, int32_t mNumQuery, int32_t mNumPoint,
+    int32_t numThreads)
+{
+    int64_t const nbSamples = static_cast<int64_t>(batch) * mNumQuery * mNumHeads * mNumLevels * mNumPoint;
+    auto const valueF = toFloat(value, static_cast<int64_t>(batch) * mSpatialSize * mNumHeads * mChannels);
+    auto const samplingLocF = toFloat(samplingLoc, nbSamples * 2);
+    auto const attnWeightF = toFloat(attnWeight, nbSamples);
+    std::vector<float> outputF(static_cast<int64_t>(batch) * mNumQuery * mNumHeads * mChannels);
+
+    int32_t const status = ms_deform_attn_host_forward(valueF.data(), spatialShapes, levelStartIndex,
+        samplingLocF.data(), attnWeightF.data(), outputF.data(), batch, mSpatialSize, mNumHeads, mChannels, mNumLevels,
+        mNumQuery, mNumPoint, numThreads);
+    nvinfer1::pluginInternal::convertToHalf(outputF.data(), output, static_cast<int64_t>(outputF.size()));
+    return status;
+}
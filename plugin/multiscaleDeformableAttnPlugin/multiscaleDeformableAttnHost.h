@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ **************************************************************************
+ * Modified from Deformable DETR
+ * Copyright (c) 2020-2023 SenseTime. All Rights Reserved.
+ * Licensed under the Apache License, Version 2.0 [see LICENSE for details]
+ * https://github.com/fundamentalvision/Deformable-DETR/blob/main/LICENSE
+ **************************************************************************
+ */
+
+#ifndef TRT_MULTISCALE_DEFORMABLE_ATTN_HOST_H
+#define TRT_MULTISCALE_DEFORMABLE_ATTN_HOST_H
+
+#include <cstdint>
+#include <cuda_fp16.h>
+
+//!
+//! \brief Host implementation of ms_deform_attn_cuda_forward(), on host buffers with the same layouts.
+//!
+//! Queries are processed in parallel across batch items, heads and blocks of queries. The bilinear weights of each
+//! sampling point are computed once and applied to all the channels of the head, which are contiguous in value and
+//! output. The accumulation over the channels uses AVX2 with FMA or AVX-512 when the CPU supports them, which changes
+//! the rounding of the sums.
+//!
+//! This implementation is not part of the plugin library. It is compiled into plugin_host_benchmark, which times it and
+//! compares it with MultiscaleDeformableAttnPlugin_TRT.
+//!
+//! \param numThreads Number of threads, or 0 for one per hardware thread.
+//!
+int32_t ms_deform_attn_host_forward(float const* value, int32_t const* spatialShapes, int32_t const* levelStartIndex,
+    float const* samplingLoc, float const* attnWeight, float* output, int32_t batch, int32_t mSpatialSize,
+    int32_t mNumHeads, int32_t mChannels, int32_t mNumLevels, int32_t mNumQuery, int32_t mNumPoint,
+    int32_t numThreads = 0);
+
+//!
+//! \brief FP16 overload, computing in FP32 on copies of the tensors converted on the host with F16C when available.
+//!
+int32_t ms_deform_attn_host_forward(__half const* value, int32_t const* spatialShapes, int32_t const* levelStartIndex,
+    __half const* samplingLoc, __half const* attnWeight, __half* output, int32_t batch, int32_t mSpatialSize,
+    int32_t mNumHeads, int32_t mChannels, int32_t mNumLevels, int32_t mNumQuery, int32_t mNumPoint,
+    int32_t numThreads = 0);
+
+#endif // TRT_MULTISCALE_DEFORMABLE_ATTN_HOST_H
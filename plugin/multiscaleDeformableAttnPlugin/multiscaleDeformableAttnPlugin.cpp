@@ -21,12 +21,6 @@
 using namespace nvinfer1;
 using namespace nvinfer1::plugin;
 
-namespace
-{
-static char const* DMHA_VERSION{"2"};
-static char const* DMHA_NAME{"MultiscaleDeformableAttnPlugin_TRT"};
-} // namespace
-
 namespace nvinfer1::plugin
 {
 
@@ -57,12 +51,12 @@ IPluginCapability* MultiscaleDeformableAttnPlugin::getCapabilityInterface(Plugin
 // IPluginV3OneCore methods
 char const* MultiscaleDeformableAttnPlugin::getPluginName() const noexcept
 {
-    return DMHA_NAME;
+    return kMULTISCALE_DEFORMABLE_ATTN_PLUGIN_NAME;
 }
 
 char const* MultiscaleDeformableAttnPlugin::getPluginVersion() const noexcept
 {
-    return DMHA_VERSION;
+    return kMULTISCALE_DEFORMABLE_ATTN_PLUGIN_VERSION;
 }
 
 int32_t MultiscaleDeformableAttnPlugin::getNbOutputs() const noexcept
@@ -375,12 +369,12 @@ MultiscaleDeformableAttnPluginCreator::MultiscaleDeformableAttnPluginCreator()
 
 char const* MultiscaleDeformableAttnPluginCreator::getPluginName() const noexcept
 {
-    return DMHA_NAME;
+    return kMULTISCALE_DEFORMABLE_ATTN_PLUGIN_NAME;
 }
 
 char const* MultiscaleDeformableAttnPluginCreator::getPluginVersion() const noexcept
 {
-    return DMHA_VERSION;
+    return kMULTISCALE_DEFORMABLE_ATTN_PLUGIN_VERSION;
 }
 
 PluginFieldCollection const* MultiscaleDeformableAttnPluginCreator::getFieldNames() noexcept
@@ -37,6 +37,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kMULTISCALE_DEFORMABLE_ATTN_PLUGIN_VERSION{"2"};
+constexpr char const* kMULTISCALE_DEFORMABLE_ATTN_PLUGIN_NAME{"MultiscaleDeformableAttnPlugin_TRT"};
 
 // Forward declarations
 class MultiscaleDeformableAttnPlugin;
@@ -28,12 +28,6 @@ using namespace nvinfer1::plugin;
 namespace nvinfer1::plugin
 {
 
-namespace
-{
-static char const* DMHA_VERSION{"1"};
-static char const* DMHA_NAME{"MultiscaleDeformableAttnPlugin_TRT"};
-} // namespace
-
 // // Register the plugin with TensorRT
 // REGISTER_TENSORRT_PLUGIN(MultiscaleDeformableAttnPluginCreatorLegacy);
 
@@ -178,12 +172,12 @@ nvinfer1::DataType MultiscaleDeformableAttnPluginLegacy::getOutputDataType(
 // IPluginV2 Methods
 char const* MultiscaleDeformableAttnPluginLegacy::getPluginType() const noexcept
 {
-    return DMHA_NAME;
+    return kMULTISCALE_DEFORMABLE_ATTN_LEGACY_PLUGIN_NAME;
 }
 
 char const* MultiscaleDeformableAttnPluginLegacy::getPluginVersion() const noexcept
 {
-    return DMHA_VERSION;
+    return kMULTISCALE_DEFORMABLE_ATTN_LEGACY_PLUGIN_VERSION;
 }
 
 int32_t MultiscaleDeformableAttnPluginLegacy::getNbOutputs() const noexcept
@@ -230,12 +224,12 @@ MultiscaleDeformableAttnPluginCreatorLegacy::MultiscaleDeformableAttnPluginCreat
 
 char const* MultiscaleDeformableAttnPluginCreatorLegacy::getPluginName() const noexcept
 {
-    return DMHA_NAME;
+    return kMULTISCALE_DEFORMABLE_ATTN_LEGACY_PLUGIN_NAME;
 }
 
 char const* MultiscaleDeformableAttnPluginCreatorLegacy::getPluginVersion() const noexcept
 {
-    return DMHA_VERSION;
+    return kMULTISCALE_DEFORMABLE_ATTN_LEGACY_PLUGIN_VERSION;
 }
 
 nvinfer1::PluginFieldCollection const* MultiscaleDeformableAttnPluginCreatorLegacy::getFieldNames() noexcept
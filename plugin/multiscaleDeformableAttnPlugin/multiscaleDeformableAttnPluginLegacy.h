@@ -37,6 +37,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kMULTISCALE_DEFORMABLE_ATTN_LEGACY_PLUGIN_VERSION{"1"};
+constexpr char const* kMULTISCALE_DEFORMABLE_ATTN_LEGACY_PLUGIN_NAME{"MultiscaleDeformableAttnPlugin_TRT"};
 
 // Legacy V2 Plugin implementation
 class MultiscaleDeformableAttnPluginLegacy : public nvinfer1::IPluginV2DynamicExt
@@ -22,12 +22,6 @@
 
 namespace nvinfer1::plugin
 {
-namespace
-{
-char const* const kNMS_PLUGIN_VERSION{"1"};
-char const* const kNMS_PLUGIN_NAMES[] = {"NMS_TRT", "NMSDynamic_TRT"};
-} // namespace
-
 PluginFieldCollection NMSBasePluginCreator::mFC{};
 std::vector<PluginField> NMSBasePluginCreator::mPluginAttributes;
 
@@ -337,12 +331,12 @@ bool DetectionOutputDynamic::supportsFormatCombination(
 // Get the plugin type
 char const* DetectionOutput::getPluginType() const noexcept
 {
-    return kNMS_PLUGIN_NAMES[0];
+    return kNMS_PLUGIN_NAME;
 }
 
 char const* DetectionOutputDynamic::getPluginType() const noexcept
 {
-    return kNMS_PLUGIN_NAMES[1];
+    return kNMS_DYNAMIC_PLUGIN_NAME;
 }
 
 // Get the plugin version
@@ -602,12 +596,12 @@ NMSBasePluginCreator::NMSBasePluginCreator()
 
 NMSPluginCreator::NMSPluginCreator()
 {
-    mPluginName = kNMS_PLUGIN_NAMES[0];
+    mPluginName = kNMS_PLUGIN_NAME;
 }
 
 NMSDynamicPluginCreator::NMSDynamicPluginCreator()
 {
-    mPluginName = kNMS_PLUGIN_NAMES[1];
+    mPluginName = kNMS_DYNAMIC_PLUGIN_NAME;
 }
 
 // Returns the plugin name
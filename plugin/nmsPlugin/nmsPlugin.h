@@ -26,6 +26,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kNMS_PLUGIN_VERSION{"1"};
+constexpr char const* kNMS_PLUGIN_NAME{"NMS_TRT"};
+constexpr char const* kNMS_DYNAMIC_PLUGIN_NAME{"NMSDynamic_TRT"};
 
 class TRT_DEPRECATED DetectionOutput : public IPluginV2Ext
 {
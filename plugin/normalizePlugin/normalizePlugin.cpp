@@ -25,12 +25,6 @@ using namespace nvinfer1::pluginInternal;
 using nvinfer1::plugin::Normalize;
 using nvinfer1::plugin::NormalizePluginCreator;
 
-namespace
-{
-char const* const kNORMALIZE_PLUGIN_VERSION{"1"};
-char const* const kNORMALIZE_PLUGIN_NAME{"Normalize_TRT"};
-} // namespace
-
 PluginFieldCollection NormalizePluginCreator::mFC{};
 std::vector<PluginField> NormalizePluginCreator::mPluginAttributes;
 
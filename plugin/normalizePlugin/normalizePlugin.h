@@ -25,6 +25,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kNORMALIZE_PLUGIN_VERSION{"1"};
+constexpr char const* kNORMALIZE_PLUGIN_NAME{"Normalize_TRT"};
 
 class TRT_DEPRECATED Normalize : public IPluginV2Ext
 {
@@ -21,12 +21,6 @@
 
 namespace nvinfer1::plugin
 {
-namespace
-{
-char const* const kRPROI_PLUGIN_VERSION{"1"};
-char const* const kRPROI_PLUGIN_NAME{"RPROI_TRT"};
-} // namespace
-
 PluginFieldCollection RPROIPluginCreator::mFC{};
 std::vector<PluginField> RPROIPluginCreator::mPluginAttributes;
 
@@ -25,6 +25,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kRPROI_PLUGIN_VERSION{"1"};
+constexpr char const* kRPROI_PLUGIN_NAME{"RPROI_TRT"};
 
 class RPROIPlugin : public IPluginV2IOExt
 {
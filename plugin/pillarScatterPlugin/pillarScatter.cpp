@@ -22,9 +22,6 @@
 namespace nvinfer1::plugin
 {
 
-static char const* const kPLUGIN_VERSION{"1"};
-static char const* const kPLUGIN_NAME{"PillarScatterPlugin"};
-
 // Static class fields initialization
 PluginFieldCollection PillarScatterPluginCreator::mFC{};
 std::vector<PluginField> PillarScatterPluginCreator::mPluginAttributes;
@@ -166,12 +163,12 @@ nvinfer1::DataType PillarScatterPlugin::getOutputDataType(
 
 char const* PillarScatterPlugin::getPluginType() const noexcept
 {
-    return kPLUGIN_NAME;
+    return kPILLAR_SCATTER_PLUGIN_NAME;
 }
 
 char const* PillarScatterPlugin::getPluginVersion() const noexcept
 {
-    return kPLUGIN_VERSION;
+    return kPILLAR_SCATTER_PLUGIN_VERSION;
 }
 
 int32_t PillarScatterPlugin::getNbOutputs() const noexcept
@@ -223,12 +220,12 @@ PillarScatterPluginCreator::PillarScatterPluginCreator()
 
 char const* PillarScatterPluginCreator::getPluginName() const noexcept
 {
-    return kPLUGIN_NAME;
+    return kPILLAR_SCATTER_PLUGIN_NAME;
 }
 
 char const* PillarScatterPluginCreator::getPluginVersion() const noexcept
 {
-    return kPLUGIN_VERSION;
+    return kPILLAR_SCATTER_PLUGIN_VERSION;
 }
 
 PluginFieldCollection const* PillarScatterPluginCreator::getFieldNames() noexcept
@@ -28,6 +28,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kPILLAR_SCATTER_PLUGIN_VERSION{"1"};
+constexpr char const* kPILLAR_SCATTER_PLUGIN_NAME{"PillarScatterPlugin"};
 
 class PillarScatterPlugin : public nvinfer1::IPluginV2DynamicExt
 {
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pillarScatterHost.h"
+
+#include "common/hostParallel.h"
+
+#include <algorithm>
+#include <cuda_fp16.h>
+
+namespace nvinfer1
+{
+namespace plugin
+{
+
+template <typename Element>
+void pillarScatterHost(int32_t batchSize, int32_t maxPillarNum, int32_t numFeatures, Element const* pillarFeatures,
+    uint32_t const* coords, uint32_t const* params, uint32_t featureX, uint32_t featureY, Element* spatialFeatures,
+    int32_t numThreads)
+{
+    int64_t const planeSize = static_cast<int64_t>(featureX) * featureY;
+    // Each task writes one channel of one batch item, reading the features of the pillars with a stride.
+    nvinfer1::pluginInternal::parallelFor(
+        static_cast<int64_t>(batchSize) * numFeatures, numThreads, [&](int64_t task) {
+            int64_t const b = task / numFeatures;
+            int64_t const c = task % numFeatures;
+            Element* plane = spatialFeatures + task * planeSize;
+            std::fill_n(plane, planeSize, Element{});
+            int64_t const nbPillars = std::min(static_cast<int64_t>(params[b]), static_cast<int64_t>(maxPillarNum));
+            Element const* features = pillarFeatures + b * maxPillarNum * numFeatures + c;
+            uint32_t const* pillarCoords = coords + b * maxPillarNum * 4;
+            for (int64_t p = 0; p < nbPillars; ++p)
+            {
+                uint32_t const y = pillarCoords[p * 4 + 2];
+                uint32_t const x = pillarCoords[p * 4 + 3];
+                plane[y * featureX + x] = features[p * numFeatures];
+            }
+        });
+}
+
+template void pillarScatterHost<float>(int32_t batchSize, int32_t maxPillarNum, int32_t numFeatures,
+    float const* pillarFeatures, uint32_t const* coords, uint32_t const* params, uint32_t featureX, uint32_t featureY,
+    float* spatialFeatures, int32_t numThreads);
+
+template void pillarScatterHost<half>(int32_t batchSize, int32_t maxPillarNum, int32_t numFeatures,
+    half const* pillarFeatures, uint32_t const* coords, uint32_t const* params, uint32_t featureX, uint32_t featureY,
+    half* spatialFeatures, int32_t numThreads);
+
+} // namespace plugin
+} // namespace nvinfer1
@@ -0,0 +1,47 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_PILLAR_SCATTER_HOST_H
+#define TRT_PILLAR_SCATTER_HOST_H
+
+#include <cstdint>
+
+namespace nvinfer1
+{
+namespace plugin
+{
+
+//!
+//! \brief Host implementation of pillarScatterKernelLaunch(), on host buffers with the layouts of its tensors.
+//!
+//! Scatters the features of the pillars of each batch item into a [numFeatures, featureY, featureX] grid, parallel
+//! across the channels. Cells without a pillar are zero. Element is float or half.
+//!
+//! This implementation is not part of the plugin library. It is compiled into plugin_host_benchmark, which times it and
+//! compares it with PillarScatterPlugin.
+//!
+//! \param numThreads Number of threads, or 0 for one per hardware thread.
+//!
+template <typename Element>
+void pillarScatterHost(int32_t batchSize, int32_t maxPillarNum, int32_t numFeatures, Element const* pillarFeatures,
+    uint32_t const* coords, uint32_t const* params, uint32_t featureX, uint32_t featureY, Element* spatialFeatures,
+    int32_t numThreads = 0);
+
+} // namespace plugin
+} // namespace nvinfer1
+
+#endif // TRT_PILLAR_SCATTER_HOST_H
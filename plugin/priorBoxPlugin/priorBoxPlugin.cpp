@@ -26,12 +26,6 @@ using namespace nvinfer1::plugin;
 using nvinfer1::plugin::PriorBox;
 using nvinfer1::plugin::PriorBoxPluginCreator;
 
-namespace
-{
-char const* const kPRIOR_BOX_PLUGIN_VERSION{"1"};
-char const* const kPRIOR_BOX_PLUGIN_NAME{"PriorBox_TRT"};
-} // namespace
-
 PluginFieldCollection PriorBoxPluginCreator::mFC{};
 std::vector<PluginField> PriorBoxPluginCreator::mPluginAttributes;
 
@@ -109,6 +103,7 @@ void PriorBox::setupDeviceMemory() noexcept
     // mAspectRatiosGPU.count is different to mParam.numAspectRatios.
     //
     mAspectRatiosGPU = copyToDevice(&tmpAR[0], tmpAR.size());
+    mPriorAspectRatiosCPU = tmpAR;
 
     // Number of prior boxes per grid cell on the feature map
     // tmpAR already included an aspect ratio of 1.0
@@ -192,9 +187,43 @@ Dims PriorBox::getOutputDimensions(int32_t index, Dims const* inputs, int32_t nb
 
 int32_t PriorBox::initialize() noexcept
 {
+    // The priors only depend on the parameters and the feature map size, fixed by now.
+    if (mPrecomputedOutput == nullptr && !precomputeOutput())
+    {
+        // Fall back to generating the priors at each enqueue.
+        static_cast<void>(cudaGetLastError());
+    }
     return STATUS_SUCCESS;
 }
 
+bool PriorBox::precomputeOutput() noexcept
+{
+    size_t const count = 2 * static_cast<size_t>(mH) * mW * mNumPriors * 4;
+    std::vector<float> output(count);
+    priorBoxHost(mParam, mH, mW, mNumPriors, static_cast<int32_t>(mPriorAspectRatiosCPU.size()), mMinSizeCPU.data(),
+        mMaxSizeCPU.data(), mPriorAspectRatiosCPU.data(), output.data());
+    if (cudaMalloc(&mPrecomputedOutput, count * sizeof(float)) != cudaSuccess)
+    {
+        mPrecomputedOutput = nullptr;
+        return false;
+    }
+    if (cudaMemcpy(mPrecomputedOutput, output.data(), count * sizeof(float), cudaMemcpyHostToDevice) != cudaSuccess)
+    {
+        terminate();
+        return false;
+    }
+    return true;
+}
+
+void PriorBox::terminate() noexcept
+{
+    if (mPrecomputedOutput != nullptr)
+    {
+        PLUGIN_CUERROR(cudaFree(mPrecomputedOutput));
+        mPrecomputedOutput = nullptr;
+    }
+}
+
 size_t PriorBox::getWorkspaceSize(int32_t /*maxBatchSize*/) const noexcept
 {
     return 0;
@@ -204,6 +233,12 @@ int32_t PriorBox::enqueue(int32_t /*batchSize*/, void const* const* /*inputs*/,
     void* /*workspace*/, cudaStream_t stream) noexcept
 {
     void* outputData = outputs[0];
+    if (mPrecomputedOutput != nullptr)
+    {
+        size_t const size = 2 * static_cast<size_t>(mH) * mW * mNumPriors * 4 * sizeof(float);
+        CSC(cudaMemcpyAsync(outputData, mPrecomputedOutput, size, cudaMemcpyDeviceToDevice, stream), STATUS_FAILURE);
+        return STATUS_SUCCESS;
+    }
     pluginStatus_t status = priorBoxInference(stream, mParam, mH, mW, mNumPriors, mAspectRatiosGPU.count,
         mMinSizeGPU.values, mMaxSizeGPU.values, mAspectRatiosGPU.values, outputData);
 
@@ -260,6 +295,7 @@ char const* PriorBox::getPluginVersion() const noexcept
 
 void PriorBox::destroy() noexcept
 {
+    terminate();
     PLUGIN_CUASSERT(cudaFree(const_cast<void*>(mMinSizeGPU.values)));
     if (mParam.numMaxSize > 0)
     {
@@ -347,6 +383,8 @@ void PriorBox::configurePlugin(Dims const* inputDims, int32_t nbInputs, Dims con
         mParam.stepH = static_cast<float>(mParam.imgH) / mH;
         mParam.stepW = static_cast<float>(mParam.imgW) / mW;
     }
+    // Priors generated for a previous configuration are stale.
+    terminate();
 }
 
 // Attach the plugin object to an execution context and grant the plugin the access to some context resource.
@@ -26,6 +26,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kPRIOR_BOX_PLUGIN_VERSION{"1"};
+constexpr char const* kPRIOR_BOX_PLUGIN_NAME{"PriorBox_TRT"};
 
 class PriorBox : public IPluginV2Ext
 {
@@ -42,7 +44,7 @@ public:
 
     int32_t initialize() noexcept override;
 
-    void terminate() noexcept override{};
+    void terminate() noexcept override;
 
     size_t getWorkspaceSize(int32_t maxBatchSize) const noexcept override;
 
@@ -88,6 +90,9 @@ private:
     void deserialize(uint8_t const* buffer, size_t length);
     void setupDeviceMemory() noexcept;
 
+    //! Generate the output on the host and keep it on the device. Return false if it could not be stored.
+    bool precomputeOutput() noexcept;
+
     PriorBoxParameters mParam{};
     int32_t mNumPriors{};
     int32_t mH{};
@@ -103,6 +108,12 @@ private:
     std::vector<float> mMinSizeCPU;
     std::vector<float> mMaxSizeCPU;
     std::vector<float> mAspectRatiosCPU;
+    // Aspect ratios of the priors, as in mAspectRatiosGPU.
+    std::vector<float> mPriorAspectRatiosCPU;
+
+    // Output generated at initialize(), copied at enqueue instead of running the kernel. Null if it could not be
+    // allocated.
+    void* mPrecomputedOutput{nullptr};
 
     std::string mPluginNamespace;
 };
@@ -27,12 +27,6 @@ using namespace plugin;
 using nvinfer1::plugin::ProposalLayer;
 using nvinfer1::plugin::ProposalLayerPluginCreator;
 
-namespace
-{
-char const* const kPROPOSALLAYER_PLUGIN_VERSION{"1"};
-char const* const kPROPOSALLAYER_PLUGIN_NAME{"ProposalLayer_TRT"};
-} // namespace
-
 PluginFieldCollection ProposalLayerPluginCreator::mFC{};
 std::vector<PluginField> ProposalLayerPluginCreator::mPluginAttributes;
 
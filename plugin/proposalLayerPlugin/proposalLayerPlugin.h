@@ -30,6 +30,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kPROPOSALLAYER_PLUGIN_VERSION{"1"};
+constexpr char const* kPROPOSALLAYER_PLUGIN_NAME{"ProposalLayer_TRT"};
 
 class ProposalLayer : public IPluginV2Ext
 {
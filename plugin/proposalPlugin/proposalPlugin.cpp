@@ -33,8 +33,6 @@ using nvinfer1::plugin::ProposalPluginCreator;
 // plugin specific constants
 namespace
 {
-static char const* const kPROPOSAL_PLUGIN_VERSION{"1"};
-static char const* const kPROPOSAL_PLUGIN_NAMES[] = {"Proposal", "ProposalDynamic"};
 static constexpr float kRPN_STD_SCALING{1.0F};
 } // namespace
 
@@ -214,12 +212,12 @@ ProposalDynamicPlugin::~ProposalDynamicPlugin() noexcept {}
 
 char const* ProposalPlugin::getPluginType() const noexcept
 {
-    return kPROPOSAL_PLUGIN_NAMES[0];
+    return kPROPOSAL_PLUGIN_NAME;
 }
 
 char const* ProposalDynamicPlugin::getPluginType() const noexcept
 {
-    return kPROPOSAL_PLUGIN_NAMES[1];
+    return kPROPOSAL_DYNAMIC_PLUGIN_NAME;
 }
 
 char const* ProposalPlugin::getPluginVersion() const noexcept
@@ -654,12 +652,12 @@ ProposalBasePluginCreator::ProposalBasePluginCreator() noexcept
 
 ProposalPluginCreator::ProposalPluginCreator() noexcept
 {
-    mPluginName = kPROPOSAL_PLUGIN_NAMES[0];
+    mPluginName = kPROPOSAL_PLUGIN_NAME;
 }
 
 ProposalDynamicPluginCreator::ProposalDynamicPluginCreator() noexcept
 {
-    mPluginName = kPROPOSAL_PLUGIN_NAMES[1];
+    mPluginName = kPROPOSAL_DYNAMIC_PLUGIN_NAME;
 }
 
 char const* ProposalBasePluginCreator::getPluginName() const noexcept
@@ -31,6 +31,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kPROPOSAL_PLUGIN_VERSION{"1"};
+constexpr char const* kPROPOSAL_PLUGIN_NAME{"Proposal"};
+constexpr char const* kPROPOSAL_DYNAMIC_PLUGIN_NAME{"ProposalDynamic"};
 
 class TRT_DEPRECATED ProposalPlugin : public IPluginV2Ext
 {
@@ -24,12 +24,6 @@ using namespace plugin;
 using nvinfer1::plugin::PyramidROIAlign;
 using nvinfer1::plugin::PyramidROIAlignPluginCreator;
 
-namespace
-{
-char const* const kPYRAMIDROIALGIN_PLUGIN_VERSION{"1"};
-char const* const kPYRAMIDROIALGIN_PLUGIN_NAME{"PyramidROIAlign_TRT"};
-} // namespace
-
 PluginFieldCollection PyramidROIAlignPluginCreator::mFC{};
 std::vector<PluginField> PyramidROIAlignPluginCreator::mPluginAttributes;
 
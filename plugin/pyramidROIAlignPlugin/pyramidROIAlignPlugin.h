@@ -31,6 +31,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kPYRAMIDROIALGIN_PLUGIN_VERSION{"1"};
+constexpr char const* kPYRAMIDROIALGIN_PLUGIN_NAME{"PyramidROIAlign_TRT"};
 
 class PyramidROIAlign : public IPluginV2Ext
 {
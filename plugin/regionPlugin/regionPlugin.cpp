@@ -21,9 +21,6 @@ namespace nvinfer1::plugin
 {
 namespace
 {
-char const* const kREGION_PLUGIN_VERSION{"1"};
-char const* const kREGION_PLUGIN_NAME{"Region_TRT"};
-
 template <typename T>
 void safeFree(T* ptr)
 {
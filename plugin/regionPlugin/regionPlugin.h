@@ -26,6 +26,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kREGION_PLUGIN_VERSION{"1"};
+constexpr char const* kREGION_PLUGIN_NAME{"Region_TRT"};
 
 class Region : public IPluginV2Ext
 {
@@ -25,6 +25,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kREORG_PLUGIN_STATIC_VERSION{"1"};
+constexpr char const* kREORG_PLUGIN_DYNAMIC_VERSION{"2"};
+constexpr char const* kREORG_PLUGIN_NAME{"Reorg_TRT"};
 
 template <class TBaseClass>
 class Reorg : public TBaseClass
@@ -27,12 +27,6 @@ using namespace plugin;
 using nvinfer1::plugin::ResizeNearest;
 using nvinfer1::plugin::ResizeNearestPluginCreator;
 
-namespace
-{
-char const* const kRESIZE_PLUGIN_VERSION{"1"};
-char const* const kRESIZE_PLUGIN_NAME{"ResizeNearest_TRT"};
-} // namespace
-
 PluginFieldCollection ResizeNearestPluginCreator::mFC{};
 std::vector<PluginField> ResizeNearestPluginCreator::mPluginAttributes;
 
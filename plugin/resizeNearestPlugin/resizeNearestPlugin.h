@@ -30,6 +30,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kRESIZE_PLUGIN_VERSION{"1"};
+constexpr char const* kRESIZE_PLUGIN_NAME{"ResizeNearest_TRT"};
+
 class ResizeNearest : public IPluginV2Ext
 {
 public:
@@ -24,12 +24,6 @@ using namespace plugin;
 using nvinfer1::plugin::ROIAlignV3;
 using nvinfer1::plugin::ROIAlignV3PluginCreator;
 
-namespace
-{
-char const* gRoialignPluginVersion{"2"};
-char const* gRoialignPluginName{"ROIAlign_TRT"};
-} // namespace
-
 PluginFieldCollection ROIAlignV3PluginCreator::mFC{};
 std::vector<PluginField> ROIAlignV3PluginCreator::mPluginAttributes;
 
@@ -51,12 +45,12 @@ ROIAlignV3PluginCreator::ROIAlignV3PluginCreator()
 
 char const* ROIAlignV3PluginCreator::getPluginName() const noexcept
 {
-    return gRoialignPluginName;
+    return kROIALIGN_PLUGIN_NAME;
 }
 
 char const* ROIAlignV3PluginCreator::getPluginVersion() const noexcept
 {
-    return gRoialignPluginVersion;
+    return kROIALIGN_PLUGIN_VERSION;
 }
 
 PluginFieldCollection const* ROIAlignV3PluginCreator::getFieldNames() noexcept
@@ -195,12 +189,12 @@ IPluginV3* ROIAlignV3::clone() noexcept
 
 char const* ROIAlignV3::getPluginName() const noexcept
 {
-    return gRoialignPluginName;
+    return kROIALIGN_PLUGIN_NAME;
 }
 
 char const* ROIAlignV3::getPluginVersion() const noexcept
 {
-    return gRoialignPluginVersion;
+    return kROIALIGN_PLUGIN_VERSION;
 }
 
 char const* ROIAlignV3::getPluginNamespace() const noexcept
@@ -29,6 +29,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kROIALIGN_PLUGIN_VERSION{"2"};
+constexpr char const* kROIALIGN_PLUGIN_NAME{"ROIAlign_TRT"};
 
 class ROIAlignV3PluginCreator : public nvinfer1::IPluginCreatorV3One
 {
@@ -26,8 +26,6 @@ using nvinfer1::plugin::ROIAlignPluginCreator;
 
 namespace
 {
-char const* gRoialignPluginVersion{"1"};
-char const* gRoialignPluginName{"ROIAlign_TRT"};
 size_t constexpr kSERIALIZATION_SIZE{sizeof(int32_t) * 5 + sizeof(float) + sizeof(int32_t) * 4};
 } // namespace
 
@@ -52,12 +50,12 @@ ROIAlignPluginCreator::ROIAlignPluginCreator()
 
 char const* ROIAlignPluginCreator::getPluginName() const noexcept
 {
-    return gRoialignPluginName;
+    return kROIALIGN_LEGACY_PLUGIN_NAME;
 }
 
 char const* ROIAlignPluginCreator::getPluginVersion() const noexcept
 {
-    return gRoialignPluginVersion;
+    return kROIALIGN_LEGACY_PLUGIN_VERSION;
 }
 
 PluginFieldCollection const* ROIAlignPluginCreator::getFieldNames() noexcept
@@ -200,12 +198,12 @@ bool ROIAlign::supportsFormatCombination(
 
 char const* ROIAlign::getPluginType() const noexcept
 {
-    return gRoialignPluginName;
+    return kROIALIGN_LEGACY_PLUGIN_NAME;
 }
 
 char const* ROIAlign::getPluginVersion() const noexcept
 {
-    return gRoialignPluginVersion;
+    return kROIALIGN_LEGACY_PLUGIN_VERSION;
 }
 
 IPluginV2DynamicExt* ROIAlign::clone() const noexcept
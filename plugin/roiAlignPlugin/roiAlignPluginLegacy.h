@@ -29,6 +29,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kROIALIGN_LEGACY_PLUGIN_VERSION{"1"};
+constexpr char const* kROIALIGN_LEGACY_PLUGIN_NAME{"ROIAlign_TRT"};
 
 class ROIAlign : public IPluginV2DynamicExt
 {
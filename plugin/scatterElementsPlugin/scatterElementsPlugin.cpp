@@ -46,12 +46,6 @@ std::unordered_map<ReductionType, std::string> const kREDUCE_ENUM_TO_STR{
 PluginFieldCollection ScatterElementsPluginV3Creator::gFC{};
 std::vector<PluginField> ScatterElementsPluginV3Creator::gPluginAttributes;
 
-namespace
-{
-constexpr char const* kSCATTER_PLUGIN_VERSION{"2"};
-constexpr char const* kSCATTER_PLUGIN_NAME{"ScatterElements"};
-} // namespace
-
 ScatterElementsPluginV3::ScatterElementsPluginV3(ReductionType reduction, int32_t dim)
     : mReduction(reduction)
     , mAxis(dim)
@@ -26,6 +26,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kSCATTER_PLUGIN_VERSION{"2"};
+constexpr char const* kSCATTER_PLUGIN_NAME{"ScatterElements"};
 
 class ScatterElementsPluginV3 : public IPluginV3,
                                 public IPluginV3OneCore,
@@ -39,12 +39,6 @@ std::unordered_map<std::string, ReductionType> const kREDUCE_STR_TO_ENUM{
 PluginFieldCollection ScatterElementsPluginV2Creator::gFC{};
 std::vector<PluginField> ScatterElementsPluginV2Creator::gPluginAttributes;
 
-namespace
-{
-constexpr char const* kSCATTER_ELEMENTS_NAME{"ScatterElements"};
-constexpr char const* kSCATTER_ELEMENTS_VERSION{"1"};
-} // namespace
-
 ScatterElementsPluginV2::ScatterElementsPluginV2(ReductionType reduction, int32_t dim)
     : mReduction(reduction)
     , mAxis(dim)
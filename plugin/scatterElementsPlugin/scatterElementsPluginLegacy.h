@@ -25,6 +25,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kSCATTER_ELEMENTS_NAME{"ScatterElements"};
+constexpr char const* kSCATTER_ELEMENTS_VERSION{"1"};
 
 class ScatterElementsPluginV2 final : public nvinfer1::IPluginV2DynamicExt
 {
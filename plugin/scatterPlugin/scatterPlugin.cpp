@@ -23,13 +23,6 @@
 namespace nvinfer1::plugin
 {
 
-namespace
-{
-
-char const* const kSCATTERND_PLUGIN_VERSION{"1"};
-char const* const kSCATTERND_PLUGIN_NAME{"ScatterND"};
-} // namespace
-
 PluginFieldCollection ScatterNDPluginCreator::mFC{};
 
 ScatterND::ScatterND() {}
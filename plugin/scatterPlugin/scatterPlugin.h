@@ -25,6 +25,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kSCATTERND_PLUGIN_VERSION{"1"};
+constexpr char const* kSCATTERND_PLUGIN_NAME{"ScatterND"};
 
 class ScatterND : public IPluginV2DynamicExt
 {
@@ -23,12 +23,6 @@ using namespace plugin;
 using nvinfer1::plugin::SpecialSlice;
 using nvinfer1::plugin::SpecialSlicePluginCreator;
 
-namespace
-{
-char const* const kSPECIALSLICE_PLUGIN_VERSION{"1"};
-char const* const kSPECIALSLICE_PLUGIN_NAME{"SpecialSlice_TRT"};
-} // namespace
-
 PluginFieldCollection SpecialSlicePluginCreator::mFC{};
 std::vector<PluginField> SpecialSlicePluginCreator::mPluginAttributes;
 
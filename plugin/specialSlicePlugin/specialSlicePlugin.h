@@ -30,6 +30,9 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kSPECIALSLICE_PLUGIN_VERSION{"1"};
+constexpr char const* kSPECIALSLICE_PLUGIN_NAME{"SpecialSlice_TRT"};
+
 class TRT_DEPRECATED SpecialSlice : public IPluginV2Ext
 {
 public:
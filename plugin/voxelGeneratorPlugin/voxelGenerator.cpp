@@ -30,8 +30,6 @@ using nvinfer1::plugin::VoxelGeneratorPluginCreator;
 
 namespace
 {
-char const* const kVOXEL_GENERATOR_PLUGIN_VERSION{"1"};
-char const* const kVOXEL_GENERATOR_PLUGIN_NAME{"VoxelGeneratorPlugin"};
 size_t constexpr kSERIALIZATION_SIZE{9 * sizeof(float) + 7 * sizeof(int32_t)};
 } // namespace
 
@@ -30,6 +30,8 @@ namespace nvinfer1
 {
 namespace plugin
 {
+constexpr char const* kVOXEL_GENERATOR_PLUGIN_VERSION{"1"};
+constexpr char const* kVOXEL_GENERATOR_PLUGIN_NAME{"VoxelGeneratorPlugin"};
 
 class VoxelGeneratorPlugin : public nvinfer1::IPluginV2DynamicExt
 {
@@ -0,0 +1,228 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "voxelGeneratorHost.h"
+
+#include "common/hostParallel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace nvinfer1
+{
+namespace plugin
+{
+namespace
+{
+
+using nvinfer1::pluginInternal::getNbHostThreads;
+using nvinfer1::pluginInternal::parallelFor;
+
+//! Below this many points per thread, binning is not worth spreading over more threads.
+constexpr int32_t kMIN_POINTS_PER_CHUNK{4096};
+
+//! Contiguous range of points binned by one thread.
+struct PointChunk
+{
+    int32_t begin;
+    int32_t end;
+    //! Number of points of the chunk in each cell, then position of the next point of the chunk in the pillar, or -1
+    //! if the pillar was dropped.
+    std::unordered_map<int32_t, int32_t> cellPoints;
+    //! Cells of the chunk in the order of their first point, with their entry in cellPoints.
+    std::vector<std::pair<int32_t, int32_t*>> cells;
+};
+
+//! Return the cell of a point, or -1 if it is outside of the ranges.
+int32_t getCell(VoxelGeneratorParameters const& param, float const* point)
+{
+    float const px = point[0];
+    float const py = point[1];
+    float const pz = point[2];
+    if (px < param.xMin || px >= param.xMax || py < param.yMin || py >= param.yMax || pz < param.zMin
+        || pz >= param.zMax)
+    {
+        return -1;
+    }
+    auto const x = static_cast<int32_t>(std::floor((px - param.xMin) / param.pillarX));
+    auto const y = static_cast<int32_t>(std::floor((py - param.yMin) / param.pillarY));
+    // The grid size is rounded from the ranges, so the last pillars may be cut.
+    if (x >= param.gridX || y >= param.gridY)
+    {
+        return -1;
+    }
+    return y * param.gridX + x;
+}
+
+//! Write the features derived from the points of a pillar, and clear its unused points.
+void computePillarFeatures(VoxelGeneratorParameters const& param, int32_t cell, int32_t nbPoints, float* pillar)
+{
+    int32_t const stride = param.voxelFeatures;
+    float sumX{0.F};
+    float sumY{0.F};
+    float sumZ{0.F};
+    for (int32_t i = 0; i < nbPoints; ++i)
+    {
+        sumX += pillar[i * stride];
+        sumY += pillar[i * stride + 1];
+        sumZ += pillar[i * stride + 2];
+    }
+    auto const count = static_cast<float>(nbPoints);
+    float const meanX = sumX / count;
+    float const meanY = sumY / count;
+    float const meanZ = sumZ / count;
+    float const centerX = param.pillarX / 2.0F + (cell % param.gridX) * param.pillarX + param.xMin;
+    float const centerY = param.pillarY / 2.0F + (cell / param.gridX) * param.pillarY + param.yMin;
+    float const centerZ = param.pillarZ / 2.0F + param.zMin;
+
+    // Features after the point values: offsets to the mean of the pillar, then to the center of the pillar.
+    float const origins[6] = {meanX, meanY, meanZ, centerX, centerY, centerZ};
+    int32_t const nbDerived = std::min(std::max(stride - param.pointFeatures, 0), 6);
+    for (int32_t f = 0; f < nbDerived; ++f)
+    {
+        float const origin = origins[f];
+        int32_t const axis = f % 3;
+        float* out = pillar + param.pointFeatures + f;
+        for (int32_t i = 0; i < nbPoints; ++i)
+        {
+            out[i * stride] = pillar[i * stride + axis] - origin;
+        }
+    }
+    for (int32_t i = 0; i < nbPoints; ++i)
+    {
+        std::fill(pillar + i * stride + param.pointFeatures + nbDerived, pillar + (i + 1) * stride, 0.F);
+    }
+    std::fill(pillar + static_cast<int64_t>(nbPoints) * stride, pillar + static_cast<int64_t>(param.maxPoints) * stride,
+        0.F);
+}
+
+} // namespace
+
+void voxelGeneratorHost(VoxelGeneratorParameters const& param, int32_t batchSize, int32_t maxNumPoints,
+    float const* points, uint32_t const* pointNum, float* pillarFeatures, uint32_t* coords, uint32_t* params,
+    int32_t numThreads)
+{
+    int64_t const pillarSize = static_cast<int64_t>(param.maxPoints) * param.voxelFeatures;
+    int32_t const nbCopied = std::min(param.pointFeatures, param.voxelFeatures);
+
+    // Pillar of each cell, reset after each point cloud.
+    std::vector<int32_t> cellPillars(static_cast<int64_t>(param.gridX) * param.gridY, -1);
+    std::vector<int32_t> pointCells(maxNumPoints);
+    std::vector<int32_t*> pointPositions(maxNumPoints);
+    std::vector<int32_t> pillarCells;
+    std::vector<int32_t> pillarPoints;
+
+    for (int32_t b = 0; b < batchSize; ++b)
+    {
+        float const* cloud = points + static_cast<int64_t>(b) * maxNumPoints * param.pointFeatures;
+        int32_t const nbPoints = std::min(static_cast<int32_t>(pointNum[b]), maxNumPoints);
+        float* features = pillarFeatures + b * param.maxVoxels * pillarSize;
+        uint32_t* pillarCoords = coords + static_cast<int64_t>(b) * param.maxVoxels * 4;
+
+        // Bin the points of each chunk into a hash grid of its own.
+        int32_t const nbChunks = std::max(
+            std::min(getNbHostThreads(numThreads), nbPoints / kMIN_POINTS_PER_CHUNK), static_cast<int32_t>(1));
+        std::vector<PointChunk> chunks(nbChunks);
+        parallelFor(nbChunks, numThreads, [&](int64_t c) {
+            auto& chunk = chunks[c];
+            chunk.begin = static_cast<int32_t>(static_cast<int64_t>(nbPoints) * c / nbChunks);
+            chunk.end = static_cast<int32_t>(static_cast<int64_t>(nbPoints) * (c + 1) / nbChunks);
+            for (int32_t i = chunk.begin; i < chunk.end; ++i)
+            {
+                int32_t const cell = getCell(param, cloud + static_cast<int64_t>(i) * param.pointFeatures);
+                pointCells[i] = cell;
+                if (cell < 0)
+                {
+                    continue;
+                }
+                auto const inserted = chunk.cellPoints.emplace(cell, 0);
+                if (inserted.second)
+                {
+                    chunk.cells.emplace_back(cell, &inserted.first->second);
+                }
+                ++inserted.first->second;
+                pointPositions[i] = &inserted.first->second;
+            }
+        });
+
+        // Merge the grids in point order: pillars are numbered by their first point, and each chunk appends its points
+        // to a pillar after the ones of the previous chunks.
+        pillarCells.clear();
+        pillarPoints.clear();
+        for (auto& chunk : chunks)
+        {
+            for (auto const& cellPoints : chunk.cells)
+            {
+                int32_t& pillar = cellPillars[cellPoints.first];
+                if (pillar < 0 && static_cast<int32_t>(pillarCells.size()) < param.maxVoxels)
+                {
+                    pillar = static_cast<int32_t>(pillarCells.size());
+                    pillarCells.push_back(cellPoints.first);
+                    pillarPoints.push_back(0);
+                }
+                int32_t const nbChunkPoints = *cellPoints.second;
+                *cellPoints.second = pillar < 0 ? -1 : pillarPoints[pillar];
+                if (pillar >= 0)
+                {
+                    pillarPoints[pillar] += nbChunkPoints;
+                }
+            }
+        }
+
+        parallelFor(nbChunks, numThreads, [&](int64_t c) {
+            auto const& chunk = chunks[c];
+            for (int32_t i = chunk.begin; i < chunk.end; ++i)
+            {
+                if (pointCells[i] < 0)
+                {
+                    continue;
+                }
+                int32_t& position = *pointPositions[i];
+                if (position < 0 || position >= param.maxPoints)
+                {
+                    continue;
+                }
+                int32_t const pillar = cellPillars[pointCells[i]];
+                float* out = features + pillar * pillarSize + static_cast<int64_t>(position) * param.voxelFeatures;
+                std::copy_n(cloud + static_cast<int64_t>(i) * param.pointFeatures, nbCopied, out);
+                ++position;
+            }
+        });
+
+        auto const nbPillars = static_cast<int32_t>(pillarCells.size());
+        parallelFor(nbPillars, numThreads, [&](int64_t p) {
+            int32_t const cell = pillarCells[p];
+            computePillarFeatures(param, cell, std::min(pillarPoints[p], param.maxPoints), features + p * pillarSize);
+            uint32_t* coord = pillarCoords + p * 4;
+            coord[0] = 0;
+            coord[1] = 0;
+            coord[2] = static_cast<uint32_t>(cell / param.gridX);
+            coord[3] = static_cast<uint32_t>(cell % param.gridX);
+            cellPillars[cell] = -1;
+        });
+        std::fill(features + nbPillars * pillarSize, features + param.maxVoxels * pillarSize, 0.F);
+        std::fill(pillarCoords + static_cast<int64_t>(nbPillars) * 4, pillarCoords + param.maxVoxels * 4, 0U);
+        params[b] = static_cast<uint32_t>(nbPillars);
+    }
+}
+
+} // namespace plugin
+} // namespace nvinfer1
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_VOXEL_GENERATOR_HOST_H
+#define TRT_VOXEL_GENERATOR_HOST_H
+
+#include <cstdint>
+
+namespace nvinfer1
+{
+namespace plugin
+{
+
+//! Parameters of VoxelGeneratorPlugin, with the grid size it derives from the ranges and the pillar sizes.
+struct VoxelGeneratorParameters
+{
+    int32_t maxVoxels;
+    int32_t maxPoints;
+    int32_t voxelFeatures;
+    int32_t pointFeatures; //!< 4 or 5
+    float xMin;
+    float xMax;
+    float yMin;
+    float yMax;
+    float zMin;
+    float zMax;
+    float pillarX;
+    float pillarY;
+    float pillarZ;
+    int32_t gridX;
+    int32_t gridY;
+};
+
+//!
+//! \brief Host implementation of the VoxelGeneratorPlugin kernels, on host buffers with the layouts of its tensors.
+//!
+//! Unlike the CUDA implementation, the output is deterministic: pillars are numbered in the order of their first point
+//! and hold their first maxPoints points in input order. When there are more than maxVoxels pillars, the ones kept are
+//! therefore the first ones reached by the point cloud.
+//!
+//! Points are binned in parallel into per-thread hash grids, which are merged in point order, then the points are
+//! copied and the features of each pillar are computed in parallel.
+//!
+//! This implementation is not part of the plugin library. It is compiled into plugin_host_benchmark, which times it on
+//! point clouds of 100k to 1M points and compares it with VoxelGeneratorPlugin.
+//!
+//! \param points [batchSize, maxNumPoints, pointFeatures] point cloud.
+//! \param pointNum [batchSize] number of valid points of each cloud.
+//! \param pillarFeatures [batchSize, maxVoxels, maxPoints, voxelFeatures] output features.
+//! \param coords [batchSize, maxVoxels, 4] output (0, 0, y, x) coordinates of the pillars.
+//! \param params [batchSize] output number of pillars.
+//! \param numThreads Number of threads, or 0 for one per hardware thread.
+//!
+void voxelGeneratorHost(VoxelGeneratorParameters const& param, int32_t batchSize, int32_t maxNumPoints,
+    float const* points, uint32_t const* pointNum, float* pillarFeatures, uint32_t* coords, uint32_t* params,
+    int32_t numThreads = 0);
+
+} // namespace plugin
+} // namespace nvinfer1
+
+#endif // TRT_VOXEL_GENERATOR_HOST_H
@@ -0,0 +1,353 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//! \file batchStreamTest.cpp
+//!
+//! \brief Self-test of the PrefetchBatchStream decorator used by the calibrators.
+//!
+//! The decorator reads from synthetic sources whose batches are computed from the batch number, so the tool needs no
+//! data files. The sources either support loadBatch() or only next(), and may group the samples in files of another
+//! size than the batch size, as BatchStream does.
+//!
+//! It can be run with the following command line:
+//! Command: ./batch_stream_test [--workers=N]
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BatchStream.h"
+#include "getOptions.h"
+#include "logger.h"
+
+namespace
+{
+
+std::string const kSAMPLE_NAME = "TensorRT.batch_stream_test";
+
+//! Log the failed condition and return false from the test case.
+#define EXPECT(condition)                                                                                              \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(condition))                                                                                              \
+        {                                                                                                              \
+            sample::gLogError << __FILE__ << ":" << __LINE__ << ": expected " << #condition << std::endl;             \
+            return false;                                                                                              \
+        }                                                                                                              \
+    } while (0)
+
+//!
+//! \brief Source of batches whose values encode the pass, the batch and the position, exactly representable as floats.
+//!
+//! The pass is incremented by reset(), so that a batch read before a reset can be told apart from one read after.
+//! The batch buffer holds exactly one batch, so a decorator reading past it is caught by AddressSanitizer.
+//!
+class SyntheticBatchStream : public IBatchStream
+{
+public:
+    static constexpr int32_t kCHANNELS{3};
+    static constexpr int32_t kHEIGHT{2};
+    static constexpr int32_t kWIDTH{5};
+    static constexpr int32_t kSAMPLE_VOLUME{kCHANNELS * kHEIGHT * kWIDTH};
+
+    //! \param samplesPerFile The first dimension reported by getDims(), as the number of samples per batch file.
+    //! \param loadDelay Time taken to produce each batch.
+    SyntheticBatchStream(int32_t batchSize, int32_t samplesPerFile, int32_t nbBatches, bool randomAccess,
+        std::chrono::milliseconds loadDelay = std::chrono::milliseconds{0})
+        : mBatchSize(batchSize)
+        , mSamplesPerFile(samplesPerFile)
+        , mNbBatches(nbBatches)
+        , mRandomAccess(randomAccess)
+        , mLoadDelay(loadDelay)
+        , mBatch(static_cast<size_t>(batchSize) * kSAMPLE_VOLUME)
+        , mLabels(batchSize)
+    {
+    }
+
+    static float value(int32_t pass, int32_t batch, int32_t index)
+    {
+        return static_cast<float>(pass * 1000000 + batch * 1000 + index);
+    }
+
+    void reset(int firstBatch) override
+    {
+        mBatchCount = firstBatch;
+        ++mPass;
+    }
+
+    bool next() override
+    {
+        if (!fill(mBatchCount, mBatch.data(), mLabels.data()))
+        {
+            return false;
+        }
+        ++mBatchCount;
+        return true;
+    }
+
+    void skip(int skipCount) override
+    {
+        mBatchCount += skipCount;
+    }
+
+    float* getBatch() override
+    {
+        return mBatch.data();
+    }
+
+    float* getLabels() override
+    {
+        return mLabels.data();
+    }
+
+    int getBatchesRead() const override
+    {
+        return mBatchCount;
+    }
+
+    int getBatchSize() const override
+    {
+        return mBatchSize;
+    }
+
+    nvinfer1::Dims getDims() const override
+    {
+        return nvinfer1::Dims{4, {mSamplesPerFile, kCHANNELS, kHEIGHT, kWIDTH}};
+    }
+
+    bool canLoadBatch() const override
+    {
+        return mRandomAccess;
+    }
+
+    bool loadBatch(int batchIndex, float* data, float* labels) const override
+    {
+        return mRandomAccess && fill(batchIndex, data, labels);
+    }
+
+    int32_t getPass() const
+    {
+        return mPass;
+    }
+
+private:
+    bool fill(int32_t batch, float* data, float* labels) const
+    {
+        if (batch < 0 || batch >= mNbBatches)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(mLoadDelay);
+        for (int32_t i = 0; i < mBatchSize * kSAMPLE_VOLUME; ++i)
+        {
+            data[i] = value(mPass, batch, i);
+        }
+        for (int32_t i = 0; i < mBatchSize; ++i)
+        {
+            labels[i] = value(mPass, batch, i);
+        }
+        return true;
+    }
+
+    int32_t mBatchSize{0};
+    int32_t mSamplesPerFile{0};
+    int32_t mNbBatches{0};
+    bool mRandomAccess{false};
+    std::chrono::milliseconds mLoadDelay{0};
+    std::vector<float> mBatch;
+    std::vector<float> mLabels;
+    int32_t mBatchCount{0};
+    std::atomic<int32_t> mPass{0};
+};
+
+//! Return true if the current batch of the stream is the given batch of the given pass of the source.
+bool isBatch(IBatchStream& stream, int32_t pass, int32_t batch)
+{
+    float const* data = stream.getBatch();
+    for (int32_t i = 0; i < stream.getBatchSize() * SyntheticBatchStream::kSAMPLE_VOLUME; ++i)
+    {
+        if (data[i] != SyntheticBatchStream::value(pass, batch, i))
+        {
+            return false;
+        }
+    }
+    float const* labels = stream.getLabels();
+    for (int32_t i = 0; i < stream.getBatchSize(); ++i)
+    {
+        if (labels[i] != SyntheticBatchStream::value(pass, batch, i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//! Read every batch of the source through the decorator and check each of them, then the end of the stream.
+bool readAll(int32_t batchSize, int32_t samplesPerFile, bool randomAccess, int32_t depth, int32_t nbWorkers)
+{
+    constexpr int32_t kBATCHES{20};
+    auto source = std::make_shared<SyntheticBatchStream>(batchSize, samplesPerFile, kBATCHES, randomAccess);
+    PrefetchBatchStream stream(source, depth, nbWorkers);
+    for (int32_t batch = 0; batch < kBATCHES; ++batch)
+    {
+        EXPECT(stream.next());
+        EXPECT(isBatch(stream, source->getPass(), batch));
+    }
+    EXPECT(!stream.next() && stream.getBatchesRead() == kBATCHES);
+    return true;
+}
+
+bool testSamplesPerFileBelowBatchSize()
+{
+    return readAll(4, 2, false, 3, 1);
+}
+
+bool testSamplesPerFileAboveBatchSize()
+{
+    return readAll(4, 8, false, 3, 1);
+}
+
+bool testRandomAccess(int32_t nbWorkers)
+{
+    return readAll(4, 4, true, 3, nbWorkers) && readAll(3, 6, true, 8, nbWorkers);
+}
+
+bool testReset()
+{
+    // Slow loads, so that a slot still holding a batch of the previous pass would be read before it is reloaded.
+    auto source = std::make_shared<SyntheticBatchStream>(2, 2, 3, false, std::chrono::milliseconds{20});
+    PrefetchBatchStream stream(source, 4, 1);
+    for (int32_t batch = 0; batch < 3; ++batch)
+    {
+        EXPECT(stream.next() && isBatch(stream, source->getPass(), batch));
+    }
+    EXPECT(!stream.next());
+
+    stream.reset(0);
+    EXPECT(stream.getBatchesRead() == 0);
+    EXPECT(stream.next() && isBatch(stream, source->getPass(), 0));
+
+    stream.reset(1);
+    for (int32_t batch = 1; batch < 3; ++batch)
+    {
+        EXPECT(stream.next() && isBatch(stream, source->getPass(), batch));
+    }
+    EXPECT(!stream.next() && stream.getBatchesRead() == 2);
+    return true;
+}
+
+bool testSkip()
+{
+    auto source = std::make_shared<SyntheticBatchStream>(2, 2, 10, true);
+    PrefetchBatchStream stream(source, 2, 2);
+    EXPECT(stream.next() && isBatch(stream, 0, 0));
+    // Skipped batches do not count as read.
+    stream.skip(3);
+    EXPECT(stream.getBatchesRead() == 1);
+    EXPECT(stream.next() && isBatch(stream, 0, 4) && stream.getBatchesRead() == 2);
+    stream.skip(20);
+    EXPECT(!stream.next() && stream.getBatchesRead() == 2);
+    return true;
+}
+
+bool testCopy()
+{
+    auto source = std::make_shared<SyntheticBatchStream>(2, 2, 4, true);
+    PrefetchBatchStream const original(source, 2, 2);
+    // The copy shares the source, and starts its own workers on its first batch.
+    PrefetchBatchStream copy(original);
+    for (int32_t batch = 0; batch < 4; ++batch)
+    {
+        EXPECT(copy.next() && isBatch(copy, 0, batch));
+    }
+    EXPECT(!copy.next());
+    return true;
+}
+
+void printHelp()
+{
+    std::cout << "Usage: ./batch_stream_test [options]" << std::endl
+              << "  --workers=<N>  Number of workers loading the batches of random-access sources (default = 4)"
+              << std::endl
+              << "  --help, -h     Print this message" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto sampleTest = sample::gLogger.defineTest(kSAMPLE_NAME, argc, argv);
+    sample::gLogger.reportTestStart(sampleTest);
+
+    using nvinfer1::utility::TRTOption;
+    std::vector<TRTOption> const spec{{0, "workers", true, ""}, {'h', "help", false, ""}};
+    auto const args = nvinfer1::utility::getOptions(argc, argv, spec);
+    if (!args.errMsg.empty())
+    {
+        sample::gLogError << args.errMsg << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+    if (args.values[1].first > 0)
+    {
+        printHelp();
+        return sample::gLogger.reportPass(sampleTest);
+    }
+    int32_t nbWorkers{4};
+    try
+    {
+        if (!args.values[0].second.empty())
+        {
+            nbWorkers = std::stoi(args.values[0].second.back());
+        }
+    }
+    catch (std::exception const& e)
+    {
+        sample::gLogError << "Invalid option value: " << e.what() << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+    if (nbWorkers <= 0)
+    {
+        sample::gLogError << "Invalid number of workers." << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+
+    std::vector<std::pair<char const*, std::function<bool()>>> const cases{
+        {"PrefetchBatchStream files smaller than a batch", testSamplesPerFileBelowBatchSize},
+        {"PrefetchBatchStream files larger than a batch", testSamplesPerFileAboveBatchSize},
+        {"PrefetchBatchStream random-access source", [nbWorkers]() { return testRandomAccess(nbWorkers); }},
+        {"PrefetchBatchStream reset", testReset},
+        {"PrefetchBatchStream skip", testSkip},
+        {"PrefetchBatchStream copy", testCopy},
+    };
+
+    int32_t nbFailed{0};
+    for (auto const& testCase : cases)
+    {
+        bool const passed = testCase.second();
+        sample::gLogInfo << (passed ? "[ PASSED ] " : "[ FAILED ] ") << testCase.first << std::endl;
+        nbFailed += !passed;
+    }
+    sample::gLogInfo << cases.size() - nbFailed << " of " << cases.size() << " cases passed." << std::endl;
+
+    return nbFailed == 0 ? sample::gLogger.reportPass(sampleTest) : sample::gLogger.reportFail(sampleTest);
+}
@@ -20,7 +20,11 @@
 #include "NvInfer.h"
 #include "common.h"
 #include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <stdio.h>
+#include <thread>
 #include <vector>
 
 class IBatchStream
@@ -34,6 +38,22 @@ public:
     virtual int getBatchesRead() const = 0;
     virtual int getBatchSize() const = 0;
     virtual nvinfer1::Dims getDims() const = 0;
+
+    //! Whether loadBatch() is supported. Streams that support it must allow concurrent loadBatch() calls.
+    virtual bool canLoadBatch() const
+    {
+        return false;
+    }
+
+    //! Load batch number batchIndex into caller-provided buffers of getBatchSize() * volume of one sample floats and
+    //! getBatchSize() floats respectively, without moving the stream position. Returns false if there is no such
+    //! batch.
+    virtual bool loadBatch(int batchIndex, float* data, float* labels) const
+    {
+        return false;
+    }
+
+    virtual ~IBatchStream() = default;
 };
 
 class MNISTBatchStream : public IBatchStream
@@ -94,6 +114,24 @@ public:
         return nvinfer1::Dims{4, {mBatchSize, mDims.d[0], mDims.d[1], mDims.d[2]}};
     }
 
+    bool canLoadBatch() const override
+    {
+        return true;
+    }
+
+    bool loadBatch(int batchIndex, float* data, float* labels) const override
+    {
+        int64_t const first = static_cast<int64_t>(batchIndex) * mBatchSize;
+        if (batchIndex < 0 || batchIndex >= mMaxBatches || first + mBatchSize > static_cast<int64_t>(mLabels.size()))
+        {
+            return false;
+        }
+        int64_t const imageSize = samplesCommon::volume(mDims);
+        std::copy_n(mData.data() + first * imageSize, mBatchSize * imageSize, data);
+        std::copy_n(mLabels.data() + first, mBatchSize, labels);
+        return true;
+    }
+
 private:
     void readDataFile(const std::string& dataFilePath)
     {
@@ -277,6 +315,42 @@ public:
         return mDims;
     }
 
+    bool canLoadBatch() const override
+    {
+        return true;
+    }
+
+    bool loadBatch(int batchIndex, float* data, float* labels) const override
+    {
+        if (batchIndex < 0 || batchIndex >= mMaxBatches)
+        {
+            return false;
+        }
+
+        std::vector<float> fileBatch(mDims.d[0] * mImageSize);
+        std::vector<float> fileLabels(mDims.d[0]);
+        int64_t loadedFile{-1};
+        for (int64_t batchPos = 0, csize = 0; batchPos < mBatchSize; batchPos += csize)
+        {
+            int64_t const pos = batchIndex * mBatchSize + batchPos;
+            int64_t const fileIndex = pos / mDims.d[0];
+            int64_t const fileBatchPos = pos % mDims.d[0];
+            if (fileIndex != loadedFile)
+            {
+                if (!readFile(static_cast<int>(fileIndex), fileBatch.data(), fileLabels.data()))
+                {
+                    return false;
+                }
+                loadedFile = fileIndex;
+            }
+
+            csize = std::min<int64_t>(mBatchSize - batchPos, mDims.d[0] - fileBatchPos);
+            std::copy_n(fileBatch.data() + fileBatchPos * mImageSize, csize * mImageSize, data + batchPos * mImageSize);
+            std::copy_n(fileLabels.data() + fileBatchPos, csize, labels + batchPos);
+        }
+        return true;
+    }
+
 private:
     float* getFileBatch()
     {
@@ -289,11 +363,27 @@ private:
     }
 
     bool update()
+    {
+        // Batch files are numbered by file, image lists are indexed by the batch being assembled.
+        int const fileIndex = mListFile.empty() ? mFileCount : mBatchCount;
+        if (!readFile(fileIndex, getFileBatch(), getFileLabels()))
+        {
+            return false;
+        }
+
+        mFileCount++;
+        mFileBatchPos = 0;
+        return true;
+    }
+
+    //! Read one batch file, or one batch worth of images from the list file, into the given buffers.
+    //! Only reads immutable state so that loadBatch() can call it concurrently.
+    bool readFile(int fileIndex, float* fileBatch, float* fileLabels) const
     {
         if (mListFile.empty())
         {
             std::string inputFileName
-                = samplesCommon::locateFile(mPrefix + std::to_string(mFileCount++) + mSuffix, mDataDir);
+                = samplesCommon::locateFile(mPrefix + std::to_string(fileIndex) + mSuffix, mDataDir);
             std::ifstream file(inputFileName.c_str(), std::ios::binary);
             if (!file)
             {
@@ -302,8 +392,8 @@ private:
             int d[4];
             file.read(reinterpret_cast<char*>(d), 4 * sizeof(int32_t));
             ASSERT(mDims.d[0] == d[0] && mDims.d[1] == d[1] && mDims.d[2] == d[2] && mDims.d[3] == d[3]);
-            file.read(reinterpret_cast<char*>(getFileBatch()), sizeof(float) * mDims.d[0] * mImageSize);
-            file.read(reinterpret_cast<char*>(getFileLabels()), sizeof(float) * mDims.d[0]);
+            file.read(reinterpret_cast<char*>(fileBatch), sizeof(float) * mDims.d[0] * mImageSize);
+            file.read(reinterpret_cast<char*>(fileLabels), sizeof(float) * mDims.d[0]);
         }
         else
         {
@@ -314,8 +404,8 @@ private:
                 return false;
             }
 
-            sample::gLogInfo << "Batch #" << mFileCount << std::endl;
-            file.seekg(((mBatchCount * mBatchSize)) * 7);
+            sample::gLogInfo << "Batch #" << fileIndex << std::endl;
+            file.seekg(((fileIndex * mBatchSize)) * 7);
 
             for (int i = 1; i <= mBatchSize; i++)
             {
@@ -326,8 +416,6 @@ private:
                 fNames.emplace_back(sName);
             }
 
-            mFileCount++;
-
             const int imageC = 3;
             const int imageH = 300;
             const int imageW = 300;
@@ -354,10 +442,8 @@ private:
                 }
             }
 
-            std::copy_n(data.data(), mDims.d[0] * mImageSize, getFileBatch());
+            std::copy_n(data.data(), mDims.d[0] * mImageSize, fileBatch);
         }
-
-        mFileBatchPos = 0;
         return true;
     }
 
@@ -378,4 +464,239 @@ private:
     std::vector<std::string> mDataDir; //!< Directories where the files can be found
 };
 
+//! \class PrefetchBatchStream
+//!
+//! \brief Decorates another IBatchStream and loads the upcoming batches ahead of the consumer.
+//!
+//! Up to depth batches are kept in a ring of pinned host buffers, so the calibrator's host-to-device copies can use
+//! DMA directly. If the source supports loadBatch(), batches are read and decoded by nbWorkers threads concurrently;
+//! otherwise a single thread drives the source's next() in order. getBatch() and getLabels() stay valid until the
+//! next call to next(), skip() or reset(). Worker threads are started by reset(), so copies of a stream that was
+//! never reset, such as the one EntropyCalibratorImpl takes, do not own any threads.
+//!
+class PrefetchBatchStream : public IBatchStream
+{
+public:
+    PrefetchBatchStream(std::shared_ptr<IBatchStream> source, int32_t depth = 4, int32_t nbWorkers = 2)
+        : mSource(std::move(source))
+        , mDepth(std::max(depth, 2))
+        , mNbWorkers(mSource->canLoadBatch() ? std::max(nbWorkers, 1) : 1)
+    {
+        // The first dimension of the source may be the number of samples per file rather than the batch size.
+        nvinfer1::Dims const dims = mSource->getDims();
+        mBatchVolume = mSource->getBatchSize() * (samplesCommon::volume(dims) / std::max<int64_t>(dims.d[0], 1));
+        mSlots.resize(mDepth);
+        for (auto& slot : mSlots)
+        {
+            slot.data = allocPinned(mBatchVolume);
+            slot.labels = allocPinned(mSource->getBatchSize());
+        }
+    }
+
+    PrefetchBatchStream(PrefetchBatchStream const& other)
+        : PrefetchBatchStream(other.mSource, other.mDepth, other.mNbWorkers)
+    {
+    }
+
+    PrefetchBatchStream& operator=(PrefetchBatchStream const&) = delete;
+
+    ~PrefetchBatchStream() override
+    {
+        stop();
+    }
+
+    void reset(int firstBatch) override
+    {
+        stop();
+        if (!mSource->canLoadBatch())
+        {
+            mSource->reset(firstBatch);
+        }
+        mCurrent = firstBatch - 1;
+        mNextToLoad = firstBatch;
+        mBatchesRead = 0;
+        mEndSeen = false;
+        // Forget the batches of the previous pass, so that next() waits for the slots to be loaded again.
+        for (auto& slot : mSlots)
+        {
+            slot.batch = -1;
+            slot.state = SlotState::kFREE;
+        }
+        start();
+    }
+
+    bool next() override
+    {
+        if (mWorkers.empty())
+        {
+            reset(0);
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        int const batch = mCurrent + 1;
+        Slot& slot = mSlots[batch % mDepth];
+        mConsumerCV.wait(lock, [&] { return slot.batch == batch && slot.state != SlotState::kLOADING; });
+        if (slot.state == SlotState::kEND)
+        {
+            return false;
+        }
+
+        mCurrent = batch;
+        ++mBatchesRead;
+        lock.unlock();
+        // The slot of the previous batch can now be refilled.
+        mWorkerCV.notify_all();
+        return true;
+    }
+
+    void skip(int skipCount) override
+    {
+        int const batchesRead = mBatchesRead;
+        for (int i = 0; i < skipCount && next(); ++i)
+        {
+        }
+        mBatchesRead = batchesRead;
+    }
+
+    float* getBatch() override
+    {
+        return mSlots[mCurrent % mDepth].data.get();
+    }
+
+    float* getLabels() override
+    {
+        return mSlots[mCurrent % mDepth].labels.get();
+    }
+
+    int getBatchesRead() const override
+    {
+        return mBatchesRead;
+    }
+
+    int getBatchSize() const override
+    {
+        return mSource->getBatchSize();
+    }
+
+    nvinfer1::Dims getDims() const override
+    {
+        return mSource->getDims();
+    }
+
+private:
+    struct PinnedFree
+    {
+        void operator()(float* ptr) const
+        {
+            cudaFreeHost(ptr);
+        }
+    };
+    using PinnedBuffer = std::unique_ptr<float, PinnedFree>;
+
+    enum class SlotState
+    {
+        kFREE,
+        kLOADING,
+        kREADY,
+        kEND
+    };
+
+    struct Slot
+    {
+        PinnedBuffer data;
+        PinnedBuffer labels;
+        int batch{-1};
+        SlotState state{SlotState::kFREE};
+    };
+
+    static PinnedBuffer allocPinned(int64_t count)
+    {
+        float* ptr{nullptr};
+        CHECK(cudaMallocHost(&ptr, std::max<int64_t>(count, 1) * sizeof(float)));
+        return PinnedBuffer{ptr};
+    }
+
+    void start()
+    {
+        mStop = false;
+        for (int32_t i = 0; i < mNbWorkers; ++i)
+        {
+            mWorkers.emplace_back(&PrefetchBatchStream::workerLoop, this);
+        }
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mWorkerCV.notify_all();
+        for (auto& worker : mWorkers)
+        {
+            worker.join();
+        }
+        mWorkers.clear();
+    }
+
+    bool loadInto(int batch, Slot& slot)
+    {
+        if (mSource->canLoadBatch())
+        {
+            return mSource->loadBatch(batch, slot.data.get(), slot.labels.get());
+        }
+
+        // Only one worker drives a sequential source, so batches arrive in order.
+        if (!mSource->next())
+        {
+            return false;
+        }
+        std::copy_n(mSource->getBatch(), mBatchVolume, slot.data.get());
+        std::copy_n(mSource->getLabels(), mSource->getBatchSize(), slot.labels.get());
+        return true;
+    }
+
+    void workerLoop()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true)
+        {
+            // The slot of batch b is free once the consumer has moved past batch b - mDepth.
+            mWorkerCV.wait(lock, [this] { return mStop || (!mEndSeen && mNextToLoad < mCurrent + mDepth); });
+            if (mStop)
+            {
+                return;
+            }
+
+            int const batch = mNextToLoad++;
+            Slot& slot = mSlots[batch % mDepth];
+            slot.batch = batch;
+            slot.state = SlotState::kLOADING;
+            lock.unlock();
+
+            bool const loaded = loadInto(batch, slot);
+
+            lock.lock();
+            slot.state = loaded ? SlotState::kREADY : SlotState::kEND;
+            mEndSeen = mEndSeen || !loaded;
+            mConsumerCV.notify_all();
+        }
+    }
+
+    std::shared_ptr<IBatchStream> mSource;
+    int32_t mDepth{0};
+    int32_t mNbWorkers{0};
+    int64_t mBatchVolume{0};
+    std::vector<Slot> mSlots;
+    std::vector<std::thread> mWorkers;
+    std::mutex mMutex;
+    std::condition_variable mWorkerCV;   //!< Signals workers that a slot was released or the stream stops
+    std::condition_variable mConsumerCV; //!< Signals the consumer that a slot finished loading
+    int mCurrent{-1};                    //!< Batch currently exposed through getBatch()
+    int mNextToLoad{0};                  //!< Next batch a worker will pick up
+    int mBatchesRead{0};
+    bool mEndSeen{false};
+    bool mStop{false};
+};
+
 #endif
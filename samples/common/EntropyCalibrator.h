@@ -25,12 +25,15 @@
 //!
 //! \brief Implements common functionality for Entropy calibrators.
 //!
+//! If prefetchDepth is positive, batches are read through a PrefetchBatchStream holding up to prefetchDepth batches
+//! in pinned memory, and the copy of the next batch to the device overlaps with the calibration of the current one.
+//!
 template <typename TBatchStream>
 class EntropyCalibratorImpl
 {
 public:
     EntropyCalibratorImpl(TBatchStream const& stream, int firstBatch, std::string const& networkName,
-        const char* inputBlobName, bool readCache = true)
+        const char* inputBlobName, bool readCache = true, int32_t prefetchDepth = 0)
         : mStream{stream}
         , mCalibrationTableName("CalibrationTable" + networkName)
         , mInputBlobName(inputBlobName)
@@ -39,11 +42,24 @@ public:
         nvinfer1::Dims dims = mStream.getDims();
         mInputCount = samplesCommon::volume(dims);
         CHECK(cudaMalloc(&mDeviceInput, mInputCount * sizeof(float)));
-        mStream.reset(firstBatch);
+        if (prefetchDepth > 0)
+        {
+            mPrefetchStream
+                = std::make_unique<PrefetchBatchStream>(std::make_shared<TBatchStream>(stream), prefetchDepth);
+            CHECK(cudaMalloc(&mNextDeviceInput, mInputCount * sizeof(float)));
+            CHECK(cudaStreamCreateWithFlags(&mCopyStream, cudaStreamNonBlocking));
+        }
+        getStream().reset(firstBatch);
     }
 
     virtual ~EntropyCalibratorImpl()
     {
+        if (mCopyStream)
+        {
+            CHECK(cudaStreamSynchronize(mCopyStream));
+            CHECK(cudaStreamDestroy(mCopyStream));
+            CHECK(cudaFree(mNextDeviceInput));
+        }
         CHECK(cudaFree(mDeviceInput));
     }
 
@@ -54,13 +70,28 @@ public:
 
     bool getBatch(void* bindings[], const char* names[], int nbBindings) noexcept
     {
-        if (!mStream.next())
+        ASSERT(!strcmp(names[0], mInputBlobName));
+        if (!mCopyStream)
+        {
+            if (!mStream.next())
+            {
+                return false;
+            }
+            CHECK(cudaMemcpy(mDeviceInput, mStream.getBatch(), mInputCount * sizeof(float), cudaMemcpyHostToDevice));
+            bindings[0] = mDeviceInput;
+            return true;
+        }
+
+        // The copy of this batch was issued by the previous call, unless this is the first one.
+        if (!mCopyPending && !copyNextBatch())
         {
             return false;
         }
-        CHECK(cudaMemcpy(mDeviceInput, mStream.getBatch(), mInputCount * sizeof(float), cudaMemcpyHostToDevice));
-        ASSERT(!strcmp(names[0], mInputBlobName));
+        CHECK(cudaStreamSynchronize(mCopyStream));
+        std::swap(mDeviceInput, mNextDeviceInput);
         bindings[0] = mDeviceInput;
+        // TensorRT is done with the previous batch, so its buffer receives the next one while this one is used.
+        mCopyPending = copyNextBatch();
         return true;
     }
 
@@ -85,12 +116,34 @@ public:
     }
 
 private:
+    IBatchStream& getStream()
+    {
+        return mPrefetchStream ? static_cast<IBatchStream&>(*mPrefetchStream) : mStream;
+    }
+
+    //! Start copying the next batch of the prefetching stream to mNextDeviceInput. The pinned source buffer stays
+    //! valid until the next call to next(), which only happens after the copy has been waited for.
+    bool copyNextBatch()
+    {
+        if (!mPrefetchStream->next())
+        {
+            return false;
+        }
+        CHECK(cudaMemcpyAsync(mNextDeviceInput, mPrefetchStream->getBatch(), mInputCount * sizeof(float),
+            cudaMemcpyHostToDevice, mCopyStream));
+        return true;
+    }
+
     TBatchStream mStream;
+    std::unique_ptr<PrefetchBatchStream> mPrefetchStream;
     size_t mInputCount;
     std::string mCalibrationTableName;
     const char* mInputBlobName;
     bool mReadCache{true};
     void* mDeviceInput{nullptr};
+    void* mNextDeviceInput{nullptr};
+    cudaStream_t mCopyStream{nullptr};
+    bool mCopyPending{false};
     std::vector<char> mCalibrationCache;
 };
 
@@ -104,8 +157,8 @@ class Int8EntropyCalibrator2 : public nvinfer1::IInt8EntropyCalibrator2
 {
 public:
     Int8EntropyCalibrator2(TBatchStream const& stream, int32_t firstBatch, const char* networkName,
-        const char* inputBlobName, bool readCache = true)
-        : mImpl(stream, firstBatch, networkName, inputBlobName, readCache)
+        const char* inputBlobName, bool readCache = true, int32_t prefetchDepth = 0)
+        : mImpl(stream, firstBatch, networkName, inputBlobName, readCache, prefetchDepth)
     {
     }
 
@@ -44,6 +44,7 @@ struct SampleParams
     std::vector<std::string> inputTensorNames;
     std::vector<std::string> outputTensorNames;
     std::string timingCacheFile; //!< Path to timing cache file
+    int32_t calibPrefetch{0};    //!< Number of calibration batches loaded ahead, 0 disables prefetching
 };
 
 //!
@@ -71,6 +72,7 @@ struct Args
     std::string loadEngine;
     bool rowOrder{true};
     std::string timingCacheFile;
+    int32_t calibPrefetch{0};
 };
 
 //!
@@ -90,7 +92,8 @@ inline bool parseArgs(Args& args, int32_t argc, char* argv[])
                 {"fp16", no_argument, 0, 'f'}, {"bf16", no_argument, 0, 'z'}, {"columnOrder", no_argument, 0, 'c'},
                 {"saveEngine", required_argument, 0, 's'}, {"loadEngine", required_argument, 0, 'o'},
                 {"useDLACore", required_argument, 0, 'u'}, {"batch", required_argument, 0, 'b'},
-                {"timingCacheFile", required_argument, 0, 't'}, {nullptr, 0, nullptr, 0}};
+                {"timingCacheFile", required_argument, 0, 't'}, {"calibPrefetch", required_argument, 0, 'p'},
+                {nullptr, 0, nullptr, 0}};
         int32_t option_index = 0;
         arg = getopt_long(argc, argv, "hd:iu", long_options, &option_index);
         if (arg == -1)
@@ -151,6 +154,12 @@ inline bool parseArgs(Args& args, int32_t argc, char* argv[])
                 return false;
             }
             break;
+        case 'p':
+            if (optarg)
+            {
+                args.calibPrefetch = std::stoi(optarg);
+            }
+            break;
         default: return false;
         }
     }
@@ -0,0 +1,411 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "asyncLogger.h"
+#include "logging.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sample
+{
+
+namespace
+{
+
+using Severity = nvinfer1::ILogger::Severity;
+using Clock = std::chrono::steady_clock;
+
+//! Longest time a message waits in a ring before the drain thread wakes up.
+constexpr std::chrono::milliseconds kDRAIN_INTERVAL{2};
+
+struct LogRecord
+{
+    int64_t timestampNs{0};
+    Severity severity{Severity::kINFO};
+    std::string message;
+};
+
+//!
+//! \brief Ring of the messages of one thread, with a single producer and a single consumer.
+//!
+class LogRing
+{
+public:
+    LogRing(size_t capacity, int32_t threadId)
+        : mSlots(capacity)
+        , mThreadId(threadId)
+    {
+    }
+
+    //! Move the record into the ring, or leave it untouched if the ring is full.
+    bool push(LogRecord& record)
+    {
+        uint64_t const head = mHead.load(std::memory_order_relaxed);
+        if (head - mTail.load(std::memory_order_acquire) == mSlots.size())
+        {
+            return false;
+        }
+        mSlots[head % mSlots.size()] = std::move(record);
+        mHead.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Call func(threadId, record) on the queued records, oldest first, and remove them.
+    template <typename F>
+    void drain(F&& func)
+    {
+        uint64_t tail = mTail.load(std::memory_order_relaxed);
+        uint64_t const head = mHead.load(std::memory_order_acquire);
+        for (; tail != head; ++tail)
+        {
+            func(mThreadId, mSlots[tail % mSlots.size()]);
+        }
+        mTail.store(tail, std::memory_order_release);
+    }
+
+    bool empty() const
+    {
+        return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_relaxed);
+    }
+
+    //! Called when the owning thread exits; the ring is released once drained.
+    void markOrphaned()
+    {
+        mOrphaned.store(true, std::memory_order_release);
+    }
+
+    bool isOrphaned() const
+    {
+        return mOrphaned.load(std::memory_order_acquire);
+    }
+
+private:
+    std::vector<LogRecord> mSlots;
+    int32_t mThreadId;
+    std::atomic<bool> mOrphaned{false};
+    alignas(64) std::atomic<uint64_t> mHead{0}; //!< Written by the producer
+    alignas(64) std::atomic<uint64_t> mTail{0}; //!< Written by the consumer
+};
+
+//! The ring of the calling thread, marked orphaned when the thread exits.
+struct ThreadRing
+{
+    std::shared_ptr<LogRing> ring;
+    uint64_t generation{0};
+
+    ~ThreadRing()
+    {
+        if (ring)
+        {
+            ring->markOrphaned();
+        }
+    }
+};
+
+thread_local ThreadRing tThreadRing;
+
+char const* severityPrefix(Severity severity)
+{
+    switch (severity)
+    {
+    case Severity::kINTERNAL_ERROR: return "[F] ";
+    case Severity::kERROR: return "[E] ";
+    case Severity::kWARNING: return "[W] ";
+    case Severity::kINFO: return "[I] ";
+    case Severity::kVERBOSE: return "[V] ";
+    }
+    return "";
+}
+
+class AsyncLogSink : public ILogBackend
+{
+public:
+    ~AsyncLogSink() override
+    {
+        stop();
+    }
+
+    void start(AsyncLogOptions const& options)
+    {
+        stop();
+        std::lock_guard<std::mutex> lock(mMutex);
+        mQueueDepth = std::max(options.queueDepth, 1);
+        mDropWhenFull.store(options.dropWhenFull, std::memory_order_relaxed);
+        mStart = Clock::now();
+        mStopping = false;
+        // Threads create new rings with the new depth.
+        mRings.clear();
+        ++mGeneration;
+        mThread = std::thread(&AsyncLogSink::run, this);
+        setLogBackend(this);
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mThread.joinable())
+            {
+                return;
+            }
+            setLogBackend(nullptr);
+            mStopping = true;
+        }
+        mWake.notify_one();
+        mThread.join();
+    }
+
+    void flush() override
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (!mThread.joinable())
+        {
+            return;
+        }
+        // Wait for a complete pass that started after the messages of the calling thread were queued.
+        uint64_t const target = mPassesStarted + 1;
+        mFlushRequested = true;
+        mWake.notify_one();
+        mPassDone.wait(lock, [&]() { return mPassesDone >= target || mStopping; });
+    }
+
+    void log(Severity severity, std::string&& message) override
+    {
+        enqueue(severity, std::move(message));
+    }
+
+    std::ostream& getLine(void const* consumer) override
+    {
+        // Most fragments go to the same consumer as the previous one, so skip the map lookup for them.
+        thread_local std::unordered_map<void const*, std::ostringstream> tLines;
+        thread_local void const* tLastConsumer{nullptr};
+        thread_local std::ostringstream* tLastLine{nullptr};
+        if (consumer != tLastConsumer)
+        {
+            tLastLine = &tLines[consumer];
+            tLastConsumer = consumer;
+        }
+        return *tLastLine;
+    }
+
+    void submitLine(void const* consumer, Severity severity) override
+    {
+        auto& line = static_cast<std::ostringstream&>(getLine(consumer));
+        std::string message = line.str();
+        line.str("");
+        if (!message.empty())
+        {
+            enqueue(severity, std::move(message));
+        }
+    }
+
+    bool isRunning() const noexcept
+    {
+        return getLogBackend() == this;
+    }
+
+private:
+    //! Queue a message in the ring of the calling thread. When the ring is full, either drop the message or wait for
+    //! the drain thread to make room.
+    bool enqueue(Severity severity, std::string&& message)
+    {
+        LogRecord record{
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - mStart).count(), severity,
+            std::move(message)};
+        LogRing& ring = threadRing();
+        if (ring.push(record))
+        {
+            return true;
+        }
+        if (mDropWhenFull.load(std::memory_order_relaxed))
+        {
+            mDropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // The drain thread notifies mPassDone under mMutex after each pass, so holding the lock between a failed push
+        // and the wait cannot miss the pass that frees the ring.
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (!ring.push(record))
+        {
+            if (mStopping || !mThread.joinable())
+            {
+                mDropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            mFlushRequested = true;
+            mWake.notify_one();
+            mPassDone.wait(lock);
+        }
+        return true;
+    }
+
+    LogRing& threadRing()
+    {
+        if (!tThreadRing.ring || tThreadRing.generation != mGeneration.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (tThreadRing.ring)
+            {
+                tThreadRing.ring->markOrphaned();
+            }
+            tThreadRing.ring = std::make_shared<LogRing>(mQueueDepth, mNextThreadId++);
+            tThreadRing.generation = mGeneration.load(std::memory_order_relaxed);
+            mRings.push_back(tThreadRing.ring);
+        }
+        return *tThreadRing.ring;
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true)
+        {
+            bool const last = mStopping;
+            ++mPassesStarted;
+            auto rings = mRings;
+            lock.unlock();
+            drain(rings);
+            lock.lock();
+            ++mPassesDone;
+            mPassDone.notify_all();
+            // Forget the rings of exited threads once they are empty.
+            mRings.erase(std::remove_if(mRings.begin(), mRings.end(),
+                             [](auto const& r) { return r->isOrphaned() && r->empty(); }),
+                mRings.end());
+            if (last)
+            {
+                break;
+            }
+            mWake.wait_for(lock, kDRAIN_INTERVAL, [this]() { return mStopping || mFlushRequested; });
+            mFlushRequested = false;
+        }
+    }
+
+    void drain(std::vector<std::shared_ptr<LogRing>> const& rings)
+    {
+        struct Entry
+        {
+            int64_t timestampNs;
+            int32_t threadId;
+            Severity severity;
+            std::string message;
+        };
+        std::vector<Entry> batch;
+        for (auto const& ring : rings)
+        {
+            ring->drain([&](int32_t threadId, LogRecord& record) {
+                batch.push_back({record.timestampNs, threadId, record.severity, std::move(record.message)});
+            });
+        }
+
+        uint64_t const dropped = mDropped.exchange(0, std::memory_order_relaxed);
+        if (batch.empty() && dropped == 0)
+        {
+            return;
+        }
+
+        // Messages of one thread are already in order; interleave the threads by timestamp.
+        std::stable_sort(batch.begin(), batch.end(),
+            [](Entry const& a, Entry const& b) { return a.timestampNs < b.timestampNs; });
+
+        std::string out;
+        std::string err;
+        char header[64];
+        for (auto const& e : batch)
+        {
+            std::snprintf(header, sizeof(header), "[%.6f] [T%d] ", e.timestampNs * 1e-9, e.threadId);
+            std::string& dst = e.severity >= Severity::kINFO ? out : err;
+            dst.append(header).append(severityPrefix(e.severity)).append(e.message);
+        }
+        if (dropped > 0)
+        {
+            err.append(severityPrefix(Severity::kWARNING))
+                .append(std::to_string(dropped))
+                .append(" log messages were dropped because a logging queue was full.\n");
+        }
+        if (!out.empty())
+        {
+            std::cout.write(out.data(), static_cast<std::streamsize>(out.size())).flush();
+        }
+        if (!err.empty())
+        {
+            std::cerr.write(err.data(), static_cast<std::streamsize>(err.size())).flush();
+        }
+    }
+
+    int32_t mQueueDepth{1};
+    std::atomic<bool> mDropWhenFull{false};
+    Clock::time_point mStart{Clock::now()};
+    std::mutex mMutex;
+    std::condition_variable mWake;
+    std::condition_variable mPassDone;
+    std::thread mThread;
+    bool mStopping{false};
+    bool mFlushRequested{false};
+    uint64_t mPassesStarted{0};
+    uint64_t mPassesDone{0};
+    std::atomic<uint64_t> mGeneration{0};
+    int32_t mNextThreadId{0};
+    std::vector<std::shared_ptr<LogRing>> mRings;
+    std::atomic<uint64_t> mDropped{0};
+};
+
+AsyncLogSink& getSink()
+{
+    static AsyncLogSink sink;
+    return sink;
+}
+
+} // namespace
+
+void startAsyncLogging(AsyncLogOptions const& options)
+{
+    getSink().start(options);
+}
+
+void stopAsyncLogging()
+{
+    getSink().stop();
+}
+
+void flushAsyncLogging()
+{
+    if (isAsyncLoggingEnabled())
+    {
+        getSink().flush();
+    }
+}
+
+bool isAsyncLoggingEnabled() noexcept
+{
+    return getSink().isRunning();
+}
+
+} // namespace sample
@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TENSORRT_ASYNC_LOGGER_H
+#define TENSORRT_ASYNC_LOGGER_H
+
+#include <cstdint>
+
+namespace sample
+{
+
+//!
+//! \brief Settings of the asynchronous logging backend.
+//!
+//! Each thread that logs owns a lock-free ring of messages. A background thread drains the rings, orders the messages
+//! by timestamp and writes them to stdout or stderr, so logging threads neither take a lock nor wait for the terminal.
+//! The backend is installed in the sample logger with setLogBackend(), so only the tools that start it, such as
+//! trtexec, link this file.
+//!
+struct AsyncLogOptions
+{
+    int32_t queueDepth{4096};  //!< Maximum number of messages waiting to be written, per logging thread
+    bool dropWhenFull{false}; //!< Drop messages instead of waiting when the ring of a thread is full
+};
+
+//!
+//! \brief Start writing log messages from a background thread.
+//!
+//! Messages are prefixed with the time in seconds since logging started, from a monotonic clock, and with a small
+//! integer identifying the logging thread.
+//!
+void startAsyncLogging(AsyncLogOptions const& options);
+
+//!
+//! \brief Write the queued messages and stop the background thread.
+//!
+//! Messages logged concurrently with this call may be lost, so it should be called after the logging threads have
+//! finished. It is called at exit if logging is still asynchronous.
+//!
+void stopAsyncLogging();
+
+//!
+//! \brief Wait until the messages logged so far by all threads have been written.
+//!
+void flushAsyncLogging();
+
+bool isAsyncLoggingEnabled() noexcept;
+
+} // namespace sample
+
+#endif // TENSORRT_ASYNC_LOGGER_H
@@ -0,0 +1,296 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cachingAllocator.h"
+
+#include <algorithm>
+#include <cuda_runtime_api.h>
+
+namespace sample
+{
+
+namespace
+{
+
+constexpr size_t kSMALL_BLOCK_GRANULARITY{512};
+constexpr size_t kLARGE_BLOCK_THRESHOLD{1 << 20};
+constexpr int32_t kCLASSES_PER_POWER_OF_TWO{4};
+
+size_t roundUp(size_t size, size_t step)
+{
+    return (size + step - 1) / step * step;
+}
+
+class CudaMemoryBackend : public IDeviceMemoryBackend
+{
+public:
+    ~CudaMemoryBackend() override
+    {
+        for (auto event : mEvents)
+        {
+            static_cast<void>(cudaEventDestroy(event));
+        }
+    }
+
+    void* allocate(size_t size) noexcept override
+    {
+        void* memory{nullptr};
+        if (cudaMalloc(&memory, size) != cudaSuccess)
+        {
+            // The caller handles the failure; do not leave it to be reported by an unrelated CUDA call.
+            static_cast<void>(cudaGetLastError());
+            return nullptr;
+        }
+        return memory;
+    }
+
+    void free(void* memory) noexcept override
+    {
+        static_cast<void>(cudaFree(memory));
+    }
+
+    StreamMarker recordMarker(cudaStream_t stream) noexcept override
+    {
+        cudaEvent_t event{nullptr};
+        if (!mEvents.empty())
+        {
+            event = mEvents.back();
+            mEvents.pop_back();
+        }
+        else if (cudaEventCreateWithFlags(&event, cudaEventDisableTiming) != cudaSuccess)
+        {
+            static_cast<void>(cudaGetLastError());
+            return nullptr;
+        }
+        if (cudaEventRecord(event, stream) != cudaSuccess)
+        {
+            static_cast<void>(cudaGetLastError());
+            mEvents.push_back(event);
+            return nullptr;
+        }
+        return event;
+    }
+
+    bool isMarkerReached(StreamMarker marker) noexcept override
+    {
+        cudaError_t const status = cudaEventQuery(static_cast<cudaEvent_t>(marker));
+        if (status == cudaErrorNotReady)
+        {
+            static_cast<void>(cudaGetLastError());
+        }
+        return status == cudaSuccess;
+    }
+
+    void waitForMarker(StreamMarker marker) noexcept override
+    {
+        static_cast<void>(cudaEventSynchronize(static_cast<cudaEvent_t>(marker)));
+    }
+
+    void releaseMarker(StreamMarker marker) noexcept override
+    {
+        mEvents.push_back(static_cast<cudaEvent_t>(marker));
+    }
+
+private:
+    std::vector<cudaEvent_t> mEvents; //!< Events free for reuse
+};
+
+} // namespace
+
+std::unique_ptr<IDeviceMemoryBackend> createCudaMemoryBackend()
+{
+    return std::unique_ptr<IDeviceMemoryBackend>(new CudaMemoryBackend);
+}
+
+std::ostream& operator<<(std::ostream& os, CachingAllocatorStats const& stats)
+{
+    constexpr double kMiB{1 << 20};
+    os << "In use: " << stats.inUseBytes / kMiB << " MiB (peak " << stats.peakInUseBytes / kMiB << " MiB), reserved: "
+       << stats.reservedBytes / kMiB << " MiB (peak " << stats.peakReservedBytes / kMiB << " MiB), "
+       << stats.nbAllocations << " allocations, " << stats.nbCacheHits << " served from the cache, "
+       << stats.nbBackendAllocations << " device allocations, " << stats.nbBackendFrees << " device frees";
+    return os;
+}
+
+CachingGpuAllocator::CachingGpuAllocator(std::unique_ptr<IDeviceMemoryBackend> backend)
+    : mBackend(std::move(backend))
+{
+}
+
+CachingGpuAllocator::~CachingGpuAllocator()
+{
+    trim();
+}
+
+size_t CachingGpuAllocator::getSizeClass(size_t size)
+{
+    if (size <= kLARGE_BLOCK_THRESHOLD)
+    {
+        return std::max(roundUp(size, kSMALL_BLOCK_GRANULARITY), kSMALL_BLOCK_GRANULARITY);
+    }
+    size_t powerOfTwo{kLARGE_BLOCK_THRESHOLD};
+    while (powerOfTwo <= size / 2)
+    {
+        powerOfTwo *= 2;
+    }
+    size_t const step = powerOfTwo / kCLASSES_PER_POWER_OF_TWO;
+    return roundUp(size, step);
+}
+
+void* CachingGpuAllocator::allocateAsync(uint64_t const size, uint64_t const alignment,
+    nvinfer1::AllocatorFlags const /*flags*/, cudaStream_t stream) noexcept
+{
+    if (size == 0 || alignment > kALIGNMENT)
+    {
+        return nullptr;
+    }
+    size_t const sizeClass = getSizeClass(size);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    void* memory = takeCachedBlock(sizeClass, stream);
+    if (memory != nullptr)
+    {
+        ++mStats.nbCacheHits;
+    }
+    else
+    {
+        memory = mBackend->allocate(sizeClass);
+        if (memory == nullptr)
+        {
+            // Give the cached blocks back and retry.
+            trimLocked(0);
+            memory = mBackend->allocate(sizeClass);
+        }
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+        ++mStats.nbBackendAllocations;
+        mStats.reservedBytes += sizeClass;
+        mStats.peakReservedBytes = std::max(mStats.peakReservedBytes, mStats.reservedBytes);
+    }
+
+    mInUse.emplace(memory, sizeClass);
+    ++mStats.nbAllocations;
+    mStats.inUseBytes += sizeClass;
+    mStats.peakInUseBytes = std::max(mStats.peakInUseBytes, mStats.inUseBytes);
+    return memory;
+}
+
+bool CachingGpuAllocator::deallocateAsync(void* const memory, cudaStream_t stream) noexcept
+{
+    if (memory == nullptr)
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto const it = mInUse.find(memory);
+    if (it == mInUse.end())
+    {
+        return false;
+    }
+    size_t const sizeClass = it->second;
+    mInUse.erase(it);
+    mStats.inUseBytes -= sizeClass;
+
+    StreamMarker const marker = mBackend->recordMarker(stream);
+    if (marker == nullptr)
+    {
+        // The block cannot be reused safely from another stream, so give it back.
+        mBackend->free(memory);
+        ++mStats.nbBackendFrees;
+        mStats.reservedBytes -= sizeClass;
+        return true;
+    }
+    mCache[sizeClass].push_back({memory, stream, marker});
+    return true;
+}
+
+void* CachingGpuAllocator::takeCachedBlock(size_t sizeClass, cudaStream_t stream)
+{
+    auto const cached = mCache.find(sizeClass);
+    if (cached == mCache.end())
+    {
+        return nullptr;
+    }
+    auto& blocks = cached->second;
+
+    // Work on the same stream is ordered after the release; on other streams, the release must have been reached.
+    auto block = std::find_if(blocks.rbegin(), blocks.rend(), [&](CachedBlock const& b) { return b.stream == stream; });
+    if (block == blocks.rend())
+    {
+        block = std::find_if(
+            blocks.rbegin(), blocks.rend(), [&](CachedBlock const& b) { return mBackend->isMarkerReached(b.marker); });
+    }
+    if (block == blocks.rend())
+    {
+        return nullptr;
+    }
+
+    void* const memory = block->memory;
+    mBackend->releaseMarker(block->marker);
+    blocks.erase(std::next(block).base());
+    if (blocks.empty())
+    {
+        mCache.erase(cached);
+    }
+    return memory;
+}
+
+void CachingGpuAllocator::trim(size_t targetBytes)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    trimLocked(targetBytes);
+}
+
+void CachingGpuAllocator::trimLocked(size_t targetBytes)
+{
+    while (!mCache.empty() && mStats.reservedBytes > static_cast<int64_t>(targetBytes))
+    {
+        auto largest = std::prev(mCache.end());
+        size_t const sizeClass = largest->first;
+        auto& blocks = largest->second;
+        CachedBlock const block = blocks.back();
+        blocks.pop_back();
+        if (blocks.empty())
+        {
+            mCache.erase(largest);
+        }
+
+        mBackend->waitForMarker(block.marker);
+        mBackend->releaseMarker(block.marker);
+        mBackend->free(block.memory);
+        ++mStats.nbBackendFrees;
+        mStats.reservedBytes -= sizeClass;
+    }
+}
+
+CachingAllocatorStats CachingGpuAllocator::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
+void CachingGpuAllocator::resetPeakStats()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStats.peakInUseBytes = mStats.inUseBytes;
+    mStats.peakReservedBytes = mStats.reservedBytes;
+}
+
+} // namespace sample
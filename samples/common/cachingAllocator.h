@@ -0,0 +1,146 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TENSORRT_CACHING_ALLOCATOR_H
+#define TENSORRT_CACHING_ALLOCATOR_H
+
+#include "NvInferRuntime.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace sample
+{
+
+//! Opaque handle to a position in a stream, reached once the work queued before it has finished.
+using StreamMarker = void*;
+
+//!
+//! \class IDeviceMemoryBackend
+//! \brief Source of the memory and stream markers used by CachingGpuAllocator.
+//!
+//! The allocator calls the backend with its lock held, so a backend serving a single allocator needs no locking.
+//!
+class IDeviceMemoryBackend
+{
+public:
+    virtual ~IDeviceMemoryBackend() = default;
+
+    //! Return nullptr if the memory cannot be allocated.
+    virtual void* allocate(size_t size) noexcept = 0;
+
+    virtual void free(void* memory) noexcept = 0;
+
+    //! Return a marker at the current end of the stream, or nullptr on failure.
+    virtual StreamMarker recordMarker(cudaStream_t stream) noexcept = 0;
+
+    virtual bool isMarkerReached(StreamMarker marker) noexcept = 0;
+
+    virtual void waitForMarker(StreamMarker marker) noexcept = 0;
+
+    virtual void releaseMarker(StreamMarker marker) noexcept = 0;
+};
+
+//!
+//! \brief Create a backend allocating with cudaMalloc and marking streams with CUDA events.
+//!
+std::unique_ptr<IDeviceMemoryBackend> createCudaMemoryBackend();
+
+struct CachingAllocatorStats
+{
+    int64_t inUseBytes{0};        //!< Bytes handed out and not released, rounded up to their size class
+    int64_t reservedBytes{0};     //!< Bytes obtained from the backend, in use or cached
+    int64_t peakInUseBytes{0};
+    int64_t peakReservedBytes{0};
+    int64_t nbAllocations{0};
+    int64_t nbCacheHits{0};       //!< Allocations served from the cache
+    int64_t nbBackendAllocations{0};
+    int64_t nbBackendFrees{0};
+};
+
+std::ostream& operator<<(std::ostream& os, CachingAllocatorStats const& stats);
+
+//!
+//! \class CachingGpuAllocator
+//! \brief GPU allocator keeping released blocks for reuse instead of returning them to the backend.
+//!
+//! Requests are rounded up to a size class: multiples of 512 bytes up to 1 MiB, then four classes per power of two,
+//! so at most a quarter of a block is wasted. A released block is reused right away by an allocation on the stream
+//! that released it, and by allocations on other streams once the work queued on that stream before the release has
+//! finished. When the backend runs out of memory, the cache is emptied and the allocation retried.
+//!
+//! Memory still in use when the allocator is destroyed is not released.
+//!
+class CachingGpuAllocator : public nvinfer1::IGpuAsyncAllocator
+{
+public:
+    explicit CachingGpuAllocator(std::unique_ptr<IDeviceMemoryBackend> backend);
+
+    ~CachingGpuAllocator() override;
+
+    CachingGpuAllocator(CachingGpuAllocator const&) = delete;
+    CachingGpuAllocator& operator=(CachingGpuAllocator const&) = delete;
+
+    void* allocateAsync(uint64_t const size, uint64_t const alignment, nvinfer1::AllocatorFlags const flags,
+        cudaStream_t stream) noexcept override;
+
+    //! \return False if the memory was not allocated by this allocator.
+    bool deallocateAsync(void* const memory, cudaStream_t stream) noexcept override;
+
+    //!
+    //! \brief Return cached blocks to the backend, largest first, until at most targetBytes are reserved.
+    //!
+    //! Waits for the streams that released the blocks.
+    //!
+    void trim(size_t targetBytes = 0);
+
+    CachingAllocatorStats getStats() const;
+
+    //! Restart the peak statistics from the current usage.
+    void resetPeakStats();
+
+    static size_t getSizeClass(size_t size);
+
+    //! Alignment of the blocks, as guaranteed by cudaMalloc.
+    static constexpr uint64_t kALIGNMENT{256};
+
+private:
+    struct CachedBlock
+    {
+        void* memory;
+        cudaStream_t stream; //!< Stream that released the block
+        StreamMarker marker; //!< Reached when the work queued on the stream before the release has finished
+    };
+
+    void* takeCachedBlock(size_t sizeClass, cudaStream_t stream);
+    void trimLocked(size_t targetBytes);
+
+    std::unique_ptr<IDeviceMemoryBackend> mBackend;
+    mutable std::mutex mMutex;
+    std::map<size_t, std::vector<CachedBlock>> mCache;
+    std::unordered_map<void*, size_t> mInUse; //!< Size class of the blocks handed out
+    CachingAllocatorStats mStats;
+};
+
+} // namespace sample
+
+#endif // TENSORRT_CACHING_ALLOCATOR_H
@@ -0,0 +1,482 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "debugTensorReader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sample
+{
+
+namespace
+{
+
+constexpr char kSUMMARY_FILE_NAME[] = "tensor_summary.json";
+
+//! Return the quoted value following key on a line of the form `"key": "value"`, undoing JSON escapes.
+bool getJsonStringValue(std::string const& line, std::string const& key, std::string& value)
+{
+    std::string const pattern = "\"" + key + "\": \"";
+    auto const start = line.find(pattern);
+    auto const end = line.rfind('"');
+    if (start == std::string::npos || end < start + pattern.size())
+    {
+        return false;
+    }
+
+    value.clear();
+    for (size_t i = start + pattern.size(); i < end; ++i)
+    {
+        if (line[i] == '\\' && i + 1 < end)
+        {
+            ++i;
+        }
+        value += line[i];
+    }
+    return true;
+}
+
+//! Find the value of a key in the python dict literal of a .npy header.
+std::string getNpyHeaderField(std::string const& header, std::string const& key)
+{
+    std::string const pattern = "'" + key + "':";
+    auto pos = header.find(pattern);
+    if (pos == std::string::npos)
+    {
+        return "";
+    }
+    pos = header.find_first_not_of(' ', pos + pattern.size());
+    if (pos == std::string::npos)
+    {
+        return "";
+    }
+
+    char const open = header[pos];
+    if (open == '\'' || open == '(')
+    {
+        auto const end = header.find(open == '(' ? ')' : '\'', pos + 1);
+        return end == std::string::npos ? "" : header.substr(pos + 1, end - pos - 1);
+    }
+    return header.substr(pos, header.find_first_of(",}", pos) - pos);
+}
+
+//! Parse text, surrounded by optional spaces, as a decimal integer. Unlike std::stoll, reject trailing characters
+//! and report errors through the return value.
+template <typename T>
+bool parseInteger(std::string const& text, T& value)
+{
+    auto const first = text.find_first_not_of(' ');
+    auto const last = text.find_last_not_of(' ');
+    if (first == std::string::npos)
+    {
+        return false;
+    }
+    char const* end = text.data() + last + 1;
+    auto const result = std::from_chars(text.data() + first, end, value);
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+//! Parse the extents of a shape separated by separator. An empty text is a scalar.
+bool parseShape(std::string const& text, char separator, std::vector<int64_t>& shape)
+{
+    shape.clear();
+    if (text.find_first_not_of(' ') == std::string::npos)
+    {
+        return true;
+    }
+    for (size_t pos = 0; pos <= text.size();)
+    {
+        auto const next = std::min(text.find(separator, pos), text.size());
+        std::string const extent = text.substr(pos, next - pos);
+        // A one-dimensional numpy shape is written "(N,)", so the last extent may be empty.
+        if (next == text.size() && !shape.empty() && extent.find_first_not_of(' ') == std::string::npos)
+        {
+            break;
+        }
+        int64_t value{};
+        if (!parseInteger(extent, value) || value < 0)
+        {
+            return false;
+        }
+        shape.push_back(value);
+        pos = next + 1;
+    }
+    return true;
+}
+
+//! Return the size in bits of an element of a type named as in the container index, or 0 for an unknown type.
+int32_t getContainerTypeBits(std::string const& type)
+{
+    static std::unordered_map<std::string, int32_t> const kBITS{{"BOOL", 8}, {"INT4", 4}, {"INT8", 8},
+        {"INT32", 32}, {"INT64", 64}, {"UINT8", 8}, {"FP4", 4}, {"FP8", 8}, {"E8M0", 8}, {"HALF", 16},
+        {"BF16", 16}, {"FLOAT", 32}};
+    auto it = kBITS.find(type);
+    return it == kBITS.end() ? 0 : it->second;
+}
+
+//! Return the number of elements of shape, or -1 if it is larger than maxVolume.
+int64_t getVolume(std::vector<int64_t> const& shape, int64_t maxVolume)
+{
+    int64_t volume{1};
+    for (auto const d : shape)
+    {
+        if (d != 0 && volume > maxVolume / d)
+        {
+            return -1;
+        }
+        volume *= d;
+    }
+    return volume;
+}
+
+} // namespace
+
+MappedFile::MappedFile(std::string const& path)
+{
+#if !defined(_WIN32)
+    int32_t const fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+    struct stat st
+    {
+    };
+    if (::fstat(fd, &st) == 0)
+    {
+        mSize = static_cast<size_t>(st.st_size);
+        mIsOpen = true;
+        if (mSize > 0)
+        {
+            void* addr = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED)
+            {
+                mData = addr;
+                mIsMapped = true;
+            }
+        }
+    }
+    ::close(fd);
+    if (mIsMapped || !mIsOpen || mSize == 0)
+    {
+        return;
+    }
+    mIsOpen = false;
+#endif
+    // Fall back to reading the whole file.
+    std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return;
+    }
+    mSize = static_cast<size_t>(file.tellg());
+    mBuffer.resize(mSize);
+    file.seekg(0, std::ios::beg);
+    file.read(mBuffer.data(), static_cast<std::streamsize>(mSize));
+    mData = mBuffer.data();
+    mIsOpen = static_cast<bool>(file);
+}
+
+MappedFile::~MappedFile()
+{
+    release();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+        mBuffer = std::move(other.mBuffer);
+        mSize = std::exchange(other.mSize, 0);
+        mIsOpen = std::exchange(other.mIsOpen, false);
+        mIsMapped = std::exchange(other.mIsMapped, false);
+        mData = mIsMapped ? other.mData : mBuffer.data();
+        other.mData = nullptr;
+    }
+    return *this;
+}
+
+void MappedFile::release()
+{
+#if !defined(_WIN32)
+    if (mIsMapped)
+    {
+        ::munmap(const_cast<void*>(mData), mSize);
+    }
+#endif
+    mData = nullptr;
+    mSize = 0;
+    mIsOpen = false;
+    mIsMapped = false;
+    mBuffer.clear();
+}
+
+bool parseNpy(void const* buffer, size_t size, NpyView& view, std::string& err)
+{
+    constexpr char kMAGIC[] = {'\x93', 'N', 'U', 'M', 'P', 'Y'};
+    constexpr size_t kPREAMBLE_SIZE = sizeof(kMAGIC) + 2;
+    auto const* bytes = static_cast<char const*>(buffer);
+    if (size < kPREAMBLE_SIZE + sizeof(uint16_t) || std::memcmp(bytes, kMAGIC, sizeof(kMAGIC)) != 0)
+    {
+        err = "not a .npy file";
+        return false;
+    }
+
+    // Version 1.x stores the header length in 2 bytes, later versions in 4 bytes.
+    uint8_t const major = static_cast<uint8_t>(bytes[sizeof(kMAGIC)]);
+    size_t headerLen{0};
+    size_t offset{kPREAMBLE_SIZE};
+    if (major == 1)
+    {
+        uint16_t len{};
+        std::memcpy(&len, bytes + offset, sizeof(len));
+        headerLen = len;
+        offset += sizeof(len);
+    }
+    else
+    {
+        uint32_t len{};
+        if (size < offset + sizeof(len))
+        {
+            err = "truncated .npy header";
+            return false;
+        }
+        std::memcpy(&len, bytes + offset, sizeof(len));
+        headerLen = len;
+        offset += sizeof(len);
+    }
+    if (size < offset + headerLen)
+    {
+        err = "truncated .npy header";
+        return false;
+    }
+
+    std::string const header(bytes + offset, headerLen);
+    offset += headerLen;
+
+    if (getNpyHeaderField(header, "fortran_order").find("True") != std::string::npos)
+    {
+        err = "Fortran-ordered arrays are not supported";
+        return false;
+    }
+
+    view.descr = getNpyHeaderField(header, "descr");
+    if (view.descr.size() < 3)
+    {
+        err = "missing dtype in .npy header";
+        return false;
+    }
+    if (!parseInteger(view.descr.substr(2), view.elementSize) || view.elementSize == 0)
+    {
+        err = "invalid dtype '" + view.descr + "' in .npy header";
+        return false;
+    }
+
+    if (!parseShape(getNpyHeaderField(header, "shape"), ',', view.shape))
+    {
+        err = "invalid shape in .npy header";
+        return false;
+    }
+
+    view.volume = getVolume(view.shape, static_cast<int64_t>((size - offset) / view.elementSize));
+    if (view.volume < 0)
+    {
+        err = "truncated .npy data";
+        return false;
+    }
+    view.data = bytes + offset;
+    return true;
+}
+
+std::vector<DumpedTensorFile> listDumpedNumpyFiles(std::string const& directory)
+{
+    namespace fs = std::filesystem;
+    std::vector<DumpedTensorFile> files;
+
+    std::ifstream summary(fs::path(directory) / kSUMMARY_FILE_NAME);
+    if (summary)
+    {
+        std::string line;
+        std::string name;
+        std::string value;
+        int32_t order{-1};
+        while (std::getline(summary, line))
+        {
+            if (getJsonStringValue(line, "name", value))
+            {
+                name = value;
+                ++order;
+            }
+            else if (order >= 0 && getJsonStringValue(line, "numpy", value))
+            {
+                files.push_back({name, (fs::path(directory) / value).string(), order});
+            }
+        }
+        return files;
+    }
+
+    std::error_code ec;
+    for (auto const& entry : fs::directory_iterator(directory, ec))
+    {
+        if (entry.path().extension() != ".npy")
+        {
+            continue;
+        }
+
+        // File names are "<4-digit index>_<tensor name>[_to_float|_to_int8].npy".
+        std::string stem = entry.path().stem().string();
+        auto const sep = stem.find('_');
+        int32_t order{};
+        if (sep == std::string::npos || sep == 0
+            || !std::all_of(stem.begin(), stem.begin() + sep, [](char c) { return std::isdigit(c) != 0; })
+            || !parseInteger(stem.substr(0, sep), order))
+        {
+            continue;
+        }
+        stem = stem.substr(sep + 1);
+        for (std::string const suffix : {"_to_float", "_to_int8"})
+        {
+            if (stem.size() > suffix.size() && stem.compare(stem.size() - suffix.size(), suffix.size(), suffix) == 0)
+            {
+                stem.resize(stem.size() - suffix.size());
+                break;
+            }
+        }
+        files.push_back({stem, entry.path().string(), order});
+    }
+    std::sort(files.begin(), files.end(),
+        [](DumpedTensorFile const& a, DumpedTensorFile const& b) { return a.order < b.order; });
+    return files;
+}
+
+bool DebugTensorContainer::open(std::string const& path, std::string& err)
+{
+    mTensors.clear();
+    mIndex.clear();
+    mFile = MappedFile(path);
+    if (!mFile.isOpen())
+    {
+        err = "cannot open " + path;
+        return false;
+    }
+    constexpr size_t kMAGIC_SIZE = sizeof(kDEBUG_TENSOR_CONTAINER_MAGIC) - 1;
+    if (mFile.size() < kDEBUG_TENSOR_CONTAINER_ALIGNMENT
+        || std::memcmp(mFile.data(), kDEBUG_TENSOR_CONTAINER_MAGIC, kMAGIC_SIZE) != 0)
+    {
+        err = path + " is not a debug tensor container";
+        return false;
+    }
+
+    std::string const indexPath = path + kDEBUG_TENSOR_CONTAINER_INDEX_SUFFIX;
+    std::ifstream index(indexPath);
+    if (!index)
+    {
+        err = "cannot open " + indexPath;
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(index, line))
+    {
+        std::istringstream fields(line);
+        ContainerTensor tensor;
+        std::string shape;
+        fields >> tensor.offset >> tensor.size >> tensor.iteration >> tensor.type;
+        // The shape may be empty, so split the rest of the line on tabs instead of whitespace.
+        std::string rest;
+        std::getline(fields, rest);
+        auto const tab = rest.find('\t', 1);
+        if (fields.fail() || rest.empty() || rest[0] != '\t' || tab == std::string::npos)
+        {
+            err = "malformed index line in " + indexPath + ": " + line;
+            return false;
+        }
+        shape = rest.substr(1, tab - 1);
+        if (!parseShape(shape, 'x', tensor.shape))
+        {
+            err = "invalid shape in index line of " + indexPath + ": " + line;
+            return false;
+        }
+        for (size_t i = tab + 1; i < rest.size(); ++i)
+        {
+            if (rest[i] != '\\')
+            {
+                tensor.name += rest[i];
+                continue;
+            }
+            char const escaped = i + 1 < rest.size() ? rest[++i] : '\0';
+            switch (escaped)
+            {
+            case '\\': tensor.name += '\\'; break;
+            case 'n': tensor.name += '\n'; break;
+            case 'r': tensor.name += '\r'; break;
+            case 't': tensor.name += '\t'; break;
+            default: err = "invalid escape sequence in index line of " + indexPath + ": " + line; return false;
+            }
+        }
+
+        // A tensor whose payload is not complete was being written when the dump stopped.
+        if (tensor.offset > mFile.size() || tensor.size > mFile.size() - tensor.offset)
+        {
+            break;
+        }
+
+        // Sub-byte types are packed, so the payload of an odd number of 4-bit elements ends with a padding nibble.
+        int32_t const bits = getContainerTypeBits(tensor.type);
+        int64_t const volume = getVolume(tensor.shape, std::numeric_limits<int64_t>::max() / 64);
+        if (bits > 0 && (volume < 0 || static_cast<uint64_t>((volume * bits + 7) / 8) != tensor.size))
+        {
+            err = "payload size of " + std::to_string(tensor.size) + " bytes does not match the " + tensor.type
+                + " shape " + shape + " in " + indexPath + ": " + line;
+            return false;
+        }
+        // The first entry of a (name, iteration) pair is the one found, as with a scan of the index.
+        mIndex.emplace(Key{tensor.name, tensor.iteration}, mTensors.size());
+        mTensors.push_back(std::move(tensor));
+    }
+    return true;
+}
+
+ContainerTensor const* DebugTensorContainer::find(std::string const& name, int32_t iteration) const
+{
+    auto const it = mIndex.find(Key{name, iteration});
+    return it == mIndex.end() ? nullptr : &mTensors[it->second];
+}
+
+} // namespace sample
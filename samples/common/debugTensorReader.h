@@ -0,0 +1,194 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TENSORRT_DEBUG_TENSOR_READER_H
+#define TENSORRT_DEBUG_TENSOR_READER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sample
+{
+
+//!
+//! \brief Read-only view of a whole file.
+//!
+//! The file is memory mapped where the platform supports it, and read into memory otherwise.
+//!
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    explicit MappedFile(std::string const& path);
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    bool isOpen() const
+    {
+        return mIsOpen;
+    }
+
+    void const* data() const
+    {
+        return mData;
+    }
+
+    size_t size() const
+    {
+        return mSize;
+    }
+
+private:
+    void release();
+
+    void const* mData{nullptr};
+    size_t mSize{0};
+    bool mIsOpen{false};
+    bool mIsMapped{false};
+    std::vector<char> mBuffer; //!< Backing storage when the file could not be mapped
+};
+
+//!
+//! \brief View of the array stored in a .npy file.
+//!
+struct NpyView
+{
+    std::string descr;          //!< numpy type string, e.g. "<f4"
+    std::vector<int64_t> shape; //!< Array extents, C order
+    int64_t volume{0};          //!< Number of elements
+    size_t elementSize{0};      //!< Size of one element in bytes
+    void const* data{nullptr};  //!< First element, pointing into the parsed buffer
+};
+
+//!
+//! \brief Parse a version 1.0 .npy buffer as written by DebugTensorWriter.
+//!
+//! \return True on success. On failure, err describes the problem.
+//!
+bool parseNpy(void const* buffer, size_t size, NpyView& view, std::string& err);
+
+//!
+//! \brief One tensor file of a debug tensor dump.
+//!
+struct DumpedTensorFile
+{
+    std::string name; //!< Tensor name as reported by TensorRT
+    std::string path; //!< Path to the .npy file
+    int32_t order{0}; //!< Position in the order the tensors were dumped
+};
+
+//!
+//! \brief List the numpy files of a debug tensor dump directory in dump order.
+//!
+//! Tensor names are taken from tensor_summary.json when the dump has one. Otherwise the .npy files in the directory
+//! are listed and the names are recovered from the file names, which only keep the filename-safe characters of the
+//! original tensor names.
+//!
+std::vector<DumpedTensorFile> listDumpedNumpyFiles(std::string const& directory);
+
+//!
+//! \brief Container format of debug tensor dumps, selected with the "container" debug tensor format.
+//!
+//! All tensors are appended to a single data file that starts with a kDEBUG_TENSOR_CONTAINER_ALIGNMENT byte header
+//! holding kDEBUG_TENSOR_CONTAINER_MAGIC. Each payload holds the raw tensor bytes in the TensorRT layout and starts on
+//! a kDEBUG_TENSOR_CONTAINER_ALIGNMENT byte boundary. The index file, named after the data file with an ".index"
+//! suffix, is appended with one tab-separated line per tensor:
+//!
+//!     offset  bytes  iteration  type  shape  name
+//!
+//! where type is the TensorRT data type name (e.g. "FLOAT"), shape is "x"-separated (empty for scalars), iteration
+//! counts the previous dumps of the same tensor, and backslashes, tabs, carriage returns and newlines in the name are
+//! escaped as "\\", "\t", "\r" and "\n".
+//!
+constexpr char kDEBUG_TENSOR_CONTAINER_MAGIC[] = "TRTDEBUGTENSORS1";
+constexpr size_t kDEBUG_TENSOR_CONTAINER_ALIGNMENT{64};
+constexpr char kDEBUG_TENSOR_CONTAINER_FILE_NAME[] = "debug_tensors.bin";
+constexpr char kDEBUG_TENSOR_CONTAINER_INDEX_SUFFIX[] = ".index";
+
+//!
+//! \brief Index entry of a tensor in a debug tensor container.
+//!
+struct ContainerTensor
+{
+    std::string name;
+    std::string type;           //!< TensorRT data type name
+    std::vector<int64_t> shape; //!< Tensor dimensions
+    int32_t iteration{0};       //!< Number of earlier dumps of the same tensor
+    uint64_t offset{0};         //!< Payload offset in the data file
+    uint64_t size{0};           //!< Payload size in bytes
+};
+
+//!
+//! \brief Reader of a debug tensor container.
+//!
+//! The data file is mapped, so payloads are only read from disk when they are accessed.
+//!
+class DebugTensorContainer
+{
+public:
+    //!
+    //! \brief Map the data file at path and parse its index.
+    //!
+    //! Entries after the first one whose payload extends past the end of the data file are dropped, since the dump
+    //! stopped while writing it. A malformed entry, or one whose payload size does not match its type and shape,
+    //! is an error.
+    //!
+    //! \return True on success. On failure, err describes the problem.
+    //!
+    bool open(std::string const& path, std::string& err);
+
+    std::vector<ContainerTensor> const& tensors() const
+    {
+        return mTensors;
+    }
+
+    //! \return The entry of the given dump of a tensor, or nullptr if there is none. Constant time on average.
+    ContainerTensor const* find(std::string const& name, int32_t iteration = 0) const;
+
+    //! \return The payload of a tensor, pointing into the mapped data file.
+    void const* data(ContainerTensor const& tensor) const
+    {
+        return static_cast<char const*>(mFile.data()) + tensor.offset;
+    }
+
+private:
+    using Key = std::pair<std::string, int32_t>;
+
+    struct KeyHash
+    {
+        size_t operator()(Key const& key) const noexcept
+        {
+            return std::hash<std::string>{}(key.first) ^ (static_cast<size_t>(key.second) * 0x9E3779B97F4A7C15ULL);
+        }
+    };
+
+    MappedFile mFile;
+    std::vector<ContainerTensor> mTensors;
+    std::unordered_map<Key, size_t, KeyHash> mIndex; //!< Position in mTensors of each (name, iteration)
+};
+
+} // namespace sample
+
+#endif // TENSORRT_DEBUG_TENSOR_READER_H
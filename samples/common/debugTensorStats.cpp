@@ -0,0 +1,506 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "debugTensorStats.h"
+#include "common.h"
+#include "sampleUtils.h"
+#include "utils/hostSimd.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if CUDA_VERSION >= 11060
+#include <cuda_fp8.h>
+#endif
+#if CUDA_VERSION >= 12070
+#include <cuda_fp4.h>
+#endif
+
+using namespace nvinfer1;
+using nvinfer1::utils::HostSimdLevel;
+
+namespace sample
+{
+
+namespace
+{
+
+//! Elements per block. Blocks are the unit of work of the threads and of the canonical summation order.
+constexpr int64_t kBLOCK{4096};
+
+//! Interleaved accumulators per block: element i of a block is accumulated in lane i % kLANES.
+constexpr int32_t kLANES{16};
+
+//! Minimum number of blocks per thread.
+constexpr int64_t kMIN_BLOCKS_PER_THREAD{64};
+
+struct FloatPartial
+{
+    double sum{0.0};
+    float min{std::numeric_limits<float>::max()};
+    float max{std::numeric_limits<float>::lowest()};
+    int64_t nbNaN{0};
+    int64_t nbInf{0};
+};
+
+struct IntPartial
+{
+    int64_t sum{0};
+    int64_t min{std::numeric_limits<int64_t>::max()};
+    int64_t max{std::numeric_limits<int64_t>::lowest()};
+};
+
+//! Min and max keep the current value unless the new one compares strictly less (greater), so NaN is ignored.
+inline float minOf(float acc, float v)
+{
+    return v < acc ? v : acc;
+}
+
+inline float maxOf(float acc, float v)
+{
+    return acc < v ? v : acc;
+}
+
+//! Reduce the lanes of a block in a fixed pairwise order.
+FloatPartial reduceLanes(
+    std::array<double, kLANES> sums, std::array<float, kLANES> const& mins, std::array<float, kLANES> const& maxs)
+{
+    FloatPartial partial;
+    for (int32_t width = kLANES / 2; width > 0; width /= 2)
+    {
+        for (int32_t k = 0; k < width; ++k)
+        {
+            sums[k] = sums[2 * k] + sums[2 * k + 1];
+        }
+    }
+    partial.sum = sums[0];
+    for (int32_t k = 0; k < kLANES; ++k)
+    {
+        partial.min = minOf(partial.min, mins[k]);
+        partial.max = maxOf(partial.max, maxs[k]);
+    }
+    return partial;
+}
+
+//! Accumulate elements [begin, n) of a block, which do not fill all lanes, and reduce the lanes.
+FloatPartial finishBlock(float const* x, int64_t begin, int64_t n, std::array<double, kLANES>& sums,
+    std::array<float, kLANES>& mins, std::array<float, kLANES>& maxs, int64_t nbNaN, int64_t nbInf)
+{
+    for (int64_t i = begin; i < n; ++i)
+    {
+        int32_t const k = static_cast<int32_t>(i % kLANES);
+        float const v = x[i];
+        sums[k] += v;
+        mins[k] = minOf(mins[k], v);
+        maxs[k] = maxOf(maxs[k], v);
+        nbNaN += std::isnan(v) ? 1 : 0;
+        nbInf += std::isinf(v) ? 1 : 0;
+    }
+    FloatPartial partial = reduceLanes(sums, mins, maxs);
+    partial.nbNaN = nbNaN;
+    partial.nbInf = nbInf;
+    return partial;
+}
+
+//! Portable block kernel. It defines the summation order that the SIMD kernels reproduce.
+FloatPartial accumulateBlockScalar(float const* x, int64_t n)
+{
+    std::array<double, kLANES> sums{};
+    std::array<float, kLANES> mins;
+    std::array<float, kLANES> maxs;
+    mins.fill(std::numeric_limits<float>::max());
+    maxs.fill(std::numeric_limits<float>::lowest());
+    int64_t nbNaN{0};
+    int64_t nbInf{0};
+    int64_t i = 0;
+    for (; i + kLANES <= n; i += kLANES)
+    {
+        for (int32_t k = 0; k < kLANES; ++k)
+        {
+            float const v = x[i + k];
+            sums[k] += v;
+            mins[k] = minOf(mins[k], v);
+            maxs[k] = maxOf(maxs[k], v);
+            nbNaN += std::isnan(v) ? 1 : 0;
+            nbInf += std::isinf(v) ? 1 : 0;
+        }
+    }
+    return finishBlock(x, i, n, sums, mins, maxs, nbNaN, nbInf);
+}
+
+//! Exact conversion of IEEE half bits to float, matching the F16C instructions.
+float halfBitsToFloat(uint16_t h)
+{
+    uint32_t const sign = static_cast<uint32_t>(h & 0x8000U) << 16;
+    uint32_t const exponent = (h >> 10) & 0x1FU;
+    uint32_t mantissa = h & 0x3FFU;
+    uint32_t bits{};
+    if (exponent == 0x1FU)
+    {
+        bits = sign | 0x7F800000U | (mantissa << 13);
+    }
+    else if (exponent != 0)
+    {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+    else if (mantissa == 0)
+    {
+        bits = sign;
+    }
+    else
+    {
+        // Normalize the subnormal half.
+        uint32_t e = 113;
+        while ((mantissa & 0x400U) == 0)
+        {
+            mantissa <<= 1;
+            --e;
+        }
+        bits = sign | (e << 23) | ((mantissa & 0x3FFU) << 13);
+    }
+    float f{};
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+#if TRT_HOST_X86_SIMD
+
+__attribute__((target("avx2"))) inline int64_t countSpecial(__m256 v, __m256 absMask, __m256 inf, int64_t& nbInf)
+{
+    nbInf += __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_and_ps(v, absMask), inf, _CMP_EQ_OQ)));
+    return __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(v, v, _CMP_UNORD_Q)));
+}
+
+__attribute__((target("avx2"))) FloatPartial accumulateBlockAvx2(float const* x, int64_t n)
+{
+    // Lanes 0-3, 4-7, 8-11 and 12-15 of the sum, and lanes 0-7 and 8-15 of min and max.
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+    __m256d s2 = _mm256_setzero_pd();
+    __m256d s3 = _mm256_setzero_pd();
+    __m256 mn0 = _mm256_set1_ps(std::numeric_limits<float>::max());
+    __m256 mn1 = mn0;
+    __m256 mx0 = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+    __m256 mx1 = mx0;
+    __m256 const absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+    __m256 const inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+    int64_t nbNaN{0};
+    int64_t nbInf{0};
+
+    int64_t i = 0;
+    for (; i + kLANES <= n; i += kLANES)
+    {
+        __m256 const v0 = _mm256_loadu_ps(x + i);
+        __m256 const v1 = _mm256_loadu_ps(x + i + 8);
+        s0 = _mm256_add_pd(s0, _mm256_cvtps_pd(_mm256_castps256_ps128(v0)));
+        s1 = _mm256_add_pd(s1, _mm256_cvtps_pd(_mm256_extractf128_ps(v0, 1)));
+        s2 = _mm256_add_pd(s2, _mm256_cvtps_pd(_mm256_castps256_ps128(v1)));
+        s3 = _mm256_add_pd(s3, _mm256_cvtps_pd(_mm256_extractf128_ps(v1, 1)));
+        // min_ps(a, b) returns b unless a < b, which matches minOf(b, a) including for NaN.
+        mn0 = _mm256_min_ps(v0, mn0);
+        mn1 = _mm256_min_ps(v1, mn1);
+        mx0 = _mm256_max_ps(v0, mx0);
+        mx1 = _mm256_max_ps(v1, mx1);
+        nbNaN += countSpecial(v0, absMask, inf, nbInf) + countSpecial(v1, absMask, inf, nbInf);
+    }
+
+    std::array<double, kLANES> sums;
+    std::array<float, kLANES> mins;
+    std::array<float, kLANES> maxs;
+    _mm256_storeu_pd(sums.data(), s0);
+    _mm256_storeu_pd(sums.data() + 4, s1);
+    _mm256_storeu_pd(sums.data() + 8, s2);
+    _mm256_storeu_pd(sums.data() + 12, s3);
+    _mm256_storeu_ps(mins.data(), mn0);
+    _mm256_storeu_ps(mins.data() + 8, mn1);
+    _mm256_storeu_ps(maxs.data(), mx0);
+    _mm256_storeu_ps(maxs.data() + 8, mx1);
+    return finishBlock(x, i, n, sums, mins, maxs, nbNaN, nbInf);
+}
+
+__attribute__((target("avx512f"))) FloatPartial accumulateBlockAvx512(float const* x, int64_t n)
+{
+    // Lanes 0-7 and 8-15 of the sum, and lanes 0-15 of min and max.
+    __m512d s0 = _mm512_setzero_pd();
+    __m512d s1 = _mm512_setzero_pd();
+    __m512 mn = _mm512_set1_ps(std::numeric_limits<float>::max());
+    __m512 mx = _mm512_set1_ps(std::numeric_limits<float>::lowest());
+    __m512 const inf = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+    int64_t nbNaN{0};
+    int64_t nbInf{0};
+
+    int64_t i = 0;
+    for (; i + kLANES <= n; i += kLANES)
+    {
+        __m512 const v = _mm512_loadu_ps(x + i);
+        s0 = _mm512_add_pd(s0, _mm512_cvtps_pd(_mm512_castps512_ps256(v)));
+        s1 = _mm512_add_pd(s1, _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1))));
+        mn = _mm512_min_ps(v, mn);
+        mx = _mm512_max_ps(v, mx);
+        nbNaN += __builtin_popcount(_mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q));
+        nbInf += __builtin_popcount(_mm512_cmp_ps_mask(_mm512_abs_ps(v), inf, _CMP_EQ_OQ));
+    }
+
+    std::array<double, kLANES> sums;
+    std::array<float, kLANES> mins;
+    std::array<float, kLANES> maxs;
+    _mm512_storeu_pd(sums.data(), s0);
+    _mm512_storeu_pd(sums.data() + 8, s1);
+    _mm512_storeu_ps(mins.data(), mn);
+    _mm512_storeu_ps(maxs.data(), mx);
+    return finishBlock(x, i, n, sums, mins, maxs, nbNaN, nbInf);
+}
+
+__attribute__((target("avx2,f16c"))) void convertHalfF16c(uint16_t const* src, int64_t n, float* dst)
+{
+    int64_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i))));
+    }
+    for (; i < n; ++i)
+    {
+        dst[i] = halfBitsToFloat(src[i]);
+    }
+}
+
+#endif // TRT_HOST_X86_SIMD
+
+FloatPartial accumulateBlock(float const* x, int64_t n, HostSimdLevel level)
+{
+#if TRT_HOST_X86_SIMD
+    switch (level)
+    {
+    case HostSimdLevel::kAVX512: return accumulateBlockAvx512(x, n);
+    case HostSimdLevel::kAVX2: return accumulateBlockAvx2(x, n);
+    case HostSimdLevel::kSCALAR: break;
+    }
+#endif
+    return accumulateBlockScalar(x, n);
+}
+
+//! Lookup table converting every value of an 8-bit (or packed 4-bit) floating point type to float.
+template <size_t N, typename F>
+std::array<float, N> makeTable(F&& convert)
+{
+    std::array<float, N> table{};
+    for (size_t i = 0; i < N; ++i)
+    {
+        table[i] = convert(static_cast<uint8_t>(i));
+    }
+    return table;
+}
+
+//! Convert elements [begin, begin + n) of a floating point tensor other than kFLOAT to float.
+void convertToFloat(void const* data, DataType type, int64_t begin, int64_t n, float* dst, HostSimdLevel level)
+{
+    switch (type)
+    {
+    case DataType::kHALF:
+    {
+        auto const* src = static_cast<uint16_t const*>(data) + begin;
+#if TRT_HOST_X86_SIMD
+        if (level != HostSimdLevel::kSCALAR)
+        {
+            convertHalfF16c(src, n, dst);
+            return;
+        }
+#endif
+        std::transform(src, src + n, dst, halfBitsToFloat);
+        break;
+    }
+    case DataType::kBF16:
+    {
+        auto const* src = static_cast<uint16_t const*>(data) + begin;
+        for (int64_t i = 0; i < n; ++i)
+        {
+            uint32_t const bits = static_cast<uint32_t>(src[i]) << 16;
+            std::memcpy(dst + i, &bits, sizeof(float));
+        }
+        break;
+    }
+    case DataType::kFP8:
+    {
+#if CUDA_VERSION >= 11060
+        static auto const kTABLE = makeTable<256>([](uint8_t bits) {
+            __nv_fp8_e4m3 v;
+            std::memcpy(&v, &bits, sizeof(bits));
+            return static_cast<float>(v);
+        });
+        auto const* src = static_cast<uint8_t const*>(data) + begin;
+        for (int64_t i = 0; i < n; ++i)
+        {
+            dst[i] = kTABLE[src[i]];
+        }
+#endif
+        break;
+    }
+    case DataType::kFP4:
+    {
+#if CUDA_VERSION >= 12070
+        static auto const kTABLE = makeTable<16>([](uint8_t bits) {
+            __nv_fp4_e2m1 v;
+            std::memcpy(&v, &bits, sizeof(bits));
+            return static_cast<float>(v);
+        });
+        auto const* src = static_cast<uint8_t const*>(data);
+        for (int64_t i = 0; i < n; ++i)
+        {
+            int64_t const e = begin + i;
+            dst[i] = kTABLE[(src[e / 2] >> ((e % 2) * 4)) & 0xF];
+        }
+#endif
+        break;
+    }
+    default: break;
+    }
+}
+
+//! Reduce integer elements [begin, end) of a tensor. The reduction is exact, so its order does not matter.
+IntPartial reduceIntRange(void const* data, DataType type, int64_t begin, int64_t end)
+{
+    IntPartial partial;
+    auto reduce = [&](auto const* src) {
+        int64_t sum{0};
+        int64_t mn = partial.min;
+        int64_t mx = partial.max;
+        for (int64_t i = begin; i < end; ++i)
+        {
+            int64_t const v = static_cast<int64_t>(src[i]);
+            sum += v;
+            mn = std::min(mn, v);
+            mx = std::max(mx, v);
+        }
+        partial.sum = sum;
+        partial.min = mn;
+        partial.max = mx;
+    };
+    switch (type)
+    {
+    case DataType::kBOOL: reduce(static_cast<bool const*>(data)); break;
+    case DataType::kINT8: reduce(static_cast<int8_t const*>(data)); break;
+    case DataType::kUINT8: reduce(static_cast<uint8_t const*>(data)); break;
+    case DataType::kINT32: reduce(static_cast<int32_t const*>(data)); break;
+    case DataType::kINT64: reduce(static_cast<int64_t const*>(data)); break;
+    case DataType::kINT4:
+    {
+        auto const* src = static_cast<uint8_t const*>(data);
+        for (int64_t i = begin; i < end; ++i)
+        {
+            // Sign-extend the nibble.
+            int64_t const v = static_cast<int8_t>(static_cast<uint8_t>(src[i / 2] >> ((i % 2) * 4)) << 4) >> 4;
+            partial.sum += v;
+            partial.min = std::min(partial.min, v);
+            partial.max = std::max(partial.max, v);
+        }
+        break;
+    }
+    default: break;
+    }
+    return partial;
+}
+
+bool isSupportedFloatType(DataType type)
+{
+    switch (type)
+    {
+    case DataType::kFLOAT:
+    case DataType::kHALF:
+    case DataType::kBF16: return true;
+    case DataType::kFP8: return CUDA_VERSION >= 11060;
+    case DataType::kFP4: return CUDA_VERSION >= 12070;
+    default: return false;
+    }
+}
+
+bool isIntegerType(DataType type)
+{
+    return type == DataType::kBOOL || type == DataType::kINT4 || type == DataType::kINT8 || type == DataType::kUINT8
+        || type == DataType::kINT32 || type == DataType::kINT64;
+}
+
+} // namespace
+
+bool computeTensorStatistics(
+    void const* data, DataType type, int64_t volume, TensorStatistics& stats, int32_t nbThreads)
+{
+    stats = TensorStatistics{};
+    int64_t const nbBlocks = samplesCommon::divUp(volume, kBLOCK);
+
+    if (isIntegerType(type))
+    {
+        std::vector<IntPartial> partials(nbBlocks);
+        parallelFor(nbBlocks, kMIN_BLOCKS_PER_THREAD, nbThreads, [&](int64_t blockBegin, int64_t blockEnd) {
+            for (int64_t b = blockBegin; b < blockEnd; ++b)
+            {
+                partials[b] = reduceIntRange(data, type, b * kBLOCK, std::min((b + 1) * kBLOCK, volume));
+            }
+        });
+        for (auto const& p : partials)
+        {
+            stats.intSum += p.sum;
+            stats.intMin = std::min(stats.intMin, p.min);
+            stats.intMax = std::max(stats.intMax, p.max);
+        }
+        return true;
+    }
+
+    if (!isSupportedFloatType(type))
+    {
+        return false;
+    }
+
+    stats.isFloatingPoint = true;
+    HostSimdLevel const level = utils::getHostSimdLevel();
+    std::vector<FloatPartial> partials(nbBlocks);
+    parallelFor(nbBlocks, kMIN_BLOCKS_PER_THREAD, nbThreads, [&](int64_t blockBegin, int64_t blockEnd) {
+        std::vector<float> converted(type == DataType::kFLOAT ? 0 : kBLOCK);
+        for (int64_t b = blockBegin; b < blockEnd; ++b)
+        {
+            int64_t const begin = b * kBLOCK;
+            int64_t const n = std::min(kBLOCK, volume - begin);
+            float const* x = static_cast<float const*>(data) + begin;
+            if (type != DataType::kFLOAT)
+            {
+                convertToFloat(data, type, begin, n, converted.data(), level);
+                x = converted.data();
+            }
+            partials[b] = accumulateBlock(x, n, level);
+        }
+    });
+
+    // Block sums are added in block order, independently of how the blocks were split across threads.
+    for (auto const& p : partials)
+    {
+        stats.sum += p.sum;
+        stats.min = minOf(stats.min, p.min);
+        stats.max = maxOf(stats.max, p.max);
+        stats.nbNaN += p.nbNaN;
+        stats.nbInf += p.nbInf;
+    }
+    // The payload of a NaN sum depends on the instructions that produced it.
+    if (std::isnan(stats.sum))
+    {
+        stats.sum = std::numeric_limits<double>::quiet_NaN();
+    }
+    return true;
+}
+
+} // namespace sample
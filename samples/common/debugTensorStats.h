@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TENSORRT_DEBUG_TENSOR_STATS_H
+#define TENSORRT_DEBUG_TENSOR_STATS_H
+
+#include "NvInferRuntime.h"
+#include <cstdint>
+#include <limits>
+
+namespace sample
+{
+
+//!
+//! \brief Summary statistics of a tensor.
+//!
+//! Floating point tensors are reduced in float (min, max) and double (sum) after conversion to float. Integer and
+//! boolean tensors are reduced in int64_t.
+//!
+struct TensorStatistics
+{
+    bool isFloatingPoint{false};
+    float min{std::numeric_limits<float>::max()};
+    float max{std::numeric_limits<float>::lowest()};
+    double sum{0.0};
+    int64_t nbNaN{0}; //!< Number of NaN elements, floating point tensors only
+    int64_t nbInf{0}; //!< Number of infinite elements, floating point tensors only
+    int64_t intMin{std::numeric_limits<int64_t>::max()};
+    int64_t intMax{std::numeric_limits<int64_t>::lowest()};
+    int64_t intSum{0};
+};
+
+//!
+//! \brief Compute the statistics of a host tensor.
+//!
+//! The floating point sum is accumulated in a fixed order: elements are split in blocks, each block is summed in
+//! interleaved lanes whose partial sums are added pairwise, and the block sums are added in block order. The SIMD
+//! kernels and the portable fallback follow that order, so the result is bit-identical whatever the instruction set
+//! and the number of threads. The instruction set is selected by nvinfer1::utils::getHostSimdLevel(), and can be
+//! restricted with nvinfer1::utils::setMaxHostSimdLevel().
+//!
+//! Packed INT4 and FP4 tensors store the element with the lower index in the low nibble of each byte.
+//!
+//! \param nbThreads Number of threads for large tensors; 0 selects the number of hardware threads.
+//!
+//! \return False if statistics are not supported for the data type.
+//!
+bool computeTensorStatistics(
+    void const* data, nvinfer1::DataType type, int64_t volume, TensorStatistics& stats, int32_t nbThreads = 0);
+
+} // namespace sample
+
+#endif // TENSORRT_DEBUG_TENSOR_STATS_H
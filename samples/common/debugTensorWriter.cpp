@@ -17,7 +17,10 @@
 
 #include "debugTensorWriter.h"
 #include "common.h"
+#include "debugTensorReader.h"
+#include "debugTensorStats.h"
 #include <algorithm>
+#include <array>
 #include <cuda_bf16.h>
 #include <cuda_fp16.h>
 #if CUDA_VERSION >= 11060
@@ -26,8 +29,14 @@
 #if CUDA_VERSION >= 12070
 #include <cuda_fp4.h>
 #endif
+#include <chrono>
+#include <condition_variable>
 #include <cuda_runtime_api.h>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <numeric>
+#include <thread>
 namespace sample
 {
 
@@ -288,24 +297,14 @@ void printTensorElements(T const* data, int64_t volume, std::ofstream& f)
 }
 
 template <typename T>
-void processTensorSummary(void const* addr_host, int64_t volume, std::ofstream& f)
+void processTensorSummary(void const* addr_host, nvinfer1::DataType type, int64_t volume, std::ofstream& f)
 {
-    DataRange<T> range(addr_host, volume);
+    TensorStatistics stats;
+    computeTensorStatistics(addr_host, type, volume, stats);
 
     if constexpr (isFloatingPoint<T>)
     {
-        float minVal = std::numeric_limits<float>::max();
-        float maxVal = std::numeric_limits<float>::lowest();
-        double sum = 0.0;
-
-        for (auto value : range)
-        {
-            float val = static_cast<float>(value);
-            minVal = std::min(minVal, val);
-            maxVal = std::max(maxVal, val);
-            sum += val;
-        }
-        float avgVal = sum / volume;
+        float avgVal = stats.sum / volume;
 
         // nan and inf turn into string in json
         auto valueToStr = [](float val) -> std::string {
@@ -320,28 +319,18 @@ void processTensorSummary(void const* addr_host, int64_t volume, std::ofstream&
             }
             return ss.str();
         };
-        f << "        \"min\": " << valueToStr(minVal) << "," << std::endl;
-        f << "        \"max\": " << valueToStr(maxVal) << "," << std::endl;
+        f << "        \"min\": " << valueToStr(stats.min) << "," << std::endl;
+        f << "        \"max\": " << valueToStr(stats.max) << "," << std::endl;
         f << "        \"avg\": " << valueToStr(avgVal) << "," << std::endl;
+        f << "        \"nan_count\": " << stats.nbNaN << "," << std::endl;
+        f << "        \"inf_count\": " << stats.nbInf << "," << std::endl;
     }
     else
     {
-        // For integer types, use int64_t for min/max calculation
-        int64_t minVal = std::numeric_limits<int64_t>::max();
-        int64_t maxVal = std::numeric_limits<int64_t>::lowest();
-        int64_t sum = 0;
-
-        for (auto value : range)
-        {
-            int64_t val = static_cast<int64_t>(value);
-            minVal = std::min(minVal, val);
-            maxVal = std::max(maxVal, val);
-            sum += val;
-        }
-        double avgVal = static_cast<double>(sum) / volume;
+        double avgVal = static_cast<double>(stats.intSum) / volume;
 
-        f << "        \"min\": " << minVal << "," << std::endl;
-        f << "        \"max\": " << maxVal << "," << std::endl;
+        f << "        \"min\": " << stats.intMin << "," << std::endl;
+        f << "        \"max\": " << stats.intMax << "," << std::endl;
         f << "        \"avg\": " << avgVal << "," << std::endl;
     }
 
@@ -566,8 +555,245 @@ std::vector<U> convertBufferTo(T const* data, int64_t volume)
 
 } // namespace
 
+//!
+//! \brief Bounded queue of debug tensors staged in pinned host memory, drained by a writer thread.
+//!
+//! Staging buffers are pooled and reused. Their capacities are rounded up to a power of two so that tensors of
+//! similar sizes share buffers. When the queue or the pool is full, push() either blocks until the writer thread
+//! catches up or drops the tensor, and both are counted in the statistics reported on destruction.
+//!
+class AsyncDebugTensorQueue
+{
+public:
+    //! Called on the writer thread with the host copy of a tensor.
+    using Consumer = std::function<void(void const* addrHost, nvinfer1::DataType type, nvinfer1::Dims const& shape,
+        int64_t volume, std::string const& name, int32_t tensorIndex)>;
+
+    AsyncDebugTensorQueue(DebugTensorAsyncOptions const& options, Consumer consumer)
+        : mOptions(options)
+        , mConsumer(std::move(consumer))
+    {
+        mWriter = std::thread(&AsyncDebugTensorQueue::run, this);
+    }
+
+    ~AsyncDebugTensorQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mNotEmpty.notify_one();
+        mWriter.join();
+
+        for (auto const& buffer : mFreeBuffers)
+        {
+            CHECK(cudaFreeHost(buffer.data));
+        }
+        for (auto event : mFreeEvents)
+        {
+            CHECK(cudaEventDestroy(event));
+        }
+
+        sample::gLogInfo << "Asynchronous debug tensor dump: " << mNbWritten << " tensors written, " << mNbDropped
+                         << " dropped, max queue depth " << mMaxQueued << ", callback blocked for " << mBlockedMs
+                         << " ms, peak staging memory " << (mPeakAllocatedBytes >> 20) << " MiB." << std::endl;
+        if (mNbDropped > 0)
+        {
+            sample::gLogWarning << mNbDropped << " debug tensors were dropped because the dump queue was full. "
+                                << "Increase --debugTensorQueueDepth or --debugTensorStagingSize to keep them."
+                                << std::endl;
+        }
+    }
+
+    AsyncDebugTensorQueue(AsyncDebugTensorQueue const&) = delete;
+    AsyncDebugTensorQueue& operator=(AsyncDebugTensorQueue const&) = delete;
+
+    //!
+    //! \brief Enqueue the copy of a tensor into a staging buffer on stream.
+    //!
+    //! \return False if the tensor was dropped.
+    //!
+    bool push(void const* addr, bool onDevice, nvinfer1::DataType type, nvinfer1::Dims const& shape, int64_t volume,
+        int64_t size, std::string const& name, int32_t tensorIndex, cudaStream_t stream)
+    {
+        Job job{name, type, shape, volume, tensorIndex, {}, nullptr};
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            if (!acquire(static_cast<size_t>(size), job, lock))
+            {
+                ++mNbDropped;
+                return false;
+            }
+        }
+
+        // Host tensors are copied in stream order too, since they may be produced by work still in the stream.
+        CHECK(cudaMemcpyAsync(
+            job.buffer.data, addr, size, onDevice ? cudaMemcpyDeviceToHost : cudaMemcpyHostToHost, stream));
+        CHECK(cudaEventRecord(job.copied, stream));
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mJobs.push_back(std::move(job));
+            mMaxQueued = std::max(mMaxQueued, mJobs.size());
+        }
+        mNotEmpty.notify_one();
+        return true;
+    }
+
+private:
+    struct Buffer
+    {
+        void* data{nullptr};
+        size_t capacity{0};
+    };
+
+    struct Job
+    {
+        std::string name;
+        nvinfer1::DataType type;
+        nvinfer1::Dims shape;
+        int64_t volume;
+        int32_t tensorIndex;
+        Buffer buffer;
+        cudaEvent_t copied;
+    };
+
+    static constexpr size_t kMIN_BUFFER_SIZE{size_t{64} << 10};
+
+    static size_t roundUpCapacity(size_t size)
+    {
+        size_t capacity = kMIN_BUFFER_SIZE;
+        while (capacity < size)
+        {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    //! Get a staging buffer and an event for job, waiting for the writer thread unless tensors may be dropped.
+    bool acquire(size_t size, Job& job, std::unique_lock<std::mutex>& lock)
+    {
+        size_t const capacity = roundUpCapacity(size);
+        size_t const stagingBytes = static_cast<size_t>(std::max(mOptions.stagingBytes, int64_t{0}));
+        auto const waitStart = std::chrono::steady_clock::now();
+        bool waited{false};
+        while (true)
+        {
+            if (mJobs.size() < static_cast<size_t>(std::max(mOptions.queueDepth, 1)))
+            {
+                // Best fit among the free buffers.
+                auto best = mFreeBuffers.end();
+                for (auto it = mFreeBuffers.begin(); it != mFreeBuffers.end(); ++it)
+                {
+                    if (it->capacity >= size && (best == mFreeBuffers.end() || it->capacity < best->capacity))
+                    {
+                        best = it;
+                    }
+                }
+                if (best != mFreeBuffers.end())
+                {
+                    job.buffer = *best;
+                    mFreeBuffers.erase(best);
+                    break;
+                }
+
+                // Release free buffers that are too small until the new one fits in the pool. A tensor larger than
+                // the whole pool is still staged once nothing else is in flight.
+                while (mAllocatedBytes + capacity > stagingBytes && !mFreeBuffers.empty())
+                {
+                    mAllocatedBytes -= mFreeBuffers.back().capacity;
+                    CHECK(cudaFreeHost(mFreeBuffers.back().data));
+                    mFreeBuffers.pop_back();
+                }
+                if (mAllocatedBytes + capacity <= stagingBytes || mAllocatedBytes == 0)
+                {
+                    CHECK(cudaMallocHost(&job.buffer.data, capacity));
+                    job.buffer.capacity = capacity;
+                    mAllocatedBytes += capacity;
+                    mPeakAllocatedBytes = std::max(mPeakAllocatedBytes, mAllocatedBytes);
+                    break;
+                }
+            }
+
+            if (mOptions.dropWhenFull)
+            {
+                return false;
+            }
+            waited = true;
+            mSpaceAvailable.wait(lock);
+        }
+
+        if (waited)
+        {
+            mBlockedMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - waitStart)
+                              .count();
+        }
+
+        if (mFreeEvents.empty())
+        {
+            CHECK(cudaEventCreateWithFlags(&job.copied, cudaEventDisableTiming));
+        }
+        else
+        {
+            job.copied = mFreeEvents.back();
+            mFreeEvents.pop_back();
+        }
+        return true;
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mNotEmpty.wait(lock, [this] { return mStop || !mJobs.empty(); });
+                if (mJobs.empty())
+                {
+                    return;
+                }
+                job = std::move(mJobs.front());
+                mJobs.pop_front();
+            }
+
+            CHECK(cudaEventSynchronize(job.copied));
+            mConsumer(job.buffer.data, job.type, job.shape, job.volume, job.name, job.tensorIndex);
+
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mFreeBuffers.push_back(job.buffer);
+                mFreeEvents.push_back(job.copied);
+                ++mNbWritten;
+            }
+            mSpaceAvailable.notify_all();
+        }
+    }
+
+    DebugTensorAsyncOptions mOptions;
+    Consumer mConsumer;
+
+    std::mutex mMutex;
+    std::condition_variable mNotEmpty;       //!< Signals the writer thread that a job was queued or it should stop
+    std::condition_variable mSpaceAvailable; //!< Signals blocked callbacks that a job was written
+    std::deque<Job> mJobs;
+    std::vector<Buffer> mFreeBuffers;
+    std::vector<cudaEvent_t> mFreeEvents;
+    size_t mAllocatedBytes{0};
+    bool mStop{false};
+
+    int64_t mNbWritten{0};
+    int64_t mNbDropped{0};
+    size_t mMaxQueued{0};
+    size_t mPeakAllocatedBytes{0};
+    double mBlockedMs{0.0};
+
+    std::thread mWriter;
+};
+
 DebugTensorWriter::DebugTensorWriter(std::unordered_map<std::string, std::string> const& debugTensorFileNames,
-    std::vector<std::string> const& debugTensorFormats, std::string const& engineName, std::string const& cmdline)
+    std::vector<std::string> const& debugTensorFormats, std::string const& engineName, std::string const& cmdline,
+    DebugTensorAsyncOptions const& asyncOptions)
     : mDebugTensorFileNames(debugTensorFileNames)
     , mDebugTensorFormats(debugTensorFormats)
     , mEngineName(engineName)
@@ -588,10 +814,27 @@ DebugTensorWriter::DebugTensorWriter(std::unordered_map<std::string, std::string
             sample::gLogError << "Failed to open tensor summary file: " << mSummaryFileName << std::endl;
         }
     }
+
+    if (std::find(mDebugTensorFormats.begin(), mDebugTensorFormats.end(), "container") != mDebugTensorFormats.end())
+    {
+        openContainer();
+    }
+
+    if (asyncOptions.enabled)
+    {
+        sample::gLogInfo << "Dumping debug tensors asynchronously." << std::endl;
+        mAsyncQueue = std::make_unique<AsyncDebugTensorQueue>(asyncOptions,
+            [this](void const* addrHost, nvinfer1::DataType type, nvinfer1::Dims const& shape, int64_t volume,
+                std::string const& name,
+                int32_t tensorIndex) { writeDebugTensor(addrHost, type, shape, volume, name, tensorIndex); });
+    }
 }
 
 DebugTensorWriter::~DebugTensorWriter()
 {
+    // Write the tensors still in flight before closing the summary.
+    mAsyncQueue.reset();
+
     // Close the summary file
     if (mSummaryFile.is_open())
     {
@@ -600,6 +843,65 @@ DebugTensorWriter::~DebugTensorWriter()
     }
 }
 
+void DebugTensorWriter::openContainer()
+{
+    std::string const indexFileName
+        = std::string(kDEBUG_TENSOR_CONTAINER_FILE_NAME) + kDEBUG_TENSOR_CONTAINER_INDEX_SUFFIX;
+    mContainerFile.open(kDEBUG_TENSOR_CONTAINER_FILE_NAME, std::ios::out | std::ios::binary);
+    mContainerIndex.open(indexFileName, std::ios::out);
+    if (!mContainerFile || !mContainerIndex)
+    {
+        sample::gLogError << "Failed to open debug tensor container: " << kDEBUG_TENSOR_CONTAINER_FILE_NAME
+                          << std::endl;
+        mContainerFile.close();
+        mContainerIndex.close();
+        return;
+    }
+    sample::gLogInfo << "Writing debug tensors to container: " << kDEBUG_TENSOR_CONTAINER_FILE_NAME << std::endl;
+
+    std::array<char, kDEBUG_TENSOR_CONTAINER_ALIGNMENT> header{};
+    std::copy_n(kDEBUG_TENSOR_CONTAINER_MAGIC, sizeof(kDEBUG_TENSOR_CONTAINER_MAGIC) - 1, header.begin());
+    mContainerFile.write(header.data(), header.size());
+    mContainerOffset = header.size();
+}
+
+void DebugTensorWriter::writeContainerEntry(
+    void const* addrHost, nvinfer1::DataType type, nvinfer1::Dims const& shape, int64_t size, std::string const& name)
+{
+    static constexpr std::array<char, kDEBUG_TENSOR_CONTAINER_ALIGNMENT> kPADDING{};
+    uint64_t const offset = mContainerOffset;
+    uint64_t const padding = (kDEBUG_TENSOR_CONTAINER_ALIGNMENT - size % kDEBUG_TENSOR_CONTAINER_ALIGNMENT)
+        % kDEBUG_TENSOR_CONTAINER_ALIGNMENT;
+    mContainerFile.write(static_cast<char const*>(addrHost), size);
+    mContainerFile.write(kPADDING.data(), padding);
+    mContainerOffset += size + padding;
+
+    mContainerIndex << offset << '\t' << size << '\t' << mContainerIterations[name]++ << '\t'
+                    << getDataTypeString(type) << '\t';
+    for (int32_t i = 0; i < shape.nbDims; ++i)
+    {
+        mContainerIndex << (i > 0 ? "x" : "") << shape.d[i];
+    }
+    mContainerIndex << '\t';
+    // Escape the characters that would split the line or its fields; the reader reverses this.
+    for (char c : name)
+    {
+        switch (c)
+        {
+        case '\\': mContainerIndex << "\\\\"; break;
+        case '\n': mContainerIndex << "\\n"; break;
+        case '\r': mContainerIndex << "\\r"; break;
+        case '\t': mContainerIndex << "\\t"; break;
+        default: mContainerIndex << c; break;
+        }
+    }
+    mContainerIndex << '\n';
+
+    // Flush the payload before its index entry, so that an interrupted run still leaves a readable container.
+    mContainerFile.flush();
+    mContainerIndex.flush();
+}
+
 void DebugTensorWriter::writeSummaryHeader()
 {
     mSummaryFile << "{" << std::endl;
@@ -651,15 +953,15 @@ void DebugTensorWriter::writeSummary(std::string_view name, nvinfer1::Dims const
 
     switch (type)
     {
-    case nvinfer1::DataType::kBOOL: processTensorSummary<bool>(addr_host, volume, mSummaryFile); break;
-    case nvinfer1::DataType::kINT4: processTensorSummary<Int4x2>(addr_host, volume, mSummaryFile); break;
-    case nvinfer1::DataType::kINT8: processTensorSummary<int8_t>(addr_host, volume, mSummaryFile); break;
-    case nvinfer1::DataType::kINT32: processTensorSummary<int32_t>(addr_host, volume, mSummaryFile); break;
-    case nvinfer1::DataType::kINT64: processTensorSummary<int64_t>(addr_host, volume, mSummaryFile); break;
-    case nvinfer1::DataType::kUINT8: processTensorSummary<uint8_t>(addr_host, volume, mSummaryFile); break;
+    case nvinfer1::DataType::kBOOL: processTensorSummary<bool>(addr_host, type, volume, mSummaryFile); break;
+    case nvinfer1::DataType::kINT4: processTensorSummary<Int4x2>(addr_host, type, volume, mSummaryFile); break;
+    case nvinfer1::DataType::kINT8: processTensorSummary<int8_t>(addr_host, type, volume, mSummaryFile); break;
+    case nvinfer1::DataType::kINT32: processTensorSummary<int32_t>(addr_host, type, volume, mSummaryFile); break;
+    case nvinfer1::DataType::kINT64: processTensorSummary<int64_t>(addr_host, type, volume, mSummaryFile); break;
+    case nvinfer1::DataType::kUINT8: processTensorSummary<uint8_t>(addr_host, type, volume, mSummaryFile); break;
     case nvinfer1::DataType::kFP4:
 #if CUDA_VERSION >= 12070
-        processTensorSummary<Fp4x2>(addr_host, volume, mSummaryFile);
+        processTensorSummary<Fp4x2>(addr_host, type, volume, mSummaryFile);
 #else
         sample::gLogWarning << "Unsupported data type kFP4 for tensor '" << name
                             << "' summary dump in this CUDA version." << std::endl;
@@ -667,7 +969,7 @@ void DebugTensorWriter::writeSummary(std::string_view name, nvinfer1::Dims const
         break;
     case nvinfer1::DataType::kFP8:
 #if CUDA_VERSION >= 11060
-        processTensorSummary<__nv_fp8_e4m3>(addr_host, volume, mSummaryFile);
+        processTensorSummary<__nv_fp8_e4m3>(addr_host, type, volume, mSummaryFile);
         break;
 #else
         sample::gLogWarning << "Unsupported data type kFP8 for tensor '" << name
@@ -677,9 +979,9 @@ void DebugTensorWriter::writeSummary(std::string_view name, nvinfer1::Dims const
     case nvinfer1::DataType::kE8M0:
         sample::gLogWarning << "Unsupported data type kE8M0 for tensor '" << name << "' summary dump." << std::endl;
         break;
-    case nvinfer1::DataType::kHALF: processTensorSummary<half>(addr_host, volume, mSummaryFile); break;
-    case nvinfer1::DataType::kBF16: processTensorSummary<nv_bfloat16>(addr_host, volume, mSummaryFile); break;
-    case nvinfer1::DataType::kFLOAT: processTensorSummary<float>(addr_host, volume, mSummaryFile); break;
+    case nvinfer1::DataType::kHALF: processTensorSummary<half>(addr_host, type, volume, mSummaryFile); break;
+    case nvinfer1::DataType::kBF16: processTensorSummary<nv_bfloat16>(addr_host, type, volume, mSummaryFile); break;
+    case nvinfer1::DataType::kFLOAT: processTensorSummary<float>(addr_host, type, volume, mSummaryFile); break;
     }
 
     mSummaryFile << "    }";
@@ -729,7 +1031,7 @@ bool writeNumpyFile(void const* addr_host, std::string_view dtype, nvinfer1::Dim
         return false;
     }
 
-    sample::gLogVerbose << "Writing debug tensor '" << tensorName << "' to numpy file '" << fileName << "'"
+    sample::gLogVerbose << "Writing tensor '" << tensorName << "' to numpy file '" << fileName << "'"
                         << std::endl;
 
     // Write numpy magic string and version
@@ -850,10 +1152,19 @@ std::string writeNumpy(nvinfer1::DataType type, void const* addr_host, int64_t v
 bool DebugTensorWriter::processDebugTensor(void const* addr, nvinfer1::TensorLocation location, nvinfer1::DataType type,
     nvinfer1::Dims const& shape, char const* name, cudaStream_t stream)
 {
-    CHECK(cudaStreamSynchronize(stream));
-    // Store data from callback.
     auto volume = std::accumulate(shape.d, shape.d + shape.nbDims, 1LL, std::multiplies<int64_t>{});
     int64_t size = samplesCommon::getNbBytes(type, volume);
+    int32_t const tensorIndex = mTensorIndex++;
+
+    if (mAsyncQueue)
+    {
+        mAsyncQueue->push(addr, location == nvinfer1::TensorLocation::kDEVICE, type, shape, volume, size, name,
+            tensorIndex, stream);
+        return true;
+    }
+
+    CHECK(cudaStreamSynchronize(stream));
+    // Store data from callback.
     std::vector<char> hostDataOut;
     void const* addrHost = nullptr;
     if (location == nvinfer1::TensorLocation::kDEVICE)
@@ -867,6 +1178,14 @@ bool DebugTensorWriter::processDebugTensor(void const* addr, nvinfer1::TensorLoc
         addrHost = addr;
     }
 
+    writeDebugTensor(addrHost, type, shape, volume, name, tensorIndex);
+    return true;
+}
+
+void DebugTensorWriter::writeDebugTensor(void const* addrHost, nvinfer1::DataType type, nvinfer1::Dims const& shape,
+    int64_t volume, std::string const& name, int32_t tensorIndex)
+{
+    int64_t const size = samplesCommon::getNbBytes(type, volume);
     std::string assignedFileName;
     std::string numpyFileName;
     std::string rawFileName;
@@ -884,7 +1203,7 @@ bool DebugTensorWriter::processDebugTensor(void const* addr, nvinfer1::TensorLoc
     }
 
     std::stringstream ss;
-    ss << std::setw(4) << std::setfill('0') << mTensorIndex << "_";
+    ss << std::setw(4) << std::setfill('0') << tensorIndex << "_";
     std::string prefix = ss.str();
 
     if (std::find(mDebugTensorFormats.begin(), mDebugTensorFormats.end(), "raw") != mDebugTensorFormats.end())
@@ -897,6 +1216,11 @@ bool DebugTensorWriter::processDebugTensor(void const* addr, nvinfer1::TensorLoc
         f.close();
     }
 
+    if (mContainerFile.is_open())
+    {
+        writeContainerEntry(addrHost, type, shape, size, name);
+    }
+
     if (std::find(mDebugTensorFormats.begin(), mDebugTensorFormats.end(), "numpy") != mDebugTensorFormats.end())
     {
         numpyFileName = writeNumpy(type, addrHost, volume, shape, name, prefix);
@@ -913,9 +1237,6 @@ bool DebugTensorWriter::processDebugTensor(void const* addr, nvinfer1::TensorLoc
         writeSummary(name, shape, type, volume, addrHost, assignedFileName, numpyFileName, stringFileName, rawFileName);
         mSummaryFile.flush();
     }
-
-    mTensorIndex++;
-    return true;
 }
 
 } // namespace sample
@@ -20,24 +20,48 @@
 
 #include "NvInferRuntime.h"
 #include <fstream>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 namespace sample
 {
 
+//!
+//! \brief Settings of asynchronous debug tensor dumping.
+//!
+//! In asynchronous mode, the debug listener callback only enqueues a copy of the tensor into a pinned staging buffer
+//! on the inference stream. A writer thread waits for the copy and writes the files, so the callback neither
+//! synchronizes the stream nor does any file I/O.
+//!
+struct DebugTensorAsyncOptions
+{
+    bool enabled{false};
+    int32_t queueDepth{64};                   //!< Maximum number of tensors waiting to be written
+    int64_t stagingBytes{int64_t{256} << 20}; //!< Maximum pinned host memory used to stage tensors
+    bool dropWhenFull{false}; //!< Drop tensors instead of blocking the callback when the queue or the pool is full
+};
+
+class AsyncDebugTensorQueue;
+
 class DebugTensorWriter : public nvinfer1::IDebugListener
 {
 public:
     DebugTensorWriter(std::unordered_map<std::string, std::string> const& debugTensorFileNames,
         std::vector<std::string> const& debugTensorFormats, std::string const& engineName = "",
-        std::string const& cmdline = "");
+        std::string const& cmdline = "", DebugTensorAsyncOptions const& asyncOptions = {});
     ~DebugTensorWriter() override;
 
     bool processDebugTensor(void const* addr, nvinfer1::TensorLocation location, nvinfer1::DataType type,
         nvinfer1::Dims const& shape, char const* name, cudaStream_t stream) override;
 
 private:
+    void writeDebugTensor(void const* addrHost, nvinfer1::DataType type, nvinfer1::Dims const& shape, int64_t volume,
+        std::string const& name, int32_t tensorIndex);
+    void openContainer();
+    void writeContainerEntry(void const* addrHost, nvinfer1::DataType type, nvinfer1::Dims const& shape, int64_t size,
+        std::string const& name);
     void writeSummaryHeader();
     void writeSummaryFooter();
     void writeSummary(std::string_view name, nvinfer1::Dims const& shape, nvinfer1::DataType type, int64_t volume,
@@ -52,8 +76,21 @@ private:
     std::string mEngineName;
     std::string mCmdline;
     int32_t mTensorIndex{0};
+    std::ofstream mContainerFile;  //!< Data file of the "container" format
+    std::ofstream mContainerIndex; //!< Index file of the "container" format
+    uint64_t mContainerOffset{0};  //!< Size of the container data file
+    std::unordered_map<std::string, int32_t> mContainerIterations; //!< Number of dumps of each tensor
+    std::unique_ptr<AsyncDebugTensorQueue> mAsyncQueue; //!< Only set in asynchronous mode
 };
 
+//!
+//! \brief Write a host buffer of size bytes to a .npy file.
+//!
+//! \param dtype Numpy type string of the elements, such as "<f4".
+//!
+bool writeNumpyFile(void const* addr_host, std::string_view dtype, nvinfer1::Dims const& shape, int64_t size,
+    std::string_view tensorName, std::string const& fileName);
+
 } // namespace sample
 
 #endif // TENSORRT_DEBUG_TENSOR_WRITER_H
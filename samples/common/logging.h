@@ -20,6 +20,7 @@
 
 #include "NvInferRuntime.h"
 #include "sampleOptions.h"
+#include <atomic>
 #include <cassert>
 #include <ctime>
 #include <iomanip>
@@ -34,6 +35,51 @@ namespace sample
 
 using Severity = nvinfer1::ILogger::Severity;
 
+//!
+//! \class ILogBackend
+//!
+//! \brief Destination of the log messages when they are not written synchronously by the calling thread.
+//!
+//! A tool installs a backend with setLogBackend(), for example the asynchronous logger of asyncLogger.h. Without a
+//! backend, which is the case in the plugin library and in most samples, messages are written to stdout and stderr
+//! under the mutex of their LogStreamConsumer.
+//!
+class ILogBackend
+{
+public:
+    //! Return the stream in which the calling thread assembles its message to the given log stream consumer.
+    virtual std::ostream& getLine(void const* consumer) = 0;
+
+    //! Queue the message assembled by the calling thread for the given log stream consumer.
+    virtual void submitLine(void const* consumer, Severity severity) = 0;
+
+    //! Queue a complete message, including its trailing newline.
+    virtual void log(Severity severity, std::string&& message) = 0;
+
+    //! Wait until the messages logged so far by all threads have been written.
+    virtual void flush() = 0;
+
+    virtual ~ILogBackend() = default;
+};
+
+inline std::atomic<ILogBackend*>& getLogBackendSlot() noexcept
+{
+    static std::atomic<ILogBackend*> backend{nullptr};
+    return backend;
+}
+
+//! \return The installed log backend, or nullptr if messages are written synchronously.
+inline ILogBackend* getLogBackend() noexcept
+{
+    return getLogBackendSlot().load(std::memory_order_acquire);
+}
+
+//! Install a log backend, or go back to synchronous logging with nullptr. The backend must outlive its use.
+inline void setLogBackend(ILogBackend* backend) noexcept
+{
+    getLogBackendSlot().store(backend, std::memory_order_release);
+}
+
 class LogStreamConsumerBuffer : public std::stringbuf
 {
 public:
@@ -183,6 +229,24 @@ public:
         return mShouldLog;
     }
 
+    //!
+    //! \brief Return the stream of the message being logged by the calling thread to a log backend.
+    //!
+    //! Each thread assembles its own messages, so fragments are neither serialized on the mutex nor interleaved.
+    //!
+    std::ostream& getBackendLine(ILogBackend& backend)
+    {
+        return backend.getLine(this);
+    }
+
+    //!
+    //! \brief Queue the message assembled by the calling thread.
+    //!
+    void submitBackendLine(ILogBackend& backend)
+    {
+        backend.submitLine(this, mSeverity);
+    }
+
 private:
     static std::ostream& severityOstream(Severity severity)
     {
@@ -211,6 +275,11 @@ LogStreamConsumer& operator<<(LogStreamConsumer& logger, const T& obj)
 {
     if (logger.getShouldLog())
     {
+        if (auto* backend = getLogBackend())
+        {
+            logger.getBackendLine(*backend) << obj;
+            return logger;
+        }
         std::lock_guard<std::mutex> guard(logger.getMutex());
         auto& os = static_cast<std::ostream&>(logger);
         os << obj;
@@ -225,6 +294,17 @@ inline LogStreamConsumer& operator<<(LogStreamConsumer& logger, std::ostream& (*
 {
     if (logger.getShouldLog())
     {
+        if (auto* backend = getLogBackend())
+        {
+            // std::endl and std::flush complete the message, as they synchronize the buffer otherwise.
+            logger.getBackendLine(*backend) << f;
+            using Manipulator = std::ostream& (*) (std::ostream&);
+            if (f == static_cast<Manipulator>(std::endl) || f == static_cast<Manipulator>(std::flush))
+            {
+                logger.submitBackendLine(*backend);
+            }
+            return logger;
+        }
         std::lock_guard<std::mutex> guard(logger.getMutex());
         auto& os = static_cast<std::ostream&>(logger);
         os << f;
@@ -236,12 +316,19 @@ inline LogStreamConsumer& operator<<(LogStreamConsumer& logger, const nvinfer1::
 {
     if (logger.getShouldLog())
     {
-        std::lock_guard<std::mutex> guard(logger.getMutex());
-        auto& os = static_cast<std::ostream&>(logger);
-        for (int32_t i = 0; i < dims.nbDims; ++i)
+        auto print = [&dims](std::ostream& os) {
+            for (int32_t i = 0; i < dims.nbDims; ++i)
+            {
+                os << (i ? "x" : "") << dims.d[i];
+            }
+        };
+        if (auto* backend = getLogBackend())
         {
-            os << (i ? "x" : "") << dims.d[i];
+            print(logger.getBackendLine(*backend));
+            return logger;
         }
+        std::lock_guard<std::mutex> guard(logger.getMutex());
+        print(static_cast<std::ostream&>(logger));
     }
     return logger;
 }
@@ -311,6 +398,14 @@ public:
     //!
     void log(Severity severity, const char* msg) noexcept override
     {
+        if (auto* backend = getLogBackend())
+        {
+            if (severity <= mReportableSeverity)
+            {
+                backend->log(severity, std::string("[TRT] ") + msg + "\n");
+            }
+            return;
+        }
         LogStreamConsumer(mReportableSeverity, severity) << "[TRT] " << std::string(msg) << std::endl;
     }
 
@@ -494,6 +589,11 @@ private:
     //!
     static void reportTestResult(TestAtom const& testAtom, TestResult result)
     {
+        // Write the queued messages first, so that the result stays the last line of the test.
+        if (auto* backend = getLogBackend())
+        {
+            backend->flush();
+        }
         severityOstream(Severity::kINFO) << "&&&& " << testResultString(result) << " " << testAtom.mName << " # "
                                          << testAtom.mCmdline << std::endl;
     }
@@ -0,0 +1,293 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pinnedHostPool.h"
+
+#include <algorithm>
+#include <cuda_runtime_api.h>
+#include <new>
+
+namespace sample
+{
+
+namespace
+{
+
+size_t roundUp(size_t size, size_t step)
+{
+    return (size + step - 1) / step * step;
+}
+
+class CudaPinnedBackend : public IPinnedMemoryBackend
+{
+public:
+    void* allocate(size_t size) noexcept override
+    {
+        void* memory{nullptr};
+        if (cudaMallocHost(&memory, size) != cudaSuccess)
+        {
+            // The caller handles the failure; do not leave it to be reported by an unrelated CUDA call.
+            static_cast<void>(cudaGetLastError());
+            return nullptr;
+        }
+        return memory;
+    }
+
+    void free(void* memory) noexcept override
+    {
+        static_cast<void>(cudaFreeHost(memory));
+    }
+
+    bool registerMemory(void* memory, size_t size) noexcept override
+    {
+        if (cudaHostRegister(memory, size, cudaHostRegisterDefault) != cudaSuccess)
+        {
+            static_cast<void>(cudaGetLastError());
+            return false;
+        }
+        return true;
+    }
+
+    void unregisterMemory(void* memory) noexcept override
+    {
+        static_cast<void>(cudaHostUnregister(memory));
+    }
+};
+
+} // namespace
+
+std::unique_ptr<IPinnedMemoryBackend> createCudaPinnedBackend()
+{
+    return std::unique_ptr<IPinnedMemoryBackend>(new CudaPinnedBackend);
+}
+
+std::ostream& operator<<(std::ostream& os, PinnedHostPoolStats const& stats)
+{
+    constexpr double kMiB{1 << 20};
+    os << "Pinned: " << stats.getPinnedBytes() / kMiB << " MiB in " << stats.nbSlabs << " slabs";
+    if (stats.registeredBytes > 0)
+    {
+        os << " and " << stats.registeredBytes / kMiB << " MiB registered";
+    }
+    os << ", in use: " << stats.inUseBytes / kMiB << " MiB (peak " << stats.peakInUseBytes / kMiB << " MiB), "
+       << stats.nbAllocations << " allocations";
+    return os;
+}
+
+PinnedHostPool::PinnedHostPool(std::unique_ptr<IPinnedMemoryBackend> backend, size_t slabSize)
+    : mBackend(std::move(backend))
+    , mSlabSize(roundUp(std::max(slabSize, kALIGNMENT), kALIGNMENT))
+{
+}
+
+PinnedHostPool::~PinnedHostPool()
+{
+    trim();
+    for (auto const& registered : mRegistered)
+    {
+        mBackend->unregisterMemory(registered.first);
+    }
+}
+
+void* PinnedHostPool::allocate(size_t size) noexcept
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+    size_t const alignedSize = roundUp(size, kALIGNMENT);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    void* memory{nullptr};
+    try
+    {
+        for (auto& slab : mSlabs)
+        {
+            memory = allocateFromSlab(*slab, alignedSize);
+            if (memory != nullptr)
+            {
+                break;
+            }
+        }
+        if (memory == nullptr)
+        {
+            size_t const slabSize = std::max(mSlabSize, alignedSize);
+            auto* slabMemory = static_cast<uint8_t*>(mBackend->allocate(slabSize));
+            if (slabMemory == nullptr)
+            {
+                return nullptr;
+            }
+            try
+            {
+                mSlabs.push_back(std::unique_ptr<Slab>(new Slab{slabMemory, slabSize, {{0, slabSize}}}));
+            }
+            catch (std::bad_alloc const&)
+            {
+                mBackend->free(slabMemory);
+                throw;
+            }
+            ++mStats.nbSlabs;
+            mStats.slabBytes += slabSize;
+            memory = allocateFromSlab(*mSlabs.back(), alignedSize);
+        }
+    }
+    catch (std::bad_alloc const&)
+    {
+        // The bookkeeping of the pool could not grow; the caller falls back to its own allocation.
+        return nullptr;
+    }
+
+    ++mStats.nbAllocations;
+    mStats.inUseBytes += alignedSize;
+    mStats.peakInUseBytes = std::max(mStats.peakInUseBytes, mStats.inUseBytes);
+    return memory;
+}
+
+void* PinnedHostPool::allocateFromSlab(Slab& slab, size_t size)
+{
+    auto const range = std::find_if(slab.freeRanges.begin(), slab.freeRanges.end(),
+        [size](std::pair<size_t const, size_t> const& r) { return r.second >= size; });
+    if (range == slab.freeRanges.end())
+    {
+        return nullptr;
+    }
+    size_t const offset = range->first;
+    void* const memory = slab.memory + offset;
+    mInUse.emplace(memory, Allocation{&slab, offset, size});
+
+    // Reuse the node of the range for its remainder, so that nothing can fail once the allocation is recorded.
+    auto node = slab.freeRanges.extract(range);
+    if (node.mapped() > size)
+    {
+        node.key() = offset + size;
+        node.mapped() -= size;
+        slab.freeRanges.insert(std::move(node));
+    }
+    ++slab.nbInUse;
+    return memory;
+}
+
+bool PinnedHostPool::deallocate(void* memory) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto const it = mInUse.find(memory);
+    if (it == mInUse.end())
+    {
+        return false;
+    }
+    Allocation const allocation = it->second;
+    mInUse.erase(it);
+    mStats.inUseBytes -= allocation.size;
+
+    --allocation.slab->nbInUse;
+
+    // Merge the range with the free ranges around it, growing their nodes in place when there are some.
+    auto& ranges = allocation.slab->freeRanges;
+    size_t const end = allocation.offset + allocation.size;
+    auto const next = ranges.lower_bound(allocation.offset);
+    bool const mergesNext = next != ranges.end() && next->first == end;
+    auto const previous = next != ranges.begin() ? std::prev(next) : ranges.end();
+    if (previous != ranges.end() && previous->first + previous->second == allocation.offset)
+    {
+        previous->second += allocation.size;
+        if (mergesNext)
+        {
+            previous->second += next->second;
+            ranges.erase(next);
+        }
+    }
+    else if (mergesNext)
+    {
+        auto node = ranges.extract(next);
+        node.key() = allocation.offset;
+        node.mapped() += allocation.size;
+        ranges.insert(std::move(node));
+    }
+    else
+    {
+        try
+        {
+            ranges.emplace(allocation.offset, allocation.size);
+        }
+        catch (std::bad_alloc const&)
+        {
+            // The range is lost until the slab is trimmed, once its other buffers are released.
+        }
+    }
+    return true;
+}
+
+bool PinnedHostPool::registerHostMemory(void* memory, size_t size) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (memory == nullptr || size == 0 || mRegistered.count(memory) != 0)
+    {
+        return false;
+    }
+    // Record the memory first, so that it is never left pinned without being tracked.
+    try
+    {
+        mRegistered.emplace(memory, size);
+    }
+    catch (std::bad_alloc const&)
+    {
+        return false;
+    }
+    if (!mBackend->registerMemory(memory, size))
+    {
+        mRegistered.erase(memory);
+        return false;
+    }
+    mStats.registeredBytes += size;
+    return true;
+}
+
+bool PinnedHostPool::unregisterHostMemory(void* memory) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto const it = mRegistered.find(memory);
+    if (it == mRegistered.end())
+    {
+        return false;
+    }
+    mBackend->unregisterMemory(memory);
+    mStats.registeredBytes -= it->second;
+    mRegistered.erase(it);
+    return true;
+}
+
+void PinnedHostPool::trim()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto const firstFree = std::stable_partition(
+        mSlabs.begin(), mSlabs.end(), [](std::unique_ptr<Slab> const& slab) { return slab->nbInUse > 0; });
+    for (auto it = firstFree; it != mSlabs.end(); ++it)
+    {
+        mBackend->free((*it)->memory);
+        --mStats.nbSlabs;
+        mStats.slabBytes -= (*it)->size;
+    }
+    mSlabs.erase(firstFree, mSlabs.end());
+}
+
+PinnedHostPoolStats PinnedHostPool::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
+} // namespace sample
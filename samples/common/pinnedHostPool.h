@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TENSORRT_PINNED_HOST_POOL_H
+#define TENSORRT_PINNED_HOST_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace sample
+{
+
+//!
+//! \class IHostBufferPool
+//! \brief Source of host memory for the host buffers of the samples.
+//!
+class IHostBufferPool
+{
+public:
+    virtual ~IHostBufferPool() = default;
+
+    //! Return nullptr if the memory cannot be allocated; the caller then allocates it itself.
+    virtual void* allocate(size_t size) noexcept = 0;
+
+    //! \return False if the memory was not allocated by this pool.
+    virtual bool deallocate(void* memory) noexcept = 0;
+
+    //! Pin size bytes of memory allocated by the caller. Return false if the memory could not be pinned.
+    virtual bool registerHostMemory(void* memory, size_t size) noexcept = 0;
+
+    //! Unpin memory pinned with registerHostMemory(). Return false if it was not.
+    virtual bool unregisterHostMemory(void* memory) noexcept = 0;
+};
+
+//!
+//! \class IPinnedMemoryBackend
+//! \brief Source of the pinned memory used by PinnedHostPool.
+//!
+//! The pool calls the backend with its lock held, so a backend serving a single pool needs no locking.
+//!
+class IPinnedMemoryBackend
+{
+public:
+    virtual ~IPinnedMemoryBackend() = default;
+
+    //! Return nullptr if the memory cannot be allocated.
+    virtual void* allocate(size_t size) noexcept = 0;
+
+    virtual void free(void* memory) noexcept = 0;
+
+    //! Pin memory allocated elsewhere. Return false on failure.
+    virtual bool registerMemory(void* memory, size_t size) noexcept = 0;
+
+    virtual void unregisterMemory(void* memory) noexcept = 0;
+};
+
+//!
+//! \brief Create a backend allocating with cudaMallocHost and pinning with cudaHostRegister.
+//!
+std::unique_ptr<IPinnedMemoryBackend> createCudaPinnedBackend();
+
+struct PinnedHostPoolStats
+{
+    int64_t slabBytes{0};       //!< Bytes of the slabs obtained from the backend
+    int64_t registeredBytes{0}; //!< Bytes pinned with registerHostMemory()
+    int64_t inUseBytes{0};      //!< Bytes handed out and not released, rounded up to the alignment
+    int64_t peakInUseBytes{0};
+    int64_t nbSlabs{0};
+    int64_t nbAllocations{0};
+
+    //! Pinned memory held by the pool.
+    int64_t getPinnedBytes() const
+    {
+        return slabBytes + registeredBytes;
+    }
+};
+
+std::ostream& operator<<(std::ostream& os, PinnedHostPoolStats const& stats);
+
+//!
+//! \class PinnedHostPool
+//! \brief Pinned host memory sub-allocated from a few large slabs instead of one pinned allocation per buffer.
+//!
+//! Buffers are carved first-fit out of the slabs, aligned to kALIGNMENT, and released ranges are merged with their
+//! free neighbors. A new slab of slabSize bytes, or of the buffer size if larger, is reserved only when no slab has
+//! room. Slabs are kept until trim() or the destruction of the pool.
+//!
+//! Memory allocated elsewhere can be pinned with registerHostMemory(), and counts in the pinned footprint of the pool
+//! until it is unregistered or the pool is destroyed.
+//!
+//! Memory still in use when the pool is destroyed is not released.
+//!
+class PinnedHostPool : public IHostBufferPool
+{
+public:
+    static constexpr size_t kDEFAULT_SLAB_SIZE{64 << 20};
+
+    //! Alignment of the buffers, enough for any vectorized copy.
+    static constexpr size_t kALIGNMENT{256};
+
+    explicit PinnedHostPool(std::unique_ptr<IPinnedMemoryBackend> backend, size_t slabSize = kDEFAULT_SLAB_SIZE);
+
+    ~PinnedHostPool() override;
+
+    PinnedHostPool(PinnedHostPool const&) = delete;
+    PinnedHostPool& operator=(PinnedHostPool const&) = delete;
+
+    void* allocate(size_t size) noexcept override;
+
+    bool deallocate(void* memory) noexcept override;
+
+    bool registerHostMemory(void* memory, size_t size) noexcept override;
+
+    bool unregisterHostMemory(void* memory) noexcept override;
+
+    //! Return the slabs without buffers in use to the backend.
+    void trim();
+
+    PinnedHostPoolStats getStats() const;
+
+private:
+    struct Slab
+    {
+        uint8_t* memory;
+        size_t size;
+        std::map<size_t, size_t> freeRanges; //!< Size of the free ranges, by offset
+        size_t nbInUse{0};
+    };
+
+    struct Allocation
+    {
+        Slab* slab;
+        size_t offset;
+        size_t size;
+    };
+
+    //! Return nullptr if the slab has no free range of size bytes. May throw std::bad_alloc, leaving the slab as is.
+    void* allocateFromSlab(Slab& slab, size_t size);
+
+    std::unique_ptr<IPinnedMemoryBackend> mBackend;
+    size_t mSlabSize;
+    mutable std::mutex mMutex;
+    std::vector<std::unique_ptr<Slab>> mSlabs;
+    std::unordered_map<void*, Allocation> mInUse;
+    std::unordered_map<void*, size_t> mRegistered; //!< Size of the memory pinned with registerHostMemory()
+    PinnedHostPoolStats mStats;
+};
+
+} // namespace sample
+
+#endif // TENSORRT_PINNED_HOST_POOL_H
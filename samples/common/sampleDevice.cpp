@@ -119,4 +119,180 @@ int32_t getCudaRuntimeVersion()
     return version;
 }
 
+namespace
+{
+
+//! Return the smallest g such that size <= 2^g.
+int32_t getSizeGroup(size_t size)
+{
+    int32_t group{0};
+    while ((static_cast<size_t>(1) << group) < size)
+    {
+        ++group;
+    }
+    return group;
+}
+
+} // namespace
+
+OutputBufferPool::OutputBufferPool(bool useManaged, size_t maxPooledBytes)
+    : OutputBufferPool(
+        [useManaged]() -> std::unique_ptr<IMirroredBuffer> {
+            if (useManaged)
+            {
+                return std::make_unique<UnifiedMirroredBuffer>();
+            }
+            return std::make_unique<DiscreteMirroredBuffer>();
+        },
+        maxPooledBytes)
+{
+}
+
+OutputBufferPool::~OutputBufferPool()
+{
+    for (auto& group : mBuffers)
+    {
+        for (auto& pooled : group.second)
+        {
+            if (pooled.released != nullptr)
+            {
+                CHECK(cudaEventDestroy(pooled.released));
+            }
+        }
+    }
+}
+
+std::unique_ptr<IMirroredBuffer> OutputBufferPool::acquire(size_t size, cudaStream_t stream, bool shrink)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        int32_t const group = getSizeGroup(size);
+        auto const end = shrink ? mBuffers.upper_bound(group) : mBuffers.end();
+        for (auto it = mBuffers.lower_bound(group); it != end; ++it)
+        {
+            auto& buffers = it->second;
+            auto best = buffers.end();
+            for (auto b = buffers.begin(); b != buffers.end(); ++b)
+            {
+                size_t const bufferSize = b->buffer->getSize();
+                if (bufferSize >= size && (best == buffers.end() || bufferSize < best->buffer->getSize()))
+                {
+                    best = b;
+                }
+            }
+            if (best == buffers.end())
+            {
+                continue;
+            }
+
+            PooledBuffer pooled = std::move(*best);
+            buffers.erase(best);
+            if (buffers.empty())
+            {
+                mBuffers.erase(it);
+            }
+            ++mStats.nbPoolHits;
+            mStats.pooledBytes -= pooled.buffer->getSize();
+            if (pooled.released != nullptr)
+            {
+                if (pooled.stream != stream)
+                {
+                    CHECK(cudaStreamWaitEvent(stream, pooled.released, 0));
+                }
+                CHECK(cudaEventDestroy(pooled.released));
+            }
+            else if (pooled.stream != stream)
+            {
+                CHECK(cudaStreamSynchronize(pooled.stream));
+            }
+            return std::move(pooled.buffer);
+        }
+    }
+
+    auto buffer = mMakeBuffer();
+    buffer->allocate(size);
+    return buffer;
+}
+
+void OutputBufferPool::release(std::unique_ptr<IMirroredBuffer> buffer, cudaStream_t stream)
+{
+    cudaEvent_t released{nullptr};
+    if (cudaEventCreateWithFlags(&released, cudaEventDisableTiming) != cudaSuccess
+        || cudaEventRecord(released, stream) != cudaSuccess)
+    {
+        // Fall back to synchronizing the stream when the buffer is acquired on another stream.
+        static_cast<void>(cudaGetLastError());
+        if (released != nullptr)
+        {
+            CHECK(cudaEventDestroy(released));
+            released = nullptr;
+        }
+    }
+
+    std::vector<PooledBuffer> evicted;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        int64_t const size = buffer->getSize();
+        mBuffers[getSizeGroup(size)].push_back({std::move(buffer), stream, released, mNbReleases++});
+        mStats.pooledBytes += size;
+
+        while (mMaxPooledBytes > 0 && mStats.pooledBytes > static_cast<int64_t>(mMaxPooledBytes))
+        {
+            // The buffers of a group are in release order, so the oldest buffer is at the front of a group.
+            auto oldest = mBuffers.begin();
+            for (auto it = std::next(oldest); it != mBuffers.end(); ++it)
+            {
+                if (it->second.front().order < oldest->second.front().order)
+                {
+                    oldest = it;
+                }
+            }
+            auto& buffers = oldest->second;
+            mStats.pooledBytes -= buffers.front().buffer->getSize();
+            ++mStats.nbEvictions;
+            evicted.push_back(std::move(buffers.front()));
+            buffers.erase(buffers.begin());
+            if (buffers.empty())
+            {
+                mBuffers.erase(oldest);
+            }
+        }
+    }
+
+    for (auto& pooled : evicted)
+    {
+        freePooled(pooled);
+    }
+}
+
+void OutputBufferPool::freePooled(PooledBuffer& pooled)
+{
+    if (pooled.released != nullptr)
+    {
+        CHECK(cudaEventSynchronize(pooled.released));
+        CHECK(cudaEventDestroy(pooled.released));
+    }
+    else
+    {
+        CHECK(cudaStreamSynchronize(pooled.stream));
+    }
+    pooled.buffer.reset();
+}
+
+void OutputBufferPool::countReallocation(bool shrink)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++mStats.nbReallocations;
+    if (shrink)
+    {
+        ++mStats.nbShrinks;
+    }
+}
+
+OutputBufferPoolStats OutputBufferPool::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
 } // namespace sample
@@ -18,13 +18,21 @@
 #ifndef TRT_SAMPLE_DEVICE_H
 #define TRT_SAMPLE_DEVICE_H
 
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <cuda.h>
 #include <cuda_runtime.h>
+#include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "common.h"
+#include "pinnedHostPool.h"
 #include "sampleUtils.h"
 
 namespace sample
@@ -292,10 +300,47 @@ private:
     size_t mSize{0};
 };
 
+//! Number of devices whose buffers can be served by an allocator; the buffers of other devices use cudaMalloc.
+constexpr int32_t kMAX_BUFFER_ALLOCATOR_DEVICES{64};
+
+//!
+//! \brief Return the allocators serving the allocations of TrtDeviceBuffer instead of cudaMalloc, by device.
+//!
+inline std::array<std::atomic<nvinfer1::IGpuAsyncAllocator*>, kMAX_BUFFER_ALLOCATOR_DEVICES>& deviceBufferAllocators()
+{
+    static std::array<std::atomic<nvinfer1::IGpuAsyncAllocator*>, kMAX_BUFFER_ALLOCATOR_DEVICES> allocators{};
+    return allocators;
+}
+
+//!
+//! \brief Serve the buffers allocated from now on while the given device is current from the given allocator, or
+//! from cudaMalloc if nullptr.
+//!
+//! The allocator must outlive the buffers it allocates, and return false when asked to release memory it did not
+//! allocate, which is then released with cudaFree.
+//!
+inline void setDeviceBufferAllocator(int32_t device, nvinfer1::IGpuAsyncAllocator* allocator)
+{
+    if (device >= 0 && device < kMAX_BUFFER_ALLOCATOR_DEVICES)
+    {
+        deviceBufferAllocators()[device].store(allocator);
+    }
+}
+
 struct DeviceAllocator
 {
     void operator()(void** ptr, size_t size)
     {
+        int32_t device{-1};
+        if (size > 0 && cudaGetDevice(&device) == cudaSuccess && device < kMAX_BUFFER_ALLOCATOR_DEVICES)
+        {
+            auto* allocator = deviceBufferAllocators()[device].load();
+            *ptr = allocator != nullptr ? allocator->allocateAsync(size, 0, 0, nullptr) : nullptr;
+            if (*ptr != nullptr)
+            {
+                return;
+            }
+        }
         CHECK(cudaMalloc(ptr, size));
     }
 };
@@ -304,6 +349,15 @@ struct DeviceDeallocator
 {
     void operator()(void* ptr)
     {
+        // The buffer may be released while another device is current, so ask every allocator.
+        for (auto const& slot : deviceBufferAllocators())
+        {
+            auto* allocator = slot.load();
+            if (allocator != nullptr && allocator->deallocateAsync(ptr, nullptr))
+            {
+                return;
+            }
+        }
         CHECK(cudaFree(ptr));
     }
 };
@@ -316,13 +370,43 @@ struct ManagedAllocator
     }
 };
 
+//!
+//! \brief Return the pool serving the allocations of TrtHostBuffer before cudaMallocHost, or nullptr.
+//!
+inline std::atomic<IHostBufferPool*>& hostBufferPool()
+{
+    static std::atomic<IHostBufferPool*> pool{nullptr};
+    return pool;
+}
+
+//!
+//! \brief Serve the host buffers allocated from now on from the given pool, or from cudaMallocHost if nullptr.
+//!
+//! The pool must outlive the buffers it allocates or registers.
+//!
+inline void setHostBufferPool(IHostBufferPool* pool)
+{
+    hostBufferPool().store(pool);
+}
+
 struct HostAllocator
 {
     //! Attempts to allocate size bytes on host, pointing *ptr to the start.
-    //! First attempts to allocate pinned memory using cudaMallocHost(ptr, size), failing that, warns to gLogWarning and
-    //! falls back to ::operator new(size) to allocate pageable memory. If that still fails, an exception may be thrown.
+    //! First attempts to allocate from the host buffer pool if one is set, then to allocate pinned memory using
+    //! cudaMallocHost(ptr, size), failing that, warns to gLogWarning and falls back to ::operator new(size) to allocate
+    //! pageable memory, which the host buffer pool then tries to pin. If that still fails, an exception may be thrown.
     void operator()(void** ptr, size_t size)
     {
+        auto* pool = hostBufferPool().load();
+        if (pool != nullptr)
+        {
+            *ptr = pool->allocate(size);
+            if (*ptr != nullptr)
+            {
+                return;
+            }
+        }
+
         // Try allocating pinned host memory.
         cudaError_t ret = cudaMallocHost(ptr, size);
 
@@ -334,10 +418,18 @@ struct HostAllocator
 
             sample::gLogWarning << "cudaMallocHost() call with ptr=" << ptr << " and size=" << size
                                 << " returns a cuda error: " << cudaGetErrorString(ret) << std::endl;
-            sample::gLogWarning << "Allocate pageable host memory instead of pinned host memory. H2D and D2H copy "
-                                   "latencies may become longer."
-                                << std::endl;
             *ptr = ::operator new(size);
+            if (pool != nullptr && pool->registerHostMemory(*ptr, size))
+            {
+                sample::gLogWarning << "Allocate pageable host memory and pin it with cudaHostRegister() instead."
+                                    << std::endl;
+            }
+            else
+            {
+                sample::gLogWarning << "Allocate pageable host memory instead of pinned host memory. H2D and D2H "
+                                       "copy latencies may become longer."
+                                    << std::endl;
+            }
 
             // Make sure there is no remaining cuda error at this point.
             CHECK(cudaGetLastError());
@@ -348,11 +440,23 @@ struct HostAllocator
 struct HostDeallocator
 {
     //! Attempts to deallocate the host memory allocated by HostAllocator.
-    //! It first checks if ptr is a pinned or pageable host memory. If pinned, call cudaFreeHost() to free it. If
-    //! pageable, call ::operator delete() to free it. If ptr is neither of them, an error is printed and the program
-    //! exits.
+    //! Memory from the host buffer pool goes back to the pool, and pageable memory pinned by the pool is unpinned and
+    //! deleted. Otherwise, it first checks if ptr is a pinned or pageable host memory. If pinned, call cudaFreeHost()
+    //! to free it. If pageable, call ::operator delete() to free it. If ptr is neither of them, an error is printed
+    //! and the program exits.
     void operator()(void* ptr)
     {
+        auto* pool = hostBufferPool().load();
+        if (pool != nullptr && pool->deallocate(ptr))
+        {
+            return;
+        }
+        if (pool != nullptr && pool->unregisterHostMemory(ptr))
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
         // Check if the host memory pointer is pinned or pageable.
         cudaPointerAttributes attrs;
         CHECK(cudaPointerGetAttributes(&attrs, ptr));
@@ -518,6 +622,89 @@ private:
     TrtManagedBuffer mBuffer;
 }; // class UnifiedMirroredBuffer
 
+//!
+//! \brief Policy deciding the capacity of the buffers of OutputAllocator.
+//!
+struct OutputAllocatorPolicy
+{
+    //! A growing buffer gets at least this many times its previous capacity. 1 allocates the requested size only.
+    float growthFactor{1.F};
+    //! Shrink a buffer after this many consecutive requests below a quarter of its capacity. 0 never shrinks.
+    int32_t shrinkAfter{0};
+};
+
+struct OutputBufferPoolStats
+{
+    int64_t nbReallocations{0}; //!< Buffers replaced because the output grew or shrank
+    int64_t nbPoolHits{0};      //!< Buffers served from the pool instead of being allocated
+    int64_t nbShrinks{0};
+    int64_t nbEvictions{0};     //!< Buffers freed to keep the pool under its cap
+    int64_t pooledBytes{0};     //!< Bytes of the buffers kept for reuse
+};
+
+//!
+//! \class OutputBufferPool
+//! \brief Buffers released by the OutputAllocators of all the contexts, kept for reuse by any of them.
+//!
+//! Buffers are grouped by the power of two of their size. A request is served by the smallest large enough buffer of
+//! the lowest group holding one. A buffer released on one stream and acquired on another makes the acquiring stream
+//! wait for the work queued before the release.
+//!
+//! When the kept buffers exceed maxPooledBytes, the least recently released ones are freed, once the work queued
+//! before their release has finished. A cap of 0 keeps every released buffer.
+//!
+class OutputBufferPool
+{
+public:
+    //! Return a new, unallocated buffer.
+    using BufferFactory = std::function<std::unique_ptr<IMirroredBuffer>()>;
+
+    //! Construct a pool allocating unified buffers if useManaged is set and discrete ones otherwise.
+    explicit OutputBufferPool(bool useManaged, size_t maxPooledBytes = 0);
+
+    //! Construct a pool allocating the buffers returned by makeBuffer.
+    OutputBufferPool(BufferFactory makeBuffer, size_t maxPooledBytes)
+        : mMakeBuffer(std::move(makeBuffer))
+        , mMaxPooledBytes(maxPooledBytes)
+    {
+    }
+
+    ~OutputBufferPool();
+
+    OutputBufferPool(OutputBufferPool const&) = delete;
+    OutputBufferPool& operator=(OutputBufferPool const&) = delete;
+
+    //! Return a buffer of at least size bytes, to be used on stream. With shrink set, pooled buffers larger than the
+    //! power of two above size are left in the pool, so that shrinking does not take back a large buffer.
+    std::unique_ptr<IMirroredBuffer> acquire(size_t size, cudaStream_t stream, bool shrink = false);
+
+    //! Keep a buffer no longer used by the work queued on stream after this call.
+    void release(std::unique_ptr<IMirroredBuffer> buffer, cudaStream_t stream);
+
+    void countReallocation(bool shrink);
+
+    OutputBufferPoolStats getStats() const;
+
+private:
+    struct PooledBuffer
+    {
+        std::unique_ptr<IMirroredBuffer> buffer;
+        cudaStream_t stream;
+        cudaEvent_t released; //!< Recorded on stream at the release, or nullptr if the event could not be created
+        uint64_t order;       //!< Rank of the release, to evict the oldest buffers first
+    };
+
+    //! Wait for the work queued before the release of the buffer, and free it.
+    static void freePooled(PooledBuffer& pooled);
+
+    BufferFactory mMakeBuffer;
+    size_t mMaxPooledBytes{0};
+    mutable std::mutex mMutex;
+    std::map<int32_t, std::vector<PooledBuffer>> mBuffers; //!< Buffers by power of two of their size, oldest first
+    uint64_t mNbReleases{0};
+    OutputBufferPoolStats mStats;
+};
+
 //!
 //! Class to allocate memory for outputs with data-dependent shapes. The sizes of those are unknown so pre-allocation is
 //! not possible.
@@ -525,9 +712,13 @@ private:
 class OutputAllocator : public nvinfer1::IOutputAllocator
 {
 public:
-    //! Construct, using buffer as the backing storage:
-    explicit OutputAllocator(std::unique_ptr<IMirroredBuffer> buffer)
+    //! Construct, using buffer as the backing storage. With a pool, buffers replaced on reallocation are exchanged
+    //! through the pool instead of being freed.
+    explicit OutputAllocator(std::unique_ptr<IMirroredBuffer> buffer, OutputAllocatorPolicy const& policy = {},
+        std::shared_ptr<OutputBufferPool> pool = nullptr)
         : mBuffer{std::move(buffer)}
+        , mPolicy(policy)
+        , mPool(std::move(pool))
     {
         ASSERT(mBuffer);
     }
@@ -536,25 +727,40 @@ public:
 
     void* reallocateOutput(
         char const* tensorName, void* currentMemory, uint64_t size, uint64_t alignment) noexcept override
+    {
+        return reallocateOutputAsync(tensorName, currentMemory, size, alignment, nullptr);
+    }
+
+    //! IMirroredBuffer does not implement Async allocation, so only the exchanges with the pool are stream-ordered.
+    void* reallocateOutputAsync(char const* tensorName, void* currentMemory, uint64_t size, uint64_t alignment,
+        cudaStream_t stream) noexcept override
     {
         // Some memory allocators return nullptr when allocating zero bytes, but TensorRT requires a non-null ptr
         // even for empty tensors, so allocate a dummy byte.
         size = std::max(size, static_cast<uint64_t>(1));
-        if (size > mSize)
+        alignment = std::max(alignment, static_cast<uint64_t>(1));
+        uint64_t const capacity = mBuffer->getSize();
+        if (size > capacity)
+        {
+            auto const grown = static_cast<uint64_t>(static_cast<double>(capacity) * mPolicy.growthFactor);
+            replaceBuffer(roundUp(std::max(size, grown), alignment), stream, false);
+            mNbSmallRequests = 0;
+        }
+        else if (mPolicy.shrinkAfter > 0 && size < capacity / 4)
         {
-            mBuffer->allocate(roundUp(size, alignment));
-            mSize = size;
+            if (++mNbSmallRequests >= mPolicy.shrinkAfter)
+            {
+                replaceBuffer(roundUp(size, alignment), stream, true);
+                mNbSmallRequests = 0;
+            }
+        }
+        else
+        {
+            mNbSmallRequests = 0;
         }
         return mBuffer->getDeviceBuffer();
     }
 
-    //! IMirroredBuffer does not implement Async allocation, hence this is just a wrap around
-    void* reallocateOutputAsync(char const* tensorName, void* currentMemory, uint64_t size, uint64_t alignment,
-        cudaStream_t /*stream*/) noexcept override
-    {
-        return reallocateOutput(tensorName, currentMemory, size, alignment);
-    }
-
     void notifyShape(char const* tensorName, nvinfer1::Dims const& dims) noexcept override
     {
         mFinalDims = dims;
@@ -570,9 +776,54 @@ public:
         return mFinalDims;
     }
 
+    //! Return the number of times the buffer was replaced because the output grew or shrank.
+    int64_t getNbReallocations() const
+    {
+        return mNbReallocations;
+    }
+
+    int64_t getNbShrinks() const
+    {
+        return mNbShrinks;
+    }
+
 private:
+    //! Replace the buffer with one of size bytes. The new buffer is acquired before the old one is given up, so that
+    //! the pool cannot hand the old buffer back. A grown-out buffer goes to the pool. A shrunk one is freed, as
+    //! keeping it in the pool would not lower the memory held.
+    void replaceBuffer(uint64_t size, cudaStream_t stream, bool shrink)
+    {
+        bool const initial = mBuffer->getSize() == 0;
+        if (mPool)
+        {
+            auto buffer = mPool->acquire(size, stream, shrink);
+            std::swap(mBuffer, buffer);
+            if (!initial && !shrink)
+            {
+                mPool->release(std::move(buffer), stream);
+            }
+        }
+        else
+        {
+            mBuffer->allocate(size);
+        }
+        if (!initial)
+        {
+            ++mNbReallocations;
+            mNbShrinks += shrink ? 1 : 0;
+            if (mPool)
+            {
+                mPool->countReallocation(shrink);
+            }
+        }
+    }
+
     std::unique_ptr<IMirroredBuffer> mBuffer;
-    uint64_t mSize{};
+    OutputAllocatorPolicy mPolicy;
+    std::shared_ptr<OutputBufferPool> mPool;
+    int32_t mNbSmallRequests{0};
+    int64_t mNbReallocations{0};
+    int64_t mNbShrinks{0};
     nvinfer1::Dims mFinalDims;
 };
 
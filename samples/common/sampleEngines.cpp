@@ -35,6 +35,7 @@
 #include "sampleDevice.h"
 #include "sampleEngines.h"
 #include "sampleOptions.h"
+#include "samplePhases.h"
 #include "sampleUtils.h"
 
 using namespace nvinfer1;
@@ -80,10 +81,12 @@ nvinfer1::ICudaEngine* LazilyDeserializedEngine::get()
     {
         SMP_RETVAL_IF_FALSE(getAsyncFileReader().isOpen() || getFileReader().isOpen() || !getBlob().empty(),
             "Engine is empty. Nothing to deserialize!", nullptr, sample::gLogError);
+        ScopedPhase const phase("Deserialize engine");
         using time_point = std::chrono::time_point<std::chrono::high_resolution_clock>;
         using duration = std::chrono::duration<float>;
         time_point const deserializeStartTime{std::chrono::high_resolution_clock::now()};
 
+        std::unique_ptr<ScopedPhase> runtimePhase{new ScopedPhase("Create runtime")};
         if (mLeanDLLPath.empty())
         {
             mRuntime.reset(createRuntime());
@@ -114,8 +117,14 @@ nvinfer1::ICudaEngine* LazilyDeserializedEngine::get()
             mRuntime->setDLACore(mDLACore);
         }
         mRuntime->setErrorRecorder(&gRecorder);
+        if (mGpuAllocator != nullptr)
+        {
+            mRuntime->setGpuAllocator(mGpuAllocator);
+        }
+        runtimePhase.reset();
         for (auto const& pluginPath : mDynamicPlugins)
         {
+            ScopedPhase const pluginPhase("Load plugin library " + pluginPath);
             mRuntime->getPluginRegistry().loadLibrary(pluginPath.c_str());
         }
 
@@ -196,6 +205,7 @@ Parser modelToNetwork(ModelOptions const& model, BuildOptions const& build, nvin
     std::ostream& err, std::vector<std::string>* vcPluginLibrariesUsed)
 {
     sample::gLogInfo << "Start parsing network model." << std::endl;
+    ScopedPhase const phase("Parse model");
     auto const tBegin = std::chrono::high_resolution_clock::now();
 
     Parser parser;
@@ -1193,14 +1203,18 @@ bool networkToSerializedEngine(
     std::unique_ptr<nvinfer1::IInt8Calibrator> calibrator;
     std::vector<std::vector<int8_t>> sparseWeights;
     SMP_RETVAL_IF_FALSE(config != nullptr, "Config creation failed", false, err);
-    SMP_RETVAL_IF_FALSE(
-        setupNetworkAndConfig(build, sys, builder, *env.network, *config, calibrator, err, sparseWeights),
-        "Network And Config setup failed", false, err);
+    {
+        ScopedPhase const phase("Set up network and config");
+        SMP_RETVAL_IF_FALSE(
+            setupNetworkAndConfig(build, sys, builder, *env.network, *config, calibrator, err, sparseWeights),
+            "Network And Config setup failed", false, err);
+    }
 
     std::unique_ptr<ITimingCache> timingCache{};
     // Try to load cache from file. Create a fresh cache if the file doesn't exist
     if (build.timingCacheMode == TimingCacheMode::kGLOBAL)
     {
+        ScopedPhase const phase("Load timing cache");
         timingCache = samplesCommon::buildTimingCacheFromFile(gLogger.getTRTLogger(), *config, build.timingCacheFile);
     }
 
@@ -1210,7 +1224,12 @@ bool networkToSerializedEngine(
     config->setProfileStream(*profileStream);
 
     auto const tBegin = std::chrono::high_resolution_clock::now();
-    std::unique_ptr<IHostMemory> serializedEngine{builder.buildSerializedNetwork(*env.network, *config)};
+    std::unique_ptr<IHostMemory> serializedEngine;
+    {
+        // The builder builds and serializes the engine in a single call.
+        ScopedPhase const phase("Build and serialize engine");
+        serializedEngine.reset(builder.buildSerializedNetwork(*env.network, *config));
+    }
     SMP_RETVAL_IF_FALSE(serializedEngine != nullptr, "Engine could not be created from network", false, err);
     auto const tEnd = std::chrono::high_resolution_clock::now();
     float const buildTime = std::chrono::duration<float>(tEnd - tBegin).count();
@@ -1221,6 +1240,7 @@ bool networkToSerializedEngine(
 
     if (build.timingCacheMode == TimingCacheMode::kGLOBAL)
     {
+        ScopedPhase const phase("Update timing cache");
         auto timingCache = config->getTimingCache();
         samplesCommon::updateTimingCacheFile(gLogger.getTRTLogger(), build.timingCacheFile, timingCache, builder);
     }
@@ -1234,6 +1254,7 @@ bool networkToSerializedEngine(
 bool modelToBuildEnv(
     ModelOptions const& model, BuildOptions const& build, SystemOptions& sys, BuildEnvironment& env, std::ostream& err)
 {
+    std::unique_ptr<ScopedPhase> networkPhase{new ScopedPhase("Create network")};
     env.builder.reset(createBuilder());
     SMP_RETVAL_IF_FALSE(env.builder != nullptr, "Builder creation failed", false, err);
     env.builder->setErrorRecorder(&gRecorder);
@@ -1242,9 +1263,11 @@ bool modelToBuildEnv(
         : 0U;
     for (auto const& pluginPath : sys.dynamicPlugins)
     {
+        ScopedPhase const pluginPhase("Load plugin library " + pluginPath);
         env.builder->getPluginRegistry().loadLibrary(pluginPath.c_str());
     }
     env.network.reset(env.builder->createNetworkV2(networkFlags));
+    networkPhase.reset();
 
     std::vector<std::string> vcPluginLibrariesUsed;
     SMP_RETVAL_IF_FALSE(env.network != nullptr, "Network creation failed", false, err);
@@ -1459,6 +1482,7 @@ bool getEngineBuildEnv(
 
     if (build.load)
     {
+        ScopedPhase const phase("Load engine file");
         if (build.safe)
         {
             createEngineSuccess = loadEngineToBuildEnv(build.engine, env, err);
@@ -1477,6 +1501,7 @@ bool getEngineBuildEnv(
     }
     else
     {
+        ScopedPhase const phase("Build engine from model");
         createEngineSuccess = modelToBuildEnv(model, build, sys, env, err);
     }
 
@@ -1490,6 +1515,7 @@ bool getEngineBuildEnv(
 
     if (build.save)
     {
+        ScopedPhase const phase("Save engine");
         std::ofstream engineFile(build.engine, std::ios::binary);
         auto& engineBlob = env.engine.getBlob();
         engineFile.write(static_cast<char const*>(engineBlob.data), engineBlob.size);
@@ -196,6 +196,14 @@ public:
         mDynamicPlugins = dynamicPlugins;
     }
 
+    //!
+    //! \brief Set the allocator used by the runtime, which must outlive the engine. Has no effect once deserialized.
+    //!
+    void setGpuAllocator(nvinfer1::IGpuAllocator* allocator)
+    {
+        mGpuAllocator = allocator;
+    }
+
 private:
     bool mIsSafe{false};
     bool mVersionCompatible{false};
@@ -212,6 +220,7 @@ private:
     nvinfer1::TempfileControlFlags mTempfileControls{getTempfileControlDefaults()};
     std::string mLeanDLLPath{};
     std::vector<std::string> mDynamicPlugins;
+    nvinfer1::IGpuAllocator* mGpuAllocator{nullptr};
 
     //! \name Owned TensorRT objects
     //! Per TensorRT object lifetime requirements as outlined in the developer guide,
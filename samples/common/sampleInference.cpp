@@ -23,6 +23,8 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <sstream>
 #include <thread>
 #include <vector>
 
@@ -38,6 +40,7 @@
 #include "logger.h"
 #include "sampleInference.h"
 #include "sampleOptions.h"
+#include "samplePhases.h"
 #include "sampleReporting.h"
 #include "sampleUtils.h"
 
@@ -253,6 +256,7 @@ void contractInt64ToInt32(std::vector<int64_t>& shapeData)
 
 bool setUpInference(InferenceEnvironment& iEnv, InferenceOptions const& inference, SystemOptions const& system)
 {
+    ScopedPhase const phase("Set up inference");
     int32_t device{};
     CHECK(cudaGetDevice(&device));
 
@@ -339,6 +343,10 @@ bool setUpInference(InferenceEnvironment& iEnv, InferenceOptions const& inferenc
     cudaStream_t setOptProfileStream;
     CHECK(cudaStreamCreate(&setOptProfileStream));
 
+    std::unique_ptr<ScopedPhase> contextPhase{new ScopedPhase("Create execution contexts")};
+    iEnv.outputBufferPool
+        = std::make_shared<OutputBufferPool>(useManagedMemory, static_cast<size_t>(inference.outputPoolMiB) << 20);
+    OutputAllocatorPolicy const outputPolicy{inference.outputGrowthFactor, inference.outputShrinkAfter};
     for (int32_t s = 0; s < inference.infStreams; ++s)
     {
         IExecutionContext* ec{nullptr};
@@ -381,10 +389,12 @@ bool setUpInference(InferenceEnvironment& iEnv, InferenceOptions const& inferenc
         }
 
         iEnv.contexts.emplace_back(ec);
-        iEnv.bindings.emplace_back(std::make_unique<Bindings>(useManagedMemory));
+        iEnv.bindings.emplace_back(
+            std::make_unique<Bindings>(useManagedMemory, outputPolicy, iEnv.outputBufferPool));
     }
 
     CHECK(cudaStreamDestroy(setOptProfileStream));
+    contextPhase.reset();
 
     if (iEnv.profiler)
     {
@@ -512,8 +522,13 @@ bool setUpInference(InferenceEnvironment& iEnv, InferenceOptions const& inferenc
     // Create Debug Listener and turn on debug states if client requested dumping debug tensors.
     if (!inference.debugTensorFileNames.empty() || !inference.dumpAlldebugTensorFormats.empty())
     {
-        iEnv.listener = std::make_unique<DebugTensorWriter>(
-            inference.debugTensorFileNames, inference.dumpAlldebugTensorFormats, engine->getName(), iEnv.cmdline);
+        DebugTensorAsyncOptions asyncOptions;
+        asyncOptions.enabled = inference.asyncDebugTensors;
+        asyncOptions.queueDepth = inference.debugTensorQueueDepth;
+        asyncOptions.stagingBytes = static_cast<int64_t>(inference.debugTensorStagingSize) << 20;
+        asyncOptions.dropWhenFull = inference.dropDebugTensors;
+        iEnv.listener = std::make_unique<DebugTensorWriter>(inference.debugTensorFileNames,
+            inference.dumpAlldebugTensorFormats, engine->getName(), iEnv.cmdline, asyncOptions);
         iEnv.contexts.front()->setDebugListener(iEnv.listener.get());
         for (auto const& s : inference.debugTensorFileNames)
         {
@@ -530,6 +545,7 @@ bool setUpInference(InferenceEnvironment& iEnv, InferenceOptions const& inferenc
         return false;
     }
 
+    ScopedPhase const fillPhase("Fill inputs");
     auto const* context = iEnv.contexts.front().get();
     bool fillBindingsSuccess = FillStdBindings(
         engine, context, inference.inputs, iEnv.bindings, 1, endBindingIndex, inference.optProfileIndex)();
@@ -591,6 +607,7 @@ struct SyncStruct
     TrtCudaEvent gpuStart{cudaEventBlockingSync};
     TimePoint cpuStart{};
     float sleep{};
+    PhaseId phase{kNO_PHASE}; //!< Phase of the thread that launched the inference threads
 };
 
 struct Enqueue
@@ -908,6 +925,7 @@ private:
         mEnqueue = EnqueueFunction(EnqueueExplicit(context, mBindings));
         if (inference.graph)
         {
+            ScopedPhase const phase("Capture CUDA graph");
             sample::gLogInfo << "Capturing CUDA graph for the current execution context" << std::endl;
 
             TrtCudaStream& stream = getStream(StreamType::kCOMPUTE);
@@ -967,6 +985,8 @@ bool inferenceLoop(std::vector<std::unique_ptr<Iteration>>& iStreams, TimePoint
 {
     float durationMs = 0;
     int32_t skip = 0;
+    // The first iteration also pays for the initialization done by the first enqueue of each context.
+    std::unique_ptr<ScopedPhase> firstInferencePhase{new ScopedPhase(kFIRST_INFERENCE_PHASE)};
 
     if (maxDurationMs == -1.F)
     {
@@ -985,6 +1005,7 @@ bool inferenceLoop(std::vector<std::unique_ptr<Iteration>>& iStreams, TimePoint
             {
                 s->sync(cpuStart, gpuStart, trace, skipTransfers);
             }
+            firstInferencePhase.reset();
         }
     }
 
@@ -1001,6 +1022,7 @@ bool inferenceLoop(std::vector<std::unique_ptr<Iteration>>& iStreams, TimePoint
         {
             durationMs = std::max(durationMs, s->sync(cpuStart, gpuStart, trace, skipTransfers));
         }
+        firstInferencePhase.reset();
         if (durationMs < warmupMs) // Warming up
         {
             if (durationMs) // Skip complete iterations
@@ -1027,6 +1049,7 @@ void inferenceExecution(InferenceOptions const& inference, InferenceEnvironment&
 {
     try
     {
+        ScopedPhase const phase("Inference thread " + std::to_string(threadIdx), sync.phase);
         float warmupMs = inference.warmup;
         float durationMs = -1.F;
         if (inference.duration != -1.F)
@@ -1107,7 +1130,9 @@ bool runInference(
 
     trace.resize(0);
 
+    ScopedPhase const phase("Inference");
     SyncStruct sync;
+    sync.phase = phase.getId();
     sync.sleep = inference.sleep;
     sync.mainStream.sleep(&sync.sleep);
     sync.cpuStart = getCurrentTime();
@@ -1444,6 +1469,163 @@ void Binding::dump(std::ostream& os, Dims dims, Dims strides, int32_t vectorDim,
     }
 }
 
+namespace
+{
+
+//! Copy the elements of a tensor in row-major order into dst, converting them from Src to Dst.
+template <typename Dst, typename Src>
+void gatherElements(
+    void const* src, Dims const& dims, Dims const& strides, int32_t vectorDim, int32_t spv, std::vector<char>& dst)
+{
+    dst.resize(volume(dims) * sizeof(Dst));
+    auto const* typedSrc = static_cast<Src const*>(src);
+    auto* typedDst = reinterpret_cast<Dst*>(dst.data());
+    forEachElementOffset(dims, strides, vectorDim, spv,
+        [&](int64_t index, int64_t offset) { typedDst[index] = static_cast<Dst>(typedSrc[offset]); });
+}
+
+//! Copy the elements of an INT4 tensor in row-major order into dst, either unpacked to int8 or packed.
+void gatherInt4Elements(void const* src, Dims const& dims, Dims const& strides, int32_t vectorDim, int32_t spv,
+    bool unpack, std::vector<char>& dst)
+{
+    auto const vol = volume(dims);
+    dst.assign(unpack ? vol : samplesCommon::divUp(vol, 2), 0);
+    auto const* typedSrc = static_cast<uint8_t const*>(src);
+    forEachElementOffset(dims, strides, vectorDim, spv, [&](int64_t index, int64_t offset) {
+        uint8_t const nibble = (typedSrc[offset / 2] >> (offset % 2 == 0 ? 0 : 4)) & 0xF;
+        if (unpack)
+        {
+            dst[index] = static_cast<char>(static_cast<int8_t>(nibble << 4) >> 4);
+        }
+        else
+        {
+            dst[index / 2] = static_cast<char>(dst[index / 2] | (nibble << (index % 2 == 0 ? 0 : 4)));
+        }
+    });
+}
+
+} // namespace
+
+std::string Binding::exportBinary(
+    std::string const& prefix, bool numpy, Dims dims, Dims strides, int32_t vectorDim, int32_t spv) const
+{
+    void const* hostBuffer{};
+    if (outputAllocator != nullptr)
+    {
+        hostBuffer = outputAllocator->getBuffer()->getHostBuffer();
+        dims = outputAllocator->getFinalDims();
+    }
+    else
+    {
+        hostBuffer = buffer->getHostBuffer();
+    }
+
+    // Dense tensors are written straight from the host buffer, others are gathered in row-major order first.
+    bool const dense = isDenseLayout(dims, strides, vectorDim);
+    auto const vol = samplesCommon::volume(dims);
+    std::vector<char> gathered;
+    std::string dtype;
+    auto gatherAs = [&](auto dst, auto src) {
+        gatherElements<decltype(dst), decltype(src)>(hostBuffer, dims, strides, vectorDim, spv, gathered);
+    };
+    switch (dataType)
+    {
+    case DataType::kBOOL:
+    case DataType::kINT8:
+    case DataType::kUINT8:
+        dtype = dataType == DataType::kBOOL ? "|b1" : dataType == DataType::kINT8 ? "<i1" : "|u1";
+        if (!dense)
+        {
+            gatherAs(uint8_t{}, uint8_t{});
+        }
+        break;
+    case DataType::kHALF:
+        dtype = "<f2";
+        if (!dense)
+        {
+            gatherAs(uint16_t{}, uint16_t{});
+        }
+        break;
+    case DataType::kFLOAT:
+    case DataType::kINT32:
+        dtype = dataType == DataType::kFLOAT ? "<f4" : "<i4";
+        if (!dense)
+        {
+            gatherAs(uint32_t{}, uint32_t{});
+        }
+        break;
+    case DataType::kINT64:
+        dtype = "<i8";
+        if (!dense)
+        {
+            gatherAs(uint64_t{}, uint64_t{});
+        }
+        break;
+    case DataType::kBF16:
+        dtype = "<f4";
+        if (numpy)
+        {
+            gatherAs(float{}, BFloat16{});
+        }
+        else if (!dense)
+        {
+            gatherAs(uint16_t{}, uint16_t{});
+        }
+        break;
+    case DataType::kFP8:
+#if CUDA_VERSION >= 11060
+        dtype = "<f4";
+        if (numpy)
+        {
+            gatherAs(float{}, __nv_fp8_e4m3{});
+        }
+        else if (!dense)
+        {
+            gatherAs(uint8_t{}, uint8_t{});
+        }
+        break;
+#else
+        sample::gLogWarning << "FP8 output export is not supported in this CUDA version." << std::endl;
+        return "";
+#endif
+    case DataType::kINT4:
+        dtype = "<i1";
+        if (numpy || !dense)
+        {
+            gatherInt4Elements(hostBuffer, dims, strides, vectorDim, spv, numpy, gathered);
+        }
+        break;
+    case DataType::kFP4:
+    case DataType::kE8M0:
+        sample::gLogWarning << "Output export of " << dataType << " tensors is not supported." << std::endl;
+        return "";
+    }
+
+    void const* data = gathered.empty() ? hostBuffer : gathered.data();
+    int64_t const size = gathered.empty() ? samplesCommon::getNbBytes(dataType, vol) : gathered.size();
+    if (numpy)
+    {
+        std::string const fileName = prefix + ".npy";
+        return writeNumpyFile(data, dtype, dims, size, prefix, fileName) ? fileName : "";
+    }
+
+    std::stringstream fileName;
+    fileName << prefix << ".";
+    for (int32_t i = 0; i < dims.nbDims; ++i)
+    {
+        fileName << (i > 0 ? "." : "") << dims.d[i];
+    }
+    fileName << "." << dataType << ".raw";
+    std::ofstream f(fileName.str(), std::ios::out | std::ios::binary);
+    if (!f)
+    {
+        sample::gLogError << "Cannot open file for write: " << fileName.str() << std::endl;
+        return "";
+    }
+    f.write(static_cast<char const*>(data), size);
+    return f ? fileName.str() : "";
+}
+
 void Bindings::addBinding(TensorInfo const& tensorInfo, std::string const& fileName /*= ""*/)
 {
     auto const b = tensorInfo.bindingIndex;
@@ -1472,7 +1654,8 @@ void Bindings::addBinding(TensorInfo const& tensorInfo, std::string const& fileN
         ASSERT(!tensorInfo.isInput); // Only output shape can be possibly unknown because of DDS.
         if (mBindings[b].outputAllocator == nullptr)
         {
-            mBindings[b].outputAllocator = std::make_unique<OutputAllocator>(makeBuffer(mUseManaged));
+            mBindings[b].outputAllocator
+                = std::make_unique<OutputAllocator>(makeBuffer(mUseManaged), mOutputPolicy, mOutputPool);
         }
     }
     else
@@ -1552,6 +1735,18 @@ void Bindings::dumpBindingValues(nvinfer1::IExecutionContext const& context, int
     mBindings[binding].dump(os, dims, strides, vectorDim, spv, separator);
 }
 
+std::string Bindings::exportBindingValues(nvinfer1::IExecutionContext const& context, int32_t binding,
+    std::string const& prefix, bool numpy) const
+{
+    auto const tensorName = context.getEngine().getIOTensorName(binding);
+    Dims dims = context.getTensorShape(tensorName);
+    Dims strides = context.getTensorStrides(tensorName);
+    int32_t vectorDim = context.getEngine().getTensorVectorizedDim(tensorName);
+    int32_t const spv = context.getEngine().getTensorComponentsPerElement(tensorName);
+
+    return mBindings[binding].exportBinary(prefix, numpy, dims, strides, vectorDim, spv);
+}
+
 namespace
 {
 
@@ -1654,4 +1849,287 @@ bool Bindings::setTensorAddresses(nvinfer1::IExecutionContext& context) const
     return true;
 }
 
+size_t Bindings::getDeviceBytes() const
+{
+    size_t bytes{0};
+    for (auto const& b : mBindings)
+    {
+        if (b.buffer != nullptr)
+        {
+            bytes += b.buffer->getSize();
+        }
+    }
+    return bytes;
+}
+
+namespace
+{
+
+int64_t roundUpToPowerOfTwo(int64_t value)
+{
+    int64_t result{1};
+    while (result < value)
+    {
+        result *= 2;
+    }
+    return result;
+}
+
+bool isRuntimeDimension(int64_t dim)
+{
+    return dim == -1;
+}
+
+} // namespace
+
+ExecutionContextPool::ExecutionContextPool(nvinfer1::ICudaEngine& engine, bool useManaged, size_t memoryCap)
+    : mEngine(engine)
+    , mUseManaged(useManaged)
+    , mMemoryCap(memoryCap)
+{
+    for (int32_t b = 0; b < engine.getNbIOTensors(); ++b)
+    {
+        char const* name = engine.getIOTensorName(b);
+        Dims const dims = engine.getTensorShape(name);
+        if (engine.getTensorIOMode(name) == TensorIOMode::kINPUT
+            && std::any_of(dims.d, dims.d + dims.nbDims, isRuntimeDimension))
+        {
+            mDynamicInputs.emplace_back(name);
+        }
+    }
+}
+
+int32_t ExecutionContextPool::findProfile(std::vector<Dims> const& shapes) const
+{
+    for (int32_t p = 0; p < mEngine.getNbOptimizationProfiles(); ++p)
+    {
+        bool accepted{true};
+        for (size_t i = 0; i < mDynamicInputs.size() && accepted; ++i)
+        {
+            char const* name = mDynamicInputs[i].c_str();
+            Dims const minDims = mEngine.getProfileShape(name, p, OptProfileSelector::kMIN);
+            Dims const maxDims = mEngine.getProfileShape(name, p, OptProfileSelector::kMAX);
+            accepted = shapes[i].nbDims == minDims.nbDims;
+            for (int32_t d = 0; d < minDims.nbDims && accepted; ++d)
+            {
+                accepted = shapes[i].d[d] >= minDims.d[d] && shapes[i].d[d] <= maxDims.d[d];
+            }
+        }
+        if (accepted)
+        {
+            return p;
+        }
+    }
+    return -1;
+}
+
+ExecutionContextPool::PooledContext* ExecutionContextPool::acquire(
+    InferenceOptions::ShapeProfile const& shapes, TrtCudaStream& stream)
+{
+    std::vector<Dims> requested;
+    for (auto const& name : mDynamicInputs)
+    {
+        auto const shape = findPlausible(shapes, name);
+        if (shape == shapes.end())
+        {
+            sample::gLogError << "Shape missing for input with dynamic shape: " << name << std::endl;
+            return nullptr;
+        }
+        requested.push_back(toDims(shape->second));
+    }
+    int32_t const profile = findProfile(requested);
+    if (profile < 0)
+    {
+        sample::gLogError << "No optimization profile accepts the shapes:";
+        for (size_t i = 0; i < mDynamicInputs.size(); ++i)
+        {
+            sample::gLogError << " " << mDynamicInputs[i] << ":" << requested[i];
+        }
+        sample::gLogError << std::endl;
+        return nullptr;
+    }
+
+    std::vector<Dims> bucket = requested;
+    std::ostringstream key;
+    key << profile;
+    for (size_t i = 0; i < mDynamicInputs.size(); ++i)
+    {
+        char const* name = mDynamicInputs[i].c_str();
+        Dims const engineDims = mEngine.getTensorShape(name);
+        Dims const maxDims = mEngine.getProfileShape(name, profile, OptProfileSelector::kMAX);
+        for (int32_t d = 0; d < engineDims.nbDims; ++d)
+        {
+            if (isRuntimeDimension(engineDims.d[d]))
+            {
+                bucket[i].d[d] = std::min(roundUpToPowerOfTwo(requested[i].d[d]), maxDims.d[d]);
+            }
+        }
+        key << ";" << bucket[i];
+    }
+
+    auto const found = mIndex.find(key.str());
+    if (found != mIndex.end())
+    {
+        ++mStats.nbHits;
+        mContexts.splice(mContexts.begin(), mContexts, found->second);
+    }
+    else
+    {
+        ++mStats.nbMisses;
+        auto pooled = createContext(profile, bucket, stream);
+        if (pooled == nullptr)
+        {
+            return nullptr;
+        }
+        pooled->key = key.str();
+        mStats.deviceBytes += pooled->deviceBytes;
+        mStats.peakDeviceBytes = std::max(mStats.peakDeviceBytes, mStats.deviceBytes);
+        ++mStats.nbContexts;
+        mContexts.push_front(std::move(pooled));
+        mIndex[key.str()] = mContexts.begin();
+        evict();
+    }
+
+    auto& pooled = *mContexts.front();
+    return setShapes(pooled, requested) ? &pooled : nullptr;
+}
+
+std::unique_ptr<ExecutionContextPool::PooledContext> ExecutionContextPool::createContext(
+    int32_t profile, std::vector<Dims> const& bucket, TrtCudaStream& stream)
+{
+    std::unique_ptr<PooledContext> pooled{new PooledContext};
+    pooled->profile = profile;
+    pooled->context.reset(mEngine.createExecutionContext(ExecutionContextAllocationStrategy::kUSER_MANAGED));
+    if (pooled->context == nullptr || !pooled->context->setOptimizationProfileAsync(profile, stream.get()))
+    {
+        sample::gLogError << "Unable to create an execution context for profile " << profile << std::endl;
+        return nullptr;
+    }
+    for (size_t i = 0; i < mDynamicInputs.size(); ++i)
+    {
+        if (!pooled->context->setInputShape(mDynamicInputs[i].c_str(), bucket[i]))
+        {
+            return nullptr;
+        }
+    }
+
+    size_t const memorySize = pooled->context->updateDeviceMemorySizeForShapes();
+    pooled->memory = TrtDeviceBuffer(memorySize);
+    pooled->context->setDeviceMemoryV2(pooled->memory.get(), pooled->memory.getSize());
+
+    std::unordered_map<std::string, std::string> const noInputs;
+    std::vector<std::unique_ptr<Bindings>> bindings;
+    bindings.emplace_back(std::make_unique<Bindings>(mUseManaged));
+    if (!FillBindingClosure<nvinfer1::ICudaEngine>(
+            &mEngine, pooled->context.get(), noInputs, bindings, 1, mEngine.getNbIOTensors(), profile)()
+        || !bindings.front()->setTensorAddresses(*pooled->context))
+    {
+        return nullptr;
+    }
+    pooled->bindings = std::move(bindings.front());
+    pooled->deviceBytes = memorySize + pooled->bindings->getDeviceBytes();
+    return pooled;
+}
+
+bool ExecutionContextPool::setShapes(PooledContext& pooled, std::vector<Dims> const& shapes)
+{
+    bool changed{false};
+    for (size_t i = 0; i < mDynamicInputs.size(); ++i)
+    {
+        char const* name = mDynamicInputs[i].c_str();
+        Dims const current = pooled.context->getTensorShape(name);
+        if (current.nbDims == shapes[i].nbDims && std::equal(current.d, current.d + current.nbDims, shapes[i].d))
+        {
+            continue;
+        }
+        if (!pooled.context->setInputShape(name, shapes[i]))
+        {
+            return false;
+        }
+        changed = true;
+    }
+
+    size_t const memorySize = changed ? pooled.context->updateDeviceMemorySizeForShapes() : 0;
+    if (memorySize > pooled.memory.getSize())
+    {
+        // Only expected when the memory needed does not grow with the shapes.
+        mStats.deviceBytes += memorySize - pooled.memory.getSize();
+        mStats.peakDeviceBytes = std::max(mStats.peakDeviceBytes, mStats.deviceBytes);
+        pooled.deviceBytes += memorySize - pooled.memory.getSize();
+        pooled.memory = TrtDeviceBuffer(memorySize);
+        pooled.context->setDeviceMemoryV2(pooled.memory.get(), pooled.memory.getSize());
+    }
+    return true;
+}
+
+void ExecutionContextPool::evict()
+{
+    while (mMemoryCap > 0 && mStats.deviceBytes > static_cast<int64_t>(mMemoryCap) && mContexts.size() > 1)
+    {
+        auto const& lru = mContexts.back();
+        mStats.deviceBytes -= lru->deviceBytes;
+        --mStats.nbContexts;
+        ++mStats.nbEvictions;
+        mIndex.erase(lru->key);
+        mContexts.pop_back();
+    }
+}
+
+bool runContextPoolBenchmark(InferenceOptions const& inference, InferenceEnvironment& iEnv)
+{
+    auto* engine = iEnv.engine.get();
+    SMP_RETVAL_IF_FALSE(engine != nullptr, "Got invalid engine!", false, sample::gLogError);
+    for (int32_t b = 0; b < engine->getNbIOTensors(); ++b)
+    {
+        char const* name = engine->getIOTensorName(b);
+        if (engine->getTensorIOMode(name) == TensorIOMode::kINPUT && engine->isShapeInferenceIO(name))
+        {
+            sample::gLogError << "The context pool does not support input shape tensors: " << name << std::endl;
+            return false;
+        }
+    }
+
+    ExecutionContextPool pool(*engine, inference.useManaged, static_cast<size_t>(inference.contextPoolMiB) << 20);
+    TrtCudaStream stream;
+    int32_t const nbShapes = static_cast<int32_t>(inference.poolShapes.size());
+    int32_t const nbRequests = std::max(inference.iterations, nbShapes);
+    std::vector<float> hitLatencies;
+    std::vector<float> missLatencies;
+    for (int32_t r = 0; r < nbRequests; ++r)
+    {
+        auto const start = std::chrono::high_resolution_clock::now();
+        int64_t const nbMisses = pool.getStats().nbMisses;
+        auto* pooled = pool.acquire(inference.poolShapes[r % nbShapes], stream);
+        if (pooled == nullptr || !pooled->context->enqueueV3(stream.get()))
+        {
+            sample::gLogError << "Context pool request " << r << " failed." << std::endl;
+            return false;
+        }
+        stream.synchronize();
+        float const latencyMs
+            = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        (pool.getStats().nbMisses > nbMisses ? missLatencies : hitLatencies).push_back(latencyMs);
+    }
+
+    auto printLatencies = [](char const* what, std::vector<float> const& latencies) {
+        if (latencies.empty())
+        {
+            return;
+        }
+        float const total = std::accumulate(latencies.begin(), latencies.end(), 0.F);
+        sample::gLogInfo << "Latency on " << what << " contexts: mean = " << total / latencies.size()
+                         << " ms, max = " << *std::max_element(latencies.begin(), latencies.end()) << " ms ("
+                         << latencies.size() << " requests)" << std::endl;
+    };
+    auto const& stats = pool.getStats();
+    sample::gLogInfo << "=== Context Pool ===" << std::endl;
+    sample::gLogInfo << "Requests: " << nbRequests << ", hits: " << stats.nbHits << ", misses: " << stats.nbMisses
+                     << ", evictions: " << stats.nbEvictions << std::endl;
+    sample::gLogInfo << "Contexts: " << stats.nbContexts << ", device memory: " << stats.deviceBytes / 1.0_MiB
+                     << " MiB (peak " << stats.peakDeviceBytes / 1.0_MiB << " MiB)" << std::endl;
+    printLatencies("cached", hitLatencies);
+    printLatencies("new", missLatencies);
+    return true;
+}
+
 } // namespace sample
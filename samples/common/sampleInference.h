@@ -29,6 +29,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace sample
@@ -52,6 +53,7 @@ struct InferenceEnvironment
     std::vector<TrtDeviceBuffer>
         deviceMemory; //< Device memory used for inference when the allocation strategy is not static.
     std::vector<std::unique_ptr<Bindings>> bindings;
+    std::shared_ptr<OutputBufferPool> outputBufferPool; //!< Buffers of the outputs with data-dependent shapes
     std::unique_ptr<DebugTensorWriter> listener;
     bool error{false};
 
@@ -114,6 +116,17 @@ struct Binding
 
     void dump(std::ostream& os, nvinfer1::Dims dims, nvinfer1::Dims strides, int32_t vectorDim, int32_t spv,
         std::string const separator = " ") const;
+
+    //!
+    //! \brief Write the values in row-major order to a binary file.
+    //!
+    //! Writes <prefix>.npy if numpy is true, and <prefix>.<dims>.<type>.raw otherwise. Numpy has no BF16, FP8 or INT4
+    //! type, so these are written as float and int8 in .npy files.
+    //!
+    //! \return The name of the file, or an empty string on failure.
+    //!
+    std::string exportBinary(std::string const& prefix, bool numpy, nvinfer1::Dims dims, nvinfer1::Dims strides,
+        int32_t vectorDim, int32_t spv) const;
 };
 
 struct TensorInfo
@@ -139,8 +152,11 @@ class Bindings
 {
 public:
     Bindings() = delete;
-    explicit Bindings(bool useManaged)
+    explicit Bindings(bool useManaged, OutputAllocatorPolicy const& outputPolicy = {},
+        std::shared_ptr<OutputBufferPool> outputPool = nullptr)
         : mUseManaged(useManaged)
+        , mOutputPolicy(outputPolicy)
+        , mOutputPool(std::move(outputPool))
     {
     }
 
@@ -168,6 +184,9 @@ public:
     void dumpBindingValues(nvinfer1::IExecutionContext const& context, int32_t binding, std::ostream& os,
         std::string const& separator = " ", int32_t batch = 1) const;
 
+    std::string exportBindingValues(nvinfer1::IExecutionContext const& context, int32_t binding,
+        std::string const& prefix, bool numpy) const;
+
     void dumpRawBindingToFiles(nvinfer1::IExecutionContext const& context, std::ostream& os) const;
 
     void dumpInputs(nvinfer1::IExecutionContext const& context, std::ostream& os) const
@@ -225,13 +244,92 @@ public:
 
     bool setTensorAddresses(nvinfer1::IExecutionContext& context) const;
 
+    //! Return the device memory of the buffers allocated up front, excluding the outputs with data-dependent shapes.
+    size_t getDeviceBytes() const;
+
 private:
     std::unordered_map<std::string, int32_t> mNames;
     std::vector<Binding> mBindings;
     std::vector<void*> mDevicePointers;
     bool mUseManaged{false};
+    OutputAllocatorPolicy mOutputPolicy;
+    std::shared_ptr<OutputBufferPool> mOutputPool; //!< Shared by the bindings of all the contexts
 };
 
+struct ContextPoolStats
+{
+    int64_t nbHits{0};
+    int64_t nbMisses{0};
+    int64_t nbEvictions{0};
+    int64_t deviceBytes{0}; //!< Context memory and bindings of the contexts in the pool
+    int64_t peakDeviceBytes{0};
+    int32_t nbContexts{0};
+};
+
+//!
+//! \class ExecutionContextPool
+//! \brief Execution contexts created on demand per optimization profile and shape bucket, kept with their bindings.
+//!
+//! The input shapes of a request are rounded up to a bucket: each runtime dimension to the next power of two, clamped
+//! to the maximum of the first profile accepting the shapes. A context is set up once per profile and bucket, with
+//! bindings sized for the bucket, and then serves any shapes of the bucket with setInputShape() alone. This assumes
+//! that the outputs do not grow when the inputs shrink. When the device memory of the pool goes over the cap, the least
+//! recently used contexts are destroyed.
+//!
+//! Contexts are destroyed without synchronization, so the work queued on a context must have finished before the next
+//! call to acquire(). The pool is not thread-safe, and does not support engines with input shape tensors.
+//!
+class ExecutionContextPool
+{
+public:
+    struct PooledContext
+    {
+        int32_t profile{0};
+        // Declared before the context, so that the context is destroyed before the memory and the bindings it uses.
+        TrtDeviceBuffer memory;
+        std::unique_ptr<Bindings> bindings;
+        std::unique_ptr<nvinfer1::IExecutionContext> context;
+        size_t deviceBytes{0};
+        std::string key;
+    };
+
+    //! \param memoryCap Maximum device memory of the pool in bytes, or 0 for no limit.
+    ExecutionContextPool(nvinfer1::ICudaEngine& engine, bool useManaged, size_t memoryCap);
+
+    //!
+    //! \brief Return a context set to the given input shapes, or nullptr if no profile accepts them.
+    //!
+    //! The context stays valid until the next call, and its work must be queued on stream.
+    //!
+    PooledContext* acquire(InferenceOptions::ShapeProfile const& shapes, TrtCudaStream& stream);
+
+    ContextPoolStats const& getStats() const
+    {
+        return mStats;
+    }
+
+private:
+    int32_t findProfile(std::vector<nvinfer1::Dims> const& shapes) const;
+    std::unique_ptr<PooledContext> createContext(
+        int32_t profile, std::vector<nvinfer1::Dims> const& bucket, TrtCudaStream& stream);
+    bool setShapes(PooledContext& pooled, std::vector<nvinfer1::Dims> const& shapes);
+    void evict();
+
+    nvinfer1::ICudaEngine& mEngine;
+    bool mUseManaged{false};
+    size_t mMemoryCap{0};
+    std::vector<std::string> mDynamicInputs; //!< Inputs with runtime dimensions
+    std::list<std::unique_ptr<PooledContext>> mContexts; //!< Most recently used first
+    std::unordered_map<std::string, std::list<std::unique_ptr<PooledContext>>::iterator> mIndex;
+    ContextPoolStats mStats;
+};
+
+//!
+//! \brief Run requests cycling through the shapes of --poolShapes on contexts from an ExecutionContextPool, and report
+//!        the pool statistics and the latency of the requests served by cached and by new contexts.
+//!
+bool runContextPoolBenchmark(InferenceOptions const& inference, InferenceEnvironment& iEnv);
+
 struct TaskInferenceEnvironment
 {
     TaskInferenceEnvironment(std::string engineFile, InferenceOptions const& inference,
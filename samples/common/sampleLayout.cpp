@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sampleLayout.h"
+#include "common.h"
+#include "sampleUtils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace nvinfer1;
+
+namespace sample
+{
+
+namespace
+{
+
+//! Tile edge in elements. A 32x32 tile of 8-byte elements is 8 KiB, so a source and a destination tile stay in L1.
+constexpr int64_t kTILE{32};
+
+//! Minimum number of bytes a worker thread should move; smaller conversions are not worth spawning threads for.
+constexpr int64_t kMIN_BYTES_PER_THREAD{1 << 20};
+
+bool isPacked4(DataType type)
+{
+    return type == DataType::kINT4 || type == DataType::kFP4;
+}
+
+//! Transpose source rows [rowBegin, rowEnd) of a rows x cols matrix, one kTILE x kTILE tile at a time.
+template <typename T>
+void transposeRowRange(T* dst, T const* src, int64_t rows, int64_t cols, int64_t rowBegin, int64_t rowEnd)
+{
+    for (int64_t r0 = rowBegin; r0 < rowEnd; r0 += kTILE)
+    {
+        int64_t const r1 = std::min(r0 + kTILE, rowEnd);
+        for (int64_t c0 = 0; c0 < cols; c0 += kTILE)
+        {
+            int64_t const c1 = std::min(c0 + kTILE, cols);
+            for (int64_t c = c0; c < c1; ++c)
+            {
+                T* out = dst + c * rows;
+                for (int64_t r = r0; r < r1; ++r)
+                {
+                    out[r] = src[r * cols + c];
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+void transposeBatchedImpl(void* dst, void const* src, int64_t batch, int64_t rows, int64_t cols, int32_t nbThreads)
+{
+    auto* tdst = static_cast<T*>(dst);
+    auto const* tsrc = static_cast<T const*>(src);
+    int64_t const matrixSize = rows * cols;
+    int64_t const nbRowTiles = samplesCommon::divUp(rows, kTILE);
+
+    // One work item is a band of kTILE source rows of one matrix. Bands write disjoint column ranges of the output.
+    int64_t const bandBytes = kTILE * cols * static_cast<int64_t>(sizeof(T));
+    int64_t const minBands = std::max(kMIN_BYTES_PER_THREAD / std::max(bandBytes, int64_t{1}), int64_t{1});
+    parallelFor(batch * nbRowTiles, minBands, nbThreads, [&](int64_t begin, int64_t end) {
+        for (int64_t item = begin; item < end; ++item)
+        {
+            int64_t const b = item / nbRowTiles;
+            int64_t const rowBegin = (item % nbRowTiles) * kTILE;
+            int64_t const rowEnd = std::min(rowBegin + kTILE, rows);
+            transposeRowRange(tdst + b * matrixSize, tsrc + b * matrixSize, rows, cols, rowBegin, rowEnd);
+        }
+    });
+}
+
+//! Transpose packed 4-bit elements. Two elements share a byte, so this runs on a single thread.
+void transposeBatchedPacked4(void* dst, void const* src, int64_t batch, int64_t rows, int64_t cols)
+{
+    auto* bdst = static_cast<uint8_t*>(dst);
+    auto const* bsrc = static_cast<uint8_t const*>(src);
+    int64_t const matrixSize = rows * cols;
+    std::memset(bdst, 0, samplesCommon::getNbBytes(DataType::kINT4, batch * matrixSize));
+
+    for (int64_t b = 0; b < batch; ++b)
+    {
+        int64_t const base = b * matrixSize;
+        for (int64_t r0 = 0; r0 < rows; r0 += kTILE)
+        {
+            int64_t const r1 = std::min(r0 + kTILE, rows);
+            for (int64_t c0 = 0; c0 < cols; c0 += kTILE)
+            {
+                int64_t const c1 = std::min(c0 + kTILE, cols);
+                for (int64_t c = c0; c < c1; ++c)
+                {
+                    for (int64_t r = r0; r < r1; ++r)
+                    {
+                        int64_t const s = base + r * cols + c;
+                        int64_t const d = base + c * rows + r;
+                        uint8_t const nibble = (bsrc[s / 2] >> ((s % 2) * 4)) & 0xF;
+                        bdst[d / 2] |= static_cast<uint8_t>(nibble << ((d % 2) * 4));
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+void transposeBatched(
+    void* dst, void const* src, int64_t batch, int64_t rows, int64_t cols, size_t elementSize, int32_t nbThreads)
+{
+    ASSERT(dst != src);
+    ASSERT(batch >= 0 && rows >= 0 && cols >= 0);
+    switch (elementSize)
+    {
+    case 1: transposeBatchedImpl<uint8_t>(dst, src, batch, rows, cols, nbThreads); break;
+    case 2: transposeBatchedImpl<uint16_t>(dst, src, batch, rows, cols, nbThreads); break;
+    case 4: transposeBatchedImpl<uint32_t>(dst, src, batch, rows, cols, nbThreads); break;
+    case 8: transposeBatchedImpl<uint64_t>(dst, src, batch, rows, cols, nbThreads); break;
+    default: ASSERT(false && "Unsupported element size");
+    }
+}
+
+void transposeBatched(
+    void* dst, void const* src, int64_t batch, int64_t rows, int64_t cols, DataType type, int32_t nbThreads)
+{
+    if (isPacked4(type))
+    {
+        ASSERT(dst != src);
+        transposeBatchedPacked4(dst, src, batch, rows, cols);
+        return;
+    }
+    transposeBatched(dst, src, batch, rows, cols, samplesCommon::getNbBytes(type, 1), nbThreads);
+}
+
+void transpose2D(void* dst, void const* src, int64_t rows, int64_t cols, DataType type, int32_t nbThreads)
+{
+    transposeBatched(dst, src, 1, rows, cols, type, nbThreads);
+}
+
+void transposeSubBuffer(void* data, int64_t rows, int64_t cols, DataType type, int32_t nbThreads)
+{
+    ASSERT(data != nullptr);
+    size_t const nbBytes = samplesCommon::getNbBytes(type, rows * cols);
+    std::vector<uint8_t> tmp(static_cast<uint8_t const*>(data), static_cast<uint8_t const*>(data) + nbBytes);
+    transpose2D(data, tmp.data(), rows, cols, type, nbThreads);
+}
+
+void convertNCHWToNHWC(void* dst, void const* src, Dims const& dims, DataType type, int32_t nbThreads)
+{
+    ASSERT(dims.nbDims >= 2);
+    int64_t const spatial = samplesCommon::volume(dims, 2, dims.nbDims);
+    transposeBatched(dst, src, dims.d[0], dims.d[1], spatial, type, nbThreads);
+}
+
+void convertNHWCToNCHW(void* dst, void const* src, Dims const& dims, DataType type, int32_t nbThreads)
+{
+    ASSERT(dims.nbDims >= 2);
+    int64_t const spatial = samplesCommon::volume(dims, 2, dims.nbDims);
+    transposeBatched(dst, src, dims.d[0], spatial, dims.d[1], type, nbThreads);
+}
+
+} // namespace sample
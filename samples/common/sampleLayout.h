@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_SAMPLE_LAYOUT_H
+#define TRT_SAMPLE_LAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "NvInfer.h"
+
+namespace sample
+{
+
+//!
+//! \brief Host-side weight and tensor layout conversions.
+//!
+//! All routines operate on dense row-major buffers. Matrices are processed in cache-sized tiles, and large inputs are
+//! split across threads. nbThreads <= 0 selects the number of hardware threads. Sub-byte types (kINT4, kFP4) are
+//! packed two elements per byte, low nibble first, and are converted on a single thread since neighbouring elements
+//! share a byte.
+//!
+
+//!
+//! \brief Transpose a batch of rows x cols matrices of elements of elementSize bytes into cols x rows matrices.
+//!
+//! \p dst and \p src must not overlap. Supported element sizes are 1, 2, 4 and 8 bytes.
+//!
+void transposeBatched(void* dst, void const* src, int64_t batch, int64_t rows, int64_t cols, size_t elementSize,
+    int32_t nbThreads = 0);
+
+//!
+//! \brief Transpose a batch of rows x cols matrices of the given data type into cols x rows matrices.
+//!
+void transposeBatched(void* dst, void const* src, int64_t batch, int64_t rows, int64_t cols,
+    nvinfer1::DataType type, int32_t nbThreads = 0);
+
+//!
+//! \brief Transpose a rows x cols matrix of the given data type into a cols x rows matrix.
+//!
+void transpose2D(
+    void* dst, void const* src, int64_t rows, int64_t cols, nvinfer1::DataType type, int32_t nbThreads = 0);
+
+//!
+//! \brief Transpose a rows x cols sub-buffer in place, using a temporary buffer of the same size.
+//!
+void transposeSubBuffer(void* data, int64_t rows, int64_t cols, nvinfer1::DataType type, int32_t nbThreads = 0);
+
+//!
+//! \brief Convert a tensor from NCHW to NHWC layout.
+//!
+//! \p dims holds the NCHW extents; every dimension after the second is treated as spatial, so NCDHW is supported too.
+//!
+void convertNCHWToNHWC(
+    void* dst, void const* src, nvinfer1::Dims const& dims, nvinfer1::DataType type, int32_t nbThreads = 0);
+
+//!
+//! \brief Convert a tensor from NHWC to NCHW layout.
+//!
+//! \p dims holds the NCHW extents of the tensor, i.e. the extents of the converted result.
+//!
+void convertNHWCToNCHW(
+    void* dst, void const* src, nvinfer1::Dims const& dims, nvinfer1::DataType type, int32_t nbThreads = 0);
+
+} // namespace sample
+
+#endif // TRT_SAMPLE_LAYOUT_H
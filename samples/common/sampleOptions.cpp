@@ -1695,6 +1695,45 @@ void InferenceOptions::parse(Arguments& arguments)
     {
         throw std::invalid_argument(std::string("Unknown allocationStrategy: ") + allocationStrategyString);
     }
+    getAndDelOption(arguments, "--cachingAllocator", cachingAllocator);
+    getAndDelOption(arguments, "--pinnedPool", pinnedPoolMiB);
+    if (pinnedPoolMiB < 0)
+    {
+        throw std::invalid_argument("--pinnedPool must be non-negative.");
+    }
+    getAndDelOption(arguments, "--outputGrowth", outputGrowthFactor);
+    if (outputGrowthFactor < 1.F)
+    {
+        throw std::invalid_argument("--outputGrowth must be at least 1.");
+    }
+    getAndDelOption(arguments, "--outputShrinkAfter", outputShrinkAfter);
+    if (outputShrinkAfter < 0)
+    {
+        throw std::invalid_argument("--outputShrinkAfter must be non-negative.");
+    }
+    getAndDelOption(arguments, "--outputPoolMemory", outputPoolMiB);
+    if (outputPoolMiB < 0)
+    {
+        throw std::invalid_argument("--outputPoolMemory must be non-negative.");
+    }
+
+    std::vector<std::string> poolShapesList;
+    getAndDelRepeatedOption(arguments, "--poolShapes", poolShapesList);
+    for (auto const& list : poolShapesList)
+    {
+        ShapeProfile poolShape;
+        for (auto const& s : splitToStringVec(list, ','))
+        {
+            auto nameDimsPair = splitNameAndValue<std::vector<int64_t>>(s);
+            insertShapesInference(poolShape, removeSingleQuotationMarks(nameDimsPair.first), nameDimsPair.second);
+        }
+        poolShapes.push_back(poolShape);
+    }
+    getAndDelOption(arguments, "--contextPoolMemory", contextPoolMiB);
+    if (contextPoolMiB < 0)
+    {
+        throw std::invalid_argument("--contextPoolMemory must be non-negative.");
+    }
 
     bool allowWs{false};
     getAndDelOption(arguments, "--allowWeightStreaming", allowWs);
@@ -1718,12 +1757,28 @@ void InferenceOptions::parse(Arguments& arguments)
     std::string debugFormats;
     getAndDelOption(arguments, "--saveAllDebugTensors", debugFormats);
     dumpAlldebugTensorFormats = splitToStringVec(debugFormats, ',');
+
+    getAndDelOption(arguments, "--asyncDebugTensors", asyncDebugTensors);
+    getAndDelOption(arguments, "--dropDebugTensors", dropDebugTensors);
+    getAndDelOption(arguments, "--debugTensorQueueDepth", debugTensorQueueDepth);
+    getAndDelOption(arguments, "--debugTensorStagingSize", debugTensorStagingSize);
+    if (debugTensorQueueDepth < 1 || debugTensorStagingSize < 1)
+    {
+        throw std::invalid_argument("--debugTensorQueueDepth and --debugTensorStagingSize must be positive.");
+    }
 }
 
 void ReportingOptions::parse(Arguments& arguments)
 {
     getAndDelOption(arguments, "--avgRuns", avgs);
     getAndDelOption(arguments, "--verbose", verbose);
+    getAndDelOption(arguments, "--asyncLogging", asyncLogging);
+    getAndDelOption(arguments, "--logQueueDepth", logQueueDepth);
+    getAndDelOption(arguments, "--dropLogs", dropLogs);
+    if (logQueueDepth < 1)
+    {
+        throw std::invalid_argument("--logQueueDepth must be positive.");
+    }
     getAndDelOption(arguments, "--dumpRefit", refit);
     getAndDelOption(arguments, "--dumpOutput", output);
     getAndDelOption(arguments, "--dumpRawBindingsToFile", dumpRawBindings);
@@ -1731,7 +1786,14 @@ void ReportingOptions::parse(Arguments& arguments)
     getAndDelOption(arguments, "--dumpLayerInfo", layerInfo);
     getAndDelOption(arguments, "--dumpOptimizationProfile", optProfileInfo);
     getAndDelOption(arguments, "--exportTimes", exportTimes);
+    getAndDelOption(arguments, "--exportPhases", exportPhases);
     getAndDelOption(arguments, "--exportOutput", exportOutput);
+    getAndDelOption(arguments, "--exportOutputFormat", exportOutputFormat);
+    if (exportOutputFormat != "json" && exportOutputFormat != "npy" && exportOutputFormat != "raw")
+    {
+        throw std::invalid_argument(
+            "Invalid --exportOutputFormat " + exportOutputFormat + ", expected json, npy or raw.");
+    }
     getAndDelOption(arguments, "--exportProfile", exportProfile);
     getAndDelOption(arguments, "--exportLayerInfo", exportLayerInfo);
 
@@ -1887,6 +1949,21 @@ void TaskInferenceOptions::parse(Arguments& arguments)
     getAndDelOption(arguments, "persistentCacheRatio", persistentCacheRatio);
 }
 
+void BatchJobOptions::parse(Arguments& arguments)
+{
+    getAndDelOption(arguments, "--jobs", jobFile);
+    getAndDelOption(arguments, "--jobThreads", jobThreads);
+    getAndDelOption(arguments, "--exportJobReport", exportJobReport);
+    if (jobThreads < 1)
+    {
+        throw std::invalid_argument("--jobThreads must be at least 1.");
+    }
+    if (jobFile.empty() && (jobThreads != 1 || !exportJobReport.empty()))
+    {
+        throw std::invalid_argument("--jobThreads and --exportJobReport require --jobs.");
+    }
+}
+
 void SafeBuilderOptions::parse(Arguments& arguments)
 {
     auto getFormats = [&arguments](std::vector<IOFormat>& formatsVector, const char* argument) {
@@ -2357,6 +2434,8 @@ std::ostream& operator<<(std::ostream& os, const InferenceOptions& options)
     {
         wsBudget = std::to_string(options.weightStreamingBudget.percent) + "%";
     }
+    std::string const pinnedPool
+        = options.pinnedPoolMiB > 0 ? std::to_string(options.pinnedPoolMiB) + " MiB slabs" : "Disabled";
 
     os << "Iterations: "                << options.iterations                                   << std::endl <<
           "Duration: "                  << options.duration   << "s (+ "
@@ -2375,7 +2454,14 @@ std::ostream& operator<<(std::ostream& os, const InferenceOptions& options)
           "NVTX verbosity: "            << static_cast<int32_t>(options.nvtxVerbosity)          << std::endl <<
           "Persistent Cache Ratio: "    << static_cast<float>(options.persistentCacheRatio)     << std::endl <<
           "Optimization Profile Index: "<< options.optProfileIndex                              << std::endl <<
-          "Weight Streaming Budget: "   << wsBudget                                             << std::endl;
+          "Weight Streaming Budget: "   << wsBudget                                             << std::endl <<
+          "Caching Allocator: "         << boolToEnabled(options.cachingAllocator)              << std::endl <<
+          "Pinned Pool: "               << pinnedPool                                           << std::endl <<
+          "Output Growth Factor: "      << options.outputGrowthFactor                           << std::endl <<
+          "Output Shrink After: "       << options.outputShrinkAfter << " requests"             << std::endl <<
+          "Output Pool Cap: "           << options.outputPoolMiB << " MiB"                      << std::endl <<
+          "Context Pool Shapes: "       << options.poolShapes.size() << " sets"                 << std::endl <<
+          "Context Pool Memory: "       << options.contextPoolMiB << " MiB"                     << std::endl;
     // clang-format on
 
     os << "Inputs:" << std::endl;
@@ -2394,6 +2480,12 @@ std::ostream& operator<<(std::ostream& os, const InferenceOptions& options)
     {
         os << format << std::endl;
     }
+    if (options.asyncDebugTensors)
+    {
+        os << "Debug Tensor Dump: Asynchronous, queue depth " << options.debugTensorQueueDepth << ", staging "
+           << options.debugTensorStagingSize << " MiB, " << (options.dropDebugTensors ? "drop" : "block")
+           << " when full" << std::endl;
+    }
 
     return os;
 }
@@ -2403,13 +2495,16 @@ std::ostream& operator<<(std::ostream& os, const ReportingOptions& options)
     // clang-format off
     os << "=== Reporting Options ==="                                                     << std::endl <<
           "Verbose: "                     << boolToEnabled(options.verbose)               << std::endl <<
+          "Asynchronous logging: "        << boolToEnabled(options.asyncLogging)          << std::endl <<
           "Averages: "                    << options.avgs << " inferences"                << std::endl <<
           "Percentiles: "                 << joinValuesToString(options.percentiles, ",") << std::endl <<
           "Dump refittable layers:"       << boolToEnabled(options.refit)                 << std::endl <<
           "Dump output: "                 << boolToEnabled(options.output)                << std::endl <<
           "Profile: "                     << boolToEnabled(options.profile)               << std::endl <<
           "Export timing to JSON file: "  << options.exportTimes                          << std::endl <<
+          "Export phases to JSON file: "  << options.exportPhases                         << std::endl <<
           "Export output to JSON file: "  << options.exportOutput                         << std::endl <<
+          "Export output format: "        << options.exportOutputFormat                   << std::endl <<
           "Export profile to JSON file: " << options.exportProfile                        << std::endl;
     // clang-format on
 
@@ -2760,6 +2855,22 @@ void InferenceOptions::help(std::ostream& os)
           "                                  static = Allocate device memory based on max size across all profiles."                 << std::endl <<
           "                                  profile = Allocate device memory based on max size of the current profile."             << std::endl <<
           "                                  runtime = Allocate device memory based on the actual input shapes."                     << std::endl <<
+          "  --cachingAllocator          Serve the device memory of the runtime and of the I/O buffers from a caching allocator,"    << std::endl <<
+          "                              which reuses released blocks instead of calling cudaMalloc and cudaFree again"             << std::endl <<
+          "                              (default = disabled)"                                                                       << std::endl <<
+          "  --pinnedPool=N              Sub-allocate the pinned host buffers of the bindings from slabs of N MiB instead of"        << std::endl <<
+          "                              pinning each buffer separately (default = 0, disabled)"                                     << std::endl <<
+          "  --outputGrowth=F            Give the buffer of an output with a data-dependent shape at least F times its previous"     << std::endl <<
+          "                              size when it grows (default = 1, the requested size only)"                                  << std::endl <<
+          "  --outputShrinkAfter=N       Shrink the buffer of an output with a data-dependent shape after N consecutive"             << std::endl <<
+          "                              inferences using less than a quarter of it (default = 0, never shrink)"                     << std::endl <<
+          "  --outputPoolMemory=N        Cap the released buffers of outputs with data-dependent shapes kept for reuse to N MiB,"    << std::endl <<
+          "                              freeing the least recently released ones (default = " << defaultOutputPoolMiB << ", 0 = no cap)" << std::endl <<
+          "  --poolShapes=spec           After the inference, run requests cycling through the shapes of the repeated --poolShapes"  << std::endl <<
+          "                              flags on contexts created per optimization profile and shape bucket, and report the"        << std::endl <<
+          "                              hits, misses and evictions of the context pool. Same format as --shapes."                   << std::endl <<
+          "  --contextPoolMemory=N       Cap the device memory of the contexts of --poolShapes to N MiB, evicting the least"         << std::endl <<
+          "                              recently used ones (default = 0, no cap)"                                                   << std::endl <<
           "  --saveDebugTensors          Specify list of names of tensors to turn on the debug state"                                << std::endl <<
           "                              and filename to save raw outputs to."                                                       << std::endl <<
           "                              These tensors must be specified as debug tensors during build time."                        << std::endl <<
@@ -2769,7 +2880,16 @@ void InferenceOptions::help(std::ostream& os)
           "                              Including debug tensors marked by --markDebug and --markUnfusedTensorsAsDebugTensors"       << std::endl <<
           "                              Multiple file formats can be saved simultaneously."                                         << std::endl <<
         R"(                              Input values spec   ::= format[","format])"                                                 << std::endl <<
-        R"(                                           format ::= "summary"|"numpy"|"string"|"raw")"                                  << std::endl <<
+        R"(                                           format ::= "summary"|"numpy"|"string"|"raw"|"container")"                      << std::endl <<
+          "                              container = Append all tensors to debug_tensors.bin, indexed by debug_tensors.bin.index"    << std::endl <<
+          "  --asyncDebugTensors         Dump debug tensors asynchronously: the debug callback only enqueues a copy into"            << std::endl <<
+          "                              pinned memory and a writer thread writes the files (default = disabled)"                    << std::endl <<
+          "  --debugTensorQueueDepth=N   Maximum number of debug tensors waiting to be written in asynchronous mode "
+                                                                                "(default = " << defaultDebugTensorQueueDepth << ")" << std::endl <<
+          "  --debugTensorStagingSize=N  Maximum pinned memory in MiB used to stage debug tensors in asynchronous mode "
+                                                                               "(default = " << defaultDebugTensorStagingSize << ")" << std::endl <<
+          "  --dropDebugTensors          In asynchronous mode, drop debug tensors instead of blocking inference when the"            << std::endl <<
+          "                              queue or the staging memory is full (default = disabled)"                                   << std::endl <<
           "  --weightStreamingBudget     Set the maximum amount of GPU memory TensorRT is allowed to use for weights."               << std::endl <<
           "                              It can take on the following values:"                                                       << std::endl <<
           "                                  -2: (default) Disable weight streaming at runtime."                                     << std::endl <<
@@ -2788,6 +2908,12 @@ void ReportingOptions::help(std::ostream& os)
     // clang-format off
     os << "=== Reporting Options ==="                                                                    << std::endl <<
           "  --verbose                   Use verbose logging (default = false)"                          << std::endl <<
+          "  --asyncLogging              Write log messages from a background thread, with a monotonic"  << std::endl <<
+          "                              timestamp and a thread id (default = false)"                    << std::endl <<
+          "  --logQueueDepth=N           Maximum number of queued log messages per thread with --asyncLogging "
+                                                     "(default = " << defaultLogQueueDepth << ")"        << std::endl <<
+          "  --dropLogs                  Drop log messages instead of waiting when the queue is full "
+                                                                                "(default = false)"      << std::endl <<
           "  --avgRuns=N                 Report performance measurements averaged over N consecutive "
                                                        "iterations (default = " << defaultAvgRuns << ")" << std::endl <<
           "  --percentile=P1,P2,P3,...   Report performance for the P1,P2,P3,... percentages (0<=P_i<=100, 0 "
@@ -2805,7 +2931,16 @@ void ReportingOptions::help(std::ostream& os)
           "  --dumpOptimizationProfile   Print the optimization profile(s) information "
                                                                                 "(default = disabled)"   << std::endl <<
           "  --exportTimes=<file>        Write the timing results in a json file (default = disabled)"   << std::endl <<
+          "  --exportPhases=<file>       Write the duration and memory usage of the startup phases, such as "
+                                                                             "parsing,"                  << std::endl <<
+          "                              building, deserialization and first inference, in a json file"  << std::endl <<
+          "                              (default = disabled)"                                           << std::endl <<
           "  --exportOutput=<file>       Write the output tensors to a json file (default = disabled)"   << std::endl <<
+          "  --exportOutputFormat=<fmt>  Format of --exportOutput (default = json)"                      << std::endl <<
+          "                              fmt ::= \"json\"|\"npy\"|\"raw\""                               << std::endl <<
+          "                              npy and raw write each output tensor in row-major order to "
+                                                                    "<file>.<tensor>.npy"                << std::endl <<
+          "                              or <file>.<tensor>.<dims>.<type>.raw"                           << std::endl <<
           "  --exportProfile=<file>      Write the profile information per layer in a json file "
                                                                               "(default = disabled)"     << std::endl <<
           "  --exportLayerInfo=<file>    Write the layer information of the engine in a json file "
@@ -2827,6 +2962,22 @@ void TaskInferenceOptions::help(std::ostream& os)
     // clang-format on
 }
 
+void BatchJobOptions::help(std::ostream& os)
+{
+    // clang-format off
+    os << "=== Batch Job Options ==="                                                                                                << std::endl <<
+          "  --jobs=<file>               Run every non-empty line of the file, not starting with '#', as the arguments of a separate" << std::endl <<
+          "                              trtexec run in this process. Arguments containing spaces can be double-quoted."             << std::endl <<
+          "                              The other command line arguments are appended to every job unless the job sets them."       << std::endl <<
+          "                              The jobs share the loaded libraries and plugins, the CUDA context and the files of"         << std::endl <<
+          "                              --timingCacheFile. Each job logs with its own --verbose setting. Asynchronous logging,"    << std::endl <<
+          "                              once started by a job, stays on for the following jobs."                                   << std::endl <<
+          "  --jobThreads=N              Run up to N jobs at the same time (default = 1). Concurrent jobs must agree on --verbose,"  << std::endl <<
+          "                              the logging options, --useRuntime, --cachingAllocator and --pinnedPool."                   << std::endl <<
+          "  --exportJobReport=<file>    Write the status, duration and performance summary of every job to a JSON file"             << std::endl;
+    // clang-format on
+}
+
 void helpHelp(std::ostream& os)
 {
     // clang-format off
@@ -2847,6 +2998,8 @@ void AllOptions::help(std::ostream& os)
     os << std::endl;
     SystemOptions::help(os);
     os << std::endl;
+    BatchJobOptions::help(os);
+    os << std::endl;
     helpHelp(os);
 }
 
@@ -53,9 +53,13 @@ constexpr float defaultDuration{3.F};
 constexpr float defaultSleep{};
 constexpr float defaultIdle{};
 constexpr float defaultPersistentCacheRatio{0};
+constexpr int32_t defaultDebugTensorQueueDepth{64};
+constexpr int32_t defaultDebugTensorStagingSize{256}; // MiB
+constexpr int32_t defaultOutputPoolMiB{256};
 
 // Reporting default params
 constexpr int32_t defaultAvgRuns{10};
+constexpr int32_t defaultLogQueueDepth{4096};
 constexpr std::array<float, 3> defaultPercentiles{90, 95, 99};
 
 enum class PrecisionConstraints
@@ -323,8 +327,19 @@ public:
     ShapeProfile shapes;
     nvinfer1::ProfilingVerbosity nvtxVerbosity{nvinfer1::ProfilingVerbosity::kLAYER_NAMES_ONLY};
     MemoryAllocationStrategy memoryAllocationStrategy{MemoryAllocationStrategy::kSTATIC};
+    bool cachingAllocator{false};
+    int32_t pinnedPoolMiB{0};
+    float outputGrowthFactor{1.F};
+    int32_t outputShrinkAfter{0};
+    int32_t outputPoolMiB{defaultOutputPoolMiB};
+    std::vector<ShapeProfile> poolShapes;
+    int32_t contextPoolMiB{0};
     std::unordered_map<std::string, std::string> debugTensorFileNames;
     std::vector<std::string> dumpAlldebugTensorFormats;
+    bool asyncDebugTensors{false};
+    bool dropDebugTensors{false};
+    int32_t debugTensorQueueDepth{defaultDebugTensorQueueDepth};
+    int32_t debugTensorStagingSize{defaultDebugTensorStagingSize};
     WeightStreamingBudget weightStreamingBudget;
 
     void parse(Arguments& arguments) override;
@@ -336,6 +351,9 @@ class ReportingOptions : public Options
 {
 public:
     bool verbose{false};
+    bool asyncLogging{false};
+    int32_t logQueueDepth{defaultLogQueueDepth};
+    bool dropLogs{false};
     int32_t avgs{defaultAvgRuns};
     std::vector<float> percentiles{defaultPercentiles.begin(), defaultPercentiles.end()};
     bool refit{false};
@@ -345,7 +363,9 @@ public:
     bool layerInfo{false};
     bool optProfileInfo{false};
     std::string exportTimes;
+    std::string exportPhases;
     std::string exportOutput;
+    std::string exportOutputFormat{"json"}; //!< "json", "npy" or "raw"
     std::string exportProfile;
     std::string exportLayerInfo;
 
@@ -407,6 +427,21 @@ public:
     static void help(std::ostream& out);
 };
 
+//!
+//! \brief Options of trtexec batch job mode, where each line of a job file is the argument list of one run.
+//!
+class BatchJobOptions : public Options
+{
+public:
+    std::string jobFile;         //!< Empty unless running in batch job mode
+    int32_t jobThreads{1};       //!< Number of jobs running at the same time
+    std::string exportJobReport; //!< JSON file receiving the results of all the jobs
+
+    void parse(Arguments& arguments) override;
+
+    static void help(std::ostream& out);
+};
+
 Arguments argsToArgumentsMap(int32_t argc, char* argv[]);
 
 bool parseHelp(Arguments& arguments);
@@ -0,0 +1,353 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "samplePhases.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include <cuda_runtime_api.h>
+
+#include "logger.h"
+
+namespace sample
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct MemorySample
+{
+    int64_t rssBytes{0};
+    int64_t peakRssBytes{0};
+    int64_t deviceBytes{0};
+};
+
+struct PhaseRecord
+{
+    std::string name;
+    PhaseId parent{kNO_PHASE};
+    float startMs{0.F};
+    float endMs{-1.F};
+    MemorySample start;
+    MemorySample end;
+    int64_t peakDeviceBytes{0};
+};
+
+std::atomic<bool> gPhaseRecordingEnabled{false};
+thread_local PhaseId tCurrentPhase{kNO_PHASE};
+
+//! Return the value in bytes of a "<key>: <value> kB" line of /proc/self/status.
+int64_t parseStatusKb(std::string const& line, std::string const& key)
+{
+    if (line.compare(0, key.size(), key) != 0)
+    {
+        return -1;
+    }
+    return std::stoll(line.substr(key.size())) * 1024;
+}
+
+MemorySample sampleMemory()
+{
+    MemorySample sample;
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        int64_t value = parseStatusKb(line, "VmRSS:");
+        if (value >= 0)
+        {
+            sample.rssBytes = value;
+        }
+        value = parseStatusKb(line, "VmHWM:");
+        if (value >= 0)
+        {
+            sample.peakRssBytes = value;
+        }
+    }
+#endif // __linux__
+    size_t freeBytes{0};
+    size_t totalBytes{0};
+    if (cudaMemGetInfo(&freeBytes, &totalBytes) == cudaSuccess)
+    {
+        sample.deviceBytes = static_cast<int64_t>(totalBytes - freeBytes);
+    }
+    else
+    {
+        // Do not leave the error to be reported by an unrelated CUDA call.
+        static_cast<void>(cudaGetLastError());
+    }
+    return sample;
+}
+
+class PhaseRecorder
+{
+public:
+    void enable()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!gPhaseRecordingEnabled.load(std::memory_order_relaxed))
+        {
+            mStart = Clock::now();
+            gPhaseRecordingEnabled.store(true, std::memory_order_release);
+        }
+    }
+
+    PhaseId begin(std::string const& name, PhaseId parent)
+    {
+        MemorySample const memory = sampleMemory();
+        std::lock_guard<std::mutex> lock(mMutex);
+        PhaseRecord record;
+        record.name = name;
+        record.parent = parent;
+        record.startMs = elapsedMs();
+        record.start = memory;
+        record.peakDeviceBytes = memory.deviceBytes;
+        mPhases.push_back(std::move(record));
+        return static_cast<PhaseId>(mPhases.size() - 1);
+    }
+
+    void end(PhaseId id)
+    {
+        MemorySample const memory = sampleMemory();
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto& record = mPhases[id];
+        record.endMs = elapsedMs();
+        record.end = memory;
+        record.peakDeviceBytes = std::max(record.peakDeviceBytes, memory.deviceBytes);
+        if (record.parent != kNO_PHASE)
+        {
+            auto& parent = mPhases[record.parent];
+            parent.peakDeviceBytes = std::max(parent.peakDeviceBytes, record.peakDeviceBytes);
+        }
+    }
+
+    float getEndTime(std::string const& name)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        float endMs{-1.F};
+        for (auto const& record : mPhases)
+        {
+            if (record.name == name && record.endMs >= 0.F && (endMs < 0.F || record.endMs < endMs))
+            {
+                endMs = record.endMs;
+            }
+        }
+        return endMs;
+    }
+
+    //! Return a copy of the phases, with phases still open ending now.
+    std::vector<PhaseRecord> snapshot()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        std::vector<PhaseRecord> phases = mPhases;
+        float const nowMs = elapsedMs();
+        for (auto& record : phases)
+        {
+            if (record.endMs < 0.F)
+            {
+                record.endMs = nowMs;
+                record.end = record.start;
+            }
+        }
+        return phases;
+    }
+
+private:
+    float elapsedMs() const
+    {
+        return std::chrono::duration<float, std::milli>(Clock::now() - mStart).count();
+    }
+
+    std::mutex mMutex;
+    Clock::time_point mStart{Clock::now()};
+    std::vector<PhaseRecord> mPhases;
+};
+
+PhaseRecorder& getRecorder()
+{
+    static PhaseRecorder recorder;
+    return recorder;
+}
+
+//! Call func(id, depth) on the phases in depth-first order, children ordered by start time.
+template <typename F>
+void visitPhases(std::vector<PhaseRecord> const& phases, F&& func)
+{
+    std::vector<std::vector<PhaseId>> children(phases.size() + 1);
+    for (PhaseId id = 0; id < static_cast<PhaseId>(phases.size()); ++id)
+    {
+        PhaseId const parent = phases[id].parent;
+        children[parent == kNO_PHASE ? phases.size() : parent].push_back(id);
+    }
+    for (auto& list : children)
+    {
+        std::stable_sort(list.begin(), list.end(),
+            [&phases](PhaseId a, PhaseId b) { return phases[a].startMs < phases[b].startMs; });
+    }
+
+    std::vector<std::pair<PhaseId, int32_t>> stack;
+    auto const& roots = children.back();
+    for (auto it = roots.rbegin(); it != roots.rend(); ++it)
+    {
+        stack.emplace_back(*it, 0);
+    }
+    while (!stack.empty())
+    {
+        auto const [id, depth] = stack.back();
+        stack.pop_back();
+        func(id, depth);
+        for (auto it = children[id].rbegin(); it != children[id].rend(); ++it)
+        {
+            stack.emplace_back(*it, depth + 1);
+        }
+    }
+}
+
+float toMiB(int64_t bytes)
+{
+    return static_cast<float>(bytes) / (1 << 20);
+}
+
+} // namespace
+
+void enablePhaseRecording()
+{
+    getRecorder().enable();
+}
+
+bool isPhaseRecordingEnabled() noexcept
+{
+    return gPhaseRecordingEnabled.load(std::memory_order_acquire);
+}
+
+PhaseId currentPhase() noexcept
+{
+    return tCurrentPhase;
+}
+
+ScopedPhase::ScopedPhase(std::string const& name)
+    : ScopedPhase(name, tCurrentPhase)
+{
+}
+
+ScopedPhase::ScopedPhase(std::string const& name, PhaseId parent)
+{
+    if (isPhaseRecordingEnabled())
+    {
+        mId = getRecorder().begin(name, parent);
+        mPrevious = tCurrentPhase;
+        tCurrentPhase = mId;
+    }
+}
+
+ScopedPhase::~ScopedPhase()
+{
+    if (mId != kNO_PHASE)
+    {
+        getRecorder().end(mId);
+        tCurrentPhase = mPrevious;
+    }
+}
+
+float getPhaseEndTime(std::string const& name)
+{
+    return getRecorder().getEndTime(name);
+}
+
+void printPhases(std::ostream& os)
+{
+    auto const phases = getRecorder().snapshot();
+    os << "=== Startup phases ===" << std::endl;
+    visitPhases(phases, [&](PhaseId id, int32_t depth) {
+        auto const& p = phases[id];
+        os << std::string(2 * depth, ' ') << p.name << ": " << p.endMs - p.startMs << " ms (starts at " << p.startMs
+           << " ms), RSS = " << toMiB(p.end.rssBytes) << " MiB, device memory = " << toMiB(p.end.deviceBytes)
+           << " MiB" << std::endl;
+    });
+}
+
+void exportPhases(std::string const& fileName)
+{
+    auto const phases = getRecorder().snapshot();
+    std::ofstream os(fileName, std::ofstream::trunc);
+    if (!os)
+    {
+        sample::gLogError << "Cannot open phase file " << fileName << std::endl;
+        return;
+    }
+
+    os << "{" << std::endl;
+    os << "  \"timeToFirstInferenceMs\" : " << getPhaseEndTime(kFIRST_INFERENCE_PHASE) << "," << std::endl;
+    os << "  \"phases\" : [";
+    int32_t previousDepth{-1};
+    visitPhases(phases, [&](PhaseId id, int32_t depth) {
+        // Close the phases between the previous one and this one.
+        if (depth > previousDepth)
+        {
+            os << (previousDepth >= 0 ? ", \"children\" : [" : "") << std::endl;
+        }
+        else
+        {
+            os << " }";
+            for (int32_t d = previousDepth; d > depth; --d)
+            {
+                os << " ] }";
+            }
+            os << "," << std::endl;
+        }
+        previousDepth = depth;
+
+        auto const& p = phases[id];
+        std::string name;
+        for (char const c : p.name)
+        {
+            if (c == '"' || c == '\\')
+            {
+                name.push_back('\\');
+            }
+            name.push_back(c);
+        }
+        os << std::string(4 + 2 * depth, ' ')
+           << "{ \"name\" : \"" << name << "\", \"startMs\" : " << p.startMs << ", \"durationMs\" : "
+           << p.endMs - p.startMs << ", \"rssMiB\" : " << toMiB(p.end.rssBytes) << ", \"rssDeltaMiB\" : "
+           << toMiB(p.end.rssBytes - p.start.rssBytes) << ", \"peakRssMiB\" : " << toMiB(p.end.peakRssBytes)
+           << ", \"deviceMemMiB\" : " << toMiB(p.end.deviceBytes) << ", \"deviceMemDeltaMiB\" : "
+           << toMiB(p.end.deviceBytes - p.start.deviceBytes) << ", \"peakDeviceMemMiB\" : "
+           << toMiB(p.peakDeviceBytes);
+    });
+    if (previousDepth >= 0)
+    {
+        os << " }";
+        for (int32_t d = previousDepth; d > 0; --d)
+        {
+            os << " ] }";
+        }
+        os << std::endl << "  ";
+    }
+    os << "]" << std::endl;
+    os << "}" << std::endl;
+}
+
+} // namespace sample
@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_SAMPLE_PHASES_H
+#define TRT_SAMPLE_PHASES_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace sample
+{
+
+//!
+//! Startup phases, such as loading libraries, building or deserializing the engine and running the first inference,
+//! are recorded as a tree. A phase opened by a thread becomes a child of the innermost phase still open on that
+//! thread. Each phase records its wall time and the host resident memory and device memory in use at its start and
+//! end. Nothing is recorded until enablePhaseRecording() is called.
+//!
+
+using PhaseId = int32_t;
+
+constexpr PhaseId kNO_PHASE{-1};
+
+//! Name of the phase whose end defines the time to first inference.
+constexpr char const* kFIRST_INFERENCE_PHASE{"First inference"};
+
+//!
+//! \brief Start recording phases; the times of the phases are relative to the first call.
+//!
+void enablePhaseRecording();
+
+bool isPhaseRecordingEnabled() noexcept;
+
+//!
+//! \brief Return the innermost phase open on the calling thread, or kNO_PHASE.
+//!
+PhaseId currentPhase() noexcept;
+
+//!
+//! \class ScopedPhase
+//! \brief Record a phase lasting from construction to destruction.
+//!
+class ScopedPhase
+{
+public:
+    explicit ScopedPhase(std::string const& name);
+
+    //! Open a phase under the given parent, typically the current phase of the thread that launched this one.
+    ScopedPhase(std::string const& name, PhaseId parent);
+
+    ~ScopedPhase();
+
+    ScopedPhase(ScopedPhase const&) = delete;
+    ScopedPhase& operator=(ScopedPhase const&) = delete;
+
+    PhaseId getId() const noexcept
+    {
+        return mId;
+    }
+
+private:
+    PhaseId mId{kNO_PHASE};
+    PhaseId mPrevious{kNO_PHASE};
+};
+
+//!
+//! \brief Return the time in milliseconds from enablePhaseRecording() to the end of the first phase with the given
+//!        name, or a negative value if no such phase ended.
+//!
+float getPhaseEndTime(std::string const& name);
+
+//!
+//! \brief Print the phases recorded so far as an indented tree.
+//!
+void printPhases(std::ostream& os);
+
+//!
+//! \brief Write the phases recorded so far to a JSON file.
+//!
+//! Printed format:
+//! { "timeToFirstInferenceMs" : time, "phases" : [ phase, ... ] }
+//! phase ::= { "name" : string, "startMs" : time, "durationMs" : time, "rssMiB" : size, "rssDeltaMiB" : size,
+//!             "peakRssMiB" : size, "deviceMemMiB" : size, "deviceMemDeltaMiB" : size, "peakDeviceMemMiB" : size,
+//!             "children" : [ phase, ... ] }
+//!
+//! Sizes are taken at the end of the phase. peakRssMiB is the high-water mark of the process so far, and
+//! peakDeviceMemMiB is the largest usage sampled at the boundaries of the phase and of its children.
+//!
+void exportPhases(std::string const& fileName);
+
+} // namespace sample
+
+#endif // TRT_SAMPLE_PHASES_H
@@ -338,6 +338,30 @@ void printPerformanceReport(std::vector<InferenceTrace> const& trace, ReportingO
     }
 }
 
+PerformanceSummary getPerformanceSummary(std::vector<InferenceTrace> const& trace,
+    ReportingOptions const& reportingOpts, InferenceOptions const& infOpts)
+{
+    PerformanceSummary summary;
+    float const warmupMs = infOpts.warmup;
+    auto const isNotWarmup = [&warmupMs](const InferenceTrace& a) { return a.computeStart >= warmupMs; };
+    auto const noWarmup = std::find_if(trace.begin(), trace.end(), isNotWarmup);
+    if (noWarmup == trace.end())
+    {
+        return summary;
+    }
+
+    std::vector<InferenceTime> timings(trace.end() - noWarmup);
+    std::transform(noWarmup, trace.end(), timings.begin(), traceToTiming);
+    int32_t const batchSize = infOpts.batch ? infOpts.batch : 1;
+    summary.walltimeMs = trace.back().d2hEnd - noWarmup->h2dStart;
+    summary.throughput = batchSize * timings.size() / summary.walltimeMs * 1000;
+    summary.latency
+        = getPerformanceResult(timings, [](InferenceTime const& t) { return t.latency(); }, reportingOpts.percentiles);
+    summary.gpuCompute
+        = getPerformanceResult(timings, [](InferenceTime const& t) { return t.compute; }, reportingOpts.percentiles);
+    return summary;
+}
+
 //! Printed format:
 //! [ value, ...]
 //! value ::= { "start enq : time, "end enq" : time, "start h2d" : time, "end h2d" : time, "start compute" : time,
@@ -498,6 +522,22 @@ void exportJSONOutput(
 void exportJSONOutput(
     nvinfer1::IExecutionContext const& context, Bindings const& bindings, std::string const& fileName, int32_t batch);
 
+void exportBinaryOutput(nvinfer1::IExecutionContext const& context, Bindings const& bindings,
+    std::string const& prefix, std::string const& format)
+{
+    for (auto const& binding : bindings.getOutputBindings())
+    {
+        auto const fileName = bindings.exportBindingValues(
+            context, binding.second, prefix + "." + genFilenameSafeString(binding.first), format == "npy");
+        if (fileName.empty())
+        {
+            sample::gLogError << "Failed to export output tensor '" << binding.first << "'." << std::endl;
+            continue;
+        }
+        sample::gLogInfo << "Exported output tensor '" << binding.first << "' to " << fileName << std::endl;
+    }
+}
+
 void printLayerInfo(
     ReportingOptions const& reporting, nvinfer1::ICudaEngine* engine, nvinfer1::IExecutionContext* context)
 {
@@ -584,7 +624,14 @@ void dump(std::unique_ptr<nvinfer1::IExecutionContext> const& context, std::uniq
     }
     if (!reporting.exportOutput.empty())
     {
-        exportJSONOutput(*context, *binding, reporting.exportOutput, batch);
+        if (reporting.exportOutputFormat == "json")
+        {
+            exportJSONOutput(*context, *binding, reporting.exportOutput, batch);
+        }
+        else
+        {
+            exportBinaryOutput(*context, *binding, reporting.exportOutput, reporting.exportOutputFormat);
+        }
     }
 }
 } // namespace details
@@ -123,6 +123,18 @@ struct PerformanceResult
     float coeffVar{0.F}; // coefficient of variation
 };
 
+//!
+//! \struct PerformanceSummary
+//! \brief Main metrics of an inference run, as printed in the performance summary
+//!
+struct PerformanceSummary
+{
+    float throughput{0.F}; //!< Queries per second
+    float walltimeMs{0.F}; //!< Host walltime of the timed iterations
+    PerformanceResult latency;
+    PerformanceResult gpuCompute;
+};
+
 //!
 //! \brief Print benchmarking time and number of traces collected
 //!
@@ -156,6 +168,12 @@ void printMetricExplanations(std::ostream& os);
 void printPerformanceReport(std::vector<InferenceTrace> const& trace, ReportingOptions const& reportingOpts,
     InferenceOptions const& infOpts, std::ostream& osInfo, std::ostream& osWarning, std::ostream& osVerbose);
 
+//!
+//! \brief Summarize a timing trace without printing it
+//!
+PerformanceSummary getPerformanceSummary(std::vector<InferenceTrace> const& trace,
+    ReportingOptions const& reportingOpts, InferenceOptions const& infOpts);
+
 //!
 //! \brief Export a timing trace to JSON file
 //!
@@ -180,6 +198,12 @@ void dumpRawBindingsToFiles(nvinfer1::IExecutionContext const& context, Bindings
 void exportJSONOutput(
     nvinfer1::IExecutionContext const& context, Bindings const& bindings, std::string const& fileName, int32_t batch);
 
+//!
+//! \brief Export each output tensor to a .npy file if format is "npy", or to a raw binary file otherwise
+//!
+void exportBinaryOutput(nvinfer1::IExecutionContext const& context, Bindings const& bindings,
+    std::string const& prefix, std::string const& format);
+
 //!
 //! \struct LayerProfile
 //! \brief Layer profile information
@@ -19,6 +19,13 @@
 #include "bfloat16.h"
 #include "common.h"
 #include "half.h"
+#include "sampleLayout.h"
+#include <atomic>
+#include <charconv>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <cuda.h>
 #include <type_traits>
 
@@ -423,92 +430,178 @@ void sparsify(Weights const& weights, int32_t k, int32_t trs, std::vector<int8_t
     }
 }
 
-template <typename T>
-void print(std::ostream& os, T v)
+namespace
 {
-    os << v;
-}
 
-void print(std::ostream& os, int8_t v)
-{
-    os << static_cast<int32_t>(v);
-}
+//! Number of characters formatted before they are written to the stream.
+constexpr size_t kTEXT_CHUNK_SIZE{size_t{1} << 20};
 
-void print(std::ostream& os, __half v)
-{
-    os << static_cast<float>(v);
-}
+//! Upper bound of the number of characters of one formatted value, excluding the digits requested by the precision.
+constexpr size_t kMAX_VALUE_CHARS{64};
 
-#if CUDA_VERSION >= 11060
-void print(std::ostream& os, __nv_fp8_e4m3 v)
+//!
+//! \brief Formats tensor values with std::to_chars into a large buffer that is written to a stream in chunks.
+//!
+//! Floating point values follow the floatfield and precision of the stream, so the text is the same as with
+//! operator<<. Streams with other formatting flags, such as std::hex, std::showpos or std::boolalpha, or with a
+//! field width, are written value by value with operator<< instead.
+//!
+class TextChunkWriter
 {
-    os << static_cast<float>(v);
-}
-#endif
+public:
+    TextChunkWriter(std::ostream& os, std::string const& separator)
+        : mOs(os)
+        , mSeparator(separator)
+        , mPrecision(static_cast<int32_t>(os.precision()))
+    {
+        auto const flags = os.flags();
+        auto const floatField = flags & std::ios_base::floatfield;
+        auto const unsupported = std::ios_base::boolalpha | std::ios_base::showbase | std::ios_base::showpoint
+            | std::ios_base::showpos | std::ios_base::uppercase;
+        mUseStream = (flags & unsupported) || (flags & std::ios_base::basefield & ~std::ios_base::dec)
+            || floatField == std::ios_base::floatfield || os.width() != 0 || os.getloc() != std::locale::classic();
+        mFloatFormat = floatField == std::ios_base::fixed ? std::chars_format::fixed
+            : floatField == std::ios_base::scientific     ? std::chars_format::scientific
+                                                          : std::chars_format::general;
+        if (!mUseStream)
+        {
+            mBuffer.resize(kTEXT_CHUNK_SIZE + separator.size() + kMAX_VALUE_CHARS + std::max(mPrecision, 0));
+        }
+    }
 
-int32_t dataOffsetFromDims(int64_t v, Dims const& dims, Dims const& strides, int32_t vectorDim, int32_t spv)
-{
-    int32_t dataOffset = 0;
-    for (int32_t dimIndex = dims.nbDims - 1; dimIndex >= 0; --dimIndex)
+    ~TextChunkWriter()
+    {
+        flush();
+    }
+
+    template <typename T>
+    void write(T value)
     {
-        int32_t dimVal = v % dims.d[dimIndex];
-        if (dimIndex == vectorDim)
+        if (mUseStream)
         {
-            dataOffset += (dimVal / spv) * strides.d[dimIndex] * spv + dimVal % spv;
+            if (!mFirst)
+            {
+                mOs << mSeparator;
+            }
+            mFirst = false;
+            writeToStream(value);
+            return;
         }
-        else
+        if (mSize >= kTEXT_CHUNK_SIZE)
         {
-            dataOffset += dimVal * strides.d[dimIndex] * (vectorDim == -1 ? 1 : spv);
+            flush();
         }
-        v /= dims.d[dimIndex];
-        ASSERT(v >= 0);
+        char* pos = mBuffer.data() + mSize;
+        if (!mFirst)
+        {
+            pos = std::copy(mSeparator.begin(), mSeparator.end(), pos);
+        }
+        mFirst = false;
+        mSize = format(pos, mBuffer.data() + mBuffer.size(), value) - mBuffer.data();
     }
 
-    return dataOffset;
-}
+private:
+    void flush()
+    {
+        mOs.write(mBuffer.data(), static_cast<std::streamsize>(mSize));
+        mSize = 0;
+    }
 
-template <typename T>
-void dumpBuffer(void const* buffer, std::string const& separator, std::ostream& os, Dims const& dims,
-    Dims const& strides, int32_t vectorDim, int32_t spv)
-{
-    auto const vol = volume(dims);
-    T const* typedBuffer = static_cast<T const*>(buffer);
-    for (int64_t v = 0; v < vol; ++v)
+    template <typename T>
+    void writeToStream(T v)
     {
-        int32_t dataOffset = dataOffsetFromDims(v, dims, strides, vectorDim, spv);
-        if (v > 0)
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            mOs << v;
+        }
+        else if constexpr (std::is_integral_v<T>)
         {
-            os << separator;
+            // Print 8-bit values as numbers rather than characters.
+            mOs << +v;
+        }
+        else
+        {
+            mOs << static_cast<float>(v);
         }
-        print(os, typedBuffer[dataOffset]);
     }
-}
 
-void dumpInt4Buffer(void const* buffer, std::string const& separator, std::ostream& os, Dims const& dims,
-    Dims const& strides, int32_t vectorDim, int32_t spv)
-{
-    auto const vol = volume(dims);
-    uint8_t const* typedBuffer = static_cast<uint8_t const*>(buffer);
-    for (int64_t v = 0; v < vol; ++v)
+    char* format(char* first, char* /*last*/, bool v)
     {
-        int32_t dataOffset = dataOffsetFromDims(v, dims, strides, vectorDim, spv);
-        if (v > 0)
-        {
-            os << separator;
-        }
+        *first = v ? '1' : '0';
+        return first + 1;
+    }
+
+    char* format(char* first, char* last, float v)
+    {
+        return std::to_chars(first, last, v, mFloatFormat, mPrecision).ptr;
+    }
 
-        auto value = typedBuffer[dataOffset / 2];
-        if (dataOffset % 2 == 0)
+    template <typename T>
+    char* format(char* first, char* last, T v)
+    {
+        if constexpr (std::is_integral_v<T>)
         {
-            // Cast to int8_t before right shift, so right-shift will sign-extend.
-            // Left shift on int8_t can be undefined behaviour, must perform left shift on uint8_t.
-            os << (static_cast<int8_t>(value << 4) >> 4);
+            return std::to_chars(first, last, v).ptr;
         }
         else
         {
-            os << (static_cast<int8_t>(value) >> 4);
+            return format(first, last, static_cast<float>(v));
+        }
+    }
+
+    std::ostream& mOs;
+    std::string const& mSeparator;
+    int32_t mPrecision{};
+    std::chars_format mFloatFormat{std::chars_format::general};
+    bool mUseStream{false};
+    std::vector<char> mBuffer;
+    size_t mSize{0};
+    bool mFirst{true};
+};
+
+} // namespace
+
+bool isDenseLayout(Dims const& dims, Dims const& strides, int32_t vectorDim)
+{
+    if (vectorDim != -1)
+    {
+        return false;
+    }
+    int64_t expected{1};
+    for (int32_t d = dims.nbDims - 1; d >= 0; --d)
+    {
+        // The stride of a dimension of size 1 is never used.
+        if (dims.d[d] != 1 && strides.d[d] != expected)
+        {
+            return false;
         }
+        expected *= dims.d[d];
     }
+    return true;
+}
+
+template <typename T>
+void dumpBuffer(void const* buffer, std::string const& separator, std::ostream& os, Dims const& dims,
+    Dims const& strides, int32_t vectorDim, int32_t spv)
+{
+    T const* typedBuffer = static_cast<T const*>(buffer);
+    TextChunkWriter writer(os, separator);
+    forEachElementOffset(
+        dims, strides, vectorDim, spv, [&](int64_t /*index*/, int64_t offset) { writer.write(typedBuffer[offset]); });
+}
+
+void dumpInt4Buffer(void const* buffer, std::string const& separator, std::ostream& os, Dims const& dims,
+    Dims const& strides, int32_t vectorDim, int32_t spv)
+{
+    uint8_t const* typedBuffer = static_cast<uint8_t const*>(buffer);
+    TextChunkWriter writer(os, separator);
+    forEachElementOffset(dims, strides, vectorDim, spv, [&](int64_t /*index*/, int64_t offset) {
+        auto value = typedBuffer[offset / 2];
+        // Cast to int8_t before right shift, so right-shift will sign-extend.
+        // Left shift on int8_t can be undefined behaviour, must perform left shift on uint8_t.
+        writer.write(static_cast<int32_t>(
+            offset % 2 == 0 ? static_cast<int8_t>(value << 4) >> 4 : static_cast<int8_t>(value) >> 4));
+    });
 }
 
 // Explicit instantiation
@@ -583,18 +676,7 @@ template void sparsify<half_float::half>(
 template <typename T>
 void transpose2DWeights(void* dst, void const* src, int32_t const m, int32_t const n)
 {
-    ASSERT(dst != src);
-    T* tdst = reinterpret_cast<T*>(dst);
-    T const* tsrc = reinterpret_cast<T const*>(src);
-    for (int32_t mi = 0; mi < m; ++mi)
-    {
-        for (int32_t ni = 0; ni < n; ++ni)
-        {
-            int32_t const isrc = mi * n + ni;
-            int32_t const idst = ni * m + mi;
-            tdst[idst] = tsrc[isrc];
-        }
-    }
+    transposeBatched(dst, src, 1, m, n, sizeof(T));
 }
 
 // Explicit instantiation
@@ -649,4 +731,136 @@ bool matchStringWithOneWildcard(std::string const& pattern, std::string const& t
         && target.rfind(splitPattern[1]) == (target.size() - splitPattern[1].size());
 }
 
+namespace
+{
+
+//! Threads serving runChunksOnPool(), grown on demand and joined when the process exits.
+class ChunkWorkerPool
+{
+public:
+    static ChunkWorkerPool& getInstance()
+    {
+        static ChunkWorkerPool pool;
+        return pool;
+    }
+
+    //! Queue task nbCopies times, first growing the pool to at least nbCopies threads.
+    void post(std::function<void()> const& task, int64_t nbCopies)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            while (static_cast<int64_t>(mThreads.size()) < nbCopies)
+            {
+                mThreads.emplace_back([this]() { work(); });
+            }
+            for (int64_t i = 0; i < nbCopies; ++i)
+            {
+                mTasks.push_back(task);
+            }
+        }
+        mCondition.notify_all();
+    }
+
+    ~ChunkWorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mCondition.notify_all();
+        for (auto& thread : mThreads)
+        {
+            thread.join();
+        }
+    }
+
+private:
+    ChunkWorkerPool() = default;
+
+    void work()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this]() { return mStop || !mTasks.empty(); });
+                if (mTasks.empty())
+                {
+                    return;
+                }
+                task = std::move(mTasks.front());
+                mTasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::deque<std::function<void()>> mTasks;
+    std::vector<std::thread> mThreads;
+    bool mStop{false};
+};
+
+//! Chunks of one runChunksOnPool() call. Chunks are claimed through an atomic counter, so the calling thread runs all
+//! the chunks no worker has claimed yet, and nested calls cannot wait on busy workers.
+struct ChunkJob
+{
+    std::function<void(int64_t, int64_t)> func;
+    int64_t n;
+    int64_t chunk;
+    int64_t nbChunks;
+    std::atomic<int64_t> next{0};
+    std::atomic<int64_t> nbDone{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::exception_ptr error;
+
+    void runChunks()
+    {
+        for (int64_t c = next++; c < nbChunks; c = next++)
+        {
+            try
+            {
+                func(c * chunk, std::min((c + 1) * chunk, n));
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+            if (++nbDone == nbChunks)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace
+
+void runChunksOnPool(int64_t n, int64_t chunk, int64_t nbChunks, std::function<void(int64_t, int64_t)> const& func)
+{
+    // Workers may still hold the job after the last chunk, so it is shared with them.
+    auto job = std::make_shared<ChunkJob>();
+    job->func = func;
+    job->n = n;
+    job->chunk = chunk;
+    job->nbChunks = nbChunks;
+    ChunkWorkerPool::getInstance().post([job]() { job->runChunks(); }, nbChunks - 1);
+
+    job->runChunks();
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->finished.wait(lock, [&job]() { return job->nbDone == job->nbChunks; });
+    if (job->error)
+    {
+        std::rethrow_exception(job->error);
+    }
+}
+
 } // namespace sample
@@ -18,13 +18,17 @@
 #ifndef TRT_SAMPLE_UTILS_H
 #define TRT_SAMPLE_UTILS_H
 
+#include <algorithm>
+#include <array>
 #include <fstream>
 #include <filesystem>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <numeric>
 #include <random>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -74,6 +78,55 @@ void dumpBuffer(void const* buffer, std::string const& separator, std::ostream&
 void dumpInt4Buffer(void const* buffer, std::string const& separator, std::ostream& os, Dims const& dims,
     Dims const& strides, int32_t vectorDim, int32_t spv);
 
+//! Whether the elements of a tensor are stored contiguously in row-major order.
+bool isDenseLayout(nvinfer1::Dims const& dims, nvinfer1::Dims const& strides, int32_t vectorDim);
+
+//!
+//! \brief Call func(index, offset) for each element of a tensor in row-major order.
+//!
+//! offset is the position of the index-th element in a buffer with the given strides and vectorization. It is updated
+//! incrementally from one element to the next, and is the index itself when the layout is dense.
+//!
+template <typename F>
+void forEachElementOffset(
+    nvinfer1::Dims const& dims, nvinfer1::Dims const& strides, int32_t vectorDim, int32_t spv, F&& func)
+{
+    int64_t const vol = volume(dims);
+    if (isDenseLayout(dims, strides, vectorDim))
+    {
+        for (int64_t v = 0; v < vol; ++v)
+        {
+            func(v, v);
+        }
+        return;
+    }
+
+    auto contribution = [&](int32_t d, int64_t i) -> int64_t {
+        if (d == vectorDim)
+        {
+            return (i / spv) * strides.d[d] * spv + i % spv;
+        }
+        return i * strides.d[d] * (vectorDim == -1 ? 1 : spv);
+    };
+    std::array<int64_t, nvinfer1::Dims::MAX_DIMS> index{};
+    int64_t offset{0};
+    for (int64_t v = 0; v < vol; ++v)
+    {
+        func(v, offset);
+        for (int32_t d = dims.nbDims - 1; d >= 0; --d)
+        {
+            int64_t const previous = contribution(d, index[d]);
+            if (++index[d] < dims.d[d])
+            {
+                offset += contribution(d, index[d]) - previous;
+                break;
+            }
+            offset -= previous;
+            index[d] = 0;
+        }
+    }
+}
+
 void loadFromFile(std::string const& fileName, char* dst, size_t size);
 
 bool canWriteFile(const std::string& path);
@@ -104,6 +157,42 @@ void sparsifyMatMulKernelWeights(
 template <typename T>
 void transpose2DWeights(void* dst, void const* src, int32_t const m, int32_t const n);
 
+//! Resolve a requested worker count: values <= 0 select the number of hardware threads.
+inline int32_t resolveNbThreads(int32_t nbThreads)
+{
+    if (nbThreads > 0)
+    {
+        return nbThreads;
+    }
+    return std::max(static_cast<int32_t>(std::thread::hardware_concurrency()), 1);
+}
+
+//! Run func(begin, end) on nbChunks chunks of chunk items covering [0, n), on the calling thread and the threads of a
+//! worker pool shared by the process, created on first use. Returns when all chunks are done, rethrowing the first
+//! exception thrown by func.
+void runChunksOnPool(int64_t n, int64_t chunk, int64_t nbChunks, std::function<void(int64_t, int64_t)> const& func);
+
+//! Split [0, n) into contiguous chunks of at least minChunk items and run func(begin, end) on each chunk using up to
+//! nbThreads threads. A single chunk runs on the calling thread; otherwise the calling thread works alongside the
+//! threads of a persistent pool (see runChunksOnPool()), so that repeated calls do not pay for thread creation.
+template <typename F>
+void parallelFor(int64_t n, int64_t minChunk, int32_t nbThreads, F&& func)
+{
+    if (n <= 0)
+    {
+        return;
+    }
+    int64_t const maxChunks = std::max(n / std::max(minChunk, int64_t{1}), int64_t{1});
+    int64_t const nbChunks = std::min(static_cast<int64_t>(resolveNbThreads(nbThreads)), maxChunks);
+    if (nbChunks == 1)
+    {
+        func(int64_t{0}, n);
+        return;
+    }
+    int64_t const chunk = (n + nbChunks - 1) / nbChunks;
+    runChunksOnPool(n, chunk, (n + chunk - 1) / chunk, std::ref(func));
+}
+
 //! A helper function to match a target string with a pattern where the pattern can contain up to one wildcard ('*')
 //! character that matches to any strings.
 bool matchStringWithOneWildcard(std::string const& pattern, std::string const& target);
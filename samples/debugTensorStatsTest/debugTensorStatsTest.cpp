@@ -0,0 +1,324 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//! \file debugTensorStatsTest.cpp
+//!
+//! \brief Self-test of the debug tensor statistics written by trtexec --saveAllDebugTensors=summary.
+//!
+//! For every data type, the statistics computed with each instruction set supported by the CPU and with several
+//! thread counts must be bit-identical to those of the scalar code on one thread. The floating point, packed INT4
+//! and packed FP4 statistics are also checked against a direct computation.
+//!
+//! It can be run with the following command line:
+//! Command: ./debug_tensor_stats_test
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "debugTensorStats.h"
+#include "getOptions.h"
+#include "logger.h"
+#include "utils/hostSimd.h"
+
+using nvinfer1::DataType;
+using nvinfer1::utils::HostSimdLevel;
+
+namespace
+{
+
+std::string const kSAMPLE_NAME = "TensorRT.debug_tensor_stats_test";
+
+//! Log the failed condition and return false from the test case.
+#define EXPECT(condition)                                                                                              \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(condition))                                                                                              \
+        {                                                                                                              \
+            sample::gLogError << __FILE__ << ":" << __LINE__ << ": expected " << #condition << std::endl;             \
+            return false;                                                                                              \
+        }                                                                                                              \
+    } while (0)
+
+//! Elements of the large tensors: 200 blocks of the statistics and an odd tail, so that several threads are used, the
+//! last block is partial and packed tensors end with a padding nibble.
+constexpr int64_t kLARGE_VOLUME{200 * 4096 + 21};
+
+//! Elements of the small tensors, which hold NaN and infinities where the data type has them.
+constexpr int64_t kSMALL_VOLUME{37};
+
+//! Values of the FP4 E2M1 encodings, indexed by the nibble.
+constexpr float kFP4_VALUES[16]{0.F, 0.5F, 1.F, 1.5F, 2.F, 3.F, 4.F, 6.F, -0.F, -0.5F, -1.F, -1.5F, -2.F, -3.F, -4.F,
+    -6.F};
+
+int32_t getTypeBits(DataType type)
+{
+    switch (type)
+    {
+    case DataType::kINT4:
+    case DataType::kFP4: return 4;
+    case DataType::kBOOL:
+    case DataType::kINT8:
+    case DataType::kUINT8:
+    case DataType::kFP8: return 8;
+    case DataType::kHALF:
+    case DataType::kBF16: return 16;
+    case DataType::kFLOAT:
+    case DataType::kINT32: return 32;
+    case DataType::kINT64: return 64;
+    default: return 0;
+    }
+}
+
+//! Random tensor of the given type. Floating point elements are finite unless withSpecials is set, in which case a
+//! few NaN and infinite elements are inserted.
+std::vector<uint8_t> makeTensor(DataType type, int64_t volume, bool withSpecials, std::mt19937& rng)
+{
+    std::vector<uint8_t> bytes((volume * getTypeBits(type) + 7) / 8);
+    std::uniform_int_distribution<uint32_t> bits;
+    for (auto& b : bytes)
+    {
+        b = static_cast<uint8_t>(bits(rng));
+    }
+
+    auto store = [&](int64_t i, auto value) { std::memcpy(bytes.data() + i * sizeof(value), &value, sizeof(value)); };
+    std::normal_distribution<float> normal(0.F, 100.F);
+    std::uniform_int_distribution<uint32_t> exponent(1, 29);
+    for (int64_t i = 0; i < volume; ++i)
+    {
+        uint32_t const random = bits(rng);
+        switch (type)
+        {
+        case DataType::kBOOL: bytes[i] &= 1; break;
+        // The statistics sum INT64 elements in int64_t, so keep the sum of the large tensor far from overflowing.
+        case DataType::kINT64: store(i, static_cast<int64_t>(static_cast<int32_t>(random)) * 1000); break;
+        case DataType::kFLOAT: store(i, normal(rng)); break;
+        // Finite encodings: the exponent field is never all ones.
+        case DataType::kHALF: store(i, static_cast<uint16_t>((random & 0x83FFU) | (exponent(rng) << 10))); break;
+        case DataType::kBF16: store(i, static_cast<uint16_t>((random & 0x807FU) | ((100 + exponent(rng)) << 7))); break;
+        case DataType::kFP8: bytes[i] = (bytes[i] & 0x7F) == 0x7F ? 0x7E : bytes[i]; break;
+        default: break;
+        }
+    }
+
+    if (withSpecials && volume > 7)
+    {
+        float const nan = std::numeric_limits<float>::quiet_NaN();
+        float const inf = std::numeric_limits<float>::infinity();
+        switch (type)
+        {
+        case DataType::kFLOAT:
+            store(3, nan);
+            store(5, inf);
+            store(7, -inf);
+            break;
+        case DataType::kHALF:
+        case DataType::kBF16:
+        {
+            bool const half = type == DataType::kHALF;
+            store(3, static_cast<uint16_t>(half ? 0x7E00U : 0x7FC0U));
+            store(5, static_cast<uint16_t>(half ? 0x7C00U : 0x7F80U));
+            store(7, static_cast<uint16_t>(half ? 0xFC00U : 0xFF80U));
+            break;
+        }
+        case DataType::kFP8: bytes[3] = 0x7F; break;
+        default: break;
+        }
+    }
+    return bytes;
+}
+
+bool isIdentical(sample::TensorStatistics const& a, sample::TensorStatistics const& b)
+{
+    return a.isFloatingPoint == b.isFloatingPoint && std::memcmp(&a.min, &b.min, sizeof(a.min)) == 0
+        && std::memcmp(&a.max, &b.max, sizeof(a.max)) == 0 && std::memcmp(&a.sum, &b.sum, sizeof(a.sum)) == 0
+        && a.nbNaN == b.nbNaN && a.nbInf == b.nbInf && a.intMin == b.intMin && a.intMax == b.intMax
+        && a.intSum == b.intSum;
+}
+
+//! Check the statistics of FP32, FP4 and INT4 tensors against a direct computation.
+bool checkDirect(std::vector<uint8_t> const& data, DataType type, int64_t volume, sample::TensorStatistics const& stats)
+{
+    if (type == DataType::kINT4)
+    {
+        int64_t sum{0};
+        int64_t mn{std::numeric_limits<int64_t>::max()};
+        int64_t mx{std::numeric_limits<int64_t>::lowest()};
+        for (int64_t i = 0; i < volume; ++i)
+        {
+            int32_t const nibble = (data[i / 2] >> ((i % 2) * 4)) & 0xF;
+            int64_t const v = nibble >= 8 ? nibble - 16 : nibble;
+            sum += v;
+            mn = std::min(mn, v);
+            mx = std::max(mx, v);
+        }
+        EXPECT(!stats.isFloatingPoint && stats.intSum == sum && stats.intMin == mn && stats.intMax == mx);
+        return true;
+    }
+
+    std::vector<float> values(volume);
+    for (int64_t i = 0; i < volume; ++i)
+    {
+        if (type == DataType::kFP4)
+        {
+            values[i] = kFP4_VALUES[(data[i / 2] >> ((i % 2) * 4)) & 0xF];
+        }
+        else
+        {
+            std::memcpy(&values[i], data.data() + i * sizeof(float), sizeof(float));
+        }
+    }
+    double sum{0.0};
+    double sumAbs{0.0};
+    float mn{std::numeric_limits<float>::max()};
+    float mx{std::numeric_limits<float>::lowest()};
+    int64_t nbNaN{0};
+    int64_t nbInf{0};
+    for (float const v : values)
+    {
+        sum += v;
+        sumAbs += std::abs(v);
+        nbNaN += std::isnan(v) ? 1 : 0;
+        nbInf += std::isinf(v) ? 1 : 0;
+        if (!std::isnan(v))
+        {
+            mn = std::min(mn, v);
+            mx = std::max(mx, v);
+        }
+    }
+    EXPECT(stats.isFloatingPoint && stats.min == mn && stats.max == mx && stats.nbNaN == nbNaN && stats.nbInf == nbInf);
+    // FP4 values are multiples of 0.5, so their sum is exact in any order.
+    double const tolerance = type == DataType::kFP4 ? 0.0 : 1e-9 * sumAbs;
+    EXPECT(nbNaN > 0 || nbInf > 0 ? std::isnan(stats.sum) == std::isnan(sum) : std::abs(stats.sum - sum) <= tolerance);
+    return true;
+}
+
+//! Compare the statistics of every supported instruction set and thread count with the scalar single-thread ones.
+bool testType(DataType type)
+{
+    std::mt19937 rng(static_cast<uint32_t>(type) + 1);
+    for (int64_t const volume : {int64_t{0}, kSMALL_VOLUME, kLARGE_VOLUME})
+    {
+        auto const data = makeTensor(type, volume, volume == kSMALL_VOLUME, rng);
+
+        nvinfer1::utils::setMaxHostSimdLevel(HostSimdLevel::kSCALAR);
+        sample::TensorStatistics reference;
+        if (!sample::computeTensorStatistics(data.data(), type, volume, reference, 1))
+        {
+            // FP8 and FP4 need a recent enough CUDA toolkit.
+            sample::gLogInfo << "Statistics are not supported for data type " << static_cast<int32_t>(type)
+                             << " in this build." << std::endl;
+            return true;
+        }
+        if (type == DataType::kFLOAT || type == DataType::kFP4 || type == DataType::kINT4)
+        {
+            EXPECT(checkDirect(data, type, volume, reference));
+        }
+
+        for (auto const level : {HostSimdLevel::kSCALAR, HostSimdLevel::kAVX2, HostSimdLevel::kAVX512})
+        {
+            nvinfer1::utils::setMaxHostSimdLevel(level);
+            if (nvinfer1::utils::getHostSimdLevel() != level)
+            {
+                continue;
+            }
+            for (int32_t const nbThreads : {1, 2, 3, 8, 0})
+            {
+                sample::TensorStatistics stats;
+                EXPECT(sample::computeTensorStatistics(data.data(), type, volume, stats, nbThreads));
+                if (!isIdentical(stats, reference))
+                {
+                    sample::gLogError << "Statistics of " << volume << " elements with SIMD level "
+                                      << static_cast<int32_t>(level) << " and " << nbThreads
+                                      << " thread(s) differ from the scalar ones." << std::endl;
+                    return false;
+                }
+            }
+        }
+    }
+    nvinfer1::utils::setMaxHostSimdLevel(HostSimdLevel::kAVX512);
+    return true;
+}
+
+void printHelp()
+{
+    std::cout << "Usage: ./debug_tensor_stats_test [options]" << std::endl
+              << "  --help, -h     Print this message" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto sampleTest = sample::gLogger.defineTest(kSAMPLE_NAME, argc, argv);
+    sample::gLogger.reportTestStart(sampleTest);
+
+    using nvinfer1::utility::TRTOption;
+    std::vector<TRTOption> const spec{{'h', "help", false, ""}};
+    auto const args = nvinfer1::utility::getOptions(argc, argv, spec);
+    if (!args.errMsg.empty())
+    {
+        sample::gLogError << args.errMsg << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+    if (args.values[0].first > 0)
+    {
+        printHelp();
+        return sample::gLogger.reportPass(sampleTest);
+    }
+
+    sample::gLogInfo << "Widest SIMD level of this CPU: " << static_cast<int32_t>(nvinfer1::utils::getHostSimdLevel())
+                     << " (0 = scalar, 1 = AVX2, 2 = AVX-512)." << std::endl;
+
+    std::vector<std::pair<char const*, DataType>> const types{
+        {"FLOAT", DataType::kFLOAT},
+        {"HALF", DataType::kHALF},
+        {"BF16", DataType::kBF16},
+        {"FP8", DataType::kFP8},
+        {"FP4", DataType::kFP4},
+        {"INT4", DataType::kINT4},
+        {"INT8", DataType::kINT8},
+        {"UINT8", DataType::kUINT8},
+        {"INT32", DataType::kINT32},
+        {"INT64", DataType::kINT64},
+        {"BOOL", DataType::kBOOL},
+    };
+    std::vector<std::pair<std::string, std::function<bool()>>> cases;
+    for (auto const& type : types)
+    {
+        cases.emplace_back(
+            std::string("computeTensorStatistics ") + type.first, [&type]() { return testType(type.second); });
+    }
+
+    int32_t nbFailed{0};
+    for (auto const& testCase : cases)
+    {
+        bool const passed = testCase.second();
+        sample::gLogInfo << (passed ? "[ PASSED ] " : "[ FAILED ] ") << testCase.first << std::endl;
+        nbFailed += !passed;
+    }
+    sample::gLogInfo << cases.size() - nbFailed << " of " << cases.size() << " cases passed." << std::endl;
+
+    return nbFailed == 0 ? sample::gLogger.reportPass(sampleTest) : sample::gLogger.reportFail(sampleTest);
+}
@@ -0,0 +1,242 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//! \file layoutBenchmark.cpp
+//!
+//! \brief Micro-benchmark of the host layout conversions of sampleLayout.h.
+//!
+//! For each shape, the tool times a naive element-by-element transpose, sample::transposeBatched() on a single
+//! thread and sample::transposeBatched() on the requested number of threads, checks that all three agree, and
+//! reports the time per call and the bandwidth. Small shapes show the fixed cost of a call, such as dispatching work
+//! to the worker threads; large shapes show the effect of tiling and threading.
+//!
+//! It can be run with the following command line:
+//! Command: ./layout_benchmark [--shapes=1x64x64,16x512x512] [--elementSize=4] [--threads=N] [--iterations=N]
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "getOptions.h"
+#include "logger.h"
+#include "sampleLayout.h"
+#include "sampleUtils.h"
+
+namespace
+{
+
+std::string const kSAMPLE_NAME = "TensorRT.layout_benchmark";
+
+//! Shapes benchmarked when --shapes is not given, from a small weight matrix to a large activation.
+char const* const kDEFAULT_SHAPES = "1x64x64,1x256x256,16x128x128,1x1024x1024,16x512x512,1x4096x4096";
+
+//! Minimum time spent timing each variant of a shape, so that small shapes are timed over many calls.
+constexpr double kMIN_SECONDS{0.2};
+
+struct Shape
+{
+    int64_t batch{1};
+    int64_t rows{0};
+    int64_t cols{0};
+};
+
+struct BenchmarkOptions
+{
+    std::vector<Shape> shapes;
+    size_t elementSize{4};
+    int32_t nbThreads{0};
+    int32_t iterations{0};
+};
+
+//! Parse a shape "BxRxC" or "RxC".
+Shape parseShape(std::string const& text)
+{
+    std::vector<int64_t> extents;
+    for (auto const& extent : sample::splitToStringVec(text, 'x'))
+    {
+        extents.push_back(std::stoll(extent));
+    }
+    if (extents.size() < 2 || extents.size() > 3
+        || std::any_of(extents.begin(), extents.end(), [](int64_t e) { return e <= 0; }))
+    {
+        throw std::invalid_argument("invalid shape " + text);
+    }
+    return extents.size() == 2 ? Shape{1, extents[0], extents[1]} : Shape{extents[0], extents[1], extents[2]};
+}
+
+//! Reference transpose, one element at a time in destination order.
+void naiveTranspose(uint8_t* dst, uint8_t const* src, Shape const& shape, size_t elementSize)
+{
+    for (int64_t b = 0; b < shape.batch; ++b)
+    {
+        uint8_t const* srcMatrix = src + b * shape.rows * shape.cols * elementSize;
+        uint8_t* dstMatrix = dst + b * shape.rows * shape.cols * elementSize;
+        for (int64_t c = 0; c < shape.cols; ++c)
+        {
+            for (int64_t r = 0; r < shape.rows; ++r)
+            {
+                std::memcpy(dstMatrix + (c * shape.rows + r) * elementSize,
+                    srcMatrix + (r * shape.cols + c) * elementSize, elementSize);
+            }
+        }
+    }
+}
+
+//! Return the average time of func in microseconds, timed over iterations calls, or over at least kMIN_SECONDS if
+//! iterations is 0.
+template <typename F>
+double timeCalls(int32_t iterations, F&& func)
+{
+    func();
+    using Clock = std::chrono::steady_clock;
+    int64_t nbCalls{0};
+    auto const start = Clock::now();
+    auto end = start;
+    do
+    {
+        func();
+        ++nbCalls;
+        end = Clock::now();
+    } while (iterations > 0 ? nbCalls < iterations : std::chrono::duration<double>(end - start).count() < kMIN_SECONDS);
+    return std::chrono::duration<double, std::micro>(end - start).count() / nbCalls;
+}
+
+void printHelp()
+{
+    std::cout << "Usage: ./layout_benchmark [options]" << std::endl
+              << "  --shapes=<BxRxC>[,<BxRxC>]  Batches of rows x cols matrices to transpose (default = "
+              << kDEFAULT_SHAPES << ")" << std::endl
+              << "  --elementSize=<N>           Element size in bytes: 1, 2, 4 or 8 (default = 4)" << std::endl
+              << "  --threads=<N>               Number of threads of the threaded variant (default = number of "
+                 "hardware threads)"
+              << std::endl
+              << "  --iterations=<N>            Number of calls timed per variant (default = as many as fit in "
+              << kMIN_SECONDS << " s)" << std::endl
+              << "  --help, -h                  Print this message" << std::endl;
+}
+
+bool parseOptions(int32_t argc, char** argv, BenchmarkOptions& options)
+{
+    using nvinfer1::utility::TRTOption;
+    std::vector<TRTOption> const spec{{0, "shapes", true, ""}, {0, "elementSize", true, ""}, {0, "threads", true, ""},
+        {0, "iterations", true, ""}, {'h', "help", false, ""}};
+    auto const args = nvinfer1::utility::getOptions(argc, argv, spec);
+    if (!args.errMsg.empty())
+    {
+        sample::gLogError << args.errMsg << std::endl;
+        return false;
+    }
+    auto const& values = args.values;
+    if (values[4].first > 0)
+    {
+        printHelp();
+        exit(EXIT_SUCCESS);
+    }
+
+    auto lastValue = [&](size_t i, std::string const& fallback) {
+        return values[i].second.empty() ? fallback : values[i].second.back();
+    };
+    try
+    {
+        for (auto const& shape : sample::splitToStringVec(lastValue(0, kDEFAULT_SHAPES), ','))
+        {
+            options.shapes.push_back(parseShape(shape));
+        }
+        options.elementSize = std::stoul(lastValue(1, std::to_string(options.elementSize)));
+        options.nbThreads = std::stoi(lastValue(2, std::to_string(options.nbThreads)));
+        options.iterations = std::stoi(lastValue(3, std::to_string(options.iterations)));
+    }
+    catch (std::exception const& e)
+    {
+        sample::gLogError << "Invalid option value: " << e.what() << std::endl;
+        return false;
+    }
+
+    auto const size = options.elementSize;
+    if ((size != 1 && size != 2 && size != 4 && size != 8) || options.iterations < 0)
+    {
+        sample::gLogError << "Invalid arguments." << std::endl;
+        printHelp();
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto sampleTest = sample::gLogger.defineTest(kSAMPLE_NAME, argc, argv);
+    sample::gLogger.reportTestStart(sampleTest);
+
+    BenchmarkOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return sample::gLogger.reportFail(sampleTest);
+    }
+
+    int32_t const nbThreads = sample::resolveNbThreads(options.nbThreads);
+    sample::gLogInfo << "Element size " << options.elementSize << " bytes, threaded variant on " << nbThreads
+                     << " threads. Times are in microseconds per call." << std::endl;
+    sample::gLogInfo << std::left << std::setw(20) << "shape" << std::right << std::setw(12) << "naive" << std::setw(12)
+                     << "1 thread" << std::setw(12) << "threaded" << std::setw(12) << "GB/s" << std::endl;
+
+    bool pass{true};
+    for (auto const& shape : options.shapes)
+    {
+        size_t const bytes = shape.batch * shape.rows * shape.cols * options.elementSize;
+        std::vector<uint8_t> src(bytes);
+        for (size_t i = 0; i < bytes; ++i)
+        {
+            src[i] = static_cast<uint8_t>(i * 2654435761U >> 13);
+        }
+        std::vector<uint8_t> expected(bytes);
+        std::vector<uint8_t> single(bytes);
+        std::vector<uint8_t> threaded(bytes);
+
+        double const naiveUs = timeCalls(
+            options.iterations, [&]() { naiveTranspose(expected.data(), src.data(), shape, options.elementSize); });
+        double const singleUs = timeCalls(options.iterations, [&]() {
+            sample::transposeBatched(
+                single.data(), src.data(), shape.batch, shape.rows, shape.cols, options.elementSize, 1);
+        });
+        double const threadedUs = timeCalls(options.iterations, [&]() {
+            sample::transposeBatched(
+                threaded.data(), src.data(), shape.batch, shape.rows, shape.cols, options.elementSize, nbThreads);
+        });
+
+        std::string const name
+            = std::to_string(shape.batch) + "x" + std::to_string(shape.rows) + "x" + std::to_string(shape.cols);
+        // Each call reads and writes the buffer once.
+        double const gigabytesPerSecond = 2.0 * bytes / (threadedUs * 1e3);
+        sample::gLogInfo << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+                         << std::setw(12) << naiveUs << std::setw(12) << singleUs << std::setw(12) << threadedUs
+                         << std::setprecision(2) << std::setw(12) << gigabytesPerSecond << std::endl;
+
+        if (single != expected || threaded != expected)
+        {
+            sample::gLogError << "Transpose of " << name << " differs from the reference." << std::endl;
+            pass = false;
+        }
+    }
+
+    return pass ? sample::gLogger.reportPass(sampleTest) : sample::gLogger.reportFail(sampleTest);
+}
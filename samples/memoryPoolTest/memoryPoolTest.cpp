@@ -0,0 +1,882 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//! \file memoryPoolTest.cpp
+//!
+//! \brief Self-test of the memory pools used by trtexec.
+//!
+//! The pools are run on host memory backends, so the tool needs no GPU. The backends count the memory and markers
+//! they hand out, fail allocations beyond a capacity, and let the test decide when the work of a stream has finished.
+//! They back sample::CachingGpuAllocator and sample::PinnedHostPool. The buffers of sample::OutputBufferPool and
+//! sample::OutputAllocator are host buffers counted the same way.
+//!
+//! It can be run with the following command line:
+//! Command: ./memory_pool_test [--threads=N]
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "cachingAllocator.h"
+#include "getOptions.h"
+#include "logger.h"
+#include "pinnedHostPool.h"
+#include "sampleDevice.h"
+
+namespace
+{
+
+std::string const kSAMPLE_NAME = "TensorRT.memory_pool_test";
+
+//! Log the failed condition and return false from the test case.
+#define EXPECT(condition)                                                                                              \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(condition))                                                                                              \
+        {                                                                                                              \
+            sample::gLogError << __FILE__ << ":" << __LINE__ << ": expected " << #condition << std::endl;             \
+            return false;                                                                                              \
+        }                                                                                                              \
+    } while (0)
+
+cudaStream_t makeStream(uintptr_t id)
+{
+    return reinterpret_cast<cudaStream_t>(id);
+}
+
+//! Counters of a host backend, kept by the test so that they can be checked after the pool destroyed the backend.
+struct BackendCounters
+{
+    size_t capacity{SIZE_MAX}; //!< Allocations beyond this number of live bytes fail
+    size_t liveBytes{0};
+    int64_t nbAllocations{0};
+    int64_t nbFailedAllocations{0};
+    int64_t nbFrees{0};
+    int64_t nbLiveMarkers{0};
+    int64_t nbWaits{0};
+    bool failMarkers{false};
+    bool failRegistrations{false};
+    std::unordered_map<void*, size_t> live;
+    std::unordered_map<void*, size_t> registered; //!< Memory pinned in place by the pinned backend
+};
+
+//!
+//! \brief Device memory backend allocating host memory, with markers reached when the test says so.
+//!
+class HostMemoryBackend : public sample::IDeviceMemoryBackend
+{
+public:
+    explicit HostMemoryBackend(BackendCounters& counters)
+        : mCounters(counters)
+    {
+    }
+
+    void* allocate(size_t size) noexcept override
+    {
+        if (mCounters.liveBytes + size > mCounters.capacity)
+        {
+            ++mCounters.nbFailedAllocations;
+            return nullptr;
+        }
+        void* memory = std::malloc(size);
+        mCounters.live.emplace(memory, size);
+        mCounters.liveBytes += size;
+        ++mCounters.nbAllocations;
+        return memory;
+    }
+
+    void free(void* memory) noexcept override
+    {
+        auto const it = mCounters.live.find(memory);
+        if (it == mCounters.live.end())
+        {
+            // Reported by the test through the counters.
+            mCounters.nbFrees = -1;
+            return;
+        }
+        mCounters.liveBytes -= it->second;
+        mCounters.live.erase(it);
+        ++mCounters.nbFrees;
+        std::free(memory);
+    }
+
+    sample::StreamMarker recordMarker(cudaStream_t /*stream*/) noexcept override
+    {
+        if (mCounters.failMarkers)
+        {
+            return nullptr;
+        }
+        ++mCounters.nbLiveMarkers;
+        return new bool{mAllReached};
+    }
+
+    bool isMarkerReached(sample::StreamMarker marker) noexcept override
+    {
+        return mAllReached || *static_cast<bool*>(marker);
+    }
+
+    void waitForMarker(sample::StreamMarker marker) noexcept override
+    {
+        ++mCounters.nbWaits;
+        *static_cast<bool*>(marker) = true;
+    }
+
+    void releaseMarker(sample::StreamMarker marker) noexcept override
+    {
+        --mCounters.nbLiveMarkers;
+        delete static_cast<bool*>(marker);
+    }
+
+    //! Mark the work queued so far on every stream, and from now on, as finished.
+    void setAllReached(bool reached)
+    {
+        mAllReached = reached;
+    }
+
+private:
+    BackendCounters& mCounters;
+    bool mAllReached{false};
+};
+
+struct CachingAllocatorFixture
+{
+    BackendCounters counters;
+    HostMemoryBackend* backend{nullptr};
+    std::unique_ptr<sample::CachingGpuAllocator> allocator;
+
+    CachingAllocatorFixture()
+    {
+        std::unique_ptr<HostMemoryBackend> owned(new HostMemoryBackend(counters));
+        backend = owned.get();
+        allocator.reset(new sample::CachingGpuAllocator(std::move(owned)));
+    }
+
+    //! The allocator does not release the blocks still in use, so the fixture does.
+    ~CachingAllocatorFixture()
+    {
+        allocator.reset();
+        for (auto const& block : counters.live)
+        {
+            std::free(block.first);
+        }
+    }
+
+    void* allocate(size_t size, cudaStream_t stream)
+    {
+        return allocator->allocateAsync(size, 0, 0, stream);
+    }
+};
+
+bool testSizeClasses()
+{
+    using sample::CachingGpuAllocator;
+    EXPECT(CachingGpuAllocator::getSizeClass(1) == 512);
+    EXPECT(CachingGpuAllocator::getSizeClass(512) == 512);
+    EXPECT(CachingGpuAllocator::getSizeClass(513) == 1024);
+    EXPECT(CachingGpuAllocator::getSizeClass(1 << 20) == 1 << 20);
+    EXPECT(CachingGpuAllocator::getSizeClass((1 << 20) + 1) == (5 << 20) / 4);
+    EXPECT(CachingGpuAllocator::getSizeClass(3 << 20) == 3 << 20);
+    EXPECT(CachingGpuAllocator::getSizeClass((3 << 20) + 1) == (7 << 20) / 2);
+    for (size_t size = 1; size < (64 << 20); size = size * 3 / 2 + 1)
+    {
+        size_t const sizeClass = CachingGpuAllocator::getSizeClass(size);
+        EXPECT(sizeClass >= size && sizeClass % CachingGpuAllocator::kALIGNMENT == 0);
+        EXPECT(size <= (1 << 20) ? sizeClass - size < 512 : (sizeClass - size) * 4 <= sizeClass);
+    }
+    return true;
+}
+
+bool testInvalidRequests()
+{
+    CachingAllocatorFixture f;
+    EXPECT(f.allocate(0, nullptr) == nullptr);
+    EXPECT(f.allocator->allocateAsync(64, 2 * sample::CachingGpuAllocator::kALIGNMENT, 0, nullptr) == nullptr);
+    int32_t foreign{0};
+    EXPECT(!f.allocator->deallocateAsync(&foreign, nullptr));
+    EXPECT(f.allocator->deallocateAsync(nullptr, nullptr));
+    EXPECT(f.counters.nbAllocations == 0);
+    return true;
+}
+
+bool testSameStreamReuse()
+{
+    CachingAllocatorFixture f;
+    cudaStream_t const stream = makeStream(1);
+    void* const first = f.allocate(1000, stream);
+    EXPECT(first != nullptr);
+    EXPECT(f.allocator->deallocateAsync(first, stream));
+    // The work of the stream has not finished, but the next allocation on the stream is ordered after it.
+    EXPECT(f.allocate(700, stream) == first);
+    auto const stats = f.allocator->getStats();
+    EXPECT(stats.nbAllocations == 2 && stats.nbCacheHits == 1 && stats.nbBackendAllocations == 1);
+    EXPECT(stats.inUseBytes == 1024 && stats.reservedBytes == 1024);
+    return true;
+}
+
+bool testCrossStreamReuse()
+{
+    CachingAllocatorFixture f;
+    cudaStream_t const releasing = makeStream(1);
+    cudaStream_t const other = makeStream(2);
+    void* const first = f.allocate(4096, releasing);
+    EXPECT(f.allocator->deallocateAsync(first, releasing));
+
+    // Another stream must not get the block while the work queued before the release may still use it.
+    void* const second = f.allocate(4096, other);
+    EXPECT(second != nullptr && second != first);
+    EXPECT(f.counters.nbAllocations == 2);
+
+    f.backend->setAllReached(true);
+    void* const third = f.allocate(4096, other);
+    EXPECT(third == first);
+    EXPECT(f.allocator->getStats().nbCacheHits == 1);
+    return true;
+}
+
+bool testOutOfMemoryRetry()
+{
+    CachingAllocatorFixture f;
+    f.counters.capacity = 3 << 20;
+    cudaStream_t const stream = makeStream(1);
+    void* const a = f.allocate(1 << 20, stream);
+    void* const b = f.allocate(1 << 20, stream);
+    EXPECT(a != nullptr && b != nullptr);
+    EXPECT(f.allocator->deallocateAsync(a, stream) && f.allocator->deallocateAsync(b, stream));
+
+    // A larger class does not fit next to the cached blocks: they are given back and the allocation retried.
+    void* const large = f.allocate(2 << 20, stream);
+    EXPECT(large != nullptr);
+    EXPECT(f.counters.nbFailedAllocations == 1 && f.counters.nbFrees == 2);
+    EXPECT(f.counters.nbWaits == 2 && f.counters.nbLiveMarkers == 0);
+    EXPECT(f.allocator->getStats().reservedBytes == 2 << 20);
+
+    // Nothing is cached any more, so the next failure is reported.
+    EXPECT(f.allocate(2 << 20, stream) == nullptr);
+    return true;
+}
+
+bool testTrim()
+{
+    CachingAllocatorFixture f;
+    cudaStream_t const stream = makeStream(1);
+    std::vector<void*> blocks;
+    for (size_t size : {512, 4096, 1 << 20, 4 << 20})
+    {
+        blocks.push_back(f.allocate(size, stream));
+    }
+    void* const kept = f.allocate(512, stream);
+    for (void* block : blocks)
+    {
+        EXPECT(f.allocator->deallocateAsync(block, stream));
+    }
+
+    // Largest blocks first, until at most the target is reserved.
+    f.allocator->trim(2 << 20);
+    auto stats = f.allocator->getStats();
+    EXPECT(f.counters.nbFrees == 1 && f.counters.nbWaits == 1);
+    EXPECT(stats.reservedBytes == 512 + 512 + 4096 + (1 << 20));
+
+    f.allocator->trim();
+    stats = f.allocator->getStats();
+    EXPECT(stats.reservedBytes == 512 && stats.inUseBytes == 512 && stats.nbBackendFrees == 4);
+    EXPECT(f.counters.nbLiveMarkers == 0);
+    EXPECT(f.allocator->deallocateAsync(kept, stream));
+    return true;
+}
+
+bool testPeakStats()
+{
+    CachingAllocatorFixture f;
+    cudaStream_t const stream = makeStream(1);
+    void* const a = f.allocate(8192, stream);
+    void* const b = f.allocate(8192, stream);
+    EXPECT(f.allocator->deallocateAsync(a, stream) && f.allocator->deallocateAsync(b, stream));
+    auto stats = f.allocator->getStats();
+    EXPECT(stats.inUseBytes == 0 && stats.peakInUseBytes == 16384 && stats.peakReservedBytes == 16384);
+
+    f.allocator->resetPeakStats();
+    void* const c = f.allocate(8192, stream);
+    stats = f.allocator->getStats();
+    EXPECT(stats.peakInUseBytes == 8192 && stats.peakReservedBytes == 16384);
+    EXPECT(f.allocator->deallocateAsync(c, stream));
+    return true;
+}
+
+bool testMarkerFailure()
+{
+    CachingAllocatorFixture f;
+    f.counters.failMarkers = true;
+    void* const block = f.allocate(512, makeStream(1));
+    // Without a marker, the block cannot be reused safely and goes back to the backend.
+    EXPECT(f.allocator->deallocateAsync(block, makeStream(1)));
+    EXPECT(f.counters.nbFrees == 1 && f.counters.liveBytes == 0);
+    EXPECT(f.allocator->getStats().reservedBytes == 0);
+    return true;
+}
+
+bool testDestruction()
+{
+    BackendCounters counters;
+    {
+        sample::CachingGpuAllocator allocator(std::unique_ptr<HostMemoryBackend>(new HostMemoryBackend(counters)));
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            void* const block = allocator.allocateAsync(1024 << i, 0, 0, makeStream(i % 2));
+            allocator.deallocateAsync(block, makeStream(i % 2));
+        }
+    }
+    // The cached blocks are freed, after waiting for the streams that released them.
+    EXPECT(counters.nbFrees == counters.nbAllocations && counters.live.empty());
+    EXPECT(counters.nbLiveMarkers == 0 && counters.nbWaits == counters.nbFrees);
+    return true;
+}
+
+bool testConcurrentUse(int32_t nbThreads)
+{
+    CachingAllocatorFixture f;
+    f.backend->setAllReached(true);
+    constexpr int32_t kITERATIONS{2000};
+    std::vector<std::thread> threads;
+    std::vector<int32_t> failures(nbThreads, 0);
+    for (int32_t t = 0; t < nbThreads; ++t)
+    {
+        threads.emplace_back([&f, &failures, t]() {
+            cudaStream_t const stream = makeStream(t + 1);
+            std::vector<void*> blocks;
+            for (int32_t i = 0; i < kITERATIONS; ++i)
+            {
+                size_t const size = 256 << ((i * 7 + t) % 12);
+                void* const block = f.allocate(size, stream);
+                if (block == nullptr)
+                {
+                    ++failures[t];
+                    continue;
+                }
+                // Write the whole block, so that a block handed out twice is caught by the sanitizers.
+                std::fill_n(static_cast<uint8_t*>(block), size, static_cast<uint8_t>(t));
+                blocks.push_back(block);
+                if (blocks.size() > 4)
+                {
+                    failures[t] += !f.allocator->deallocateAsync(blocks.front(), stream);
+                    blocks.erase(blocks.begin());
+                }
+            }
+            for (void* block : blocks)
+            {
+                failures[t] += !f.allocator->deallocateAsync(block, stream);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (int32_t t = 0; t < nbThreads; ++t)
+    {
+        EXPECT(failures[t] == 0);
+    }
+    auto const stats = f.allocator->getStats();
+    EXPECT(stats.inUseBytes == 0 && stats.nbAllocations == int64_t{kITERATIONS} * nbThreads);
+    EXPECT(stats.nbCacheHits + stats.nbBackendAllocations == stats.nbAllocations);
+    EXPECT(stats.reservedBytes == static_cast<int64_t>(f.counters.liveBytes));
+    return true;
+}
+
+//!
+//! \brief Pinned memory backend allocating pageable host memory.
+//!
+class HostPinnedBackend : public sample::IPinnedMemoryBackend
+{
+public:
+    explicit HostPinnedBackend(BackendCounters& counters)
+        : mCounters(counters)
+    {
+    }
+
+    void* allocate(size_t size) noexcept override
+    {
+        if (mCounters.liveBytes + size > mCounters.capacity)
+        {
+            ++mCounters.nbFailedAllocations;
+            return nullptr;
+        }
+        // The pool rounds the slabs up to its alignment, as required by aligned_alloc.
+        void* memory = std::aligned_alloc(sample::PinnedHostPool::kALIGNMENT, size);
+        mCounters.live.emplace(memory, size);
+        mCounters.liveBytes += size;
+        ++mCounters.nbAllocations;
+        return memory;
+    }
+
+    void free(void* memory) noexcept override
+    {
+        auto const it = mCounters.live.find(memory);
+        if (it == mCounters.live.end())
+        {
+            mCounters.nbFrees = -1;
+            return;
+        }
+        mCounters.liveBytes -= it->second;
+        mCounters.live.erase(it);
+        ++mCounters.nbFrees;
+        std::free(memory);
+    }
+
+    bool registerMemory(void* memory, size_t size) noexcept override
+    {
+        if (mCounters.failRegistrations || mCounters.registered.count(memory) != 0)
+        {
+            return false;
+        }
+        mCounters.registered.emplace(memory, size);
+        return true;
+    }
+
+    void unregisterMemory(void* memory) noexcept override
+    {
+        if (mCounters.registered.erase(memory) == 0)
+        {
+            mCounters.nbFrees = -1;
+        }
+    }
+
+private:
+    BackendCounters& mCounters;
+};
+
+struct PinnedPoolFixture
+{
+    static constexpr size_t kSLAB_SIZE{4096};
+
+    BackendCounters counters;
+    std::unique_ptr<sample::PinnedHostPool> pool;
+
+    PinnedPoolFixture()
+        : pool(new sample::PinnedHostPool(
+            std::unique_ptr<HostPinnedBackend>(new HostPinnedBackend(counters)), kSLAB_SIZE))
+    {
+    }
+
+    //! The pool does not release the slabs still in use, so the fixture does.
+    ~PinnedPoolFixture()
+    {
+        pool.reset();
+        for (auto const& slab : counters.live)
+        {
+            std::free(slab.first);
+        }
+    }
+
+    //! Return true if [memory, memory + size) lies in a slab.
+    bool isInSlab(void* memory, size_t size) const
+    {
+        auto const* bytes = static_cast<uint8_t*>(memory);
+        for (auto const& slab : counters.live)
+        {
+            auto const* begin = static_cast<uint8_t*>(slab.first);
+            if (bytes >= begin && bytes + size <= begin + slab.second)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+bool testPinnedSubAllocation()
+{
+    PinnedPoolFixture f;
+    std::vector<void*> buffers;
+    for (size_t size : {1, 300, 1000, 256})
+    {
+        void* const buffer = f.pool->allocate(size);
+        EXPECT(buffer != nullptr && f.isInSlab(buffer, size));
+        EXPECT(reinterpret_cast<uintptr_t>(buffer) % sample::PinnedHostPool::kALIGNMENT == 0);
+        buffers.push_back(buffer);
+    }
+    EXPECT(f.counters.nbAllocations == 1);
+    auto const stats = f.pool->getStats();
+    EXPECT(stats.nbSlabs == 1 && stats.slabBytes == PinnedPoolFixture::kSLAB_SIZE);
+    EXPECT(stats.inUseBytes == 256 + 512 + 1024 + 256 && stats.nbAllocations == 4);
+
+    int32_t foreign{0};
+    EXPECT(!f.pool->deallocate(&foreign));
+    EXPECT(f.pool->allocate(0) == nullptr);
+    for (void* buffer : buffers)
+    {
+        EXPECT(f.pool->deallocate(buffer));
+    }
+    EXPECT(!f.pool->deallocate(buffers.front()));
+    EXPECT(f.pool->getStats().inUseBytes == 0 && f.pool->getStats().peakInUseBytes == 2048);
+    return true;
+}
+
+bool testPinnedMerge()
+{
+    PinnedPoolFixture f;
+    std::vector<void*> quarters;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        quarters.push_back(f.pool->allocate(1024));
+    }
+    EXPECT(f.counters.nbAllocations == 1);
+
+    // The two middle quarters merge into a range large enough for half a slab.
+    EXPECT(f.pool->deallocate(quarters[1]) && f.pool->deallocate(quarters[2]));
+    void* const half = f.pool->allocate(2048);
+    EXPECT(half == quarters[1] && f.counters.nbAllocations == 1);
+
+    // Then the whole slab, once every range is back.
+    EXPECT(f.pool->deallocate(half) && f.pool->deallocate(quarters[0]) && f.pool->deallocate(quarters[3]));
+    void* const whole = f.pool->allocate(4096);
+    EXPECT(whole == quarters[0] && f.counters.nbAllocations == 1);
+    EXPECT(f.pool->deallocate(whole));
+    return true;
+}
+
+bool testPinnedSlabs()
+{
+    PinnedPoolFixture f;
+    void* const small = f.pool->allocate(4000);
+    // A buffer larger than the slabs gets a slab of its own size.
+    void* const large = f.pool->allocate(10000);
+    EXPECT(small != nullptr && large != nullptr);
+    auto stats = f.pool->getStats();
+    EXPECT(stats.nbSlabs == 2 && stats.slabBytes == 4096 + 10240);
+
+    // Only the slabs without buffers in use go back to the backend.
+    EXPECT(f.pool->deallocate(large));
+    f.pool->trim();
+    stats = f.pool->getStats();
+    EXPECT(stats.nbSlabs == 1 && stats.slabBytes == 4096 && f.counters.nbFrees == 1);
+    EXPECT(f.isInSlab(small, 4000));
+
+    // When the backend fails, so does the pool, and the caller falls back to its own allocation.
+    f.counters.capacity = f.counters.liveBytes;
+    EXPECT(f.pool->allocate(1024) == nullptr);
+    EXPECT(f.pool->deallocate(small));
+    return true;
+}
+
+bool testPinnedDestruction()
+{
+    BackendCounters counters;
+    {
+        sample::PinnedHostPool pool(std::unique_ptr<HostPinnedBackend>(new HostPinnedBackend(counters)), 4096);
+        for (size_t size : {4096, 4096, 8192})
+        {
+            pool.deallocate(pool.allocate(size));
+        }
+        // A slab with a buffer in use is not released.
+        static_cast<void>(pool.allocate(4096));
+    }
+    // The second buffer reuses the first slab.
+    bool const released = counters.nbAllocations == 2 && counters.nbFrees == 1 && counters.live.size() == 1;
+    for (auto const& slab : counters.live)
+    {
+        std::free(slab.first);
+    }
+    EXPECT(released);
+    return true;
+}
+
+bool testPinnedRegistration()
+{
+    BackendCounters counters;
+    std::vector<uint8_t> first(1000);
+    std::vector<uint8_t> second(300);
+    {
+        sample::PinnedHostPool pool(std::unique_ptr<HostPinnedBackend>(new HostPinnedBackend(counters)), 4096);
+        EXPECT(pool.registerHostMemory(first.data(), first.size()));
+        EXPECT(pool.registerHostMemory(second.data(), second.size()));
+        auto stats = pool.getStats();
+        EXPECT(stats.registeredBytes == 1300 && stats.getPinnedBytes() == 1300 && counters.registered.size() == 2);
+        // Registered memory does not come from the slabs.
+        EXPECT(stats.nbSlabs == 0 && counters.nbAllocations == 0);
+
+        EXPECT(!pool.registerHostMemory(first.data(), first.size()));
+        EXPECT(!pool.registerHostMemory(nullptr, 64));
+        EXPECT(!pool.registerHostMemory(first.data() + 1, 0));
+        int32_t foreign{0};
+        EXPECT(!pool.unregisterHostMemory(&foreign));
+        EXPECT(!pool.deallocate(first.data()));
+
+        EXPECT(pool.unregisterHostMemory(first.data()));
+        EXPECT(!pool.unregisterHostMemory(first.data()));
+        stats = pool.getStats();
+        EXPECT(stats.registeredBytes == 300 && counters.registered.size() == 1);
+
+        // When the backend cannot pin the memory, the pool does not track it.
+        counters.failRegistrations = true;
+        EXPECT(!pool.registerHostMemory(first.data(), first.size()));
+        EXPECT(pool.getStats().registeredBytes == 300 && !pool.unregisterHostMemory(first.data()));
+    }
+    // The pool unpins the memory still registered when it is destroyed.
+    EXPECT(counters.registered.empty() && counters.nbFrees == 0);
+    return true;
+}
+
+bool testPinnedConcurrentUse(int32_t nbThreads)
+{
+    PinnedPoolFixture f;
+    constexpr int32_t kITERATIONS{2000};
+    std::vector<std::thread> threads;
+    std::vector<int32_t> failures(nbThreads, 0);
+    for (int32_t t = 0; t < nbThreads; ++t)
+    {
+        threads.emplace_back([&f, &failures, t]() {
+            std::vector<std::pair<void*, size_t>> buffers;
+            for (int32_t i = 0; i < kITERATIONS; ++i)
+            {
+                size_t const size = 1 + (i * 131 + t * 17) % 6000;
+                void* const buffer = f.pool->allocate(size);
+                if (buffer == nullptr)
+                {
+                    ++failures[t];
+                    continue;
+                }
+                std::fill_n(static_cast<uint8_t*>(buffer), size, static_cast<uint8_t>(t));
+                buffers.emplace_back(buffer, size);
+                if (buffers.size() > 4)
+                {
+                    auto const& oldest = buffers.front();
+                    // Another thread writing to the buffer would have changed its content.
+                    auto const* bytes = static_cast<uint8_t*>(oldest.first);
+                    failures[t] += std::any_of(bytes, bytes + oldest.second, [t](uint8_t b) { return b != t; });
+                    failures[t] += !f.pool->deallocate(oldest.first);
+                    buffers.erase(buffers.begin());
+                }
+            }
+            for (auto const& buffer : buffers)
+            {
+                failures[t] += !f.pool->deallocate(buffer.first);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (int32_t t = 0; t < nbThreads; ++t)
+    {
+        EXPECT(failures[t] == 0);
+    }
+    auto const stats = f.pool->getStats();
+    EXPECT(stats.inUseBytes == 0 && stats.nbAllocations == int64_t{kITERATIONS} * nbThreads);
+    EXPECT(stats.slabBytes == static_cast<int64_t>(f.counters.liveBytes));
+    return true;
+}
+
+//!
+//! \brief Mirrored buffer of host memory, counting its bytes in the counters of the test.
+//!
+class HostMirroredBuffer : public sample::IMirroredBuffer
+{
+public:
+    explicit HostMirroredBuffer(BackendCounters& counters)
+        : mCounters(counters)
+    {
+    }
+
+    ~HostMirroredBuffer() override
+    {
+        mCounters.liveBytes -= mMemory.size();
+    }
+
+    void allocate(size_t size) override
+    {
+        mCounters.liveBytes += size - mMemory.size();
+        mMemory.assign(size, 0);
+        ++mCounters.nbAllocations;
+    }
+
+    void* getDeviceBuffer() const override
+    {
+        return const_cast<uint8_t*>(mMemory.data());
+    }
+
+    void* getHostBuffer() const override
+    {
+        return const_cast<uint8_t*>(mMemory.data());
+    }
+
+    void hostToDevice(sample::TrtCudaStream& /*stream*/) override {}
+
+    void deviceToHost(sample::TrtCudaStream& /*stream*/) override {}
+
+    size_t getSize() const override
+    {
+        return mMemory.size();
+    }
+
+private:
+    BackendCounters& mCounters;
+    std::vector<uint8_t> mMemory;
+};
+
+struct OutputPoolFixture
+{
+    BackendCounters counters;
+    std::shared_ptr<sample::OutputBufferPool> pool;
+
+    OutputPoolFixture()
+        : pool(std::make_shared<sample::OutputBufferPool>(
+            [this]() { return std::unique_ptr<sample::IMirroredBuffer>(new HostMirroredBuffer(counters)); }, 0))
+    {
+    }
+
+    std::unique_ptr<sample::OutputAllocator> makeAllocator(
+        sample::OutputAllocatorPolicy const& policy, bool pooled = true)
+    {
+        return std::unique_ptr<sample::OutputAllocator>(new sample::OutputAllocator(
+            std::unique_ptr<sample::IMirroredBuffer>(new HostMirroredBuffer(counters)), policy,
+            pooled ? pool : nullptr));
+    }
+};
+
+bool testOutputShrink()
+{
+    OutputPoolFixture f;
+    auto allocator = f.makeAllocator({1.F, 1});
+    constexpr uint64_t kSMALL{1 << 10};
+    constexpr uint64_t kLARGE{1 << 20};
+    allocator->reallocateOutputAsync("out", nullptr, kLARGE, 256, nullptr);
+
+    // A larger buffer released by another allocator stays in the pool when the allocator shrinks, and the large
+    // buffer it held is freed instead of being kept.
+    auto other = std::unique_ptr<sample::IMirroredBuffer>(new HostMirroredBuffer(f.counters));
+    other->allocate(4 * kLARGE);
+    f.pool->release(std::move(other), nullptr);
+    EXPECT(f.counters.liveBytes == 5 * kLARGE && f.pool->getStats().pooledBytes == 4 * kLARGE);
+    allocator->reallocateOutputAsync("out", nullptr, kSMALL, 256, nullptr);
+    EXPECT(allocator->getBuffer()->getSize() == kSMALL);
+    EXPECT(f.counters.liveBytes == 4 * kLARGE + kSMALL && f.pool->getStats().pooledBytes == 4 * kLARGE);
+
+    // Growing takes the pooled buffer and releases the small one, which the next shrink takes back.
+    allocator->reallocateOutputAsync("out", nullptr, kLARGE, 256, nullptr);
+    EXPECT(allocator->getBuffer()->getSize() == 4 * kLARGE && f.pool->getStats().pooledBytes == kSMALL);
+    allocator->reallocateOutputAsync("out", nullptr, kSMALL, 256, nullptr);
+    auto const stats = f.pool->getStats();
+    EXPECT(allocator->getBuffer()->getSize() == kSMALL && f.counters.liveBytes == kSMALL);
+    EXPECT(stats.pooledBytes == 0 && stats.nbPoolHits == 2);
+    EXPECT(stats.nbReallocations == 3 && stats.nbShrinks == 2);
+    EXPECT(allocator->getNbReallocations() == 3 && allocator->getNbShrinks() == 2);
+    return true;
+}
+
+bool testOutputWithoutPool()
+{
+    OutputPoolFixture f;
+    auto allocator = f.makeAllocator({2.F, 2}, false);
+    allocator->reallocateOutputAsync("out", nullptr, 1000, 1, nullptr);
+    allocator->reallocateOutputAsync("out", nullptr, 1500, 1, nullptr);
+    EXPECT(allocator->getBuffer()->getSize() == 2000);
+    // Shrinking takes shrinkAfter consecutive small requests.
+    allocator->reallocateOutputAsync("out", nullptr, 100, 1, nullptr);
+    EXPECT(allocator->getBuffer()->getSize() == 2000);
+    allocator->reallocateOutputAsync("out", nullptr, 100, 1, nullptr);
+    EXPECT(allocator->getBuffer()->getSize() == 100 && f.counters.liveBytes == 100);
+    EXPECT(allocator->getNbReallocations() == 2 && allocator->getNbShrinks() == 1);
+    EXPECT(f.pool->getStats().nbReallocations == 0);
+    return true;
+}
+
+void printHelp()
+{
+    std::cout << "Usage: ./memory_pool_test [options]" << std::endl
+              << "  --threads=<N>  Number of threads of the concurrent cases (default = 4)" << std::endl
+              << "  --help, -h     Print this message" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto sampleTest = sample::gLogger.defineTest(kSAMPLE_NAME, argc, argv);
+    sample::gLogger.reportTestStart(sampleTest);
+
+    using nvinfer1::utility::TRTOption;
+    std::vector<TRTOption> const spec{{0, "threads", true, ""}, {'h', "help", false, ""}};
+    auto const args = nvinfer1::utility::getOptions(argc, argv, spec);
+    if (!args.errMsg.empty())
+    {
+        sample::gLogError << args.errMsg << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+    if (args.values[1].first > 0)
+    {
+        printHelp();
+        return sample::gLogger.reportPass(sampleTest);
+    }
+    int32_t nbThreads{4};
+    try
+    {
+        if (!args.values[0].second.empty())
+        {
+            nbThreads = std::stoi(args.values[0].second.back());
+        }
+    }
+    catch (std::exception const& e)
+    {
+        sample::gLogError << "Invalid option value: " << e.what() << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+    if (nbThreads <= 0)
+    {
+        sample::gLogError << "Invalid number of threads." << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+
+    std::vector<std::pair<char const*, std::function<bool()>>> const cases{
+        {"CachingGpuAllocator size classes", testSizeClasses},
+        {"CachingGpuAllocator invalid requests", testInvalidRequests},
+        {"CachingGpuAllocator same-stream reuse", testSameStreamReuse},
+        {"CachingGpuAllocator cross-stream reuse", testCrossStreamReuse},
+        {"CachingGpuAllocator out-of-memory retry", testOutOfMemoryRetry},
+        {"CachingGpuAllocator trim", testTrim},
+        {"CachingGpuAllocator peak statistics", testPeakStats},
+        {"CachingGpuAllocator marker failure", testMarkerFailure},
+        {"CachingGpuAllocator destruction", testDestruction},
+        {"CachingGpuAllocator concurrent use", [nbThreads]() { return testConcurrentUse(nbThreads); }},
+        {"PinnedHostPool sub-allocation", testPinnedSubAllocation},
+        {"PinnedHostPool merge of free ranges", testPinnedMerge},
+        {"PinnedHostPool slabs", testPinnedSlabs},
+        {"PinnedHostPool destruction", testPinnedDestruction},
+        {"PinnedHostPool host registration", testPinnedRegistration},
+        {"PinnedHostPool concurrent use", [nbThreads]() { return testPinnedConcurrentUse(nbThreads); }},
+        {"OutputAllocator shrink through the pool", testOutputShrink},
+        {"OutputAllocator without pool", testOutputWithoutPool},
+    };
+
+    int32_t nbFailed{0};
+    for (auto const& testCase : cases)
+    {
+        bool const passed = testCase.second();
+        sample::gLogInfo << (passed ? "[ PASSED ] " : "[ FAILED ] ") << testCase.first << std::endl;
+        nbFailed += !passed;
+    }
+    sample::gLogInfo << cases.size() - nbFailed << " of " << cases.size() << " cases passed." << std::endl;
+
+    return nbFailed == 0 ? sample::gLogger.reportPass(sampleTest) : sample::gLogger.reportFail(sampleTest);
+}
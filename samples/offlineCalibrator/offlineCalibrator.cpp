@@ -0,0 +1,566 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//! \file offlineCalibrator.cpp
+//!
+//! \brief Builds an INT8 calibration cache on the CPU from activation dumps.
+//!
+//! The activations are the .npy files written by trtexec --saveAllDebugTensors=numpy. For each tensor, the tool
+//! builds a histogram of the absolute values over all dumps and picks the clipping threshold (amax) with one of:
+//!   - entropy: minimize the KL divergence between the reference and the quantized distribution,
+//!   - percentile: clip at a percentile of the absolute values,
+//!   - mse: minimize the mean squared quantization error.
+//!
+//! The result is written in the calibration cache format that trtexec reads with --calib, so it can be used with
+//! setTensorScalesFromCalibration() or by a calibrator's readCalibrationCache().
+//!
+//! It can be run with the following command line:
+//! Command: ./offline_calibrator --dumps=<dir> [--dumps=<dir> ...] [--output=calibration.cache] [--method=entropy]
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "NvInferVersion.h"
+#include "debugTensorReader.h"
+#include "getOptions.h"
+#include "half.h"
+#include "logger.h"
+
+using namespace sample;
+
+namespace
+{
+
+std::string const kSAMPLE_NAME = "TensorRT.offline_calibrator";
+
+constexpr int32_t kDEFAULT_NB_BINS{2048};
+constexpr int32_t kNB_QUANT_BINS{128};   //!< Positive levels of a symmetric INT8 quantizer, including zero
+constexpr int32_t kQUANT_MAX{127};       //!< Largest quantized magnitude
+constexpr int64_t kBLOCK_SIZE{1024};     //!< Number of elements converted and binned at a time
+constexpr int32_t kNB_SUB_HISTOGRAMS{4}; //!< Interleaved histograms, so that consecutive increments do not alias
+constexpr float kMIN_AMAX{1e-6F};        //!< Floor for all-zero tensors, whose scale must still be positive
+
+enum class CalibrationMethod
+{
+    kENTROPY,
+    kPERCENTILE,
+    kMSE
+};
+
+struct CalibratorOptions
+{
+    std::vector<std::string> dumpDirectories;
+    std::string output{"calibration.cache"};
+    CalibrationMethod method{CalibrationMethod::kENTROPY};
+    double percentile{99.99};
+    int32_t nbBins{kDEFAULT_NB_BINS};
+    int32_t stride{1};
+    int32_t nbThreads{0};
+};
+
+//! All dumps of one tensor.
+struct TensorDumps
+{
+    std::string name;
+    std::vector<std::string> files;
+    float amax{0.F};
+    bool valid{false};
+    std::string message; //!< Why the tensor was skipped, reported once all workers are done
+};
+
+//! Call func(values, count) on consecutive blocks of a floating point .npy array, converted to float.
+template <typename F>
+bool forEachFloatBlock(NpyView const& view, F&& func)
+{
+    if (view.descr == "<f4")
+    {
+        auto const* values = static_cast<float const*>(view.data);
+        for (int64_t i = 0; i < view.volume; i += kBLOCK_SIZE)
+        {
+            func(values + i, std::min(kBLOCK_SIZE, view.volume - i));
+        }
+        return true;
+    }
+    if (view.descr == "<f2")
+    {
+        auto const* values = static_cast<half_float::half const*>(view.data);
+        float block[kBLOCK_SIZE];
+        for (int64_t i = 0; i < view.volume; i += kBLOCK_SIZE)
+        {
+            int64_t const count = std::min(kBLOCK_SIZE, view.volume - i);
+            std::transform(values + i, values + i + count, block, [](half_float::half h) { return float(h); });
+            func(block, count);
+        }
+        return true;
+    }
+    return false;
+}
+
+//! Map and parse every dump of a tensor and call func(view) on each. Returns false if a dump is unusable.
+//! This runs on worker threads, so problems are recorded in the tensor instead of being logged.
+template <typename F>
+bool forEachDump(TensorDumps& tensor, F&& func)
+{
+    for (auto const& path : tensor.files)
+    {
+        MappedFile file(path);
+        NpyView view;
+        std::string err;
+        if (!file.isOpen())
+        {
+            tensor.message = "cannot open " + path;
+            return false;
+        }
+        if (!parseNpy(file.data(), file.size(), view, err))
+        {
+            tensor.message = "cannot parse " + path + ": " + err;
+            return false;
+        }
+        if (view.descr != "<f4" && view.descr != "<f2")
+        {
+            tensor.message = "unsupported type " + view.descr;
+            return false;
+        }
+        func(view);
+    }
+    return true;
+}
+
+//! Largest finite absolute value. NaN and infinity are ignored.
+float absMax(float const* values, int64_t count)
+{
+    float m{0.F};
+    for (int64_t i = 0; i < count; ++i)
+    {
+        float const a = std::fabs(values[i]);
+        m = a <= std::numeric_limits<float>::max() ? std::max(m, a) : m;
+    }
+    return m;
+}
+
+//! Accumulate |values| into nbBins bins of width 1 / invWidth, saturating into the last bin.
+//! The bin indices of a block are computed first in a branch-free loop that the compiler vectorizes, and the
+//! increments are spread over interleaved sub-histograms to break the dependency between repeated indices.
+void accumulateHistogram(
+    float const* values, int64_t count, float invWidth, int32_t nbBins, std::vector<int64_t>& subHistograms)
+{
+    int32_t indices[kBLOCK_SIZE];
+    float const lastBin = static_cast<float>(nbBins - 1);
+    for (int64_t i = 0; i < count; ++i)
+    {
+        float const a = std::fabs(values[i]);
+        // Non-finite values go to the overflow slot at index nbBins, which is ignored.
+        indices[i] = a <= std::numeric_limits<float>::max() ? static_cast<int32_t>(std::min(a * invWidth, lastBin))
+                                                            : nbBins;
+    }
+
+    int32_t const stride = nbBins + 1;
+    int64_t i = 0;
+    for (; i + kNB_SUB_HISTOGRAMS <= count; i += kNB_SUB_HISTOGRAMS)
+    {
+        for (int32_t k = 0; k < kNB_SUB_HISTOGRAMS; ++k)
+        {
+            ++subHistograms[k * stride + indices[i + k]];
+        }
+    }
+    for (; i < count; ++i)
+    {
+        ++subHistograms[indices[i]];
+    }
+}
+
+//! Threshold minimizing KL(P || Q), where P is the histogram clipped at the threshold and Q its quantization to
+//! kNB_QUANT_BINS levels. This follows the entropy calibration of TensorRT and pytorch-quantization.
+int32_t computeEntropyBin(std::vector<double> bins, int32_t stride)
+{
+    int32_t const nbBins = static_cast<int32_t>(bins.size());
+    if (nbBins <= kNB_QUANT_BINS)
+    {
+        return nbBins;
+    }
+    // The zero bin is dominated by ReLU outputs and would swamp the divergence.
+    bins[0] = bins[1];
+
+    std::vector<double> quantSum(kNB_QUANT_BINS);
+    std::vector<int32_t> quantNonZero(kNB_QUANT_BINS);
+    double bestDivergence = std::numeric_limits<double>::infinity();
+    int32_t bestBin = nbBins;
+
+    double tail = 0.0;
+    for (int32_t i = nbBins; i >= kNB_QUANT_BINS; --i)
+    {
+        if (i < nbBins)
+        {
+            tail += bins[i];
+        }
+        if ((i - kNB_QUANT_BINS) % stride != 0)
+        {
+            continue;
+        }
+
+        // Merge the first i bins into kNB_QUANT_BINS levels, counting only non-empty bins.
+        std::fill(quantSum.begin(), quantSum.end(), 0.0);
+        std::fill(quantNonZero.begin(), quantNonZero.end(), 0);
+        for (int32_t j = 0; j < i; ++j)
+        {
+            if (bins[j] != 0.0)
+            {
+                int32_t const q = static_cast<int32_t>(static_cast<int64_t>(j) * kNB_QUANT_BINS / i);
+                quantSum[q] += bins[j];
+                ++quantNonZero[q];
+            }
+        }
+
+        double totalP = tail;
+        double totalQ = 0.0;
+        for (int32_t j = 0; j < i; ++j)
+        {
+            totalP += bins[j];
+            if (bins[j] != 0.0)
+            {
+                int32_t const q = static_cast<int32_t>(static_cast<int64_t>(j) * kNB_QUANT_BINS / i);
+                totalQ += quantSum[q] / quantNonZero[q];
+            }
+        }
+        if (totalP == 0.0 || totalQ == 0.0)
+        {
+            continue;
+        }
+
+        double divergence = 0.0;
+        for (int32_t j = 0; j < i; ++j)
+        {
+            // Outliers are clipped into the last reference bin.
+            double const p = (bins[j] + (j == i - 1 ? tail : 0.0)) / totalP;
+            if (p == 0.0)
+            {
+                continue;
+            }
+            double q = 0.0;
+            if (bins[j] != 0.0)
+            {
+                int32_t const qIdx = static_cast<int32_t>(static_cast<int64_t>(j) * kNB_QUANT_BINS / i);
+                q = quantSum[qIdx] / quantNonZero[qIdx] / totalQ;
+            }
+            divergence = q == 0.0 ? std::numeric_limits<double>::infinity() : divergence + p * std::log(p / q);
+        }
+
+        // Ties keep the largest threshold, since thresholds are visited in decreasing order.
+        if (divergence < bestDivergence)
+        {
+            bestDivergence = divergence;
+            bestBin = i;
+        }
+    }
+    return bestBin;
+}
+
+//! Smallest threshold bin whose upper edge covers the given percentile of the values.
+int32_t computePercentileBin(std::vector<double> const& bins, double percentile)
+{
+    double const total = std::accumulate(bins.begin(), bins.end(), 0.0);
+    double const target = total * percentile / 100.0;
+    double cumulative = 0.0;
+    for (size_t i = 0; i < bins.size(); ++i)
+    {
+        cumulative += bins[i];
+        if (cumulative >= target)
+        {
+            return static_cast<int32_t>(i + 1);
+        }
+    }
+    return static_cast<int32_t>(bins.size());
+}
+
+//! Threshold bin minimizing the expected squared error of symmetric quantization, evaluated at the bin centers.
+int32_t computeMseBin(std::vector<double> const& bins, int32_t stride)
+{
+    int32_t const nbBins = static_cast<int32_t>(bins.size());
+    double bestError = std::numeric_limits<double>::infinity();
+    int32_t bestBin = nbBins;
+    for (int32_t i = std::min(kNB_QUANT_BINS, nbBins); i <= nbBins; i += stride)
+    {
+        // Work in units of bins: the threshold is i and a quantization step is i / kQUANT_MAX.
+        double const step = static_cast<double>(i) / kQUANT_MAX;
+        double error = 0.0;
+        for (int32_t j = 0; j < nbBins; ++j)
+        {
+            double const center = j + 0.5;
+            double const level = std::min(std::round(center / step), static_cast<double>(kQUANT_MAX));
+            double const diff = center - level * step;
+            error += bins[j] * diff * diff;
+        }
+        if (error < bestError)
+        {
+            bestError = error;
+            bestBin = i;
+        }
+    }
+    return bestBin;
+}
+
+//! Compute the calibrated amax of one tensor from all of its dumps.
+void calibrateTensor(TensorDumps& tensor, CalibratorOptions const& options)
+{
+    float amax{0.F};
+    tensor.valid = forEachDump(tensor, [&](NpyView const& view) {
+        forEachFloatBlock(
+            view, [&](float const* values, int64_t count) { amax = std::max(amax, absMax(values, count)); });
+    });
+    if (!tensor.valid)
+    {
+        return;
+    }
+    if (amax == 0.F)
+    {
+        tensor.message = "all values are zero";
+        tensor.amax = kMIN_AMAX;
+        return;
+    }
+
+    int32_t const nbBins = options.nbBins;
+    float const invWidth = static_cast<float>(nbBins) / amax;
+    std::vector<int64_t> subHistograms(static_cast<size_t>(kNB_SUB_HISTOGRAMS) * (nbBins + 1), 0);
+    forEachDump(tensor, [&](NpyView const& view) {
+        forEachFloatBlock(view, [&](float const* values, int64_t count) {
+            accumulateHistogram(values, count, invWidth, nbBins, subHistograms);
+        });
+    });
+
+    std::vector<double> bins(nbBins, 0.0);
+    for (int32_t k = 0; k < kNB_SUB_HISTOGRAMS; ++k)
+    {
+        for (int32_t j = 0; j < nbBins; ++j)
+        {
+            bins[j] += static_cast<double>(subHistograms[k * (nbBins + 1) + j]);
+        }
+    }
+
+    int32_t bin{nbBins};
+    switch (options.method)
+    {
+    case CalibrationMethod::kENTROPY: bin = computeEntropyBin(bins, options.stride); break;
+    case CalibrationMethod::kPERCENTILE: bin = computePercentileBin(bins, options.percentile); break;
+    case CalibrationMethod::kMSE: bin = computeMseBin(bins, options.stride); break;
+    }
+    tensor.amax = std::max(amax * static_cast<float>(bin) / static_cast<float>(nbBins), kMIN_AMAX);
+}
+
+//! TensorRT only accepts the cache of the calibrator it runs, and IInt8EntropyCalibrator2 is the one used by trtexec
+//! and the samples, so the header names it whatever method picked the thresholds.
+std::string getCacheHeader()
+{
+    int32_t const version = NV_TENSORRT_MAJOR * 10000 + NV_TENSORRT_MINOR * 100 + NV_TENSORRT_PATCH;
+    return "TRT-" + std::to_string(version) + "-EntropyCalibration2";
+}
+
+//! Write scales (amax / 127) as the hexadecimal bit pattern of a float, the format readScalesFromCalibrationCache()
+//! expects.
+bool writeCalibrationCache(std::vector<TensorDumps> const& tensors, CalibratorOptions const& options)
+{
+    std::ofstream cache(options.output);
+    if (!cache)
+    {
+        sample::gLogError << "Cannot open " << options.output << " for writing." << std::endl;
+        return false;
+    }
+    cache << getCacheHeader() << std::endl;
+    for (auto const& tensor : tensors)
+    {
+        if (!tensor.valid)
+        {
+            continue;
+        }
+        float const scale = tensor.amax / kQUANT_MAX;
+        uint32_t bits{};
+        std::memcpy(&bits, &scale, sizeof(bits));
+        cache << tensor.name << ": " << std::hex << std::setw(8) << std::setfill('0') << bits << std::dec << std::endl;
+    }
+    return static_cast<bool>(cache);
+}
+
+void printHelp()
+{
+    std::cout << "Usage: ./offline_calibrator --dumps=<dir> [--dumps=<dir> ...] [options]" << std::endl
+              << "  --dumps=<dir>        Directory in which trtexec --saveAllDebugTensors=numpy[,summary] wrote its "
+                 ".npy files. Repeat for more calibration batches."
+              << std::endl
+              << "  --output=<file>      Calibration cache to write (default = calibration.cache)" << std::endl
+              << "  --method=<method>    entropy, percentile or mse (default = entropy)" << std::endl
+              << "  --percentile=<p>     Percentile used by --method=percentile (default = 99.99)" << std::endl
+              << "  --bins=<N>           Number of histogram bins (default = 2048)" << std::endl
+              << "  --stride=<N>         Step between candidate thresholds for entropy and mse (default = 1)"
+              << std::endl
+              << "  --threads=<N>        Number of worker threads (default = number of hardware threads)" << std::endl
+              << "  --help, -h           Print this message" << std::endl;
+}
+
+bool parseOptions(int32_t argc, char** argv, CalibratorOptions& options)
+{
+    using nvinfer1::utility::TRTOption;
+    std::vector<TRTOption> const spec{{0, "dumps", true, ""}, {0, "output", true, ""}, {0, "method", true, ""},
+        {0, "percentile", true, ""}, {0, "bins", true, ""}, {0, "stride", true, ""}, {0, "threads", true, ""},
+        {'h', "help", false, ""}};
+    auto const args = nvinfer1::utility::getOptions(argc, argv, spec);
+    if (!args.errMsg.empty())
+    {
+        sample::gLogError << args.errMsg << std::endl;
+        return false;
+    }
+    auto const& values = args.values;
+    if (values[7].first > 0)
+    {
+        printHelp();
+        exit(EXIT_SUCCESS);
+    }
+
+    auto lastValue = [&](size_t i, std::string const& fallback) {
+        return values[i].second.empty() ? fallback : values[i].second.back();
+    };
+    try
+    {
+        options.dumpDirectories = values[0].second;
+        options.output = lastValue(1, options.output);
+        std::string const method = lastValue(2, "entropy");
+        options.percentile = std::stod(lastValue(3, std::to_string(options.percentile)));
+        options.nbBins = std::stoi(lastValue(4, std::to_string(options.nbBins)));
+        options.stride = std::stoi(lastValue(5, std::to_string(options.stride)));
+        options.nbThreads = std::stoi(lastValue(6, std::to_string(options.nbThreads)));
+
+        if (method == "entropy")
+        {
+            options.method = CalibrationMethod::kENTROPY;
+        }
+        else if (method == "percentile")
+        {
+            options.method = CalibrationMethod::kPERCENTILE;
+        }
+        else if (method == "mse")
+        {
+            options.method = CalibrationMethod::kMSE;
+        }
+        else
+        {
+            sample::gLogError << "Unknown calibration method: " << method << std::endl;
+            return false;
+        }
+    }
+    catch (std::exception const& e)
+    {
+        sample::gLogError << "Invalid option value: " << e.what() << std::endl;
+        return false;
+    }
+
+    if (options.dumpDirectories.empty() || options.nbBins < kNB_QUANT_BINS || options.stride < 1
+        || options.percentile <= 0.0 || options.percentile > 100.0)
+    {
+        sample::gLogError << "Invalid arguments." << std::endl;
+        printHelp();
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int32_t main(int32_t argc, char** argv)
+{
+    auto sampleTest = sample::gLogger.defineTest(kSAMPLE_NAME, argc, argv);
+    sample::gLogger.reportTestStart(sampleTest);
+
+    CalibratorOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return sample::gLogger.reportFail(sampleTest);
+    }
+
+    // Group the dumps of all directories by tensor, keeping the order of the first dump.
+    std::vector<TensorDumps> tensors;
+    std::map<std::string, size_t> tensorIndices;
+    for (auto const& directory : options.dumpDirectories)
+    {
+        for (auto const& file : listDumpedNumpyFiles(directory))
+        {
+            auto const inserted = tensorIndices.emplace(file.name, tensors.size());
+            if (inserted.second)
+            {
+                tensors.push_back({file.name, {}, 0.F, false, {}});
+            }
+            tensors[inserted.first->second].files.push_back(file.path);
+        }
+    }
+    if (tensors.empty())
+    {
+        sample::gLogError << "No .npy tensor dumps found." << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+    sample::gLogInfo << "Calibrating " << tensors.size() << " tensors." << std::endl;
+
+    // Tensors differ widely in size, so workers pick up the next tensor as soon as they are done.
+    int32_t const nbHardwareThreads = std::max(static_cast<int32_t>(std::thread::hardware_concurrency()), 1);
+    int32_t const nbThreads = std::min(
+        static_cast<int32_t>(tensors.size()), options.nbThreads > 0 ? options.nbThreads : nbHardwareThreads);
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < tensors.size(); i = next++)
+        {
+            calibrateTensor(tensors[i], options);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (int32_t i = 1; i < nbThreads; ++i)
+    {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& w : workers)
+    {
+        w.join();
+    }
+
+    for (auto const& tensor : tensors)
+    {
+        if (!tensor.valid)
+        {
+            sample::gLogWarning << "Skipping tensor '" << tensor.name << "': " << tensor.message << std::endl;
+            continue;
+        }
+        if (!tensor.message.empty())
+        {
+            sample::gLogWarning << "Tensor '" << tensor.name << "': " << tensor.message << std::endl;
+        }
+        sample::gLogVerbose << tensor.name << ": amax = " << tensor.amax << std::endl;
+    }
+
+    if (!writeCalibrationCache(tensors, options))
+    {
+        return sample::gLogger.reportFail(sampleTest);
+    }
+    sample::gLogInfo << "Calibration cache written to " << options.output << std::endl;
+    return sample::gLogger.reportPass(sampleTest);
+}
@@ -0,0 +1,346 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hostKernelBenchmark.h"
+
+#include "buffers.h"
+#include "common.h"
+#include "common/kernels/kernel.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <sstream>
+
+using namespace nvinfer1;
+
+namespace sample
+{
+
+namespace
+{
+
+//! The host references follow the arithmetic of the kernels, so they should match them to the last bit. The tolerance
+//! only absorbs a different contraction of the products into FMA.
+constexpr float kDEVICE_TOLERANCE{1e-6F};
+
+constexpr float kVARIANCE[4]{0.1F, 0.1F, 0.2F, 0.2F};
+
+//! One feature map of an SSD model, with the prior boxes of PriorBox_TRT on it.
+struct PriorBoxConfig
+{
+    int32_t imageSize;
+    int32_t featureSize;
+    float minSize;
+    float maxSize;
+    std::vector<float> aspectRatios;
+};
+
+//! The feature maps of SSD models with grid anchors of GridAnchor_TRT, from the finest to the coarsest.
+struct GridAnchorConfig
+{
+    char const* name;
+    std::vector<int32_t> featureSizes;
+};
+
+//! Scales of the anchors of GridAnchor_TRT, as in TensorFlow SSD models.
+constexpr float kMIN_SCALE{0.2F};
+constexpr float kMAX_SCALE{0.95F};
+std::vector<float> const kGRID_ASPECT_RATIOS{1.F, 2.F, 0.5F, 3.F, 0.33F};
+//! The first layer only has the first three aspect ratios.
+constexpr int32_t kFIRST_LAYER_ASPECT_RATIOS{3};
+
+//! Return the aspect ratios of the priors of a PriorBox_TRT plugin, flipped and with a ratio of 1, as the plugin does.
+std::vector<float> getPriorAspectRatios(std::vector<float> const& aspectRatios)
+{
+    std::vector<float> priorAspectRatios{1.F};
+    for (float const aspectRatio : aspectRatios)
+    {
+        bool const exists = std::any_of(priorAspectRatios.begin(), priorAspectRatios.end(),
+            [aspectRatio](float r) { return std::fabs(aspectRatio - r) < 1e-6; });
+        if (!exists)
+        {
+            priorAspectRatios.push_back(aspectRatio);
+            priorAspectRatios.push_back(1.F / aspectRatio);
+        }
+    }
+    return priorAspectRatios;
+}
+
+//! Return the widths and heights of the anchors of a layer of a GridAnchor_TRT plugin, computed as the plugin does.
+void getAnchorShapes(int32_t layer, int32_t nbLayers, std::vector<float>& widths, std::vector<float>& heights)
+{
+    auto const scale
+        = [nbLayers](int32_t id) { return kMIN_SCALE + (kMAX_SCALE - kMIN_SCALE) * id / (nbLayers - 1); };
+    std::vector<float> aspectRatios;
+    std::vector<float> scales;
+    if (layer == 0)
+    {
+        aspectRatios.assign(kGRID_ASPECT_RATIOS.begin(), kGRID_ASPECT_RATIOS.begin() + kFIRST_LAYER_ASPECT_RATIOS);
+        scales = {0.1F, scale(0), scale(0)};
+    }
+    else
+    {
+        aspectRatios = kGRID_ASPECT_RATIOS;
+        aspectRatios.push_back(1.F);
+        scales.assign(kGRID_ASPECT_RATIOS.size(), scale(layer));
+        double const nextScale = layer == nbLayers - 1 ? 1.0 : scale(layer + 1);
+        scales.push_back(std::sqrt(scale(layer) * nextScale));
+    }
+    widths.clear();
+    heights.clear();
+    for (size_t i = 0; i < aspectRatios.size(); ++i)
+    {
+        float const sqrtAspectRatio = std::sqrt(aspectRatios[i]);
+        widths.push_back(scales[i] * sqrtAspectRatio);
+        heights.push_back(scales[i] / sqrtAspectRatio);
+    }
+}
+
+//!
+//! \brief Run the kernels of an IPluginV2Ext plugin once on the device and return its FP32 outputs.
+//!
+//! The plugin is enqueued without initialize(), where GridAnchor_TRT and PriorBox_TRT generate their outputs with the
+//! host references, so that it runs anchorGridInference() or priorBoxInference() instead of copying those outputs.
+//! The plugin is configured with inputDims if there are any. outputCounts are the number of values of each output.
+//!
+bool runPluginKernels(char const* name, PluginFieldCollection const& fields, std::vector<Dims> const& inputDims,
+    std::vector<int64_t> const& outputCounts, std::vector<std::vector<float>>& outputs)
+{
+    auto* creator = getPluginRegistry()->getCreator(name, "1", "");
+    if (creator == nullptr || std::string{creator->getInterfaceInfo().kind} != "PLUGIN CREATOR_V1")
+    {
+        sample::gLogError << "No creator for " << name << " v1." << std::endl;
+        return false;
+    }
+    auto const destroy = [](IPluginV2Ext* plugin) {
+        if (plugin != nullptr)
+        {
+            plugin->destroy();
+        }
+    };
+    std::unique_ptr<IPluginV2Ext, decltype(destroy)> plugin{
+        dynamic_cast<IPluginV2Ext*>(static_cast<IPluginCreator*>(creator)->createPlugin(name, &fields)), destroy};
+    if (!plugin)
+    {
+        sample::gLogError << "Cannot create a " << name << " plugin." << std::endl;
+        return false;
+    }
+
+    auto const nbInputs = static_cast<int32_t>(inputDims.size());
+    auto const nbOutputs = static_cast<int32_t>(outputCounts.size());
+    if (nbInputs > 0)
+    {
+        std::vector<Dims> outputDims;
+        for (int32_t o = 0; o < nbOutputs; ++o)
+        {
+            outputDims.push_back(plugin->getOutputDimensions(o, inputDims.data(), nbInputs));
+        }
+        std::vector<DataType> const inputTypes(nbInputs, DataType::kFLOAT);
+        std::vector<DataType> const outputTypes(nbOutputs, DataType::kFLOAT);
+        std::unique_ptr<bool[]> const inputIsBroadcast{new bool[nbInputs]()};
+        std::unique_ptr<bool[]> const outputIsBroadcast{new bool[nbOutputs]()};
+        plugin->configurePlugin(inputDims.data(), nbInputs, outputDims.data(), nbOutputs, inputTypes.data(),
+            outputTypes.data(), inputIsBroadcast.get(), outputIsBroadcast.get(), PluginFormat::kLINEAR, 1);
+    }
+
+    // The plugins generate their outputs from their parameters alone and do not read the inputs.
+    std::vector<void const*> const inputs(nbInputs, nullptr);
+    std::vector<samplesCommon::DeviceBuffer> buffers;
+    std::vector<void*> outputBuffers;
+    for (int64_t const count : outputCounts)
+    {
+        buffers.emplace_back(count, DataType::kFLOAT);
+        outputBuffers.push_back(buffers.back().data());
+    }
+    auto stream = samplesCommon::makeCudaStream();
+    if (!stream || plugin->enqueue(1, inputs.data(), outputBuffers.data(), nullptr, *stream) != 0)
+    {
+        sample::gLogError << "Cannot run the " << name << " kernels." << std::endl;
+        return false;
+    }
+    CHECK(cudaStreamSynchronize(*stream));
+    outputs.resize(nbOutputs);
+    for (int32_t o = 0; o < nbOutputs; ++o)
+    {
+        outputs[o].resize(outputCounts[o]);
+        CHECK(cudaMemcpy(outputs[o].data(), buffers[o].data(), buffers[o].nbBytes(), cudaMemcpyDeviceToHost));
+    }
+    return true;
+}
+
+//! Compare the priors of priorBoxHost() with the ones of priorBoxInference(), run through PriorBox_TRT.
+bool verifyPriorBox(KernelContext& context, std::string const& what, PriorBoxConfig const& c,
+    std::vector<float> const& reference)
+{
+    int32_t const flip{1};
+    int32_t const clip{0};
+    float const step = static_cast<float>(c.imageSize) / c.featureSize;
+    float const offset{0.5F};
+    std::vector<PluginField> const fields{{"minSize", &c.minSize, PluginFieldType::kFLOAT32, 1},
+        {"maxSize", &c.maxSize, PluginFieldType::kFLOAT32, 1},
+        {"aspectRatios", c.aspectRatios.data(), PluginFieldType::kFLOAT32,
+            static_cast<int32_t>(c.aspectRatios.size())},
+        {"flip", &flip, PluginFieldType::kINT32, 1}, {"clip", &clip, PluginFieldType::kINT32, 1},
+        {"variance", kVARIANCE, PluginFieldType::kFLOAT32, 4}, {"imgH", &c.imageSize, PluginFieldType::kINT32, 1},
+        {"imgW", &c.imageSize, PluginFieldType::kINT32, 1}, {"stepH", &step, PluginFieldType::kFLOAT32, 1},
+        {"stepW", &step, PluginFieldType::kFLOAT32, 1}, {"offset", &offset, PluginFieldType::kFLOAT32, 1}};
+    PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+    std::vector<Dims> const inputDims{
+        Dims{3, {256, c.featureSize, c.featureSize}}, Dims{3, {3, c.imageSize, c.imageSize}}};
+    std::vector<std::vector<float>> outputs;
+    if (!context.check(runPluginKernels("PriorBox_TRT", fc, inputDims, {static_cast<int64_t>(reference.size())},
+                           outputs),
+            "PriorBox_TRT failed"))
+    {
+        return false;
+    }
+    return expectNear(context, what + " and priorBoxInference outputs", outputs[0], reference, kDEVICE_TOLERANCE,
+        kDEVICE_TOLERANCE);
+}
+
+//! Compare the anchors of anchorGridHost() with the ones of anchorGridInference(), run through GridAnchor_TRT.
+bool verifyGridAnchor(KernelContext& context, std::string const& what, GridAnchorConfig const& c,
+    std::vector<std::vector<float>> const& references)
+{
+    auto const nbLayers = static_cast<int32_t>(c.featureSizes.size());
+    float const minScale{kMIN_SCALE};
+    float const maxScale{kMAX_SCALE};
+    std::vector<PluginField> const fields{{"numLayers", &nbLayers, PluginFieldType::kINT32, 1},
+        {"minSize", &minScale, PluginFieldType::kFLOAT32, 1}, {"maxSize", &maxScale, PluginFieldType::kFLOAT32, 1},
+        {"aspectRatios", kGRID_ASPECT_RATIOS.data(), PluginFieldType::kFLOAT32,
+            static_cast<int32_t>(kGRID_ASPECT_RATIOS.size())},
+        {"featureMapShapes", c.featureSizes.data(), PluginFieldType::kINT32, nbLayers},
+        {"variance", kVARIANCE, PluginFieldType::kFLOAT32, 4}};
+    PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+    std::vector<int64_t> outputCounts;
+    for (auto const& reference : references)
+    {
+        outputCounts.push_back(static_cast<int64_t>(reference.size()));
+    }
+    std::vector<std::vector<float>> outputs;
+    if (!context.check(
+            runPluginKernels("GridAnchor_TRT", fc, {}, outputCounts, outputs), "GridAnchor_TRT failed"))
+    {
+        return false;
+    }
+    bool passed = true;
+    for (int32_t layer = 0; layer < nbLayers; ++layer)
+    {
+        passed &= expectNear(context, what + " and anchorGridInference layer " + std::to_string(layer) + " outputs",
+            outputs[layer], references[layer], kDEVICE_TOLERANCE, kDEVICE_TOLERANCE);
+    }
+    return passed;
+}
+
+} // namespace
+
+bool benchmarkPriorBox(KernelContext& context)
+{
+    std::string const kernel = "priorBox";
+    // The first feature maps of SSD300 and SSD512, and a dense map of a large image.
+    std::vector<PriorBoxConfig> const configs{
+        {300, 38, 30.F, 60.F, {2.F}}, {512, 64, 35.84F, 76.8F, {2.F}}, {1024, 128, 40.F, 80.F, {2.F, 3.F}}};
+    for (auto const& c : configs)
+    {
+        std::ostringstream config;
+        config << c.featureSize << "x" << c.featureSize << ", " << c.imageSize << " image";
+
+        std::vector<float> minSize{c.minSize};
+        std::vector<float> maxSize{c.maxSize};
+        std::vector<float> aspectRatios = c.aspectRatios;
+        std::vector<float> const priorAspectRatios = getPriorAspectRatios(c.aspectRatios);
+        plugin::PriorBoxParameters param{};
+        param.minSize = minSize.data();
+        param.maxSize = maxSize.data();
+        param.aspectRatios = aspectRatios.data();
+        param.numMinSize = 1;
+        param.numMaxSize = 1;
+        param.numAspectRatios = static_cast<int32_t>(aspectRatios.size());
+        param.flip = true;
+        param.clip = false;
+        std::copy_n(kVARIANCE, 4, param.variance);
+        param.imgH = c.imageSize;
+        param.imgW = c.imageSize;
+        param.stepH = static_cast<float>(c.imageSize) / c.featureSize;
+        param.stepW = param.stepH;
+        param.offset = 0.5F;
+
+        auto const numPriors = static_cast<int32_t>(priorAspectRatios.size()) + 1;
+        int64_t const nbPriors = static_cast<int64_t>(c.featureSize) * c.featureSize * numPriors;
+        std::vector<float> output(2 * nbPriors * 4);
+        // The host reference is scalar code on one thread.
+        context.time(kernel, config.str(), context.variants(false).front(), static_cast<double>(nbPriors), "priors",
+            [&]() {
+                plugin::priorBoxHost(param, c.featureSize, c.featureSize, numPriors,
+                    static_cast<int32_t>(priorAspectRatios.size()), minSize.data(), maxSize.data(),
+                    priorAspectRatios.data(), output.data());
+            });
+        if (context.options().verify)
+        {
+            verifyPriorBox(context, kernel + " (" + config.str() + ")", c, output);
+        }
+    }
+    return true;
+}
+
+bool benchmarkGridAnchor(KernelContext& context)
+{
+    std::string const kernel = "gridAnchor";
+    std::vector<GridAnchorConfig> const configs{
+        {"SSD MobileNet 300", {19, 10, 5, 3, 2, 1}}, {"SSD MobileNet 1200", {75, 38, 19, 10, 5, 3}}};
+    for (auto const& c : configs)
+    {
+        auto const nbLayers = static_cast<int32_t>(c.featureSizes.size());
+        std::vector<std::vector<float>> widths(nbLayers);
+        std::vector<std::vector<float>> heights(nbLayers);
+        std::vector<std::vector<float>> aspectRatios(nbLayers);
+        std::vector<plugin::GridAnchorParameters> params(nbLayers);
+        std::vector<std::vector<float>> outputs(nbLayers);
+        int64_t nbAnchors{0};
+        for (int32_t layer = 0; layer < nbLayers; ++layer)
+        {
+            getAnchorShapes(layer, nbLayers, widths[layer], heights[layer]);
+            aspectRatios[layer].assign(kGRID_ASPECT_RATIOS.begin(),
+                layer == 0 ? kGRID_ASPECT_RATIOS.begin() + kFIRST_LAYER_ASPECT_RATIOS : kGRID_ASPECT_RATIOS.end());
+            int32_t const size = c.featureSizes[layer];
+            params[layer] = {kMIN_SCALE, kMAX_SCALE, aspectRatios[layer].data(),
+                static_cast<int32_t>(aspectRatios[layer].size()), size, size,
+                {kVARIANCE[0], kVARIANCE[1], kVARIANCE[2], kVARIANCE[3]}};
+            int64_t const layerAnchors = static_cast<int64_t>(size) * size * static_cast<int64_t>(widths[layer].size());
+            outputs[layer].resize(2 * layerAnchors * 4);
+            nbAnchors += layerAnchors;
+        }
+
+        // The host reference is scalar code on one thread.
+        context.time(kernel, c.name, context.variants(false).front(), static_cast<double>(nbAnchors), "anchors", [&]() {
+            for (int32_t layer = 0; layer < nbLayers; ++layer)
+            {
+                plugin::anchorGridHost(params[layer], static_cast<int32_t>(widths[layer].size()),
+                    widths[layer].data(), heights[layer].data(), outputs[layer].data());
+            }
+        });
+        if (context.options().verify)
+        {
+            verifyGridAnchor(context, kernel + " (" + std::string{c.name} + ")", c, outputs);
+        }
+    }
+    return true;
+}
+
+} // namespace sample
@@ -0,0 +1,245 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hostKernelBenchmark.h"
+
+#include "modulatedDeformConvPlugin/modulatedDeformConvHost.h"
+#include "multiscaleDeformableAttnPlugin/multiscaleDeformableAttnHost.h"
+
+#include <cuda_fp16.h>
+#include <sstream>
+
+using namespace nvinfer1;
+
+namespace sample
+{
+
+namespace
+{
+
+//! Tolerances of the comparisons of the SIMD and multithreaded variants with the scalar code, which only differ by
+//! the rounding of FMA and, in FP16, of the outputs.
+constexpr float kHOST_TOLERANCE_FP32{1e-4F};
+constexpr float kHOST_TOLERANCE_FP16{2e-3F};
+
+//! Tolerances of the comparisons with the CUDA plugins, whose FP16 kernels also compute in FP16.
+constexpr float kDEVICE_TOLERANCE_FP32{1e-3F};
+constexpr float kDEVICE_TOLERANCE_FP16{5e-2F};
+
+struct DeformConvConfig
+{
+    int32_t batch;
+    int32_t channels;
+    int32_t height;
+    int32_t width;
+    int32_t channelsOut;
+    int32_t kernel;
+    int32_t stride;
+    int32_t pad;
+    int32_t dilation;
+    int32_t group;
+    int32_t deformableGroup;
+};
+
+struct AttnConfig
+{
+    int32_t batch;
+    int32_t numQuery; //!< 0 for one query per pixel, as in the encoder
+    int32_t numHeads;
+    int32_t channels;
+    int32_t numPoint;
+    std::vector<int32_t> spatialShapes; //!< Height and width of each level
+};
+
+} // namespace
+
+bool benchmarkModulatedDeformConv(KernelContext& context)
+{
+    std::string const kernel = "modulatedDeformConv";
+    // DCNv2 layers of the last stages of a ResNet backbone.
+    std::vector<DeformConvConfig> const configs{
+        {1, 64, 56, 56, 64, 3, 1, 1, 1, 1, 1}, {1, 128, 28, 28, 128, 3, 1, 1, 1, 1, 4}, {2, 64, 32, 32, 128, 3, 2, 1, 1, 2, 2}};
+    for (auto const& c : configs)
+    {
+        int32_t const heightOut = (c.height + 2 * c.pad - (c.dilation * (c.kernel - 1) + 1)) / c.stride + 1;
+        int32_t const widthOut = (c.width + 2 * c.pad - (c.dilation * (c.kernel - 1) + 1)) / c.stride + 1;
+        int32_t const nbTaps = c.kernel * c.kernel;
+        int64_t const nbPixels = static_cast<int64_t>(heightOut) * widthOut;
+        auto input = makeUniform(static_cast<int64_t>(c.batch) * c.channels * c.height * c.width, -1.F, 1.F, 1);
+        auto weight = makeUniform(static_cast<int64_t>(c.channelsOut) * c.channels / c.group * nbTaps, -0.1F, 0.1F, 2);
+        auto bias = makeUniform(c.channelsOut, -0.1F, 0.1F, 3);
+        auto offset = makeUniform(c.batch * c.deformableGroup * 2 * nbTaps * nbPixels, -2.F, 2.F, 4);
+        auto mask = makeUniform(c.batch * c.deformableGroup * nbTaps * nbPixels, 0.F, 1.F, 5);
+        for (auto* values : {&input, &weight, &bias, &offset, &mask})
+        {
+            roundToHalf(*values);
+        }
+        double const macs = static_cast<double>(c.batch) * c.channelsOut * nbPixels * c.channels / c.group * nbTaps;
+
+        for (bool const fp16 : {false, true})
+        {
+            std::ostringstream configStream;
+            configStream << c.batch << "x" << c.channels << "x" << c.height << "x" << c.width << " to " << c.channelsOut
+                         << ", g" << c.group << " dg" << c.deformableGroup << (fp16 ? ", fp16" : "");
+            std::string const config = configStream.str();
+            std::vector<float> output(c.batch * c.channelsOut * nbPixels);
+            std::vector<__half> outputHalf(fp16 ? output.size() : 0);
+            auto const inputHalf = toHalfs(input);
+            auto const weightHalf = toHalfs(weight);
+            auto const biasHalf = toHalfs(bias);
+            auto const offsetHalf = toHalfs(offset);
+            auto const maskHalf = toHalfs(mask);
+            float const tolerance = fp16 ? kHOST_TOLERANCE_FP16 : kHOST_TOLERANCE_FP32;
+            auto const reference = timeVariants(
+                context, kernel, config, macs, "MACs", tolerance, tolerance,
+                [&](KernelVariant const& variant) {
+                    if (fp16)
+                    {
+                        modulatedDeformConvHost(inputHalf.data(), weightHalf.data(), biasHalf.data(),
+                            offsetHalf.data(), maskHalf.data(), outputHalf.data(), c.batch, c.channels, c.height,
+                            c.width, c.channelsOut, c.kernel, c.kernel, c.stride, c.stride, c.pad, c.pad, c.dilation,
+                            c.dilation, c.group, c.deformableGroup, variant.threads);
+                    }
+                    else
+                    {
+                        modulatedDeformConvHost(input.data(), weight.data(), bias.data(), offset.data(), mask.data(),
+                            output.data(), c.batch, c.channels, c.height, c.width, c.channelsOut, c.kernel, c.kernel,
+                            c.stride, c.stride, c.pad, c.pad, c.dilation, c.dilation, c.group, c.deformableGroup,
+                            variant.threads);
+                    }
+                },
+                [&]() { return fp16 ? toFloats(outputHalf) : output; });
+
+            if (!context.options().verify)
+            {
+                continue;
+            }
+            int32_t const stride[2]{c.stride, c.stride};
+            int32_t const padding[2]{c.pad, c.pad};
+            int32_t const dilation[2]{c.dilation, c.dilation};
+            std::vector<PluginField> const fields{{"stride", stride, PluginFieldType::kINT32, 2},
+                {"padding", padding, PluginFieldType::kINT32, 2}, {"dilation", dilation, PluginFieldType::kINT32, 2},
+                {"group", &c.group, PluginFieldType::kINT32, 1},
+                {"deformable_group", &c.deformableGroup, PluginFieldType::kINT32, 1}};
+            PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+            std::vector<HostTensor> const inputs{
+                makeFloatTensor(fp16, Dims4{c.batch, c.channels, c.height, c.width}, input),
+                makeFloatTensor(fp16, Dims4{c.batch, c.deformableGroup * 2 * nbTaps, heightOut, widthOut}, offset),
+                makeFloatTensor(fp16, Dims4{c.batch, c.deformableGroup * nbTaps, heightOut, widthOut}, mask),
+                makeFloatTensor(fp16, Dims4{c.channelsOut, c.channels / c.group, c.kernel, c.kernel}, weight),
+                makeFloatTensor(fp16, Dims{1, {c.channelsOut}}, bias)};
+            std::vector<HostTensor> outputs;
+            if (!context.check(runPluginOnDevice("ModulatedDeformConv2d", "2", fc, inputs, outputs) && outputs.size() == 1,
+                    "ModulatedDeformConv2d failed"))
+            {
+                return false;
+            }
+            float const deviceTolerance = fp16 ? kDEVICE_TOLERANCE_FP16 : kDEVICE_TOLERANCE_FP32;
+            expectNear(context, kernel + " (" + config + ") and ModulatedDeformConv2d outputs", toFloats(outputs[0]),
+                reference, deviceTolerance, deviceTolerance);
+        }
+    }
+    return true;
+}
+
+bool benchmarkMultiscaleDeformableAttn(KernelContext& context)
+{
+    std::string const kernel = "multiscaleDeformableAttn";
+    // The decoder and the encoder of Deformable DETR, on the four levels of an 800x1200 image.
+    std::vector<int32_t> const levels{100, 150, 50, 75, 25, 38, 13, 19};
+    std::vector<AttnConfig> const configs{{2, 300, 8, 32, 4, levels}, {1, 0, 8, 32, 4, levels}};
+    for (auto const& c : configs)
+    {
+        auto const numLevels = static_cast<int32_t>(c.spatialShapes.size() / 2);
+        std::vector<int32_t> levelStartIndex;
+        int32_t spatialSize{0};
+        for (int32_t level = 0; level < numLevels; ++level)
+        {
+            levelStartIndex.push_back(spatialSize);
+            spatialSize += c.spatialShapes[2 * level] * c.spatialShapes[2 * level + 1];
+        }
+        int32_t const numQuery = c.numQuery > 0 ? c.numQuery : spatialSize;
+        int64_t const nbSamples = static_cast<int64_t>(c.batch) * numQuery * c.numHeads * numLevels * c.numPoint;
+        auto value = makeUniform(static_cast<int64_t>(c.batch) * spatialSize * c.numHeads * c.channels, -1.F, 1.F, 1);
+        // Some of the sampling points are outside of the levels.
+        auto samplingLoc = makeUniform(nbSamples * 2, -0.05F, 1.05F, 2);
+        auto attnWeight = makeUniform(nbSamples, 0.F, 1.F / (numLevels * c.numPoint), 3);
+        for (auto* values : {&value, &samplingLoc, &attnWeight})
+        {
+            roundToHalf(*values);
+        }
+        double const nbBilinear = static_cast<double>(nbSamples) * c.channels;
+
+        for (bool const fp16 : {false, true})
+        {
+            std::ostringstream configStream;
+            configStream << c.batch << "x" << numQuery << " queries, " << c.numHeads << "x" << c.channels
+                         << (fp16 ? ", fp16" : "");
+            std::string const config = configStream.str();
+            std::vector<float> output(static_cast<int64_t>(c.batch) * numQuery * c.numHeads * c.channels);
+            std::vector<__half> outputHalf(fp16 ? output.size() : 0);
+            auto const valueHalf = toHalfs(value);
+            auto const samplingLocHalf = toHalfs(samplingLoc);
+            auto const attnWeightHalf = toHalfs(attnWeight);
+            float const tolerance = fp16 ? kHOST_TOLERANCE_FP16 : kHOST_TOLERANCE_FP32;
+            auto const reference = timeVariants(
+                context, kernel, config, nbBilinear, "samples", tolerance, tolerance,
+                [&](KernelVariant const& variant) {
+                    if (fp16)
+                    {
+                        ms_deform_attn_host_forward(valueHalf.data(), c.spatialShapes.data(), levelStartIndex.data(),
+                            samplingLocHalf.data(), attnWeightHalf.data(), outputHalf.data(), c.batch, spatialSize,
+                            c.numHeads, c.channels, numLevels, numQuery, c.numPoint, variant.threads);
+                    }
+                    else
+                    {
+                        ms_deform_attn_host_forward(value.data(), c.spatialShapes.data(), levelStartIndex.data(),
+                            samplingLoc.data(), attnWeight.data(), output.data(), c.batch, spatialSize, c.numHeads,
+                            c.channels, numLevels, numQuery, c.numPoint, variant.threads);
+                    }
+                },
+                [&]() { return fp16 ? toFloats(outputHalf) : output; });
+
+            if (!context.options().verify)
+            {
+                continue;
+            }
+            PluginFieldCollection const fc{0, nullptr};
+            Dims samplingDims{6, {c.batch, numQuery, c.numHeads, numLevels, c.numPoint, 2}};
+            Dims weightDims{5, {c.batch, numQuery, c.numHeads, numLevels, c.numPoint}};
+            std::vector<HostTensor> const inputs{
+                makeFloatTensor(fp16, Dims4{c.batch, spatialSize, c.numHeads, c.channels}, value),
+                makeTensor(DataType::kINT32, Dims2{numLevels, 2}, c.spatialShapes),
+                makeTensor(DataType::kINT32, Dims{1, {numLevels}}, levelStartIndex),
+                makeFloatTensor(fp16, samplingDims, samplingLoc), makeFloatTensor(fp16, weightDims, attnWeight)};
+            std::vector<HostTensor> outputs;
+            if (!context.check(
+                    runPluginOnDevice("MultiscaleDeformableAttnPlugin_TRT", "2", fc, inputs, outputs)
+                        && outputs.size() == 1,
+                    "MultiscaleDeformableAttnPlugin_TRT failed"))
+            {
+                return false;
+            }
+            float const deviceTolerance = fp16 ? kDEVICE_TOLERANCE_FP16 : kDEVICE_TOLERANCE_FP32;
+            expectNear(context, kernel + " (" + config + ") and MultiscaleDeformableAttnPlugin_TRT outputs",
+                toFloats(outputs[0]), reference, deviceTolerance, deviceTolerance);
+        }
+    }
+    return true;
+}
+
+} // namespace sample
@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hostKernelBenchmark.h"
+
+#include "efficientNMSPlugin/efficientNMSHost.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+using namespace nvinfer1;
+
+namespace sample
+{
+
+namespace
+{
+
+struct NMSConfig
+{
+    int32_t batchSize;
+    int32_t numAnchors;
+    int32_t numClasses;
+    bool classAgnostic;
+};
+
+//! The outputs of EfficientNMS_TRT.
+struct NMSOutputs
+{
+    std::vector<int32_t> numDetections;
+    std::vector<float> boxes;
+    std::vector<float> scores;
+    std::vector<int32_t> classes;
+};
+
+//! Boxes clustered around a few objects per image, so that NMS suppresses many of them, and distinct scores, so that
+//! the order of the boxes does not depend on how ties are broken.
+void makeInputs(NMSConfig const& config, std::vector<float>& boxes, std::vector<float>& scores)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> unit(0.F, 1.F);
+    std::normal_distribution<float> jitter(0.F, 0.01F);
+    int64_t const nbBoxes = static_cast<int64_t>(config.batchSize) * config.numAnchors;
+    boxes.resize(nbBoxes * 4);
+    int32_t const nbObjects = 32;
+    std::vector<float> objects(nbObjects * 4);
+    for (int32_t o = 0; o < nbObjects; ++o)
+    {
+        float const y = unit(generator);
+        float const x = unit(generator);
+        float const h = 0.02F + 0.2F * unit(generator);
+        float const w = 0.02F + 0.2F * unit(generator);
+        objects[o * 4 + 0] = y - h / 2;
+        objects[o * 4 + 1] = x - w / 2;
+        objects[o * 4 + 2] = y + h / 2;
+        objects[o * 4 + 3] = x + w / 2;
+    }
+    for (int64_t b = 0; b < nbBoxes; ++b)
+    {
+        int32_t const o = static_cast<int32_t>(generator() % nbObjects);
+        for (int32_t c = 0; c < 4; ++c)
+        {
+            boxes[b * 4 + c] = objects[o * 4 + c] + jitter(generator);
+        }
+    }
+
+    scores.resize(nbBoxes * config.numClasses);
+    std::vector<int32_t> order(scores.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), generator);
+    for (size_t i = 0; i < scores.size(); ++i)
+    {
+        scores[i] = static_cast<float>(order[i] + 1) / static_cast<float>(scores.size() + 1);
+    }
+}
+
+std::string getConfigName(NMSConfig const& config)
+{
+    std::ostringstream name;
+    name << "batch " << config.batchSize << ", " << config.numAnchors << "x" << config.numClasses
+         << (config.classAgnostic ? ", agnostic" : "");
+    return name.str();
+}
+
+} // namespace
+
+bool benchmarkEfficientNMS(KernelContext& context)
+{
+    char const* const kernel = "efficientNMS";
+    float const scoreThreshold = 0.3F;
+    float const iouThreshold = 0.5F;
+    int32_t const maxOutputBoxes = 100;
+    // The number of candidates the CUDA implementation keeps per image, on all the devices except Jetson TX1/TX2.
+    int32_t const numSelectedBoxes = 5000;
+
+    std::vector<NMSConfig> const configs{
+        {1, 25200, 80, false}, {8, 8400, 80, false}, {4, 20000, 1, false}, {4, 20000, 4, true}};
+    for (auto const& config : configs)
+    {
+        std::string const configName = getConfigName(config);
+        std::vector<float> boxes;
+        std::vector<float> scores;
+        makeInputs(config, boxes, scores);
+
+        plugin::EfficientNMSParameters param;
+        param.scoreThreshold = scoreThreshold;
+        param.iouThreshold = iouThreshold;
+        param.numOutputBoxes = maxOutputBoxes;
+        param.classAgnostic = config.classAgnostic;
+        param.numSelectedBoxes = numSelectedBoxes;
+        param.batchSize = config.batchSize;
+        param.numClasses = config.numClasses;
+        param.numAnchors = config.numAnchors;
+        param.numBoxElements = config.numAnchors * 4;
+        param.numScoreElements = config.numAnchors * config.numClasses;
+
+        NMSOutputs reference;
+        for (auto const& variant : context.variants())
+        {
+            NMSOutputs outputs;
+            outputs.numDetections.resize(config.batchSize);
+            outputs.boxes.resize(config.batchSize * maxOutputBoxes * 4);
+            outputs.scores.resize(config.batchSize * maxOutputBoxes);
+            outputs.classes.resize(config.batchSize * maxOutputBoxes);
+            pluginStatus_t status{STATUS_SUCCESS};
+            context.time(kernel, configName, variant, static_cast<double>(scores.size()), "scores", [&]() {
+                status = EfficientNMSHostInference(param, boxes.data(), scores.data(), nullptr,
+                    outputs.numDetections.data(), outputs.boxes.data(), outputs.scores.data(), outputs.classes.data(),
+                    nullptr, variant.threads);
+            });
+            if (!context.check(status == STATUS_SUCCESS, "EfficientNMSHostInference() failed"))
+            {
+                return false;
+            }
+            if (&variant == &context.variants().front())
+            {
+                reference = std::move(outputs);
+                continue;
+            }
+            // The variants keep the same boxes and compute them identically.
+            std::string const what = std::string{kernel} + " " + getVariantName(variant) + " (" + configName + ")";
+            expectEqual(context, what + " detections", outputs.numDetections, reference.numDetections);
+            expectEqual(context, what + " boxes", outputs.boxes, reference.boxes);
+            expectEqual(context, what + " scores", outputs.scores, reference.scores);
+            expectEqual(context, what + " classes", outputs.classes, reference.classes);
+        }
+
+        if (!context.options().verify)
+        {
+            continue;
+        }
+        int32_t const zero{0};
+        int32_t const classAgnostic{config.classAgnostic ? 1 : 0};
+        int32_t const background{-1};
+        std::vector<PluginField> const fields{{"score_threshold", &scoreThreshold, PluginFieldType::kFLOAT32, 1},
+            {"iou_threshold", &iouThreshold, PluginFieldType::kFLOAT32, 1},
+            {"max_output_boxes", &maxOutputBoxes, PluginFieldType::kINT32, 1},
+            {"background_class", &background, PluginFieldType::kINT32, 1},
+            {"score_activation", &zero, PluginFieldType::kINT32, 1},
+            {"class_agnostic", &classAgnostic, PluginFieldType::kINT32, 1},
+            {"box_coding", &zero, PluginFieldType::kINT32, 1}};
+        PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+        std::vector<HostTensor> const inputs{
+            makeTensor(DataType::kFLOAT, Dims3{config.batchSize, config.numAnchors, 4}, boxes),
+            makeTensor(DataType::kFLOAT, Dims3{config.batchSize, config.numAnchors, config.numClasses}, scores)};
+        std::vector<HostTensor> outputs;
+        if (!context.check(runPluginOnDevice("EfficientNMS_TRT", "1", fc, inputs, outputs) && outputs.size() == 4,
+                "EfficientNMS_TRT failed"))
+        {
+            return false;
+        }
+        // The kept boxes must be the same, and their coordinates and scores are copied from the inputs.
+        std::string const what = std::string{kernel} + " (" + configName + ") and EfficientNMS_TRT";
+        expectNear(context, what + " detections", toFloats(outputs[0]),
+            std::vector<float>(reference.numDetections.begin(), reference.numDetections.end()), 0.F, 0.F);
+        expectNear(context, what + " boxes", toFloats(outputs[1]), reference.boxes, 0.F, 0.F);
+        expectNear(context, what + " scores", toFloats(outputs[2]), reference.scores, 0.F, 0.F);
+        expectNear(context, what + " classes", toFloats(outputs[3]),
+            std::vector<float>(reference.classes.begin(), reference.classes.end()), 0.F, 0.F);
+    }
+    return true;
+}
+
+} // namespace sample
@@ -0,0 +1,383 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hostKernelBenchmark.h"
+
+#include "buffers.h"
+#include "common.h"
+#include "common/hostParallel.h"
+#include "logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cuda_fp16.h>
+#include <iomanip>
+#include <memory>
+#include <random>
+
+using namespace nvinfer1;
+using nvinfer1::pluginInternal::HostSimdLevel;
+using samplesCommon::SampleUniquePtr;
+
+namespace sample
+{
+
+namespace
+{
+
+struct KernelEntry
+{
+    char const* name;
+    bool (*run)(KernelContext& context);
+};
+
+std::vector<KernelEntry> const kKERNELS{
+    {"efficientNMS", benchmarkEfficientNMS},
+    {"voxelGenerator", benchmarkVoxelGenerator},
+    {"pillarScatter", benchmarkPillarScatter},
+    {"modulatedDeformConv", benchmarkModulatedDeformConv},
+    {"multiscaleDeformableAttn", benchmarkMultiscaleDeformableAttn},
+    {"skipLayerNorm", benchmarkSkipLayerNorm},
+    {"embLayerNorm", benchmarkEmbLayerNorm},
+    {"groupNorm", benchmarkGroupNorm},
+    {"instanceNorm", benchmarkInstanceNorm},
+    {"priorBox", benchmarkPriorBox},
+    {"gridAnchor", benchmarkGridAnchor},
+};
+
+} // namespace
+
+KernelContext::KernelContext(KernelOptions const& options)
+    : mOptions(options)
+{
+    pluginInternal::setMaxHostSimdLevel(HostSimdLevel::kAVX512);
+    HostSimdLevel const simd = pluginInternal::getHostSimdLevel();
+    int32_t const threads = pluginInternal::getNbHostThreads(options.threads);
+    mVariants.push_back({HostSimdLevel::kSCALAR, 1});
+    mScalarVariants.push_back({HostSimdLevel::kSCALAR, 1});
+    if (simd != HostSimdLevel::kSCALAR)
+    {
+        mVariants.push_back({simd, 1});
+    }
+    if (threads > 1)
+    {
+        mVariants.push_back({simd, threads});
+        mScalarVariants.push_back({HostSimdLevel::kSCALAR, threads});
+    }
+}
+
+void KernelContext::time(std::string const& kernel, std::string const& config, KernelVariant const& variant,
+    double items, char const* unit, std::function<void()> const& run)
+{
+    pluginInternal::setMaxHostSimdLevel(variant.simd);
+    run();
+    auto const start = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < mOptions.iterations; ++i)
+    {
+        run();
+    }
+    auto const end = std::chrono::steady_clock::now();
+    pluginInternal::setMaxHostSimdLevel(HostSimdLevel::kAVX512);
+
+    double const milliseconds = std::chrono::duration<double, std::milli>(end - start).count() / mOptions.iterations;
+    auto const reference = std::find_if(mTimings.begin(), mTimings.end(),
+        [&](Timing const& timing) { return timing.kernel == kernel && timing.config == config; });
+    double const speedup = reference == mTimings.end() ? 1.0 : reference->milliseconds / milliseconds;
+    mTimings.push_back({kernel, config, getVariantName(variant), milliseconds, items * 1000.0 / milliseconds, unit,
+        speedup});
+}
+
+bool KernelContext::check(bool condition, std::string const& message)
+{
+    if (!condition)
+    {
+        sample::gLogError << message << std::endl;
+        mPassed = false;
+    }
+    return condition;
+}
+
+void KernelContext::printResults() const
+{
+    sample::gLogInfo << std::left << std::setw(26) << "kernel" << std::setw(40) << "configuration" << std::setw(14)
+                     << "variant" << std::right << std::setw(12) << "ms" << std::setw(16) << "throughput"
+                     << std::setw(10) << "speedup" << std::endl;
+    for (auto const& timing : mTimings)
+    {
+        sample::gLogInfo << std::left << std::setw(26) << timing.kernel << std::setw(40) << timing.config
+                         << std::setw(14) << timing.variant << std::right << std::fixed << std::setprecision(3)
+                         << std::setw(12) << timing.milliseconds << std::setprecision(3) << std::setw(12)
+                         << timing.itemsPerSecond / 1e6 << " M" << std::left << std::setw(8)
+                         << (timing.unit + "/s") << std::right << std::setprecision(2) << std::setw(6)
+                         << timing.speedup << "x" << std::endl;
+    }
+}
+
+std::string getVariantName(KernelVariant const& variant)
+{
+    std::string name;
+    switch (variant.simd)
+    {
+    case HostSimdLevel::kSCALAR: name = "scalar"; break;
+    case HostSimdLevel::kAVX2: name = "avx2"; break;
+    case HostSimdLevel::kAVX512: name = "avx512"; break;
+    }
+    return name + " x" + std::to_string(variant.threads);
+}
+
+bool expectNear(KernelContext& context, std::string const& what, std::vector<float> const& actual,
+    std::vector<float> const& expected, float atol, float rtol)
+{
+    if (!context.check(actual.size() == expected.size(), what + " have different sizes"))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        bool const near = std::abs(actual[i] - expected[i]) <= atol + rtol * std::abs(expected[i]);
+        // NaN and infinities must match exactly.
+        bool const same = actual[i] == expected[i] || (std::isnan(actual[i]) && std::isnan(expected[i]));
+        if (!same && !near)
+        {
+            std::ostringstream message;
+            message << what << " differ at " << i << ": " << actual[i] << " instead of " << expected[i];
+            return context.check(false, message.str());
+        }
+    }
+    return true;
+}
+
+std::vector<float> timeVariants(KernelContext& context, std::string const& kernel, std::string const& config,
+    double items, char const* unit, float atol, float rtol, std::function<void(KernelVariant const&)> const& run,
+    std::function<std::vector<float>()> const& getOutputs)
+{
+    std::vector<float> reference;
+    for (auto const& variant : context.variants())
+    {
+        context.time(kernel, config, variant, items, unit, [&]() { run(variant); });
+        if (&variant == &context.variants().front())
+        {
+            reference = getOutputs();
+            continue;
+        }
+        expectNear(context, kernel + " " + getVariantName(variant) + " (" + config + ") outputs", getOutputs(),
+            reference, atol, rtol);
+    }
+    return reference;
+}
+
+std::vector<float> toFloats(HostTensor const& tensor)
+{
+    std::vector<float> values;
+    switch (tensor.type)
+    {
+    case DataType::kFLOAT:
+        values.resize(tensor.data.size() / sizeof(float));
+        std::memcpy(values.data(), tensor.data.data(), tensor.data.size());
+        break;
+    case DataType::kHALF:
+    {
+        auto const* data = reinterpret_cast<__half const*>(tensor.data.data());
+        for (size_t i = 0; i < tensor.data.size() / sizeof(__half); ++i)
+        {
+            values.push_back(__half2float(data[i]));
+        }
+        break;
+    }
+    case DataType::kINT32:
+    {
+        auto const* data = reinterpret_cast<int32_t const*>(tensor.data.data());
+        for (size_t i = 0; i < tensor.data.size() / sizeof(int32_t); ++i)
+        {
+            values.push_back(static_cast<float>(data[i]));
+        }
+        break;
+    }
+    default: sample::gLogError << "Unsupported tensor type." << std::endl;
+    }
+    return values;
+}
+
+std::vector<float> toFloats(std::vector<__half> const& values)
+{
+    std::vector<float> result(values.size());
+    pluginInternal::convertToFloat(values.data(), result.data(), static_cast<int64_t>(values.size()));
+    return result;
+}
+
+std::vector<__half> toHalfs(std::vector<float> const& values)
+{
+    std::vector<__half> result(values.size());
+    pluginInternal::convertToHalf(values.data(), result.data(), static_cast<int64_t>(values.size()));
+    return result;
+}
+
+std::vector<float> makeUniform(int64_t count, float low, float high, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(low, high);
+    std::vector<float> values(count);
+    std::generate(values.begin(), values.end(), [&]() { return distribution(generator); });
+    return values;
+}
+
+void roundToHalf(std::vector<float>& values)
+{
+    values = toFloats(toHalfs(values));
+}
+
+HostTensor makeFloatTensor(bool fp16, Dims const& dims, std::vector<float> const& values)
+{
+    return fp16 ? makeTensor(DataType::kHALF, dims, toHalfs(values)) : makeTensor(DataType::kFLOAT, dims, values);
+}
+
+bool runPluginOnDevice(char const* name, char const* version, PluginFieldCollection const& fields,
+    std::vector<HostTensor> const& inputs, std::vector<HostTensor>& outputs)
+{
+    auto* creator = getPluginRegistry()->getCreator(name, version, "");
+    if (creator == nullptr)
+    {
+        sample::gLogError << "No creator for " << name << " v" << version << "." << std::endl;
+        return false;
+    }
+
+    SampleUniquePtr<IBuilder> builder{createInferBuilder(sample::gLogger.getTRTLogger())};
+    if (!builder)
+    {
+        return false;
+    }
+    SampleUniquePtr<INetworkDefinition> network{
+        builder->createNetworkV2(1U << static_cast<uint32_t>(NetworkDefinitionCreationFlag::kSTRONGLY_TYPED))};
+    SampleUniquePtr<IBuilderConfig> config{builder->createBuilderConfig()};
+    if (!network || !config)
+    {
+        return false;
+    }
+    std::vector<ITensor*> tensors;
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        tensors.push_back(network->addInput(("input" + std::to_string(i)).c_str(), inputs[i].type, inputs[i].dims));
+    }
+
+    // The plugins only need to live until the engine is built.
+    auto const destroyV2 = [](IPluginV2* plugin) {
+        if (plugin != nullptr)
+        {
+            plugin->destroy();
+        }
+    };
+    std::unique_ptr<IPluginV2, decltype(destroyV2)> pluginV2{nullptr, destroyV2};
+    std::unique_ptr<IPluginV3> pluginV3;
+    ILayer* layer{nullptr};
+    std::string const kind = creator->getInterfaceInfo().kind;
+    auto const nbInputs = static_cast<int32_t>(tensors.size());
+    if (kind == "PLUGIN CREATOR_V1")
+    {
+        pluginV2.reset(static_cast<IPluginCreator*>(creator)->createPlugin(name, &fields));
+        layer = pluginV2 ? network->addPluginV2(tensors.data(), nbInputs, *pluginV2) : nullptr;
+    }
+    else if (kind == "PLUGIN CREATOR_V3ONE")
+    {
+        pluginV3.reset(static_cast<IPluginCreatorV3One*>(creator)->createPlugin(name, &fields, TensorRTPhase::kBUILD));
+        layer = pluginV3 ? network->addPluginV3(tensors.data(), nbInputs, nullptr, 0, *pluginV3) : nullptr;
+    }
+    if (layer == nullptr)
+    {
+        sample::gLogError << "Cannot add a " << name << " layer." << std::endl;
+        return false;
+    }
+    for (int32_t o = 0; o < layer->getNbOutputs(); ++o)
+    {
+        layer->getOutput(o)->setName(("output" + std::to_string(o)).c_str());
+        network->markOutput(*layer->getOutput(o));
+    }
+
+    SampleUniquePtr<IHostMemory> plan{builder->buildSerializedNetwork(*network, *config)};
+    SampleUniquePtr<IRuntime> runtime{createInferRuntime(sample::gLogger.getTRTLogger())};
+    if (!plan || !runtime)
+    {
+        sample::gLogError << "Cannot build a " << name << " engine." << std::endl;
+        return false;
+    }
+    SampleUniquePtr<ICudaEngine> engine{runtime->deserializeCudaEngine(plan->data(), plan->size())};
+    SampleUniquePtr<IExecutionContext> context{engine ? engine->createExecutionContext() : nullptr};
+    auto stream = samplesCommon::makeCudaStream();
+    if (!context || !stream)
+    {
+        return false;
+    }
+
+    std::vector<samplesCommon::DeviceBuffer> buffers;
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        buffers.emplace_back(samplesCommon::volume(inputs[i].dims), inputs[i].type);
+        CHECK(cudaMemcpy(buffers.back().data(), inputs[i].data.data(), inputs[i].data.size(), cudaMemcpyHostToDevice));
+        context->setTensorAddress(("input" + std::to_string(i)).c_str(), buffers.back().data());
+    }
+    outputs.resize(layer->getNbOutputs());
+    for (size_t o = 0; o < outputs.size(); ++o)
+    {
+        std::string const tensorName = "output" + std::to_string(o);
+        outputs[o].dims = engine->getTensorShape(tensorName.c_str());
+        outputs[o].type = engine->getTensorDataType(tensorName.c_str());
+        buffers.emplace_back(samplesCommon::volume(outputs[o].dims), outputs[o].type);
+        outputs[o].data.resize(buffers.back().nbBytes());
+        context->setTensorAddress(tensorName.c_str(), buffers.back().data());
+    }
+    if (!context->enqueueV3(*stream))
+    {
+        sample::gLogError << "Cannot run the " << name << " engine." << std::endl;
+        return false;
+    }
+    CHECK(cudaStreamSynchronize(*stream));
+    for (size_t o = 0; o < outputs.size(); ++o)
+    {
+        CHECK(cudaMemcpy(outputs[o].data.data(), buffers[inputs.size() + o].data(), outputs[o].data.size(),
+            cudaMemcpyDeviceToHost));
+    }
+    return true;
+}
+
+bool runHostKernelBenchmarks(KernelOptions const& options)
+{
+    bool const all = std::find(options.kernels.begin(), options.kernels.end(), "all") != options.kernels.end();
+    for (auto const& name : options.kernels)
+    {
+        bool const known = std::any_of(
+            kKERNELS.begin(), kKERNELS.end(), [&name](KernelEntry const& kernel) { return name == kernel.name; });
+        if (!known && name != "all")
+        {
+            sample::gLogError << "Unknown kernel '" << name << "'." << std::endl;
+            return false;
+        }
+    }
+
+    KernelContext context(options);
+    for (auto const& kernel : kKERNELS)
+    {
+        if (all || std::find(options.kernels.begin(), options.kernels.end(), kernel.name) != options.kernels.end())
+        {
+            sample::gLogVerbose << "Benchmarking the " << kernel.name << " host kernel." << std::endl;
+            context.check(kernel.run(context), std::string{kernel.name} + " failed");
+        }
+    }
+    context.printResults();
+    return context.passed();
+}
+
+} // namespace sample
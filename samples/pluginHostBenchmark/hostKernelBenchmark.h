@@ -0,0 +1,182 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_PLUGIN_HOST_BENCHMARK_HOST_KERNEL_BENCHMARK_H
+#define TRT_PLUGIN_HOST_BENCHMARK_HOST_KERNEL_BENCHMARK_H
+
+#include "NvInfer.h"
+#include "common/hostSimd.h"
+
+#include <cstdint>
+#include <cstring>
+#include <cuda_fp16.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace sample
+{
+
+struct KernelOptions
+{
+    std::vector<std::string> kernels; //!< Kernels to run, or "all"
+    int32_t iterations{10};
+    int32_t threads{0}; //!< 0 for one per hardware thread
+    bool verify{false}; //!< Also compare the host kernels with the CUDA plugins
+};
+
+//! Instruction set and number of threads a host kernel runs with.
+struct KernelVariant
+{
+    nvinfer1::pluginInternal::HostSimdLevel simd;
+    int32_t threads;
+};
+
+//! A tensor exchanged with a plugin run on the device.
+struct HostTensor
+{
+    nvinfer1::DataType type{nvinfer1::DataType::kFLOAT};
+    nvinfer1::Dims dims{};
+    std::vector<uint8_t> data;
+};
+
+//! Times the variants of the host kernels and records the results of their checks.
+class KernelContext
+{
+public:
+    explicit KernelContext(KernelOptions const& options);
+
+    KernelOptions const& options() const
+    {
+        return mOptions;
+    }
+
+    //! Return the variants to time. The first one, scalar code on one thread, is the reference of the others. Kernels
+    //! without SIMD code only run the scalar code, on one thread then on several threads.
+    std::vector<KernelVariant> const& variants(bool simd = true) const
+    {
+        return simd ? mVariants : mScalarVariants;
+    }
+
+    //! Time options().iterations calls of run() with the instruction set and threads of variant, after a warm-up call.
+    //! items is the work done by one call, reported per second in unit.
+    void time(std::string const& kernel, std::string const& config, KernelVariant const& variant, double items,
+        char const* unit, std::function<void()> const& run);
+
+    //! Record a failure with message unless condition holds, and return condition.
+    bool check(bool condition, std::string const& message);
+
+    bool passed() const
+    {
+        return mPassed;
+    }
+
+    //! Print the average time of each variant, its throughput and its speedup over the reference.
+    void printResults() const;
+
+private:
+    struct Timing
+    {
+        std::string kernel;
+        std::string config;
+        std::string variant;
+        double milliseconds;
+        double itemsPerSecond;
+        std::string unit;
+        double speedup;
+    };
+
+    KernelOptions mOptions;
+    std::vector<KernelVariant> mVariants;
+    std::vector<KernelVariant> mScalarVariants;
+    std::vector<Timing> mTimings;
+    bool mPassed{true};
+};
+
+//! Name a variant, for example "avx512 x16".
+std::string getVariantName(KernelVariant const& variant);
+
+//! Check that |actual - expected| <= atol + rtol * |expected| for all the values, and report the first mismatch.
+bool expectNear(KernelContext& context, std::string const& what, std::vector<float> const& actual,
+    std::vector<float> const& expected, float atol, float rtol);
+
+//! Check that two buffers hold the same values.
+template <typename T>
+bool expectEqual(
+    KernelContext& context, std::string const& what, std::vector<T> const& actual, std::vector<T> const& expected)
+{
+    bool const equal = actual.size() == expected.size()
+        && (actual.empty() || std::memcmp(actual.data(), expected.data(), actual.size() * sizeof(T)) == 0);
+    return context.check(equal, what + " differ");
+}
+
+//! Time run() with each variant, and check that the outputs returned by getOutputs() after each run are within
+//! |actual - expected| <= atol + rtol * |expected| of the ones of the reference. Return the reference outputs.
+std::vector<float> timeVariants(KernelContext& context, std::string const& kernel, std::string const& config,
+    double items, char const* unit, float atol, float rtol, std::function<void(KernelVariant const&)> const& run,
+    std::function<std::vector<float>()> const& getOutputs);
+
+//! Return the values of a kFLOAT, kHALF or kINT32 tensor as floats.
+std::vector<float> toFloats(HostTensor const& tensor);
+
+std::vector<float> toFloats(std::vector<__half> const& values);
+
+std::vector<__half> toHalfs(std::vector<float> const& values);
+
+//! Return count values drawn uniformly from [low, high).
+std::vector<float> makeUniform(int64_t count, float low, float high, uint32_t seed);
+
+//! Round the values to FP16, so that the FP32 and FP16 runs of a kernel see the same inputs.
+void roundToHalf(std::vector<float>& values);
+
+//! Return a tensor holding values of a host buffer.
+template <typename T>
+HostTensor makeTensor(nvinfer1::DataType type, nvinfer1::Dims const& dims, std::vector<T> const& values)
+{
+    HostTensor tensor{type, dims, std::vector<uint8_t>(values.size() * sizeof(T))};
+    std::memcpy(tensor.data.data(), values.data(), tensor.data.size());
+    return tensor;
+}
+
+//! Return an FP16 tensor of the values if fp16 is set, and an FP32 tensor otherwise.
+HostTensor makeFloatTensor(bool fp16, nvinfer1::Dims const& dims, std::vector<float> const& values);
+
+//! Build a strongly typed engine made of a single plugin layer, run it once on the device and return its outputs.
+//!
+//! The plugin is created with fields by the creator registered under name and version. Its outputs must have static
+//! shapes. Return false if the engine cannot be built or run.
+bool runPluginOnDevice(char const* name, char const* version, nvinfer1::PluginFieldCollection const& fields,
+    std::vector<HostTensor> const& inputs, std::vector<HostTensor>& outputs);
+
+bool benchmarkEfficientNMS(KernelContext& context);
+bool benchmarkEmbLayerNorm(KernelContext& context);
+bool benchmarkGridAnchor(KernelContext& context);
+bool benchmarkGroupNorm(KernelContext& context);
+bool benchmarkInstanceNorm(KernelContext& context);
+bool benchmarkModulatedDeformConv(KernelContext& context);
+bool benchmarkMultiscaleDeformableAttn(KernelContext& context);
+bool benchmarkPillarScatter(KernelContext& context);
+bool benchmarkPriorBox(KernelContext& context);
+bool benchmarkSkipLayerNorm(KernelContext& context);
+bool benchmarkVoxelGenerator(KernelContext& context);
+
+//! Run the kernel benchmarks selected by options, print their timings and return whether all their checks passed.
+bool runHostKernelBenchmarks(KernelOptions const& options);
+
+} // namespace sample
+
+#endif // TRT_PLUGIN_HOST_BENCHMARK_HOST_KERNEL_BENCHMARK_H
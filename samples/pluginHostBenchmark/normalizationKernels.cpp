@@ -0,0 +1,472 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hostKernelBenchmark.h"
+
+#include "common/normalizationHost.h"
+
+#include <algorithm>
+#include <cuda_fp16.h>
+#include <random>
+#include <sstream>
+
+using namespace nvinfer1;
+
+namespace sample
+{
+
+namespace
+{
+
+//! Tolerances of the comparisons of the SIMD and multithreaded variants with the scalar code, which only differ by
+//! the rounding of FMA and, in FP16, of the outputs.
+constexpr float kHOST_TOLERANCE_FP32{1e-4F};
+constexpr float kHOST_TOLERANCE_FP16{2e-3F};
+
+//! Tolerances of the comparisons with the CUDA plugins, whose FP16 kernels also compute some of the sums in FP16.
+constexpr float kDEVICE_TOLERANCE_FP32{1e-3F};
+constexpr float kDEVICE_TOLERANCE_FP16{5e-2F};
+
+//! Embedding tables of BERT.
+constexpr int32_t kWORD_SIZE{30522};
+constexpr int32_t kTOKEN_SIZE{2};
+constexpr int32_t kPOSITION_SIZE{512};
+constexpr int32_t kHIDDEN_SIZE{768};
+
+struct LayerNormConfig
+{
+    int32_t batch;
+    int32_t seqLength;
+    int32_t ld;
+};
+
+struct ChannelNormConfig
+{
+    int32_t batch;
+    int32_t channels;
+    int32_t height;
+    int32_t width;
+    int32_t groups; //!< Groups of GroupNormalizationPlugin
+    bool relu;      //!< Leaky ReLU of InstanceNormalization_TRT
+};
+
+struct Embeddings
+{
+    std::vector<float> beta;
+    std::vector<float> gamma;
+    std::vector<float> word;
+    std::vector<float> position;
+    std::vector<float> token;
+};
+
+std::vector<int32_t> makeIds(int64_t count, int32_t size, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::vector<int32_t> ids(count);
+    for (auto& id : ids)
+    {
+        id = static_cast<int32_t>(generator() % size);
+    }
+    return ids;
+}
+
+//! Return batch sequence lengths drawn uniformly from [minLength, maxLength].
+std::vector<int32_t> makeLengths(int32_t batch, int32_t minLength, int32_t maxLength, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int32_t> distribution(minLength, maxLength);
+    std::vector<int32_t> lengths(batch);
+    for (auto& length : lengths)
+    {
+        length = distribution(generator);
+    }
+    return lengths;
+}
+
+std::vector<PluginField> getEmbeddingFields(Embeddings const& embeddings, int32_t const& outputFp16)
+{
+    auto const field = [](char const* name, std::vector<float> const& values) {
+        return PluginField{name, values.data(), PluginFieldType::kFLOAT32, static_cast<int32_t>(values.size())};
+    };
+    return {field("bert_embeddings_layernorm_beta", embeddings.beta),
+        field("bert_embeddings_layernorm_gamma", embeddings.gamma),
+        field("bert_embeddings_word_embeddings", embeddings.word),
+        field("bert_embeddings_token_type_embeddings", embeddings.token),
+        field("bert_embeddings_position_embeddings", embeddings.position),
+        {"output_fp16", &outputFp16, PluginFieldType::kINT32, 1}};
+}
+
+std::string getLayerNormConfigName(LayerNormConfig const& config, bool fp16)
+{
+    std::ostringstream name;
+    name << config.batch << "x" << config.seqLength << "x" << config.ld << (fp16 ? ", fp16" : "");
+    return name.str();
+}
+
+std::string getChannelNormConfigName(ChannelNormConfig const& config, bool fp16)
+{
+    std::ostringstream name;
+    name << config.batch << "x" << config.channels << "x" << config.height << "x" << config.width;
+    if (config.groups > 0)
+    {
+        name << ", " << config.groups << " groups";
+    }
+    name << (config.relu ? ", relu" : "") << (fp16 ? ", fp16" : "");
+    return name.str();
+}
+
+//! Compare the embeddings of embLayerNormHost() or embLayerNormVarSeqlenHost() with one of the embLayerNorm plugins.
+bool verifyEmbLayerNorm(KernelContext& context, std::string const& what, char const* version, bool fp16,
+    Embeddings const& embeddings, std::vector<HostTensor> const& inputs,
+    std::vector<std::vector<float> const*> const& references)
+{
+    int32_t const outputFp16 = fp16 ? 1 : 0;
+    auto const fields = getEmbeddingFields(embeddings, outputFp16);
+    PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+    std::vector<HostTensor> outputs;
+    if (!context.check(runPluginOnDevice("CustomEmbLayerNormPluginDynamic", version, fc, inputs, outputs)
+                && outputs.size() >= references.size(),
+            "CustomEmbLayerNormPluginDynamic v" + std::string(version) + " failed"))
+    {
+        return false;
+    }
+    float const tolerance = fp16 ? kDEVICE_TOLERANCE_FP16 : kDEVICE_TOLERANCE_FP32;
+    bool passed = true;
+    for (size_t o = 0; o < references.size(); ++o)
+    {
+        passed &= expectNear(context,
+            what + " and CustomEmbLayerNormPluginDynamic v" + version + " output " + std::to_string(o),
+            toFloats(outputs[o]), *references[o], tolerance, tolerance);
+    }
+    return passed;
+}
+
+} // namespace
+
+bool benchmarkSkipLayerNorm(KernelContext& context)
+{
+    std::string const kernel = "skipLayerNorm";
+    // The residual layers of BERT base and BERT large.
+    std::vector<LayerNormConfig> const configs{{8, 128, 768}, {8, 384, 1024}};
+    for (auto const& c : configs)
+    {
+        int64_t const n = static_cast<int64_t>(c.batch) * c.seqLength * c.ld;
+        auto input = makeUniform(n, -2.F, 2.F, 1);
+        auto skip = makeUniform(n, -2.F, 2.F, 2);
+        auto beta = makeUniform(c.ld, -0.5F, 0.5F, 3);
+        auto gamma = makeUniform(c.ld, 0.5F, 1.5F, 4);
+        auto bias = makeUniform(c.ld, -0.5F, 0.5F, 5);
+        for (auto* values : {&input, &skip, &beta, &gamma, &bias})
+        {
+            roundToHalf(*values);
+        }
+
+        for (bool const fp16 : {false, true})
+        {
+            std::string const config = getLayerNormConfigName(c, fp16);
+            std::vector<float> output(n);
+            std::vector<__half> outputHalf(fp16 ? n : 0);
+            auto const inputHalf = toHalfs(input);
+            auto const skipHalf = toHalfs(skip);
+            auto const betaHalf = toHalfs(beta);
+            auto const gammaHalf = toHalfs(gamma);
+            auto const biasHalf = toHalfs(bias);
+            float const tolerance = fp16 ? kHOST_TOLERANCE_FP16 : kHOST_TOLERANCE_FP32;
+            auto const reference = timeVariants(
+                context, kernel, config, static_cast<double>(n), "values", tolerance, tolerance,
+                [&](KernelVariant const& variant) {
+                    if (fp16)
+                    {
+                        plugin::skipLayerNormHost(c.ld, n, inputHalf.data(), skipHalf.data(), betaHalf.data(),
+                            gammaHalf.data(), outputHalf.data(), biasHalf.data(), variant.threads);
+                    }
+                    else
+                    {
+                        plugin::skipLayerNormHost(c.ld, n, input.data(), skip.data(), beta.data(), gamma.data(),
+                            output.data(), bias.data(), variant.threads);
+                    }
+                },
+                [&]() { return fp16 ? toFloats(outputHalf) : output; });
+
+            if (!context.options().verify)
+            {
+                continue;
+            }
+            auto const typeId = static_cast<int32_t>(fp16 ? DataType::kHALF : DataType::kFLOAT);
+            std::vector<PluginField> const fields{{"type_id", &typeId, PluginFieldType::kINT32, 1},
+                {"ld", &c.ld, PluginFieldType::kINT32, 1}, {"beta", beta.data(), PluginFieldType::kFLOAT32, c.ld},
+                {"gamma", gamma.data(), PluginFieldType::kFLOAT32, c.ld},
+                {"bias", bias.data(), PluginFieldType::kFLOAT32, c.ld}};
+            PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+            Dims const dims{5, {c.seqLength, c.batch, c.ld, 1, 1}};
+            std::vector<HostTensor> const inputs{
+                makeFloatTensor(fp16, dims, input), makeFloatTensor(fp16, dims, skip)};
+            std::vector<HostTensor> outputs;
+            if (!context.check(
+                    runPluginOnDevice("CustomSkipLayerNormPluginDynamic", "5", fc, inputs, outputs)
+                        && outputs.size() == 1,
+                    "CustomSkipLayerNormPluginDynamic failed"))
+            {
+                return false;
+            }
+            float const deviceTolerance = fp16 ? kDEVICE_TOLERANCE_FP16 : kDEVICE_TOLERANCE_FP32;
+            expectNear(context, kernel + " (" + config + ") and CustomSkipLayerNormPluginDynamic outputs",
+                toFloats(outputs[0]), reference, deviceTolerance, deviceTolerance);
+        }
+    }
+    return true;
+}
+
+bool benchmarkEmbLayerNorm(KernelContext& context)
+{
+    std::string const kernel = "embLayerNorm";
+    int32_t const ld = kHIDDEN_SIZE;
+    Embeddings embeddings{makeUniform(ld, -0.5F, 0.5F, 1), makeUniform(ld, 0.5F, 1.5F, 2),
+        makeUniform(static_cast<int64_t>(kWORD_SIZE) * ld, -1.F, 1.F, 3),
+        makeUniform(static_cast<int64_t>(kPOSITION_SIZE) * ld, -1.F, 1.F, 4),
+        makeUniform(static_cast<int64_t>(kTOKEN_SIZE) * ld, -1.F, 1.F, 5)};
+    for (auto* values : {&embeddings.word, &embeddings.position, &embeddings.token})
+    {
+        roundToHalf(*values);
+    }
+
+    for (bool const fp16 : {false, true})
+    {
+        auto const wordHalf = toHalfs(embeddings.word);
+        auto const positionHalf = toHalfs(embeddings.position);
+        auto const tokenHalf = toHalfs(embeddings.token);
+        float const tolerance = fp16 ? kHOST_TOLERANCE_FP16 : kHOST_TOLERANCE_FP32;
+
+        // Padded sequences of [S, B] ids, with a mask of the tokens of each sequence.
+        for (auto const& c : {LayerNormConfig{8, 128, ld}, LayerNormConfig{8, 384, ld}})
+        {
+            std::string const config = getLayerNormConfigName(c, fp16);
+            int64_t const nbTokens = static_cast<int64_t>(c.seqLength) * c.batch;
+            auto const inputIds = makeIds(nbTokens, kWORD_SIZE, 6);
+            auto const tokenIds = makeIds(nbTokens, kTOKEN_SIZE, 7);
+            auto const lengths = makeLengths(c.batch, 1, c.seqLength, 8);
+            std::vector<int32_t> mask(nbTokens);
+            for (int64_t t = 0; t < nbTokens; ++t)
+            {
+                mask[t] = t / c.batch < lengths[t % c.batch] ? 1 : 0;
+            }
+            std::vector<float> output(nbTokens * ld);
+            std::vector<__half> outputHalf(fp16 ? output.size() : 0);
+            auto const reference = timeVariants(
+                context, kernel, config, static_cast<double>(output.size()), "values", tolerance, tolerance,
+                [&](KernelVariant const& variant) {
+                    if (fp16)
+                    {
+                        plugin::embLayerNormHost(ld, c.batch, c.seqLength, inputIds.data(), tokenIds.data(),
+                            embeddings.beta.data(), embeddings.gamma.data(), wordHalf.data(), positionHalf.data(),
+                            tokenHalf.data(), kWORD_SIZE, kTOKEN_SIZE, outputHalf.data(), variant.threads);
+                    }
+                    else
+                    {
+                        plugin::embLayerNormHost(ld, c.batch, c.seqLength, inputIds.data(), tokenIds.data(),
+                            embeddings.beta.data(), embeddings.gamma.data(), embeddings.word.data(),
+                            embeddings.position.data(), embeddings.token.data(), kWORD_SIZE, kTOKEN_SIZE,
+                            output.data(), variant.threads);
+                    }
+                },
+                [&]() { return fp16 ? toFloats(outputHalf) : output; });
+
+            if (context.options().verify)
+            {
+                std::vector<int32_t> maskIdx(c.batch);
+                plugin::computeMaskIdxHost(c.seqLength, c.batch, mask.data(), maskIdx.data());
+                std::vector<float> const maskIdxReference(maskIdx.begin(), maskIdx.end());
+                Dims2 const dims{c.seqLength, c.batch};
+                std::vector<HostTensor> const inputs{makeTensor(DataType::kINT32, dims, inputIds),
+                    makeTensor(DataType::kINT32, dims, tokenIds), makeTensor(DataType::kINT32, dims, mask)};
+                // The mask indices are exact, and the tolerance only allows rounding differences.
+                verifyEmbLayerNorm(context, kernel + " (" + config + ")", "6", fp16, embeddings, inputs,
+                    {&reference, &maskIdxReference});
+            }
+        }
+
+        // Packed sequences of variable length, and the sum of the embeddings of the Megatron variant.
+        LayerNormConfig const c{32, 128, ld};
+        std::string const config = "packed " + getLayerNormConfigName(c, fp16);
+        auto const lengths = makeLengths(c.batch, 16, c.seqLength, 9);
+        std::vector<int32_t> cuSeqlens(c.batch + 1, 0);
+        for (int32_t b = 0; b < c.batch; ++b)
+        {
+            cuSeqlens[b + 1] = cuSeqlens[b] + lengths[b];
+        }
+        int32_t const nbTokens = cuSeqlens.back();
+        int32_t const maxSeqlen = *std::max_element(lengths.begin(), lengths.end());
+        auto const inputIds = makeIds(nbTokens, kWORD_SIZE, 10);
+        auto const tokenIds = makeIds(nbTokens, kTOKEN_SIZE, 11);
+        std::vector<float> output(static_cast<int64_t>(nbTokens) * ld);
+        std::vector<float> skip(output.size());
+        std::vector<__half> outputHalf(fp16 ? output.size() : 0);
+        std::vector<__half> skipHalf(outputHalf.size());
+        std::vector<float> skipReference;
+        auto const reference = timeVariants(
+            context, kernel, config, static_cast<double>(output.size()), "values", tolerance, tolerance,
+            [&](KernelVariant const& variant) {
+                if (fp16)
+                {
+                    plugin::embLayerNormVarSeqlenHost(ld, c.batch, maxSeqlen, inputIds.data(), tokenIds.data(),
+                        cuSeqlens.data(), embeddings.beta.data(), embeddings.gamma.data(), wordHalf.data(),
+                        positionHalf.data(), tokenHalf.data(), kWORD_SIZE, kTOKEN_SIZE, outputHalf.data(),
+                        skipHalf.data(), variant.threads);
+                }
+                else
+                {
+                    plugin::embLayerNormVarSeqlenHost(ld, c.batch, maxSeqlen, inputIds.data(), tokenIds.data(),
+                        cuSeqlens.data(), embeddings.beta.data(), embeddings.gamma.data(), embeddings.word.data(),
+                        embeddings.position.data(), embeddings.token.data(), kWORD_SIZE, kTOKEN_SIZE, output.data(),
+                        skip.data(), variant.threads);
+                }
+            },
+            [&]() {
+                // The sums are only additions of FP32 embeddings, so they do not depend on the variant.
+                skipReference = fp16 ? toFloats(skipHalf) : skip;
+                return fp16 ? toFloats(outputHalf) : output;
+            });
+
+        if (context.options().verify)
+        {
+            Dims const idsDims{1, {nbTokens}};
+            std::vector<HostTensor> const inputs{makeTensor(DataType::kINT32, idsDims, inputIds),
+                makeTensor(DataType::kINT32, idsDims, tokenIds),
+                makeTensor(DataType::kINT32, Dims{1, {c.batch + 1}}, cuSeqlens),
+                makeTensor(DataType::kINT32, Dims{1, {maxSeqlen}}, std::vector<int32_t>(maxSeqlen))};
+            verifyEmbLayerNorm(context, kernel + " (" + config + ")", "4", fp16, embeddings, inputs, {&reference});
+            verifyEmbLayerNorm(
+                context, kernel + " (" + config + ")", "5", fp16, embeddings, inputs, {&reference, &skipReference});
+        }
+    }
+    return true;
+}
+
+bool benchmarkGroupNorm(KernelContext& context)
+{
+    std::string const kernel = "groupNorm";
+    // Layers of the UNet of Stable Diffusion and of a ResNet with group normalization.
+    std::vector<ChannelNormConfig> const configs{{1, 320, 64, 64, 32, false}, {8, 256, 28, 28, 32, false}};
+    float const epsilon{1e-5F};
+    for (auto const& c : configs)
+    {
+        std::string const config = getChannelNormConfigName(c, false);
+        int64_t const channelVolume = static_cast<int64_t>(c.height) * c.width;
+        int64_t const n = c.batch * c.channels * channelVolume;
+        auto const input = makeUniform(n, -2.F, 3.F, 1);
+        auto const gamma = makeUniform(c.channels, 0.5F, 1.5F, 2);
+        auto const beta = makeUniform(c.channels, -0.5F, 0.5F, 3);
+        std::vector<float> output(n);
+        auto const reference = timeVariants(
+            context, kernel, config, static_cast<double>(n), "values", kHOST_TOLERANCE_FP32, kHOST_TOLERANCE_FP32,
+            [&](KernelVariant const& variant) {
+                plugin::groupNormHost(c.batch, c.channels, channelVolume, c.groups, epsilon, input.data(),
+                    gamma.data(), beta.data(), output.data(), variant.threads);
+            },
+            [&]() { return output; });
+
+        if (!context.options().verify)
+        {
+            continue;
+        }
+        std::vector<PluginField> const fields{{"eps", &epsilon, PluginFieldType::kFLOAT32, 1},
+            {"num_groups", &c.groups, PluginFieldType::kINT32, 1}};
+        PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+        Dims const channelDims{1, {c.channels}};
+        std::vector<HostTensor> const inputs{
+            makeTensor(DataType::kFLOAT, Dims4{c.batch, c.channels, c.height, c.width}, input),
+            makeTensor(DataType::kFLOAT, channelDims, gamma), makeTensor(DataType::kFLOAT, channelDims, beta)};
+        std::vector<HostTensor> outputs;
+        if (!context.check(
+                runPluginOnDevice("GroupNormalizationPlugin", "1", fc, inputs, outputs) && outputs.size() == 1,
+                "GroupNormalizationPlugin failed"))
+        {
+            return false;
+        }
+        expectNear(context, kernel + " (" + config + ") and GroupNormalizationPlugin outputs", toFloats(outputs[0]),
+            reference, kDEVICE_TOLERANCE_FP32, kDEVICE_TOLERANCE_FP32);
+    }
+    return true;
+}
+
+bool benchmarkInstanceNorm(KernelContext& context)
+{
+    std::string const kernel = "instanceNorm";
+    // Layers of style transfer networks, with and without the leaky ReLU.
+    std::vector<ChannelNormConfig> const configs{{1, 64, 256, 256, 0, false}, {8, 128, 64, 64, 0, true}};
+    float const epsilon{1e-5F};
+    float const alpha{0.2F};
+    for (auto const& c : configs)
+    {
+        int64_t const channelVolume = static_cast<int64_t>(c.height) * c.width;
+        int64_t const n = c.batch * c.channels * channelVolume;
+        auto input = makeUniform(n, -2.F, 3.F, 1);
+        roundToHalf(input);
+        auto const scale = makeUniform(c.channels, 0.5F, 1.5F, 2);
+        auto const bias = makeUniform(c.channels, -0.5F, 0.5F, 3);
+
+        for (bool const fp16 : {false, true})
+        {
+            std::string const config = getChannelNormConfigName(c, fp16);
+            std::vector<float> output(n);
+            std::vector<__half> outputHalf(fp16 ? n : 0);
+            auto const inputHalf = toHalfs(input);
+            float const tolerance = fp16 ? kHOST_TOLERANCE_FP16 : kHOST_TOLERANCE_FP32;
+            auto const reference = timeVariants(
+                context, kernel, config, static_cast<double>(n), "values", tolerance, tolerance,
+                [&](KernelVariant const& variant) {
+                    if (fp16)
+                    {
+                        plugin::instanceNormHost(c.batch, c.channels, channelVolume, epsilon, inputHalf.data(),
+                            scale.data(), bias.data(), c.relu, alpha, outputHalf.data(), variant.threads);
+                    }
+                    else
+                    {
+                        plugin::instanceNormHost(c.batch, c.channels, channelVolume, epsilon, input.data(),
+                            scale.data(), bias.data(), c.relu, alpha, output.data(), variant.threads);
+                    }
+                },
+                [&]() { return fp16 ? toFloats(outputHalf) : output; });
+
+            if (!context.options().verify)
+            {
+                continue;
+            }
+            int32_t const relu = c.relu ? 1 : 0;
+            std::vector<PluginField> const fields{{"epsilon", &epsilon, PluginFieldType::kFLOAT32, 1},
+                {"scales", scale.data(), PluginFieldType::kFLOAT32, c.channels},
+                {"bias", bias.data(), PluginFieldType::kFLOAT32, c.channels},
+                {"relu", &relu, PluginFieldType::kINT32, 1}, {"alpha", &alpha, PluginFieldType::kFLOAT32, 1}};
+            PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+            std::vector<HostTensor> const inputs{
+                makeFloatTensor(fp16, Dims4{c.batch, c.channels, c.height, c.width}, input)};
+            std::vector<HostTensor> outputs;
+            if (!context.check(
+                    runPluginOnDevice("InstanceNormalization_TRT", "3", fc, inputs, outputs) && outputs.size() == 1,
+                    "InstanceNormalization_TRT failed"))
+            {
+                return false;
+            }
+            float const deviceTolerance = fp16 ? kDEVICE_TOLERANCE_FP16 : kDEVICE_TOLERANCE_FP32;
+            expectNear(context, kernel + " (" + config + ") and InstanceNormalization_TRT outputs",
+                toFloats(outputs[0]), reference, deviceTolerance, deviceTolerance);
+        }
+    }
+    return true;
+}
+
+} // namespace sample
@@ -0,0 +1,1024 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//! \file pluginHostBenchmark.cpp
+//!
+//! \brief Times the host-side lifecycle of every plugin creator registered by initLibNvInferPlugins().
+//!
+//! For each creator, the tool builds a representative PluginFieldCollection from the *_PluginConfig.yaml file of the
+//! plugin, then times createPlugin(), serialization, deserialization, clone() and destruction, and counts the heap
+//! allocations made by each call. Nothing is enqueued and no CUDA stream is created, so the results only reflect the
+//! host paths that dominate the deserialization of engines with many plugin instances.
+//!
+//! With --kernels, the tool instead times the host implementations of plugin kernels with scalar code, SIMD code and
+//! several threads, checks that they agree, and with --verify compares them with the CUDA plugins.
+//!
+//! It can be run with the following command line:
+//! Command: ./plugin_host_benchmark --configDir=<TensorRT>/plugin [--iterations=1000] [--plugins=<name>[,<name>]]
+//! Command: ./plugin_host_benchmark --kernels=all [--iterations=10] [--threads=N] [--verify]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "NvInfer.h"
+#include "NvInferPlugin.h"
+#include "getOptions.h"
+#include "hostKernelBenchmark.h"
+#include "logger.h"
+
+namespace
+{
+
+//! Number of calls to the replaceable allocation functions since the start of the process.
+std::atomic<int64_t> gNbAllocations{0};
+
+void* countedAllocate(size_t size) noexcept
+{
+    gNbAllocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+} // namespace
+
+// Replacing the global allocation functions counts the allocations of the plugin library as well, except on Windows
+// where each DLL has its own allocator.
+void* operator new(size_t size)
+{
+    void* ptr = countedAllocate(size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, std::nothrow_t const&) noexcept
+{
+    return countedAllocate(size);
+}
+
+void* operator new[](size_t size, std::nothrow_t const&) noexcept
+{
+    return countedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::nothrow_t const&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+
+using namespace nvinfer1;
+
+std::string const kSAMPLE_NAME = "TensorRT.plugin_host_benchmark";
+
+std::string const kCONFIG_SUFFIX = "_PluginConfig.yaml";
+
+struct BenchmarkOptions
+{
+    std::string configDir;
+    int32_t iterations{1000};
+    std::vector<std::string> plugins;
+    std::vector<std::string> skip;
+    sample::KernelOptions kernels; //!< Benchmark these host kernels instead of the plugin lifecycles
+};
+
+std::string trim(std::string const& s)
+{
+    size_t const begin = s.find_first_not_of(" \t\r");
+    if (begin == std::string::npos)
+    {
+        return "";
+    }
+    return s.substr(begin, s.find_last_not_of(" \t\r") - begin + 1);
+}
+
+std::string unquote(std::string const& s)
+{
+    std::string const t = trim(s);
+    if (t.size() >= 2 && (t.front() == '"' || t.front() == '\'') && t.back() == t.front())
+    {
+        return t.substr(1, t.size() - 2);
+    }
+    return t;
+}
+
+std::vector<std::string> split(std::string const& s, char separator)
+{
+    std::vector<std::string> parts;
+    std::istringstream stream(s);
+    for (std::string part; std::getline(stream, part, separator);)
+    {
+        if (!trim(part).empty())
+        {
+            parts.push_back(trim(part));
+        }
+    }
+    return parts;
+}
+
+//!
+//! \brief A node of the subset of YAML used by the plugin configuration files: block mappings and sequences, flow
+//! sequences of scalars, plain and quoted scalars, and comments.
+//!
+struct YamlNode
+{
+    std::string scalar;
+    std::vector<std::pair<std::string, YamlNode>> entries;
+    std::vector<YamlNode> items;
+
+    YamlNode const* find(std::string const& key) const
+    {
+        for (auto const& entry : entries)
+        {
+            if (entry.first == key)
+            {
+                return &entry.second;
+            }
+        }
+        return nullptr;
+    }
+};
+
+YamlNode const* findEntry(YamlNode const* node, std::string const& key)
+{
+    return node == nullptr ? nullptr : node->find(key);
+}
+
+class YamlParser
+{
+public:
+    explicit YamlParser(std::istream& in)
+    {
+        for (std::string line; std::getline(in, line);)
+        {
+            std::string const text = trim(stripComment(line));
+            if (text.empty() || text == "---" || text == "...")
+            {
+                continue;
+            }
+            mLines.push_back(Line{static_cast<int32_t>(line.find_first_not_of(' ')), text});
+        }
+    }
+
+    YamlNode parse()
+    {
+        return mLines.empty() ? YamlNode{} : parseBlock(mLines.front().indent);
+    }
+
+private:
+    struct Line
+    {
+        int32_t indent;
+        std::string text;
+    };
+
+    static std::string stripComment(std::string const& line)
+    {
+        char quote{0};
+        for (size_t i = 0; i < line.size(); ++i)
+        {
+            char const c = line[i];
+            if (quote != 0)
+            {
+                quote = c == quote ? 0 : quote;
+            }
+            else if (c == '"' || c == '\'')
+            {
+                quote = c;
+            }
+            else if (c == '#' && (i == 0 || line[i - 1] == ' ' || line[i - 1] == '\t'))
+            {
+                return line.substr(0, i);
+            }
+        }
+        return line;
+    }
+
+    //! Return the position of the ':' ending the key of a mapping entry, or npos.
+    static size_t findKeySeparator(std::string const& text)
+    {
+        char quote{0};
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            char const c = text[i];
+            if (quote != 0)
+            {
+                quote = c == quote ? 0 : quote;
+            }
+            else if (c == '"' || c == '\'')
+            {
+                quote = c;
+            }
+            else if (c == ':' && (i + 1 == text.size() || text[i + 1] == ' '))
+            {
+                return i;
+            }
+        }
+        return std::string::npos;
+    }
+
+    static bool isSequenceItem(Line const& line)
+    {
+        return line.text[0] == '-' && (line.text.size() == 1 || line.text[1] == ' ');
+    }
+
+    static YamlNode parseScalar(std::string const& text)
+    {
+        YamlNode node;
+        if (text.front() == '[' && text.back() == ']')
+        {
+            for (auto const& item : split(text.substr(1, text.size() - 2), ','))
+            {
+                node.items.push_back(YamlNode{unquote(item), {}, {}});
+            }
+        }
+        else
+        {
+            node.scalar = unquote(text);
+        }
+        return node;
+    }
+
+    bool hasLine() const
+    {
+        return mNext < mLines.size();
+    }
+
+    YamlNode parseBlock(int32_t indent)
+    {
+        return isSequenceItem(mLines[mNext]) ? parseSequence(indent) : parseMapping(indent);
+    }
+
+    //! Parse the value of an entry or item without an inline value: the more indented lines that follow, or a
+    //! sequence at the same indentation.
+    YamlNode parseNested(int32_t indent)
+    {
+        if (hasLine()
+            && (mLines[mNext].indent > indent || (mLines[mNext].indent == indent && isSequenceItem(mLines[mNext]))))
+        {
+            return parseBlock(mLines[mNext].indent);
+        }
+        return YamlNode{};
+    }
+
+    YamlNode parseSequence(int32_t indent)
+    {
+        YamlNode node;
+        while (hasLine() && mLines[mNext].indent == indent && isSequenceItem(mLines[mNext]))
+        {
+            Line& line = mLines[mNext];
+            std::string const rest = trim(line.text.substr(1));
+            if (rest.empty())
+            {
+                ++mNext;
+                node.items.push_back(parseNested(indent + 1));
+            }
+            else if (findKeySeparator(rest) != std::string::npos)
+            {
+                // "- key: value" starts a mapping indented like its first key.
+                line.indent = indent + static_cast<int32_t>(line.text.size() - rest.size());
+                line.text = rest;
+                node.items.push_back(parseMapping(line.indent));
+            }
+            else
+            {
+                ++mNext;
+                node.items.push_back(parseScalar(rest));
+            }
+        }
+        return node;
+    }
+
+    YamlNode parseMapping(int32_t indent)
+    {
+        YamlNode node;
+        while (hasLine() && mLines[mNext].indent == indent && !isSequenceItem(mLines[mNext]))
+        {
+            std::string const text = mLines[mNext].text;
+            ++mNext;
+            size_t const separator = findKeySeparator(text);
+            if (separator == std::string::npos)
+            {
+                continue;
+            }
+            std::string const value = trim(text.substr(separator + 1));
+            node.entries.emplace_back(
+                unquote(text.substr(0, separator)), value.empty() ? parseNested(indent) : parseScalar(value));
+        }
+        return node;
+    }
+
+    std::vector<Line> mLines;
+    size_t mNext{0};
+};
+
+//! Storage of a field of the collection passed to createPlugin().
+struct FieldData
+{
+    std::string name;
+    PluginFieldType type{PluginFieldType::kUNKNOWN};
+    std::vector<float> floats;
+    std::vector<int32_t> ints;
+    std::string chars;
+};
+
+//! Fields of a plugin version, built from its configuration file.
+class PluginConfig
+{
+public:
+    PluginConfig() = default;
+
+    PluginConfig(std::vector<FieldData> fields, std::string source)
+        : mData(std::move(fields))
+        , mSource(std::move(source))
+    {
+        for (auto const& data : mData)
+        {
+            void const* ptr = data.type == PluginFieldType::kFLOAT32
+                ? static_cast<void const*>(data.floats.data())
+                : data.type == PluginFieldType::kINT32 ? static_cast<void const*>(data.ints.data())
+                                                       : static_cast<void const*>(data.chars.c_str());
+            auto const length = data.type == PluginFieldType::kFLOAT32
+                ? data.floats.size()
+                : data.type == PluginFieldType::kINT32 ? data.ints.size() : data.chars.size();
+            mFields.emplace_back(data.name.c_str(), ptr, data.type, static_cast<int32_t>(length));
+        }
+        mCollection.nbFields = static_cast<int32_t>(mFields.size());
+        mCollection.fields = mFields.data();
+    }
+
+    PluginConfig(PluginConfig const&) = delete;
+    PluginConfig& operator=(PluginConfig const&) = delete;
+
+    PluginFieldCollection const& collection() const
+    {
+        return mCollection;
+    }
+
+    std::string const& source() const
+    {
+        return mSource;
+    }
+
+private:
+    std::vector<FieldData> mData;
+    std::vector<PluginField> mFields;
+    PluginFieldCollection mCollection{0, nullptr};
+    std::string mSource;
+};
+
+//! Parse a bound of attribute_options, such as "0", "=1" or "=pinf".
+double parseBound(std::string const& text, double infinity)
+{
+    std::string const value = text.empty() || text.front() != '=' ? text : text.substr(1);
+    if (value == "pinf" || value == "ninf")
+    {
+        return value == "pinf" ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity();
+    }
+    try
+    {
+        return std::stod(value);
+    }
+    catch (std::exception const&)
+    {
+        return infinity;
+    }
+}
+
+//! Return a value of an attribute allowed by its options: the first option of a list, or a value within its range.
+std::string getDefaultValue(YamlNode const* options)
+{
+    if (options == nullptr)
+    {
+        return "1";
+    }
+    if (!options->items.empty())
+    {
+        return options->items.front().scalar;
+    }
+    auto const* minNode = options->find("min");
+    auto const* maxNode = options->find("max");
+    double const inf = std::numeric_limits<double>::infinity();
+    double const lo = minNode == nullptr ? -inf : parseBound(minNode->scalar, -inf);
+    double const hi = maxNode == nullptr ? inf : parseBound(maxNode->scalar, inf);
+    double value{1.0};
+    if (std::isfinite(lo) && std::isfinite(hi))
+    {
+        value = 0.5 * (lo + hi);
+    }
+    else if (std::isfinite(lo))
+    {
+        value = lo + 1.0;
+    }
+    else if (std::isfinite(hi))
+    {
+        value = hi - 1.0;
+    }
+    std::ostringstream stream;
+    stream << value;
+    return stream.str();
+}
+
+//!
+//! \brief Build the fields of a plugin version from its configuration.
+//!
+//! Attributes take the values and shapes of the first entry of configs if there is one, and otherwise the first of
+//! their options or a value within their range, repeated attribute_length times.
+//!
+std::vector<FieldData> buildFields(YamlNode const& version)
+{
+    auto const* attributes = version.find("attributes");
+    auto const* types = version.find("attribute_types");
+    auto const* lengths = version.find("attribute_length");
+    auto const* options = version.find("attribute_options");
+    auto const* configs = version.find("configs");
+    YamlNode const* configOptions = configs == nullptr || configs->entries.empty()
+        ? nullptr
+        : configs->entries.front().second.find("attribute_options");
+
+    std::vector<FieldData> fields;
+    if (attributes == nullptr)
+    {
+        return fields;
+    }
+    for (auto const& attribute : attributes->items)
+    {
+        FieldData field;
+        field.name = attribute.scalar;
+        auto const* typeNode = findEntry(types, field.name);
+        std::string const type = typeNode == nullptr ? "" : typeNode->scalar;
+        if (type == "float32")
+        {
+            field.type = PluginFieldType::kFLOAT32;
+        }
+        else if (type == "int32")
+        {
+            field.type = PluginFieldType::kINT32;
+        }
+        else if (type == "char")
+        {
+            field.type = PluginFieldType::kCHAR;
+        }
+        else
+        {
+            sample::gLogVerbose << "Skipping attribute '" << field.name << "' of unsupported type '" << type << "'."
+                                << std::endl;
+            continue;
+        }
+
+        auto const* config = findEntry(configOptions, field.name);
+        auto const* configValue = findEntry(config, "value");
+        auto const* configShape = findEntry(config, "shape");
+        std::vector<std::string> values;
+        if (configValue != nullptr && !configValue->items.empty())
+        {
+            for (auto const& item : configValue->items)
+            {
+                values.push_back(item.scalar);
+            }
+        }
+        else
+        {
+            values.push_back(
+                configValue != nullptr ? configValue->scalar : getDefaultValue(findEntry(options, field.name)));
+        }
+
+        if (field.type == PluginFieldType::kCHAR)
+        {
+            field.chars = values.front();
+            fields.push_back(std::move(field));
+            continue;
+        }
+
+        int64_t count = static_cast<int64_t>(values.size());
+        if (configShape != nullptr)
+        {
+            count = 1;
+            for (auto const& dim : split(configShape->scalar, ','))
+            {
+                count *= std::stoll(dim);
+            }
+        }
+        else if (auto const* length = findEntry(lengths, field.name))
+        {
+            count = std::max(static_cast<int64_t>(std::stoll(length->scalar)), count);
+        }
+        for (int64_t i = 0; i < count; ++i)
+        {
+            double const value = std::stod(values[i % values.size()]);
+            if (field.type == PluginFieldType::kFLOAT32)
+            {
+                field.floats.push_back(static_cast<float>(value));
+            }
+            else
+            {
+                field.ints.push_back(static_cast<int32_t>(std::lround(value)));
+            }
+        }
+        fields.push_back(std::move(field));
+    }
+    return fields;
+}
+
+//! Configurations of the plugin versions, by plugin name and version.
+using ConfigMap = std::map<std::pair<std::string, std::string>, PluginConfig>;
+
+void loadConfigs(std::string const& configDir, ConfigMap& configs)
+{
+    namespace fs = std::filesystem;
+    for (auto const& entry : fs::recursive_directory_iterator(configDir))
+    {
+        std::string const path = entry.path().string();
+        if (!entry.is_regular_file() || path.size() < kCONFIG_SUFFIX.size()
+            || path.compare(path.size() - kCONFIG_SUFFIX.size(), kCONFIG_SUFFIX.size(), kCONFIG_SUFFIX) != 0)
+        {
+            continue;
+        }
+        std::ifstream file(path);
+        YamlNode const root = YamlParser(file).parse();
+        auto const* name = root.find("name");
+        auto const* versions = root.find("versions");
+        if (name == nullptr || versions == nullptr)
+        {
+            sample::gLogWarning << "Ignoring " << path << ", which has no name or versions." << std::endl;
+            continue;
+        }
+        for (auto const& version : versions->entries)
+        {
+            try
+            {
+                configs.emplace(std::piecewise_construct, std::forward_as_tuple(name->scalar, version.first),
+                    std::forward_as_tuple(buildFields(version.second), path));
+            }
+            catch (std::exception const& e)
+            {
+                sample::gLogWarning << "Ignoring version " << version.first << " of " << path << ": " << e.what()
+                                    << std::endl;
+            }
+        }
+    }
+}
+
+//! Average cost of a call.
+struct CallStats
+{
+    double microseconds{0.0};
+    double allocations{0.0};
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    std::string version;
+    std::string interface;
+    int64_t serializedSize{0};
+    bool created{false}; //!< Whether the first plugin was created, and the calls were timed
+    CallStats create;
+    CallStats serialize;
+    CallStats deserialize;
+    CallStats clone;
+    CallStats destroy;
+    std::string error;
+};
+
+//! Time iterations calls of func(i) and count their allocations.
+template <typename F>
+CallStats timeCalls(int32_t iterations, F const& func)
+{
+    int64_t const nbAllocations = gNbAllocations.load(std::memory_order_relaxed);
+    auto const start = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < iterations; ++i)
+    {
+        func(i);
+    }
+    auto const end = std::chrono::steady_clock::now();
+    CallStats stats;
+    stats.microseconds = std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+    stats.allocations
+        = static_cast<double>(gNbAllocations.load(std::memory_order_relaxed) - nbAllocations) / iterations;
+    return stats;
+}
+
+template <typename T>
+bool allCreated(std::vector<T*> const& plugins)
+{
+    return std::none_of(plugins.begin(), plugins.end(), [](T* plugin) { return plugin == nullptr; });
+}
+
+void benchmarkV1(
+    IPluginCreator& creator, PluginFieldCollection const& fc, int32_t iterations, BenchmarkResult& result)
+{
+    char const* name = creator.getPluginName();
+    IPluginV2* plugin = creator.createPlugin(name, &fc);
+    if (plugin == nullptr)
+    {
+        result.error = "createPlugin() failed";
+        return;
+    }
+    result.created = true;
+
+    // Plugins are destroyed in a separate loop, so that each loop times a single call.
+    std::vector<IPluginV2*> plugins(iterations, nullptr);
+    auto const destroyAll = [&]() {
+        return timeCalls(iterations, [&](int32_t i) {
+            if (plugins[i] != nullptr)
+            {
+                plugins[i]->destroy();
+                plugins[i] = nullptr;
+            }
+        });
+    };
+
+    result.create = timeCalls(iterations, [&](int32_t i) { plugins[i] = creator.createPlugin(name, &fc); });
+    result.destroy = destroyAll();
+
+    size_t const size = plugin->getSerializationSize();
+    result.serializedSize = static_cast<int64_t>(size);
+    std::vector<char> buffer(size);
+    result.serialize = timeCalls(iterations, [&](int32_t) { plugin->serialize(buffer.data()); });
+
+    result.deserialize = timeCalls(
+        iterations, [&](int32_t i) { plugins[i] = creator.deserializePlugin(name, buffer.data(), buffer.size()); });
+    if (!allCreated(plugins))
+    {
+        result.error = "deserializePlugin() failed";
+    }
+    destroyAll();
+
+    result.clone = timeCalls(iterations, [&](int32_t i) { plugins[i] = plugin->clone(); });
+    if (!allCreated(plugins) && result.error.empty())
+    {
+        result.error = "clone() failed";
+    }
+    destroyAll();
+    plugin->destroy();
+}
+
+int64_t getFieldSize(PluginField const& field)
+{
+    switch (field.type)
+    {
+    case PluginFieldType::kFLOAT64:
+    case PluginFieldType::kINT64: return 8 * static_cast<int64_t>(field.length);
+    case PluginFieldType::kFLOAT32:
+    case PluginFieldType::kINT32: return 4 * static_cast<int64_t>(field.length);
+    case PluginFieldType::kFLOAT16:
+    case PluginFieldType::kBF16:
+    case PluginFieldType::kINT16: return 2 * static_cast<int64_t>(field.length);
+    case PluginFieldType::kDIMS: return static_cast<int64_t>(sizeof(Dims)) * field.length;
+    case PluginFieldType::kINT4:
+    case PluginFieldType::kFP4: return (static_cast<int64_t>(field.length) + 1) / 2;
+    default: return field.length;
+    }
+}
+
+void benchmarkV3(
+    IPluginCreatorV3One& creator, PluginFieldCollection const& fc, int32_t iterations, BenchmarkResult& result)
+{
+    char const* name = creator.getPluginName();
+    IPluginV3* plugin = creator.createPlugin(name, &fc, TensorRTPhase::kBUILD);
+    if (plugin == nullptr)
+    {
+        result.error = "createPlugin() failed";
+        return;
+    }
+    auto* runtime = static_cast<IPluginV3OneRuntime*>(plugin->getCapabilityInterface(PluginCapabilityType::kRUNTIME));
+    if (runtime == nullptr)
+    {
+        result.error = "no runtime capability";
+        delete plugin;
+        return;
+    }
+    result.created = true;
+
+    std::vector<IPluginV3*> plugins(iterations, nullptr);
+    auto const destroyAll = [&]() {
+        return timeCalls(iterations, [&](int32_t i) {
+            delete plugins[i];
+            plugins[i] = nullptr;
+        });
+    };
+
+    result.create = timeCalls(
+        iterations, [&](int32_t i) { plugins[i] = creator.createPlugin(name, &fc, TensorRTPhase::kBUILD); });
+    result.destroy = destroyAll();
+
+    // The fields returned by the last call stay valid until the next one, so they are deserialized while the
+    // plugin is alive.
+    PluginFieldCollection const* serialized{nullptr};
+    result.serialize = timeCalls(iterations, [&](int32_t) { serialized = runtime->getFieldsToSerialize(); });
+    if (serialized == nullptr)
+    {
+        result.error = "getFieldsToSerialize() failed";
+        delete plugin;
+        return;
+    }
+    for (int32_t i = 0; i < serialized->nbFields; ++i)
+    {
+        result.serializedSize += getFieldSize(serialized->fields[i]);
+    }
+
+    result.deserialize = timeCalls(
+        iterations, [&](int32_t i) { plugins[i] = creator.createPlugin(name, serialized, TensorRTPhase::kRUNTIME); });
+    if (!allCreated(plugins))
+    {
+        result.error = "createPlugin() from the serialized fields failed";
+    }
+    destroyAll();
+
+    result.clone = timeCalls(iterations, [&](int32_t i) { plugins[i] = plugin->clone(); });
+    if (!allCreated(plugins) && result.error.empty())
+    {
+        result.error = "clone() failed";
+    }
+    destroyAll();
+    delete plugin;
+}
+
+bool isSelected(BenchmarkOptions const& options, std::string const& name)
+{
+    auto const listed = [&name](std::vector<std::string> const& names) {
+        return std::find(names.begin(), names.end(), name) != names.end();
+    };
+    return (options.plugins.empty() || listed(options.plugins)) && !listed(options.skip);
+}
+
+//! Print the average time in microseconds and the average number of allocations of each call.
+void printResults(std::vector<BenchmarkResult> const& results)
+{
+    auto const printStats = [](CallStats const& stats) {
+        sample::gLogInfo << std::right << std::fixed << std::setprecision(2) << std::setw(12) << stats.microseconds
+                         << std::setprecision(1) << std::setw(8) << stats.allocations;
+    };
+    sample::gLogInfo << std::left << std::setw(44) << "plugin" << std::setw(16) << "interface" << std::right
+                     << std::setw(10) << "bytes";
+    for (char const* call : {"create", "serialize", "deserialize", "clone", "destroy"})
+    {
+        sample::gLogInfo << std::setw(12) << call << std::setw(8) << "allocs";
+    }
+    sample::gLogInfo << std::endl;
+
+    for (auto const& result : results)
+    {
+        sample::gLogInfo << std::left << std::setw(44) << (result.name + " v" + result.version) << std::setw(16)
+                         << result.interface;
+        if (!result.created)
+        {
+            sample::gLogInfo << result.error << std::endl;
+            continue;
+        }
+        sample::gLogInfo << std::right << std::setw(10) << result.serializedSize;
+        for (auto const* stats :
+            {&result.create, &result.serialize, &result.deserialize, &result.clone, &result.destroy})
+        {
+            printStats(*stats);
+        }
+        sample::gLogInfo << (result.error.empty() ? "" : "  " + result.error) << std::endl;
+    }
+}
+
+void printHelp()
+{
+    std::cout << "Usage: ./plugin_host_benchmark [options]" << std::endl
+              << "  --configDir=<dir>          Directory searched recursively for *_PluginConfig.yaml files, such as "
+                 "the plugin directory of the TensorRT sources. Without it, plugins are created with no fields"
+              << std::endl
+              << "  --iterations=<N>           Number of calls timed per plugin and method (default = 1000), or per "
+                 "kernel variant (default = 10)"
+              << std::endl
+              << "  --plugins=<name>[,<name>]  Only benchmark these plugins" << std::endl
+              << "  --skip=<name>[,<name>]     Do not benchmark these plugins, for example the ones whose "
+                 "constructors use the device"
+              << std::endl
+              << "  --kernels=<name>[,<name>]  Benchmark the host implementations of these kernels instead, or of all "
+                 "of them with \"all\": efficientNMS, voxelGenerator, pillarScatter, "
+                 "modulatedDeformConv, multiscaleDeformableAttn, skipLayerNorm, embLayerNorm, groupNorm, instanceNorm, "
+                 "priorBox, gridAnchor"
+              << std::endl
+              << "  --threads=<N>              Number of threads of the multithreaded kernel runs (default = one per "
+                 "hardware thread)"
+              << std::endl
+              << "  --verify                   Also compare the host kernels with the CUDA plugins, which requires a GPU"
+              << std::endl
+              << "  --help, -h                 Print this message" << std::endl;
+}
+
+bool parseOptions(int32_t argc, char** argv, BenchmarkOptions& options)
+{
+    using nvinfer1::utility::TRTOption;
+    std::vector<TRTOption> const spec{{0, "configDir", true, ""}, {0, "iterations", true, ""},
+        {0, "plugins", true, ""}, {0, "skip", true, ""}, {'h', "help", false, ""}, {0, "kernels", true, ""},
+        {0, "threads", true, ""}, {0, "verify", false, ""}};
+    auto const args = nvinfer1::utility::getOptions(argc, argv, spec);
+    if (!args.errMsg.empty())
+    {
+        sample::gLogError << args.errMsg << std::endl;
+        return false;
+    }
+    auto const& values = args.values;
+    if (values[4].first > 0)
+    {
+        printHelp();
+        exit(EXIT_SUCCESS);
+    }
+
+    auto lastValue = [&](size_t i, std::string const& fallback) {
+        return values[i].second.empty() ? fallback : values[i].second.back();
+    };
+    try
+    {
+        options.configDir = lastValue(0, "");
+        options.iterations = std::stoi(lastValue(1, std::to_string(options.iterations)));
+        options.plugins = split(lastValue(2, ""), ',');
+        options.skip = split(lastValue(3, ""), ',');
+        options.kernels.kernels = split(lastValue(5, ""), ',');
+        options.kernels.iterations = std::stoi(lastValue(1, std::to_string(options.kernels.iterations)));
+        options.kernels.threads = std::stoi(lastValue(6, "0"));
+        options.kernels.verify = values[7].first > 0;
+    }
+    catch (std::exception const& e)
+    {
+        sample::gLogError << "Invalid option value: " << e.what() << std::endl;
+        return false;
+    }
+
+    if (options.iterations <= 0 || options.kernels.iterations <= 0 || options.kernels.threads < 0)
+    {
+        sample::gLogError << "Invalid arguments." << std::endl;
+        printHelp();
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int32_t main(int32_t argc, char** argv)
+{
+    auto sampleTest = sample::gLogger.defineTest(kSAMPLE_NAME, argc, argv);
+    sample::gLogger.reportTestStart(sampleTest);
+
+    BenchmarkOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return sample::gLogger.reportFail(sampleTest);
+    }
+
+    if (!options.kernels.kernels.empty())
+    {
+        // The CUDA plugins are only needed to verify the host kernels.
+        if (options.kernels.verify && !initLibNvInferPlugins(&sample::gLogger.getTRTLogger(), ""))
+        {
+            sample::gLogError << "initLibNvInferPlugins() failed." << std::endl;
+            return sample::gLogger.reportFail(sampleTest);
+        }
+        return sample::runHostKernelBenchmarks(options.kernels) ? sample::gLogger.reportPass(sampleTest)
+                                                                : sample::gLogger.reportFail(sampleTest);
+    }
+
+    ConfigMap configs;
+    if (!options.configDir.empty())
+    {
+        try
+        {
+            loadConfigs(options.configDir, configs);
+        }
+        catch (std::exception const& e)
+        {
+            sample::gLogError << "Cannot read the configurations: " << e.what() << std::endl;
+            return sample::gLogger.reportFail(sampleTest);
+        }
+        sample::gLogInfo << "Loaded " << configs.size() << " plugin configurations from " << options.configDir << "."
+                         << std::endl;
+    }
+
+    if (!initLibNvInferPlugins(&sample::gLogger.getTRTLogger(), ""))
+    {
+        sample::gLogError << "initLibNvInferPlugins() failed." << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+
+    int32_t nbCreators{0};
+    auto* const* creators = getPluginRegistry()->getAllCreators(&nbCreators);
+    PluginConfig const noConfig;
+    std::vector<BenchmarkResult> results;
+    for (int32_t c = 0; c < nbCreators; ++c)
+    {
+        auto* creator = creators[c];
+        std::string const kind = creator->getInterfaceInfo().kind;
+        BenchmarkResult result;
+        if (kind == "PLUGIN CREATOR_V1")
+        {
+            auto* creatorV1 = static_cast<IPluginCreator*>(creator);
+            result.name = creatorV1->getPluginName();
+            result.version = creatorV1->getPluginVersion();
+            result.interface = "IPluginV2";
+        }
+        else if (kind == "PLUGIN CREATOR_V3ONE")
+        {
+            auto* creatorV3 = static_cast<IPluginCreatorV3One*>(creator);
+            result.name = creatorV3->getPluginName();
+            result.version = creatorV3->getPluginVersion();
+            result.interface = "IPluginV3";
+        }
+        else
+        {
+            sample::gLogWarning << "Skipping a creator of unsupported kind '" << kind << "'." << std::endl;
+            continue;
+        }
+        if (!isSelected(options, result.name))
+        {
+            continue;
+        }
+
+        auto const config = configs.find({result.name, result.version});
+        PluginConfig const& pluginConfig = config == configs.end() ? noConfig : config->second;
+        if (config == configs.end() && !options.configDir.empty())
+        {
+            sample::gLogVerbose << "No configuration for " << result.name << " v" << result.version
+                                << ", creating it with no fields." << std::endl;
+        }
+
+        sample::gLogVerbose << "Benchmarking " << result.name << " v" << result.version << "." << std::endl;
+        PluginFieldCollection const& fc = pluginConfig.collection();
+        if (result.interface == "IPluginV2")
+        {
+            benchmarkV1(*static_cast<IPluginCreator*>(creator), fc, options.iterations, result);
+        }
+        else
+        {
+            benchmarkV3(*static_cast<IPluginCreatorV3One*>(creator), fc, options.iterations, result);
+        }
+        results.push_back(std::move(result));
+    }
+
+    // Plugins that deserialize slowest first, then the ones that could not be benchmarked.
+    std::stable_sort(results.begin(), results.end(), [](BenchmarkResult const& a, BenchmarkResult const& b) {
+        return a.deserialize.microseconds > b.deserialize.microseconds;
+    });
+    printResults(results);
+
+    return sample::gLogger.reportPass(sampleTest);
+}
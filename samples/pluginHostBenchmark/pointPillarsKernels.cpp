@@ -0,0 +1,314 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hostKernelBenchmark.h"
+
+#include "pillarScatterPlugin/pillarScatterHost.h"
+#include "voxelGeneratorPlugin/voxelGeneratorHost.h"
+
+#include <algorithm>
+#include <cuda_fp16.h>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+
+using namespace nvinfer1;
+
+namespace sample
+{
+
+namespace
+{
+
+//! Sizes of the point clouds, from a sparse sweep to a dense one.
+std::vector<int32_t> const kNB_POINTS{100000, 300000, 1000000};
+
+//! The PointPillars configuration of KITTI: 432x496 pillars of 0.16 m.
+plugin::VoxelGeneratorParameters getVoxelParameters()
+{
+    plugin::VoxelGeneratorParameters param{};
+    param.maxVoxels = 40000;
+    param.maxPoints = 32;
+    param.voxelFeatures = 10;
+    param.pointFeatures = 4;
+    param.xMin = 0.F;
+    param.xMax = 69.12F;
+    param.yMin = -39.68F;
+    param.yMax = 39.68F;
+    param.zMin = -3.F;
+    param.zMax = 1.F;
+    param.pillarX = 0.16F;
+    param.pillarY = 0.16F;
+    param.pillarZ = 4.F;
+    param.gridX = 432;
+    param.gridY = 496;
+    return param;
+}
+
+//! A point cloud of (x, y, z, intensity) points clustered in about one pillar out of ten points, without more pillars
+//! than maxVoxels. A few points are out of range. Points are away from the pillar borders, so that rounding cannot
+//! move them to another pillar.
+std::vector<float> makePointCloud(plugin::VoxelGeneratorParameters const& param, int32_t nbPoints)
+{
+    std::mt19937 generator(nbPoints);
+    std::uniform_real_distribution<float> unit(0.F, 1.F);
+    int32_t const nbCells = param.gridX * param.gridY;
+    std::vector<int32_t> cells(nbCells);
+    std::iota(cells.begin(), cells.end(), 0);
+    std::shuffle(cells.begin(), cells.end(), generator);
+    cells.resize(std::min(nbPoints / 10, param.maxVoxels * 9 / 10));
+
+    std::vector<float> points(static_cast<int64_t>(nbPoints) * param.pointFeatures);
+    for (int32_t i = 0; i < nbPoints; ++i)
+    {
+        float* point = points.data() + static_cast<int64_t>(i) * param.pointFeatures;
+        int32_t const cell = cells[generator() % cells.size()];
+        point[0] = param.xMin + (cell % param.gridX + 0.1F + 0.8F * unit(generator)) * param.pillarX;
+        point[1] = param.yMin + (cell / param.gridX + 0.1F + 0.8F * unit(generator)) * param.pillarY;
+        point[2] = param.zMin + (0.1F + 0.8F * unit(generator)) * param.pillarZ;
+        point[3] = 0.01F + unit(generator);
+        if (i % 20 == 0)
+        {
+            point[0] = param.xMax + 1.F + unit(generator);
+        }
+    }
+    return points;
+}
+
+//! The outputs of VoxelGeneratorPlugin.
+struct VoxelOutputs
+{
+    std::vector<float> features;
+    std::vector<uint32_t> coords;
+    std::vector<uint32_t> params;
+};
+
+//! Run the host implementation on a point cloud, allocating the outputs on the first call.
+void runVoxelGenerator(plugin::VoxelGeneratorParameters const& param, std::vector<float> const& points,
+    int32_t numThreads, VoxelOutputs& outputs)
+{
+    auto const nbPoints = static_cast<int32_t>(points.size() / param.pointFeatures);
+    uint32_t const pointNum = static_cast<uint32_t>(nbPoints);
+    outputs.features.resize(static_cast<int64_t>(param.maxVoxels) * param.maxPoints * param.voxelFeatures);
+    outputs.coords.resize(param.maxVoxels * 4);
+    outputs.params.resize(1);
+    plugin::voxelGeneratorHost(param, 1, nbPoints, points.data(), &pointNum, outputs.features.data(),
+        outputs.coords.data(), outputs.params.data(), numThreads);
+}
+
+//! Compare the pillars of the CUDA plugin with the host ones. The CUDA plugin numbers the pillars and orders their
+//! points nondeterministically, so pillars are matched by coordinates and their points are sorted. The points kept in
+//! full pillars are arbitrary, so only their coordinates are compared.
+void expectSamePillars(KernelContext& context, std::string const& what, plugin::VoxelGeneratorParameters const& param,
+    VoxelOutputs const& host, std::vector<HostTensor> const& device)
+{
+    std::vector<float> const deviceFeatures = toFloats(device[0]);
+    std::vector<float> const deviceCoords = toFloats(device[1]);
+    std::vector<float> const deviceParams = toFloats(device[2]);
+    if (!context.check(deviceParams.size() == 1 && deviceParams[0] == static_cast<float>(host.params[0]),
+            what + " numbers of pillars differ"))
+    {
+        return;
+    }
+
+    int32_t const nbPillars = static_cast<int32_t>(host.params[0]);
+    std::unordered_map<int64_t, int32_t> devicePillars;
+    for (int32_t p = 0; p < nbPillars; ++p)
+    {
+        devicePillars.emplace(
+            static_cast<int64_t>(deviceCoords[p * 4 + 2]) * param.gridX + static_cast<int64_t>(deviceCoords[p * 4 + 3]),
+            p);
+    }
+    int64_t const rowSize = param.voxelFeatures;
+    int64_t const pillarSize = param.maxPoints * rowSize;
+    auto const sortedRows = [&](float const* pillar) {
+        std::vector<std::vector<float>> rows;
+        for (int32_t i = 0; i < param.maxPoints; ++i)
+        {
+            rows.emplace_back(pillar + i * rowSize, pillar + (i + 1) * rowSize);
+        }
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    };
+    std::vector<float> expected;
+    std::vector<float> actual;
+    for (int32_t p = 0; p < nbPillars; ++p)
+    {
+        int64_t const cell = static_cast<int64_t>(host.coords[p * 4 + 2]) * param.gridX + host.coords[p * 4 + 3];
+        auto const devicePillar = devicePillars.find(cell);
+        if (!context.check(devicePillar != devicePillars.end(), what + " pillars differ"))
+        {
+            return;
+        }
+        float const* hostPillar = host.features.data() + p * pillarSize;
+        // Points have a positive intensity, and unused rows are zero.
+        if (hostPillar[pillarSize - rowSize + 3] != 0.F)
+        {
+            continue;
+        }
+        for (auto const& row : sortedRows(hostPillar))
+        {
+            expected.insert(expected.end(), row.begin(), row.end());
+        }
+        for (auto const& row : sortedRows(&deviceFeatures[devicePillar->second * pillarSize]))
+        {
+            actual.insert(actual.end(), row.begin(), row.end());
+        }
+    }
+    // The means of the pillars are summed in another order.
+    expectNear(context, what + " features", actual, expected, 1e-4F, 1e-5F);
+}
+
+} // namespace
+
+bool benchmarkVoxelGenerator(KernelContext& context)
+{
+    char const* const kernel = "voxelGenerator";
+    auto const param = getVoxelParameters();
+    for (int32_t const nbPoints : kNB_POINTS)
+    {
+        std::string const configName = std::to_string(nbPoints) + " points";
+        std::vector<float> const points = makePointCloud(param, nbPoints);
+
+        VoxelOutputs reference;
+        for (auto const& variant : context.variants(false))
+        {
+            VoxelOutputs outputs;
+            context.time(kernel, configName, variant, nbPoints, "points",
+                [&]() { runVoxelGenerator(param, points, variant.threads, outputs); });
+            if (&variant == &context.variants(false).front())
+            {
+                reference = std::move(outputs);
+                continue;
+            }
+            // The host implementation numbers the pillars and their points deterministically.
+            std::string const what = std::string{kernel} + " " + getVariantName(variant) + " (" + configName + ")";
+            expectEqual(context, what + " features", outputs.features, reference.features);
+            expectEqual(context, what + " coordinates", outputs.coords, reference.coords);
+            expectEqual(context, what + " numbers of pillars", outputs.params, reference.params);
+        }
+
+        if (!context.options().verify)
+        {
+            continue;
+        }
+        float const range[6]{param.xMin, param.yMin, param.zMin, param.xMax, param.yMax, param.zMax};
+        float const voxelSize[3]{param.pillarX, param.pillarY, param.pillarZ};
+        std::vector<PluginField> const fields{
+            {"max_num_points_per_voxel", &param.maxPoints, PluginFieldType::kINT32, 1},
+            {"max_voxels", &param.maxVoxels, PluginFieldType::kINT32, 1},
+            {"point_cloud_range", range, PluginFieldType::kFLOAT32, 6},
+            {"voxel_feature_num", &param.voxelFeatures, PluginFieldType::kINT32, 1},
+            {"voxel_size", voxelSize, PluginFieldType::kFLOAT32, 3}};
+        PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+        std::vector<HostTensor> const inputs{
+            makeTensor(DataType::kFLOAT, Dims3{1, nbPoints, param.pointFeatures}, points),
+            makeTensor(DataType::kINT32, Dims{1, {1}}, std::vector<int32_t>{nbPoints})};
+        std::vector<HostTensor> outputs;
+        if (!context.check(runPluginOnDevice("VoxelGeneratorPlugin", "1", fc, inputs, outputs) && outputs.size() == 3,
+                "VoxelGeneratorPlugin failed"))
+        {
+            return false;
+        }
+        expectSamePillars(
+            context, std::string{kernel} + " (" + configName + ") and VoxelGeneratorPlugin", param, reference, outputs);
+    }
+    return true;
+}
+
+bool benchmarkPillarScatter(KernelContext& context)
+{
+    char const* const kernel = "pillarScatter";
+    auto const param = getVoxelParameters();
+    int32_t const numFeatures = 64;
+    for (int32_t const nbPoints : kNB_POINTS)
+    {
+        // Scatter the pillars of a point cloud, with the features of the pillar feature network of PointPillars.
+        VoxelOutputs voxels;
+        runVoxelGenerator(param, makePointCloud(param, nbPoints), 0, voxels);
+        std::mt19937 generator(nbPoints);
+        std::uniform_real_distribution<float> unit(-1.F, 1.F);
+        std::vector<float> features(static_cast<int64_t>(param.maxVoxels) * numFeatures);
+        std::generate(features.begin(), features.end(), [&]() { return unit(generator); });
+        std::vector<half> halfFeatures(features.size());
+        std::transform(features.begin(), features.end(), halfFeatures.begin(), __float2half);
+        int64_t const nbOutputs = static_cast<int64_t>(numFeatures) * param.gridY * param.gridX;
+
+        for (bool const fp16 : {false, true})
+        {
+            std::string const configName = std::to_string(nbPoints) + " points, " + std::to_string(voxels.params[0])
+                + " pillars" + (fp16 ? ", fp16" : "");
+            std::vector<float> reference;
+            for (auto const& variant : context.variants(false))
+            {
+                std::vector<float> outputs(nbOutputs);
+                std::vector<half> halfOutputs(fp16 ? nbOutputs : 0);
+                context.time(kernel, configName, variant, voxels.params[0], "pillars", [&]() {
+                    if (fp16)
+                    {
+                        plugin::pillarScatterHost(1, param.maxVoxels, numFeatures, halfFeatures.data(),
+                            voxels.coords.data(), voxels.params.data(), param.gridX, param.gridY, halfOutputs.data(),
+                            variant.threads);
+                    }
+                    else
+                    {
+                        plugin::pillarScatterHost(1, param.maxVoxels, numFeatures, features.data(),
+                            voxels.coords.data(), voxels.params.data(), param.gridX, param.gridY, outputs.data(),
+                            variant.threads);
+                    }
+                });
+                if (fp16)
+                {
+                    std::transform(halfOutputs.begin(), halfOutputs.end(), outputs.begin(), __half2float);
+                }
+                if (&variant == &context.variants(false).front())
+                {
+                    reference = std::move(outputs);
+                    continue;
+                }
+                expectEqual(context,
+                    std::string{kernel} + " " + getVariantName(variant) + " (" + configName + ") features", outputs,
+                    reference);
+            }
+
+            if (!context.options().verify)
+            {
+                continue;
+            }
+            int32_t const denseShape[2]{param.gridY, param.gridX};
+            std::vector<PluginField> const fields{{"dense_shape", denseShape, PluginFieldType::kINT32, 2}};
+            PluginFieldCollection const fc{static_cast<int32_t>(fields.size()), fields.data()};
+            Dims3 const featureDims{1, param.maxVoxels, numFeatures};
+            std::vector<HostTensor> const inputs{fp16 ? makeTensor(DataType::kHALF, featureDims, halfFeatures)
+                                                      : makeTensor(DataType::kFLOAT, featureDims, features),
+                makeTensor(DataType::kINT32, Dims3{1, param.maxVoxels, 4}, voxels.coords),
+                makeTensor(DataType::kINT32, Dims{1, {1}}, voxels.params)};
+            std::vector<HostTensor> outputs;
+            if (!context.check(runPluginOnDevice("PillarScatterPlugin", "1", fc, inputs, outputs) && outputs.size() == 1,
+                    "PillarScatterPlugin failed"))
+            {
+                return false;
+            }
+            // Both copy the features, so they must be equal.
+            expectNear(context, std::string{kernel} + " (" + configName + ") and PillarScatterPlugin features",
+                toFloats(outputs[0]), reference, 0.F, 0.F);
+        }
+    }
+    return true;
+}
+
+} // namespace sample
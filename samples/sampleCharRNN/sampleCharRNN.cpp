@@ -48,6 +48,7 @@
 #include "cuda_runtime_api.h"
 #include "logger.h"
 #include "sampleEngines.h"
+#include "sampleLayout.h"
 using namespace nvinfer1;
 using samplesCommon::SampleUniquePtr;
 
@@ -278,22 +279,7 @@ bool SampleCharRNNBase::transposeSubBuffers(void* data, int64_t height, int64_t
         ASSERT(data != nullptr);
         ASSERT(height > 0);
         ASSERT(width > 0);
-        int64_t const tmpSize = height * width * sizeof(float);
-        samplesCommon::HostBuffer tmpbuf(tmpSize, DataType::kFLOAT);
-        ASSERT(tmpbuf.data() != nullptr);
-        auto in = static_cast<float*>(data);
-        auto out = static_cast<float*>(tmpbuf.data());
-
-        for (int64_t i{}; i < height; ++i)
-        {
-            for (int64_t j{}; j < width; ++j)
-            {
-                out[j * height + i] = in[i * width + j];
-            }
-        }
-
-        std::copy(static_cast<uint8_t*>(tmpbuf.data()), static_cast<uint8_t*>(tmpbuf.data()) + tmpSize,
-            static_cast<uint8_t*>(data));
+        sample::transposeSubBuffer(data, height, width, DataType::kFLOAT);
     }
     catch (...)
     {
@@ -210,7 +210,8 @@ bool SampleDynamicReshape::buildPreprocessorEngine(const SampleUniquePtr<nvinfer
         MNISTBatchStream calibrationStream(
             calibBatchSize, nCalibBatches, "train-images-idx3-ubyte", "train-labels-idx1-ubyte", mParams.dataDirs);
         calibrator.reset(
-            new Int8EntropyCalibrator2<MNISTBatchStream>(calibrationStream, 0, "MNISTPreprocessor", "input"));
+            new Int8EntropyCalibrator2<MNISTBatchStream>(
+                calibrationStream, 0, "MNISTPreprocessor", "input", true, mParams.calibPrefetch));
         preprocessorConfig->setInt8Calibrator(calibrator.get());
     }
 
@@ -334,7 +335,8 @@ bool SampleDynamicReshape::buildPredictionEngine(const SampleUniquePtr<nvinfer1:
         MNISTBatchStream calibrationStream(
             calibBatchSize, nCalibBatches, "train-images-idx3-ubyte", "train-labels-idx1-ubyte", mParams.dataDirs);
         calibrator.reset(
-            new Int8EntropyCalibrator2<MNISTBatchStream>(calibrationStream, 0, "MNISTPrediction", inputName));
+            new Int8EntropyCalibrator2<MNISTBatchStream>(
+                calibrationStream, 0, "MNISTPrediction", inputName, true, mParams.calibPrefetch));
         config->setInt8Calibrator(calibrator.get());
     }
     // Build the prediciton engine.
@@ -537,6 +539,7 @@ samplesCommon::OnnxSampleParams initializeSampleParams(const samplesCommon::Args
     params.fp16 = args.runInFp16;
     params.bf16 = args.runInBf16;
     params.timingCacheFile = args.timingCacheFile;
+    params.calibPrefetch = args.calibPrefetch;
     return params;
 }
 
@@ -546,7 +549,7 @@ samplesCommon::OnnxSampleParams initializeSampleParams(const samplesCommon::Args
 void printHelpInfo()
 {
     std::cout << "Usage: ./sample_dynamic_reshape [-h or --help] [-d or --datadir=<path to data directory>] "
-                 "[--timingCacheFile=<path to timing cache file>]"
+                 "[--timingCacheFile=<path to timing cache file>] [--calibPrefetch=<N>]"
               << std::endl;
     std::cout << "--help, -h         Display help information" << std::endl;
     std::cout << "--datadir          Specify path to a data directory, overriding the default. This option can be used "
@@ -558,6 +561,9 @@ void printHelpInfo()
     std::cout << "--int8             Run in Int8 mode." << std::endl;
     std::cout << "--fp16             Run in FP16 mode." << std::endl;
     std::cout << "--bf16             Run in BF16 mode." << std::endl;
+    std::cout << "--calibPrefetch    Load this many INT8 calibration batches ahead in pinned memory (default = 0, "
+                 "disabled)."
+              << std::endl;
 }
 
 int main(int argc, char** argv)
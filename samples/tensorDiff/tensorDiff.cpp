@@ -0,0 +1,585 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 1993-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//! \file tensorDiff.cpp
+//!
+//! \brief Compares two debug tensor dumps layer by layer.
+//!
+//! A dump is either a directory of .npy files written by trtexec --saveAllDebugTensors=numpy[,summary], or a
+//! container written with --saveAllDebugTensors=container. Tensors are matched by name and compared in the order
+//! of the reference dump, which is the execution order of the engine. For each pair, the tool reports the maximum
+//! absolute and relative errors, the mean absolute error, the cosine similarity and the distance in float32 ULPs,
+//! and it reports the first tensor that exceeds the thresholds.
+//!
+//! It can be run with the following command line:
+//! Command: ./tensor_diff --ref=<fp32 dump> --test=<fp16 dump> [--atol=1e-3] [--rtol=1e-3] [--minCosine=0.999]
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "debugTensorReader.h"
+#include "getOptions.h"
+#include "half.h"
+#include "logger.h"
+#include "sampleUtils.h"
+
+namespace
+{
+
+std::string const kSAMPLE_NAME = "TensorRT.tensor_diff";
+
+//! Elements converted and compared at a time.
+constexpr int64_t kCHUNK{4096};
+
+//! Minimum number of chunks per thread.
+constexpr int64_t kMIN_CHUNKS_PER_THREAD{64};
+
+struct DiffOptions
+{
+    std::string reference;
+    std::string test;
+    double atol{1e-3};
+    double rtol{1e-3};
+    double minCosine{0.999};
+    int32_t iteration{0};
+    int32_t nbThreads{0};
+    bool stopAtFirst{false};
+};
+
+enum class ElementType
+{
+    kFLOAT,
+    kHALF,
+    kBF16,
+    kINT8,
+    kUINT8,
+    kINT32,
+    kINT64,
+    kBOOL,
+    kUNSUPPORTED
+};
+
+ElementType fromNumpyDescr(std::string const& descr)
+{
+    static std::unordered_map<std::string, ElementType> const kTYPES{{"<f4", ElementType::kFLOAT},
+        {"<f2", ElementType::kHALF}, {"<i1", ElementType::kINT8}, {"|i1", ElementType::kINT8},
+        {"|u1", ElementType::kUINT8}, {"<i4", ElementType::kINT32}, {"<i8", ElementType::kINT64},
+        {"|b1", ElementType::kBOOL}};
+    auto it = kTYPES.find(descr);
+    return it == kTYPES.end() ? ElementType::kUNSUPPORTED : it->second;
+}
+
+ElementType fromContainerType(std::string const& type)
+{
+    static std::unordered_map<std::string, ElementType> const kTYPES{{"FLOAT", ElementType::kFLOAT},
+        {"HALF", ElementType::kHALF}, {"BF16", ElementType::kBF16}, {"INT8", ElementType::kINT8},
+        {"UINT8", ElementType::kUINT8}, {"INT32", ElementType::kINT32}, {"INT64", ElementType::kINT64},
+        {"BOOL", ElementType::kBOOL}};
+    auto it = kTYPES.find(type);
+    return it == kTYPES.end() ? ElementType::kUNSUPPORTED : it->second;
+}
+
+//! Return the size in bytes of an element, or 0 for unsupported types.
+size_t getElementSize(ElementType type)
+{
+    switch (type)
+    {
+    case ElementType::kFLOAT:
+    case ElementType::kINT32: return 4;
+    case ElementType::kHALF:
+    case ElementType::kBF16: return 2;
+    case ElementType::kINT8:
+    case ElementType::kUINT8:
+    case ElementType::kBOOL: return 1;
+    case ElementType::kINT64: return 8;
+    case ElementType::kUNSUPPORTED: return 0;
+    }
+    return 0;
+}
+
+//! A tensor of a dump, kept mapped while it is compared.
+struct TensorView
+{
+    ElementType type{ElementType::kUNSUPPORTED};
+    std::string typeName;
+    std::vector<int64_t> shape;
+    int64_t volume{0};
+    void const* data{nullptr};
+    sample::MappedFile file; //!< Backing file of .npy dumps
+};
+
+//!
+//! \brief The tensors of one dump, in dump order.
+//!
+class DumpSet
+{
+public:
+    bool open(std::string const& path, int32_t iteration, std::string& err)
+    {
+        namespace fs = std::filesystem;
+        std::string containerPath = path;
+        if (fs::is_directory(path))
+        {
+            containerPath = (fs::path(path) / sample::kDEBUG_TENSOR_CONTAINER_FILE_NAME).string();
+        }
+        if (fs::is_regular_file(containerPath))
+        {
+            mContainer = std::make_unique<sample::DebugTensorContainer>();
+            if (!mContainer->open(containerPath, err))
+            {
+                return false;
+            }
+            for (auto const& tensor : mContainer->tensors())
+            {
+                if (tensor.iteration == iteration)
+                {
+                    addTensor(tensor.name);
+                }
+            }
+            mIteration = iteration;
+            if (mNames.empty())
+            {
+                err = "no tensors of iteration " + std::to_string(iteration) + " found in " + containerPath;
+                return false;
+            }
+            return true;
+        }
+
+        // In a directory of .npy files, the iteration-th file of a name is its iteration-th dump.
+        std::unordered_map<std::string, int32_t> seen;
+        for (auto const& file : sample::listDumpedNumpyFiles(path))
+        {
+            if (seen[file.name]++ == iteration)
+            {
+                addTensor(file.name);
+                mNumpyPaths[file.name] = file.path;
+            }
+        }
+        if (mNames.empty())
+        {
+            err = "no tensors of iteration " + std::to_string(iteration) + " found in " + path;
+            return false;
+        }
+        return true;
+    }
+
+    std::vector<std::string> const& names() const
+    {
+        return mNames;
+    }
+
+    bool contains(std::string const& name) const
+    {
+        return mIndices.count(name) != 0;
+    }
+
+    bool load(std::string const& name, TensorView& view, std::string& err) const
+    {
+        if (mContainer)
+        {
+            auto const* tensor = mContainer->find(name, mIteration);
+            if (tensor == nullptr)
+            {
+                err = "no tensor " + name + " of iteration " + std::to_string(mIteration);
+                return false;
+            }
+            view.type = fromContainerType(tensor->type);
+            view.typeName = tensor->type;
+            view.shape = tensor->shape;
+            view.volume = 1;
+            for (auto const d : view.shape)
+            {
+                view.volume *= d;
+            }
+            // The container checks payload sizes when it is opened; check again before the payload is read.
+            size_t const elementSize = getElementSize(view.type);
+            if (elementSize > 0 && static_cast<uint64_t>(view.volume) * elementSize != tensor->size)
+            {
+                err = "payload of " + name + " has " + std::to_string(tensor->size) + " bytes, expected "
+                    + std::to_string(view.volume * elementSize);
+                return false;
+            }
+            view.data = mContainer->data(*tensor);
+            return true;
+        }
+
+        auto const& path = mNumpyPaths.at(name);
+        view.file = sample::MappedFile(path);
+        sample::NpyView npy;
+        if (!view.file.isOpen() || !sample::parseNpy(view.file.data(), view.file.size(), npy, err))
+        {
+            err = "cannot read " + path + (err.empty() ? "" : ": " + err);
+            return false;
+        }
+        view.type = fromNumpyDescr(npy.descr);
+        view.typeName = npy.descr;
+        view.shape = npy.shape;
+        view.volume = npy.volume;
+        view.data = npy.data;
+        return true;
+    }
+
+private:
+    void addTensor(std::string const& name)
+    {
+        if (mIndices.emplace(name, mNames.size()).second)
+        {
+            mNames.push_back(name);
+        }
+    }
+
+    std::vector<std::string> mNames;
+    std::unordered_map<std::string, size_t> mIndices;
+    std::unordered_map<std::string, std::string> mNumpyPaths;
+    std::unique_ptr<sample::DebugTensorContainer> mContainer;
+    int32_t mIteration{0};
+};
+
+//! Convert elements [begin, begin + n) of a tensor to float.
+void convertToFloat(TensorView const& view, int64_t begin, int64_t n, float* dst)
+{
+    auto convert = [&](auto const* src) {
+        for (int64_t i = 0; i < n; ++i)
+        {
+            dst[i] = static_cast<float>(src[begin + i]);
+        }
+    };
+    switch (view.type)
+    {
+    case ElementType::kFLOAT: std::memcpy(dst, static_cast<float const*>(view.data) + begin, n * sizeof(float)); break;
+    case ElementType::kHALF: convert(static_cast<half_float::half const*>(view.data)); break;
+    case ElementType::kBF16:
+    {
+        auto const* src = static_cast<uint16_t const*>(view.data) + begin;
+        for (int64_t i = 0; i < n; ++i)
+        {
+            uint32_t const bits = static_cast<uint32_t>(src[i]) << 16;
+            std::memcpy(dst + i, &bits, sizeof(float));
+        }
+        break;
+    }
+    case ElementType::kINT8: convert(static_cast<int8_t const*>(view.data)); break;
+    case ElementType::kUINT8: convert(static_cast<uint8_t const*>(view.data)); break;
+    case ElementType::kINT32: convert(static_cast<int32_t const*>(view.data)); break;
+    case ElementType::kINT64: convert(static_cast<int64_t const*>(view.data)); break;
+    case ElementType::kBOOL: convert(static_cast<bool const*>(view.data)); break;
+    case ElementType::kUNSUPPORTED: break;
+    }
+}
+
+//! Map a float to an integer such that the difference of two mapped values is their distance in ULPs.
+int64_t toOrderedInt(float value)
+{
+    int32_t bits{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits < 0 ? static_cast<int64_t>(std::numeric_limits<int32_t>::min()) - bits : bits;
+}
+
+struct DiffStats
+{
+    double maxAbs{0.0};
+    double maxRel{0.0};
+    double sumAbs{0.0};
+    double dot{0.0};
+    double refNorm2{0.0};
+    double testNorm2{0.0};
+    int64_t maxUlp{0};
+    double sumUlp{0.0};
+    int64_t nbFinite{0};     //!< Elements finite in both tensors
+    int64_t nbMismatched{0}; //!< Elements outside atol + rtol * |ref|, including NaN and infinity mismatches
+    int64_t nbNaNMismatch{0};
+
+    void merge(DiffStats const& other)
+    {
+        maxAbs = std::max(maxAbs, other.maxAbs);
+        maxRel = std::max(maxRel, other.maxRel);
+        sumAbs += other.sumAbs;
+        dot += other.dot;
+        refNorm2 += other.refNorm2;
+        testNorm2 += other.testNorm2;
+        maxUlp = std::max(maxUlp, other.maxUlp);
+        sumUlp += other.sumUlp;
+        nbFinite += other.nbFinite;
+        nbMismatched += other.nbMismatched;
+        nbNaNMismatch += other.nbNaNMismatch;
+    }
+
+    double cosine() const
+    {
+        if (refNorm2 == 0.0 || testNorm2 == 0.0)
+        {
+            return refNorm2 == testNorm2 ? 1.0 : 0.0;
+        }
+        return dot / std::sqrt(refNorm2 * testNorm2);
+    }
+};
+
+void accumulateDiff(float const* ref, float const* test, int64_t n, DiffOptions const& options, DiffStats& stats)
+{
+    for (int64_t i = 0; i < n; ++i)
+    {
+        float const r = ref[i];
+        float const t = test[i];
+        if (!std::isfinite(r) || !std::isfinite(t))
+        {
+            // Identical infinities match; anything else involving NaN or infinity is a mismatch.
+            bool const same = r == t;
+            stats.nbMismatched += same ? 0 : 1;
+            stats.nbNaNMismatch += std::isnan(r) != std::isnan(t) ? 1 : 0;
+            continue;
+        }
+        double const diff = std::fabs(static_cast<double>(r) - static_cast<double>(t));
+        double const absRef = std::fabs(static_cast<double>(r));
+        stats.maxAbs = std::max(stats.maxAbs, diff);
+        if (absRef > 0.0)
+        {
+            stats.maxRel = std::max(stats.maxRel, diff / absRef);
+        }
+        stats.sumAbs += diff;
+        stats.dot += static_cast<double>(r) * t;
+        stats.refNorm2 += static_cast<double>(r) * r;
+        stats.testNorm2 += static_cast<double>(t) * t;
+        int64_t const ulp = std::abs(toOrderedInt(r) - toOrderedInt(t));
+        stats.maxUlp = std::max(stats.maxUlp, ulp);
+        stats.sumUlp += static_cast<double>(ulp);
+        stats.nbMismatched += diff > options.atol + options.rtol * absRef ? 1 : 0;
+        ++stats.nbFinite;
+    }
+}
+
+DiffStats compareTensors(TensorView const& ref, TensorView const& test, DiffOptions const& options)
+{
+    int64_t const nbChunks = (ref.volume + kCHUNK - 1) / kCHUNK;
+    std::vector<DiffStats> partials(nbChunks);
+    sample::parallelFor(nbChunks, kMIN_CHUNKS_PER_THREAD, options.nbThreads, [&](int64_t chunkBegin, int64_t chunkEnd) {
+        std::vector<float> refValues(kCHUNK);
+        std::vector<float> testValues(kCHUNK);
+        for (int64_t c = chunkBegin; c < chunkEnd; ++c)
+        {
+            int64_t const begin = c * kCHUNK;
+            int64_t const n = std::min(kCHUNK, ref.volume - begin);
+            convertToFloat(ref, begin, n, refValues.data());
+            convertToFloat(test, begin, n, testValues.data());
+            accumulateDiff(refValues.data(), testValues.data(), n, options, partials[c]);
+        }
+    });
+
+    // Merge in chunk order so that the result does not depend on the number of threads.
+    DiffStats stats;
+    for (auto const& p : partials)
+    {
+        stats.merge(p);
+    }
+    return stats;
+}
+
+std::string shapeToString(std::vector<int64_t> const& shape)
+{
+    std::string s = "(";
+    for (size_t i = 0; i < shape.size(); ++i)
+    {
+        s += (i > 0 ? "x" : "") + std::to_string(shape[i]);
+    }
+    return s + ")";
+}
+
+void printHelp()
+{
+    std::cout << "Usage: ./tensor_diff --ref=<dump> --test=<dump> [options]" << std::endl
+              << "  --ref=<dump>         Reference dump: a directory of .npy files, a directory with a debug tensor "
+                 "container, or a container data file"
+              << std::endl
+              << "  --test=<dump>        Dump to compare against the reference" << std::endl
+              << "  --atol=<value>       Absolute tolerance of an element (default = 1e-3)" << std::endl
+              << "  --rtol=<value>       Tolerance relative to the reference element (default = 1e-3)" << std::endl
+              << "  --minCosine=<value>  Minimum cosine similarity of a tensor (default = 0.999)" << std::endl
+              << "  --iteration=<N>      Compare the N-th dump of each tensor (default = 0)" << std::endl
+              << "  --threads=<N>        Number of worker threads (default = number of hardware threads)" << std::endl
+              << "  --stopAtFirst        Stop at the first tensor exceeding the thresholds" << std::endl
+              << "  --help, -h           Print this message" << std::endl;
+}
+
+bool parseOptions(int32_t argc, char** argv, DiffOptions& options)
+{
+    using nvinfer1::utility::TRTOption;
+    std::vector<TRTOption> const spec{{0, "ref", true, ""}, {0, "test", true, ""}, {0, "atol", true, ""},
+        {0, "rtol", true, ""}, {0, "minCosine", true, ""}, {0, "iteration", true, ""}, {0, "threads", true, ""},
+        {0, "stopAtFirst", false, ""}, {'h', "help", false, ""}};
+    auto const args = nvinfer1::utility::getOptions(argc, argv, spec);
+    if (!args.errMsg.empty())
+    {
+        sample::gLogError << args.errMsg << std::endl;
+        return false;
+    }
+    auto const& values = args.values;
+    if (values[8].first > 0)
+    {
+        printHelp();
+        exit(EXIT_SUCCESS);
+    }
+
+    auto lastValue = [&](size_t i, std::string const& fallback) {
+        return values[i].second.empty() ? fallback : values[i].second.back();
+    };
+    try
+    {
+        options.reference = lastValue(0, "");
+        options.test = lastValue(1, "");
+        options.atol = std::stod(lastValue(2, std::to_string(options.atol)));
+        options.rtol = std::stod(lastValue(3, std::to_string(options.rtol)));
+        options.minCosine = std::stod(lastValue(4, std::to_string(options.minCosine)));
+        options.iteration = std::stoi(lastValue(5, std::to_string(options.iteration)));
+        options.nbThreads = std::stoi(lastValue(6, std::to_string(options.nbThreads)));
+        options.stopAtFirst = values[7].first > 0;
+    }
+    catch (std::exception const& e)
+    {
+        sample::gLogError << "Invalid option value: " << e.what() << std::endl;
+        return false;
+    }
+
+    if (options.reference.empty() || options.test.empty() || options.iteration < 0)
+    {
+        sample::gLogError << "Invalid arguments." << std::endl;
+        printHelp();
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int32_t main(int32_t argc, char** argv)
+{
+    auto sampleTest = sample::gLogger.defineTest(kSAMPLE_NAME, argc, argv);
+    sample::gLogger.reportTestStart(sampleTest);
+
+    DiffOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return sample::gLogger.reportFail(sampleTest);
+    }
+
+    DumpSet ref;
+    DumpSet test;
+    std::string err;
+    if (!ref.open(options.reference, options.iteration, err) || !test.open(options.test, options.iteration, err))
+    {
+        sample::gLogError << err << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+
+    sample::gLogInfo << std::left << std::setw(6) << "#" << std::setw(12) << "max abs" << std::setw(12) << "max rel"
+                     << std::setw(12) << "mean abs" << std::setw(12) << "cosine" << std::setw(12) << "max ulp"
+                     << std::setw(12) << "mean ulp" << std::setw(12) << "mismatched" << "tensor" << std::endl;
+
+    std::string firstFailure;
+    int32_t nbCompared{0};
+    int32_t nbFailed{0};
+    for (size_t i = 0; i < ref.names().size(); ++i)
+    {
+        auto const& name = ref.names()[i];
+        if (!test.contains(name))
+        {
+            sample::gLogVerbose << "Tensor '" << name << "' is not in the test dump." << std::endl;
+            continue;
+        }
+
+        TensorView refView;
+        TensorView testView;
+        bool const loaded = ref.load(name, refView, err) && test.load(name, testView, err);
+        if (loaded && (refView.type == ElementType::kUNSUPPORTED || testView.type == ElementType::kUNSUPPORTED))
+        {
+            sample::gLogWarning << "Skipping tensor '" << name << "' of unsupported type " << refView.typeName << " / "
+                                << testView.typeName << "." << std::endl;
+            continue;
+        }
+
+        ++nbCompared;
+        std::string failure;
+        // A tensor that cannot be read fails the comparison, like one that differs.
+        if (!loaded)
+        {
+            failure = err;
+            sample::gLogInfo << std::left << std::setw(6) << i << failure << "  " << name << std::endl;
+        }
+        else if (refView.volume != testView.volume)
+        {
+            failure = "shape mismatch " + shapeToString(refView.shape) + " vs " + shapeToString(testView.shape);
+            sample::gLogInfo << std::left << std::setw(6) << i << failure << "  " << name << std::endl;
+        }
+        else
+        {
+            DiffStats const stats = compareTensors(refView, testView, options);
+            double const cosine = stats.cosine();
+            double const nbFinite = std::max(stats.nbFinite, int64_t{1});
+            sample::gLogInfo << std::left << std::setw(6) << i << std::setprecision(4) << std::setw(12)
+                             << stats.maxAbs << std::setw(12) << stats.maxRel << std::setw(12)
+                             << stats.sumAbs / nbFinite << std::setprecision(6) << std::setw(12) << cosine
+                             << std::setw(12) << stats.maxUlp << std::setprecision(4) << std::setw(12)
+                             << stats.sumUlp / nbFinite << std::setw(12) << stats.nbMismatched << name << std::endl;
+            if (stats.nbMismatched > 0)
+            {
+                failure = std::to_string(stats.nbMismatched) + " of " + std::to_string(refView.volume)
+                    + " elements outside atol + rtol * |ref|";
+                if (stats.nbNaNMismatch > 0)
+                {
+                    failure += ", " + std::to_string(stats.nbNaNMismatch) + " NaN mismatches";
+                }
+            }
+            else if (cosine < options.minCosine)
+            {
+                failure = "cosine similarity " + std::to_string(cosine) + " below " + std::to_string(options.minCosine);
+            }
+        }
+
+        if (!failure.empty())
+        {
+            ++nbFailed;
+            if (firstFailure.empty())
+            {
+                firstFailure = "'" + name + "' (#" + std::to_string(i) + "): " + failure;
+                if (options.stopAtFirst)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    sample::gLogInfo << "Compared " << nbCompared << " tensors, " << nbFailed << " exceed the thresholds." << std::endl;
+    if (nbCompared == 0)
+    {
+        sample::gLogError << "No tensors in common between the dumps." << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+    if (!firstFailure.empty())
+    {
+        sample::gLogError << "First tensor exceeding the thresholds: " << firstFailure << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+    return sample::gLogger.reportPass(sampleTest);
+}
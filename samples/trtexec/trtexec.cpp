@@ -16,25 +16,36 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <chrono>
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sys/stat.h>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "NvInfer.h"
 #include "NvInferPlugin.h"
 
+#include "asyncLogger.h"
 #include "buffers.h"
+#include "cachingAllocator.h"
+#include "pinnedHostPool.h"
 #include "common.h"
 #include "logger.h"
 #include "sampleDevice.h"
 #include "sampleEngines.h"
 #include "sampleInference.h"
 #include "sampleOptions.h"
+#include "samplePhases.h"
 #include "sampleReporting.h"
 
 using namespace nvinfer1;
@@ -102,6 +113,7 @@ bool initLibrary(LibraryPtr& libPtr, std::string const& libName, FetchPtrs fetch
     }
     try
     {
+        ScopedPhase const phase("Load library " + libName);
         libPtr.reset(new DynamicLibrary{libName});
         fetchFunc(libPtr.get());
     }
@@ -212,17 +224,185 @@ nvonnxparser::IParser* createONNXParser(INetworkDefinition& network)
 using time_point = std::chrono::time_point<std::chrono::high_resolution_clock>;
 using duration = std::chrono::duration<float>;
 
-int main(int argc, char** argv)
+namespace
+{
+
+std::string const kSAMPLE_NAME = "TensorRT.trtexec";
+
+//!
+//! \brief State shared by the trtexec runs of the process, so that batch jobs load each library only once.
+//!
+struct SharedRunState
+{
+    ~SharedRunState()
+    {
+        for (auto const& allocator : gpuAllocators)
+        {
+            setDeviceBufferAllocator(allocator.first, nullptr);
+        }
+        if (hostPool)
+        {
+            setHostBufferPool(nullptr);
+        }
+    }
+
+    std::mutex mutex;
+    //! Set when the batch applied the process-wide options of its concurrent jobs once, before starting them.
+    bool processOptionsApplied{false};
+    bool runtimeSelected{false};
+    bool standardPluginsLoaded{false};
+#if !TRT_STATIC
+    LibraryPtr nvinferPluginLib{};
+#endif /* TRT_STATIC */
+    std::unordered_map<std::string, LibraryPtr> pluginLibs;
+    // The pools are declared after the libraries, so that their memory is released before the libraries are unloaded.
+    std::map<int32_t, std::unique_ptr<CachingGpuAllocator>> gpuAllocators; //!< By device
+    std::unique_ptr<PinnedHostPool> hostPool;
+};
+
+//!
+//! \brief Outcome of one trtexec run, collected in batch job mode.
+//!
+struct RunResult
+{
+    bool passed{false};
+    float walltimeMs{0.F};
+    bool hasPerformance{false};
+    PerformanceSummary performance;
+    std::vector<float> percentiles;
+};
+
+//!
+//! \brief One line of a job file.
+//!
+struct BatchJob
+{
+    int32_t line{0};
+    std::vector<std::string> arguments;
+};
+
+//! Write the recorded phases when going out of scope, after the phases of the run have ended.
+struct PhaseExport
+{
+    std::string fileName;
+
+    ~PhaseExport()
+    {
+        if (!fileName.empty())
+        {
+            sample::gLogVerbose << std::endl;
+            printPhases(sample::gLogVerbose);
+            exportPhases(fileName);
+        }
+    }
+};
+
+//! The runtime library is selected through a global, so all the runs of a process must use the same one.
+bool selectRuntime(SharedRunState& state, RuntimeMode mode)
+{
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.runtimeSelected && gUseRuntime != mode)
+    {
+        sample::gLogError << "All the jobs of a batch must use the same --useRuntime." << std::endl;
+        return false;
+    }
+    gUseRuntime = mode;
+    state.runtimeSelected = true;
+    return true;
+}
+
+//! Return the caching allocator shared by the runs on the device, serving the device buffers of trtexec as well.
+CachingGpuAllocator* getCachingAllocator(SharedRunState& state, int32_t device)
 {
-    std::string const sampleName = "TensorRT.trtexec";
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto& allocator = state.gpuAllocators[device];
+    if (!allocator)
+    {
+        allocator.reset(new CachingGpuAllocator(createCudaMemoryBackend()));
+    }
+    setDeviceBufferAllocator(device, allocator.get());
+    return allocator.get();
+}
+
+//! Return the pinned pool shared by the runs, serving the host buffers of the bindings. The first run sets the slabs.
+PinnedHostPool* getPinnedPool(SharedRunState& state, int32_t slabMiB)
+{
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.hostPool)
+    {
+        state.hostPool.reset(new PinnedHostPool(createCudaPinnedBackend(), static_cast<size_t>(slabMiB) << 20));
+    }
+    setHostBufferPool(state.hostPool.get());
+    return state.hostPool.get();
+}
 
-    auto sampleTest = sample::gLogger.defineTest(sampleName, argc, argv);
+//!
+//! \brief Stop serving the device and host buffers from the caching allocators and the pinned pool when a run ends,
+//! so that a later run without --cachingAllocator or --pinnedPool uses cudaMalloc and cudaMallocHost.
+//!
+//! Concurrent runs share the allocators and the pool until the batch ends. Declared before the environments of the
+//! run, so that their buffers are released before.
+//!
+struct BufferAllocatorReset
+{
+    SharedRunState& state;
+
+    ~BufferAllocatorReset()
+    {
+        if (state.processOptionsApplied)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(state.mutex);
+        for (auto const& allocator : state.gpuAllocators)
+        {
+            setDeviceBufferAllocator(allocator.first, nullptr);
+        }
+        setHostBufferPool(nullptr);
+    }
+};
 
+//! Load the standard plugins and the given plugin libraries unless an earlier run already loaded them.
+void loadPlugins(SharedRunState& state, std::vector<std::string> const& plugins)
+{
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (!state.standardPluginsLoaded)
+    {
+        ScopedPhase const phase("Load standard plugins");
+        sample::gLogInfo << "Loading standard plugins" << std::endl;
+#if !TRT_STATIC
+        state.nvinferPluginLib = loadLibrary(kNVINFER_PLUGIN_LIBNAME);
+        auto pInitLibNvinferPlugins
+            = state.nvinferPluginLib->symbolAddress<bool(void*, char const*)>("initLibNvInferPlugins");
+#else /* TRT_STATIC */
+        auto pInitLibNvinferPlugins = initLibNvInferPlugins;
+#endif /* TRT_STATIC */
+        ASSERT(pInitLibNvinferPlugins != nullptr);
+        pInitLibNvinferPlugins(&sample::gLogger.getTRTLogger(), "");
+        state.standardPluginsLoaded = true;
+    }
+    for (auto const& pluginPath : plugins)
+    {
+        if (state.pluginLibs.find(pluginPath) == state.pluginLibs.end())
+        {
+            ScopedPhase const phase("Load plugin library " + pluginPath);
+            sample::gLogInfo << "Loading supplied plugin library: " << pluginPath << std::endl;
+            state.pluginLibs.emplace(pluginPath, loadLibrary(pluginPath));
+        }
+    }
+}
+
+//!
+//! \brief Parse the arguments and run trtexec once, reporting the result under the given test.
+//!
+//! \param result If not null, receives the performance summary of the run.
+//!
+int32_t runTrtexec(Arguments& args, sample::Logger::TestAtom& sampleTest, SharedRunState& state, RunResult* result)
+{
     try
     {
         sample::gLogger.reportTestStart(sampleTest);
 
-        Arguments args = argsToArgumentsMap(argc, argv);
         AllOptions options;
 
         if (parseHelp(args))
@@ -272,39 +452,42 @@ int main(int argc, char** argv)
         }
 
         sample::gLogInfo << options;
-        if (options.reporting.verbose)
+        // Concurrent batch jobs share the logger, which runBatchJobs() configured before starting them. A sequential
+        // batch job does not inherit the verbosity of the previous one.
+        if (!state.processOptionsApplied && (options.reporting.verbose || result != nullptr))
         {
-            sample::setReportableSeverity(ILogger::Severity::kVERBOSE);
+            sample::setReportableSeverity(
+                options.reporting.verbose ? ILogger::Severity::kVERBOSE : ILogger::Severity::kINFO);
+        }
+        if (options.reporting.asyncLogging && !state.processOptionsApplied)
+        {
+            // Batch jobs share the logger, so only the first job requesting asynchronous logging starts it.
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (!sample::isAsyncLoggingEnabled())
+            {
+                sample::startAsyncLogging({options.reporting.logQueueDepth, options.reporting.dropLogs});
+            }
         }
         std::string const jitInVersion;
         setCudaDevice(options.system.device, sample::gLogInfo);
+        if (!options.reporting.exportPhases.empty())
+        {
+            enablePhaseRecording();
+        }
+        PhaseExport const phaseExport{options.reporting.exportPhases};
+        ScopedPhase const runPhase("trtexec");
         sample::gLogInfo << std::endl;
         sample::gLogInfo << "TensorRT version: " << NV_TENSORRT_MAJOR << "." << NV_TENSORRT_MINOR << "."
                          << NV_TENSORRT_PATCH << jitInVersion << std::endl;
 
         // Record specified runtime
-        gUseRuntime = options.build.useRuntime;
-#if !TRT_STATIC
-        LibraryPtr nvinferPluginLib{};
-#endif /* TRT_STATIC */
-        std::vector<LibraryPtr> pluginLibs;
+        if (!selectRuntime(state, options.build.useRuntime))
+        {
+            return sample::gLogger.reportFail(sampleTest);
+        }
         if (gUseRuntime == RuntimeMode::kFULL)
         {
-            sample::gLogInfo << "Loading standard plugins" << std::endl;
-#if !TRT_STATIC
-            nvinferPluginLib = loadLibrary(kNVINFER_PLUGIN_LIBNAME);
-            auto pInitLibNvinferPlugins
-                = nvinferPluginLib->symbolAddress<bool(void*, char const*)>("initLibNvInferPlugins");
-#else /* TRT_STATIC */
-            auto pInitLibNvinferPlugins = initLibNvInferPlugins;
-#endif /* TRT_STATIC */
-            ASSERT(pInitLibNvinferPlugins != nullptr);
-            pInitLibNvinferPlugins(&sample::gLogger.getTRTLogger(), "");
-            for (auto const& pluginPath : options.system.plugins)
-            {
-                sample::gLogInfo << "Loading supplied plugin library: " << pluginPath << std::endl;
-                pluginLibs.emplace_back(loadLibrary(pluginPath));
-            }
+            loadPlugins(state, options.system.plugins);
         }
         else if (!options.system.plugins.empty())
         {
@@ -315,6 +498,7 @@ int main(int argc, char** argv)
             sample::gLogError << "Safety is not supported because safety runtime library is unavailable." << std::endl;
             return sample::gLogger.reportFail(sampleTest);
         }
+        BufferAllocatorReset const allocatorReset{state};
         // Start engine building phase.
         std::unique_ptr<BuildEnvironment> bEnv(new BuildEnvironment(options.build.safe, options.build.versionCompatible,
             options.system.DLACore, options.build.tempdir, options.build.tempfileControls, options.build.leanDLLPath,
@@ -337,6 +521,14 @@ int main(int argc, char** argv)
 
         // dynamicPlugins may have been updated by getEngineBuildEnv above
         bEnv->engine.setDynamicPlugins(options.system.dynamicPlugins);
+        if (options.inference.cachingAllocator)
+        {
+            bEnv->engine.setGpuAllocator(getCachingAllocator(state, options.system.device));
+        }
+        if (options.inference.pinnedPoolMiB > 0)
+        {
+            getPinnedPool(state, options.inference.pinnedPoolMiB);
+        }
        // When some options are enabled, engine deserialization is not supported on the platform that the engine was
        // built.
         bool const supportDeserialization = !options.build.safe && !options.build.buildDLAStandalone
@@ -469,6 +661,12 @@ int main(int argc, char** argv)
         {
             printPerformanceReport(trace, options.reporting, options.inference, sample::gLogInfo, sample::gLogWarning,
                 sample::gLogVerbose);
+            if (result != nullptr)
+            {
+                result->performance = getPerformanceSummary(trace, options.reporting, options.inference);
+                result->percentiles = options.reporting.percentiles;
+                result->hasPerformance = true;
+            }
         }
 
         printOutput(options.reporting, *iEnv, options.inference.batch);
@@ -494,6 +692,32 @@ int main(int argc, char** argv)
             }
         }
         printPerformanceProfile(options.reporting, *iEnv);
+        if (!options.inference.poolShapes.empty() && !runContextPoolBenchmark(options.inference, *iEnv))
+        {
+            sample::gLogError << "Error occurred during the context pool benchmark" << std::endl;
+            return sample::gLogger.reportFail(sampleTest);
+        }
+        if (iEnv->outputBufferPool)
+        {
+            auto const outputStats = iEnv->outputBufferPool->getStats();
+            if (outputStats.nbReallocations > 0)
+            {
+                sample::gLogInfo << "Data-dependent outputs: " << outputStats.nbReallocations << " reallocations ("
+                                 << outputStats.nbShrinks << " shrinks), " << outputStats.nbPoolHits
+                                 << " buffers reused from the shared pool, " << outputStats.nbEvictions
+                                 << " evicted from it" << std::endl;
+            }
+        }
+        if (options.inference.cachingAllocator)
+        {
+            sample::gLogInfo << "Caching allocator: "
+                             << getCachingAllocator(state, options.system.device)->getStats() << std::endl;
+        }
+        if (options.inference.pinnedPoolMiB > 0)
+        {
+            auto const* pool = getPinnedPool(state, options.inference.pinnedPoolMiB);
+            sample::gLogInfo << "Pinned host pool: " << pool->getStats() << std::endl;
+        }
 
         return sample::gLogger.reportPass(sampleTest);
     }
@@ -503,3 +727,420 @@ int main(int argc, char** argv)
     }
     return sample::gLogger.reportFail(sampleTest);
 }
+
+//! Split a job line at whitespace, keeping the text between double quotes together.
+std::vector<std::string> splitJobLine(std::string const& line)
+{
+    std::vector<std::string> tokens;
+    std::string token;
+    bool inToken{false};
+    bool quoted{false};
+    for (char const c : line)
+    {
+        if (c == '"')
+        {
+            quoted = !quoted;
+            inToken = true;
+        }
+        else if (!quoted && std::isspace(static_cast<unsigned char>(c)))
+        {
+            if (inToken)
+            {
+                tokens.push_back(std::move(token));
+                token.clear();
+                inToken = false;
+            }
+        }
+        else
+        {
+            token.push_back(c);
+            inToken = true;
+        }
+    }
+    if (quoted)
+    {
+        throw std::invalid_argument("Unterminated quote in job: " + line);
+    }
+    if (inToken)
+    {
+        tokens.push_back(std::move(token));
+    }
+    return tokens;
+}
+
+std::vector<BatchJob> readJobFile(std::string const& fileName)
+{
+    std::ifstream file(fileName);
+    if (!file)
+    {
+        throw std::invalid_argument("Cannot open job file " + fileName);
+    }
+    std::vector<BatchJob> jobs;
+    std::string line;
+    for (int32_t lineNumber = 1; std::getline(file, line); ++lineNumber)
+    {
+        auto const first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#')
+        {
+            continue;
+        }
+        jobs.push_back({lineNumber, splitJobLine(line)});
+    }
+    return jobs;
+}
+
+//! Build the arguments of a job, adding the common arguments that the job does not set itself.
+Arguments getJobArguments(BatchJob const& job, Arguments const& commonArgs)
+{
+    std::vector<char*> argv{const_cast<char*>("trtexec")};
+    for (auto const& arg : job.arguments)
+    {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    Arguments jobArgs = argsToArgumentsMap(static_cast<int32_t>(argv.size()), argv.data());
+    Arguments const ownArgs = jobArgs;
+    for (auto const& arg : commonArgs)
+    {
+        // Options given several times in the common arguments are all kept.
+        if (ownArgs.find(arg.first) == ownArgs.end())
+        {
+            auto const position = arg.second.second + static_cast<int32_t>(argv.size());
+            jobArgs.emplace(arg.first, std::make_pair(arg.second.first, position));
+        }
+    }
+    return jobArgs;
+}
+
+std::string jsonEscape(std::string const& str)
+{
+    std::string escaped;
+    for (char const c : str)
+    {
+        switch (c)
+        {
+        case '"': escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n"; break;
+        case '\r': escaped += "\\r"; break;
+        case '\t': escaped += "\\t"; break;
+        default:
+            // JSON strings cannot hold the other control characters either.
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char code[7];
+                std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(c)));
+                escaped += code;
+            }
+            else
+            {
+                escaped.push_back(c);
+            }
+            break;
+        }
+    }
+    return escaped;
+}
+
+void exportPerformanceResult(std::ostream& os, PerformanceResult const& r, std::vector<float> const& percentiles)
+{
+    os << "{ \"min\" : " << r.min << ", \"max\" : " << r.max << ", \"mean\" : " << r.mean
+       << ", \"median\" : " << r.median;
+    for (size_t i = 0; i < percentiles.size() && i < r.percentiles.size(); ++i)
+    {
+        os << ", \"p" << percentiles[i] << "\" : " << r.percentiles[i];
+    }
+    os << " }";
+}
+
+//! Printed format:
+//! { "jobFile" : file, "jobThreads" : N, "walltimeMs" : time, "passed" : N, "failed" : N, "jobs" : [ job, ... ] }
+//! job ::= { "line" : N, "arguments" : string, "status" : "PASSED" | "FAILED", "walltimeMs" : time,
+//!           "throughputQps" : value, "latencyMs" : result, "gpuComputeMs" : result }
+//! result ::= { "min" : time, "max" : time, "mean" : time, "median" : time, "p<percentile>" : time, ... }
+//!
+void exportJobReport(BatchJobOptions const& batchOptions, std::vector<BatchJob> const& jobs,
+    std::vector<RunResult> const& results, float walltimeMs)
+{
+    std::ofstream os(batchOptions.exportJobReport, std::ofstream::trunc);
+    if (!os)
+    {
+        sample::gLogError << "Cannot open job report file " << batchOptions.exportJobReport << std::endl;
+        return;
+    }
+    auto const passed = std::count_if(results.begin(), results.end(), [](RunResult const& r) { return r.passed; });
+    os << "{" << std::endl;
+    os << "  \"jobFile\" : \"" << jsonEscape(batchOptions.jobFile) << "\"," << std::endl;
+    os << "  \"jobThreads\" : " << batchOptions.jobThreads << "," << std::endl;
+    os << "  \"walltimeMs\" : " << walltimeMs << "," << std::endl;
+    os << "  \"passed\" : " << passed << "," << std::endl;
+    os << "  \"failed\" : " << results.size() - passed << "," << std::endl;
+    os << "  \"jobs\" : [" << std::endl;
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        std::string arguments;
+        for (auto const& arg : jobs[i].arguments)
+        {
+            arguments += (arguments.empty() ? "" : " ") + arg;
+        }
+        auto const& r = results[i];
+        os << "    { \"line\" : " << jobs[i].line << ", \"arguments\" : \"" << jsonEscape(arguments)
+           << "\", \"status\" : \"" << (r.passed ? "PASSED" : "FAILED") << "\", \"walltimeMs\" : " << r.walltimeMs;
+        if (r.hasPerformance)
+        {
+            os << "," << std::endl << "      \"throughputQps\" : " << r.performance.throughput;
+            os << "," << std::endl << "      \"latencyMs\" : ";
+            exportPerformanceResult(os, r.performance.latency, r.percentiles);
+            os << "," << std::endl << "      \"gpuComputeMs\" : ";
+            exportPerformanceResult(os, r.performance.gpuCompute, r.percentiles);
+        }
+        os << " }" << (i + 1 < jobs.size() ? "," : "") << std::endl;
+    }
+    os << "  ]" << std::endl;
+    os << "}" << std::endl;
+}
+
+//!
+//! \brief Options of a job that configure state of the whole process: the logger, the runtime library, and the
+//! hooks through which trtexec allocates its device and host buffers.
+//!
+struct ProcessWideOptions
+{
+    bool verbose{false};
+    bool asyncLogging{false};
+    int32_t logQueueDepth{0};
+    bool dropLogs{false};
+    RuntimeMode useRuntime{RuntimeMode::kFULL};
+    bool cachingAllocator{false};
+    int32_t pinnedPoolMiB{0};
+
+    explicit ProcessWideOptions(AllOptions const& options)
+        : verbose(options.reporting.verbose)
+        , asyncLogging(options.reporting.asyncLogging)
+        , logQueueDepth(options.reporting.logQueueDepth)
+        , dropLogs(options.reporting.dropLogs)
+        , useRuntime(options.build.useRuntime)
+        , cachingAllocator(options.inference.cachingAllocator)
+        , pinnedPoolMiB(options.inference.pinnedPoolMiB)
+    {
+    }
+
+    //! \return The name of the first option differing from other, or an empty string if there is none.
+    std::string findDifference(ProcessWideOptions const& other) const
+    {
+        if (verbose != other.verbose)
+        {
+            return "--verbose";
+        }
+        if (asyncLogging != other.asyncLogging)
+        {
+            return "--asyncLogging";
+        }
+        if (asyncLogging && (logQueueDepth != other.logQueueDepth || dropLogs != other.dropLogs))
+        {
+            return "--logQueueDepth/--dropLogs";
+        }
+        if (useRuntime != other.useRuntime)
+        {
+            return "--useRuntime";
+        }
+        if (cachingAllocator != other.cachingAllocator)
+        {
+            return "--cachingAllocator";
+        }
+        if (pinnedPoolMiB != other.pinnedPoolMiB)
+        {
+            return "--pinnedPool";
+        }
+        return "";
+    }
+};
+
+//!
+//! \brief Check that concurrent jobs agree on the options that configure the whole process, and apply them once.
+//!
+//! Setting these options from several jobs at the same time would race, and a job would silently run with the logger
+//! or the allocation hooks of another. Jobs whose options cannot be parsed are skipped here; they fail when they run.
+//!
+bool applyProcessWideOptions(std::vector<BatchJob> const& jobs, Arguments const& commonArgs, SharedRunState& state)
+{
+    std::unique_ptr<ProcessWideOptions> first;
+    int32_t firstLine{0};
+    for (auto const& job : jobs)
+    {
+        AllOptions options;
+        try
+        {
+            Arguments jobArgs = getJobArguments(job, commonArgs);
+            options.parse(jobArgs);
+        }
+        catch (std::exception const&)
+        {
+            continue;
+        }
+        ProcessWideOptions const jobOptions(options);
+        if (!first)
+        {
+            first = std::make_unique<ProcessWideOptions>(jobOptions);
+            firstLine = job.line;
+            continue;
+        }
+        auto const difference = first->findDifference(jobOptions);
+        if (!difference.empty())
+        {
+            sample::gLogError << "The jobs at lines " << firstLine << " and " << job.line << " set " << difference
+                              << " differently. Concurrent jobs share the process, so they must agree on --verbose, "
+                                 "the logging options, --useRuntime, --cachingAllocator and --pinnedPool."
+                              << std::endl;
+            return false;
+        }
+    }
+    if (!first)
+    {
+        return true;
+    }
+
+    if (first->verbose)
+    {
+        sample::setReportableSeverity(ILogger::Severity::kVERBOSE);
+    }
+    if (first->asyncLogging)
+    {
+        sample::startAsyncLogging({first->logQueueDepth, first->dropLogs});
+    }
+    if (!selectRuntime(state, first->useRuntime))
+    {
+        return false;
+    }
+    // Installed before the jobs start, so that no job allocates its host buffers while another installs the pool.
+    if (first->pinnedPoolMiB > 0)
+    {
+        getPinnedPool(state, first->pinnedPoolMiB);
+    }
+    state.processOptionsApplied = true;
+    return true;
+}
+
+//!
+//! \brief Run every job of the job file, up to batchOptions.jobThreads at a time.
+//!
+//! Each job reports its own test result; the batch passes if all the jobs pass.
+//!
+int32_t runBatchJobs(BatchJobOptions const& batchOptions, Arguments& commonArgs,
+    sample::Logger::TestAtom& batchTest, SharedRunState& state)
+{
+    sample::gLogger.reportTestStart(batchTest);
+    if (parseHelp(commonArgs))
+    {
+        AllOptions::help(std::cout);
+        return EXIT_SUCCESS;
+    }
+
+    std::vector<BatchJob> jobs;
+    try
+    {
+        jobs = readJobFile(batchOptions.jobFile);
+    }
+    catch (std::invalid_argument const& arg)
+    {
+        sample::gLogError << arg.what() << std::endl;
+        return sample::gLogger.reportFail(batchTest);
+    }
+    if (jobs.empty())
+    {
+        sample::gLogError << "No job found in " << batchOptions.jobFile << std::endl;
+        return sample::gLogger.reportFail(batchTest);
+    }
+    sample::gLogInfo << "Running " << jobs.size() << " jobs from " << batchOptions.jobFile << " with "
+                     << batchOptions.jobThreads << " job threads" << std::endl;
+
+    size_t const nbThreads = std::min(static_cast<size_t>(batchOptions.jobThreads), jobs.size());
+    if (nbThreads > 1 && !applyProcessWideOptions(jobs, commonArgs, state))
+    {
+        return sample::gLogger.reportFail(batchTest);
+    }
+
+    std::vector<RunResult> results(jobs.size());
+    std::atomic<size_t> nextJob{0};
+    auto const runJobs = [&]() {
+        for (size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+        {
+            std::vector<char const*> argv{"trtexec"};
+            for (auto const& arg : jobs[i].arguments)
+            {
+                argv.push_back(arg.c_str());
+            }
+            auto jobTest = sample::gLogger.defineTest(kSAMPLE_NAME, static_cast<int32_t>(argv.size()), argv.data());
+            auto const start = std::chrono::steady_clock::now();
+            Arguments jobArgs = getJobArguments(jobs[i], commonArgs);
+            results[i].passed = runTrtexec(jobArgs, jobTest, state, &results[i]) == EXIT_SUCCESS;
+            results[i].walltimeMs
+                = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+    };
+
+    auto const start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < nbThreads; ++t)
+    {
+        threads.emplace_back(runJobs);
+    }
+    runJobs();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    float const walltimeMs
+        = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    sample::gLogInfo << std::endl;
+    sample::gLogInfo << "=== Batch job summary ===" << std::endl;
+    bool allPassed{true};
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+        auto const& r = results[i];
+        allPassed = allPassed && r.passed;
+        sample::gLogInfo << "Job at line " << jobs[i].line << ": " << (r.passed ? "PASSED" : "FAILED") << " in "
+                         << r.walltimeMs / 1000 << " s";
+        if (r.hasPerformance)
+        {
+            sample::gLogInfo << ", throughput = " << r.performance.throughput << " qps, mean latency = "
+                             << r.performance.latency.mean << " ms";
+        }
+        sample::gLogInfo << std::endl;
+    }
+    sample::gLogInfo << "Total walltime: " << walltimeMs / 1000 << " s" << std::endl;
+
+    if (!batchOptions.exportJobReport.empty())
+    {
+        exportJobReport(batchOptions, jobs, results, walltimeMs);
+    }
+    return allPassed ? sample::gLogger.reportPass(batchTest) : sample::gLogger.reportFail(batchTest);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto sampleTest = sample::gLogger.defineTest(kSAMPLE_NAME, argc, argv);
+    Arguments args = argsToArgumentsMap(argc, argv);
+    SharedRunState state;
+
+    BatchJobOptions batchOptions;
+    try
+    {
+        batchOptions.parse(args);
+    }
+    catch (std::invalid_argument const& arg)
+    {
+        sample::gLogger.reportTestStart(sampleTest);
+        AllOptions::help(std::cout);
+        sample::gLogError << arg.what() << std::endl;
+        return sample::gLogger.reportFail(sampleTest);
+    }
+
+    if (!batchOptions.jobFile.empty())
+    {
+        return runBatchJobs(batchOptions, args, sampleTest, state);
+    }
+    return runTrtexec(args, sampleTest, state, nullptr);
+}
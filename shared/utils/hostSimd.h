@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRT_SHARED_HOSTSIMD_H_
+#define TRT_SHARED_HOSTSIMD_H_
+
+#include <atomic>
+#include <cstdint>
+
+// Host SIMD kernels are compiled with function target attributes and selected at runtime with getHostSimdLevel().
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))                           \
+    && !defined(TRT_DISABLE_HOST_SIMD)
+#define TRT_HOST_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace nvinfer1::utils
+{
+
+enum class HostSimdLevel : int32_t
+{
+    kSCALAR,
+    kAVX2, //!< AVX2 with FMA and F16C
+    kAVX512
+};
+
+//! \brief Returns the widest instruction set the host kernels may use, kAVX512 unless lowered.
+inline std::atomic<HostSimdLevel>& maxHostSimdLevel()
+{
+    static std::atomic<HostSimdLevel> level{HostSimdLevel::kAVX512};
+    return level;
+}
+
+//! \brief Restricts the host kernels to the given instruction set, for example to compare them with the scalar code.
+inline void setMaxHostSimdLevel(HostSimdLevel level)
+{
+    maxHostSimdLevel() = level;
+}
+
+//! \brief Returns the widest instruction set supported by the CPU and allowed by setMaxHostSimdLevel().
+inline HostSimdLevel getHostSimdLevel()
+{
+#if TRT_HOST_X86_SIMD
+    static HostSimdLevel const supported = []() {
+        __builtin_cpu_init();
+        if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma") || !__builtin_cpu_supports("f16c"))
+        {
+            return HostSimdLevel::kSCALAR;
+        }
+        return __builtin_cpu_supports("avx512f") ? HostSimdLevel::kAVX512 : HostSimdLevel::kAVX2;
+    }();
+    HostSimdLevel const allowed = maxHostSimdLevel();
+    return static_cast<int32_t>(allowed) < static_cast<int32_t>(supported) ? allowed : supported;
+#else
+    return HostSimdLevel::kSCALAR;
+#endif
+}
+
+} // namespace nvinfer1::utils
+
+#endif // TRT_SHARED_HOSTSIMD_H_